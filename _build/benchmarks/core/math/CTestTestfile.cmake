@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks/core/math
+# Build directory: /root/repo/_build/benchmarks/core/math
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("linear_algebra")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_false_sharing.dir/benchmark_false_sharing.cpp.o"
+  "CMakeFiles/benchmark_false_sharing.dir/benchmark_false_sharing.cpp.o.d"
+  "benchmark_false_sharing"
+  "benchmark_false_sharing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_false_sharing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
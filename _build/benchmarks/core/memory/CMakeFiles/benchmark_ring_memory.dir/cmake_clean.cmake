@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_ring_memory.dir/benchmark_ring_memory.cpp.o"
+  "CMakeFiles/benchmark_ring_memory.dir/benchmark_ring_memory.cpp.o.d"
+  "benchmark_ring_memory"
+  "benchmark_ring_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_ring_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_tolerance_comparison.dir/benchmark_tolerance_comparison.cpp.o"
+  "CMakeFiles/benchmark_tolerance_comparison.dir/benchmark_tolerance_comparison.cpp.o.d"
+  "benchmark_tolerance_comparison"
+  "benchmark_tolerance_comparison.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_tolerance_comparison.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
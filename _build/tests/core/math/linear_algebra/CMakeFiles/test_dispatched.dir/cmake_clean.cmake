@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dispatched.dir/test_dispatched.cpp.o"
+  "CMakeFiles/test_dispatched.dir/test_dispatched.cpp.o.d"
+  "test_dispatched"
+  "test_dispatched.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dispatched.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
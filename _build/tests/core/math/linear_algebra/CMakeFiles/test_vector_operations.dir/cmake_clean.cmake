@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_operations.dir/test_vector_operations.cpp.o"
+  "CMakeFiles/test_vector_operations.dir/test_vector_operations.cpp.o.d"
+  "test_vector_operations"
+  "test_vector_operations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_operations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
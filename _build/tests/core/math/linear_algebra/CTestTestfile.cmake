@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/math/linear_algebra
+# Build directory: /root/repo/_build/tests/core/math/linear_algebra
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core::math::linear_algebra::determinant "test_determinant")
+set_tests_properties(core::math::linear_algebra::determinant PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/math/linear_algebra/CMakeLists.txt;1;add_mjolnir_core_test;/root/repo/tests/core/math/linear_algebra/CMakeLists.txt;0;")
+add_test(core::math::linear_algebra::dispatched "test_dispatched")
+set_tests_properties(core::math::linear_algebra::dispatched PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/math/linear_algebra/CMakeLists.txt;2;add_mjolnir_core_test;/root/repo/tests/core/math/linear_algebra/CMakeLists.txt;0;")
+add_test(core::math::linear_algebra::vector_operations "test_vector_operations")
+set_tests_properties(core::math::linear_algebra::vector_operations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/math/linear_algebra/CMakeLists.txt;4;add_mjolnir_core_test;/root/repo/tests/core/math/linear_algebra/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memory_system_allocator.dir/test_memory_system_allocator.cpp.o"
+  "CMakeFiles/test_memory_system_allocator.dir/test_memory_system_allocator.cpp.o.d"
+  "test_memory_system_allocator"
+  "test_memory_system_allocator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_system_allocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memory_system_deleter.dir/test_memory_system_deleter.cpp.o"
+  "CMakeFiles/test_memory_system_deleter.dir/test_memory_system_deleter.cpp.o.d"
+  "test_memory_system_deleter"
+  "test_memory_system_deleter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_system_deleter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ring_memory.dir/test_ring_memory.cpp.o"
+  "CMakeFiles/test_ring_memory.dir/test_ring_memory.cpp.o.d"
+  "test_ring_memory"
+  "test_ring_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ring_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/simd
+# Build directory: /root/repo/_build/tests/core/simd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core::simd::vec "test_vec")
+set_tests_properties(core::simd::vec PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/simd/CMakeLists.txt;1;add_mjolnir_core_test;/root/repo/tests/core/simd/CMakeLists.txt;0;")
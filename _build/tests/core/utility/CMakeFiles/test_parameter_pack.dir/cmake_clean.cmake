@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_parameter_pack.dir/test_parameter_pack.cpp.o"
+  "CMakeFiles/test_parameter_pack.dir/test_parameter_pack.cpp.o.d"
+  "test_parameter_pack"
+  "test_parameter_pack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_parameter_pack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_element_reduction.dir/test_element_reduction.cpp.o"
+  "CMakeFiles/test_element_reduction.dir/test_element_reduction.cpp.o.d"
+  "test_element_reduction"
+  "test_element_reduction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_element_reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
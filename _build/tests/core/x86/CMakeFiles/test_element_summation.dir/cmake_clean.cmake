@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_element_summation.dir/test_element_summation.cpp.o"
+  "CMakeFiles/test_element_summation.dir/test_element_summation.cpp.o.d"
+  "test_element_summation"
+  "test_element_summation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_element_summation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
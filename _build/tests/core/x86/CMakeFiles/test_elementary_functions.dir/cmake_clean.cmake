@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_elementary_functions.dir/test_elementary_functions.cpp.o"
+  "CMakeFiles/test_elementary_functions.dir/test_elementary_functions.cpp.o.d"
+  "test_elementary_functions"
+  "test_elementary_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_elementary_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
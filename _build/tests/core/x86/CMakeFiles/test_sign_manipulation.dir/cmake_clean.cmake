@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sign_manipulation.dir/test_sign_manipulation.cpp.o"
+  "CMakeFiles/test_sign_manipulation.dir/test_sign_manipulation.cpp.o.d"
+  "test_sign_manipulation"
+  "test_sign_manipulation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sign_manipulation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
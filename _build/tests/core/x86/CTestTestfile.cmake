@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/x86
+# Build directory: /root/repo/_build/tests/core/x86
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core::x86::array_reduction "test_array_reduction")
+set_tests_properties(core::x86::array_reduction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;1;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::bit_fields "test_bit_fields")
+set_tests_properties(core::x86::bit_fields PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;2;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::broadcast_load "test_broadcast_load")
+set_tests_properties(core::x86::broadcast_load PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;3;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::compaction "test_compaction")
+set_tests_properties(core::x86::compaction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;4;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::comparison "test_comparison")
+set_tests_properties(core::x86::comparison PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;5;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::direct_access "test_direct_access")
+set_tests_properties(core::x86::direct_access PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;6;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::dispatch "test_dispatch")
+set_tests_properties(core::x86::dispatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;7;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::element_reduction "test_element_reduction")
+set_tests_properties(core::x86::element_reduction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;8;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::elementary_functions "test_elementary_functions")
+set_tests_properties(core::x86::elementary_functions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;9;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::element_summation "test_element_summation")
+set_tests_properties(core::x86::element_summation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;10;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::intrinsics "test_intrinsics")
+set_tests_properties(core::x86::intrinsics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;11;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::permutation "test_permutation")
+set_tests_properties(core::x86::permutation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;12;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::rounding "test_rounding")
+set_tests_properties(core::x86::rounding PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;13;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::sign_manipulation "test_sign_manipulation")
+set_tests_properties(core::x86::sign_manipulation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;14;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::tolerance_comparison "test_tolerance_comparison")
+set_tests_properties(core::x86::tolerance_comparison PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;15;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
+add_test(core::x86::transposition "test_transposition")
+set_tests_properties(core::x86::transposition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/x86/CMakeLists.txt;16;add_mjolnir_core_test;/root/repo/tests/core/x86/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_new_delete_counter.dir/test_new_delete_counter.cpp.o"
+  "CMakeFiles/test_new_delete_counter.dir/test_new_delete_counter.cpp.o.d"
+  "test_new_delete_counter"
+  "test_new_delete_counter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_new_delete_counter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,187 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/benchmarks/core/CMakeLists.txt"
+  "/root/repo/benchmarks/core/math/CMakeLists.txt"
+  "/root/repo/benchmarks/core/math/linear_algebra/CMakeLists.txt"
+  "/root/repo/benchmarks/core/memory/CMakeLists.txt"
+  "/root/repo/benchmarks/core/simd/CMakeLists.txt"
+  "/root/repo/benchmarks/core/utility/CMakeLists.txt"
+  "/root/repo/benchmarks/core/x86/CMakeLists.txt"
+  "/root/repo/cmake/configure_core_module.cmake"
+  "/root/repo/cmake/dependencies/add_google_benchmark.cmake"
+  "/root/repo/cmake/dependencies/add_googletest.cmake"
+  "/root/repo/cmake/functions/add_generic_benchmark.cmake"
+  "/root/repo/cmake/functions/add_generic_executable.cmake"
+  "/root/repo/cmake/functions/add_generic_library.cmake"
+  "/root/repo/cmake/functions/add_generic_test.cmake"
+  "/root/repo/cmake/functions/add_mjolnir_benchmark.cmake"
+  "/root/repo/cmake/functions/add_mjolnir_core_benchmark.cmake"
+  "/root/repo/cmake/functions/add_mjolnir_core_test.cmake"
+  "/root/repo/cmake/functions/add_mjolnir_test.cmake"
+  "/root/repo/cmake/functions/add_to_list_after_keyword.cmake"
+  "/root/repo/cmake/functions/extract_mjolnir_version_number.cmake"
+  "/root/repo/cmake/functions/process_scopes.cmake"
+  "/root/repo/cmake/functions/target_apply_setup.cmake"
+  "/root/repo/cmake/include_cmake_functions.cmake"
+  "/root/repo/cmake/resolve_dependencies.cmake"
+  "/root/repo/src/mjolnir/core/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/core/CMakeLists.txt"
+  "/root/repo/tests/core/math/CMakeLists.txt"
+  "/root/repo/tests/core/math/linear_algebra/CMakeLists.txt"
+  "/root/repo/tests/core/memory/CMakeLists.txt"
+  "/root/repo/tests/core/simd/CMakeLists.txt"
+  "/root/repo/tests/core/utility/CMakeLists.txt"
+  "/root/repo/tests/core/x86/CMakeLists.txt"
+  "/root/repo/tests/testing/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-CXX.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/_CMakeLTOTest-CXX/src/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/foo.cpp"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/main.cpp"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mjolnir/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/math/linear_algebra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/simd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/x86/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/math/linear_algebra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/simd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/core/x86/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/DependInfo.cmake"
+  "tests/core/math/CMakeFiles/test_math.dir/DependInfo.cmake"
+  "tests/core/math/linear_algebra/CMakeFiles/test_determinant.dir/DependInfo.cmake"
+  "tests/core/math/linear_algebra/CMakeFiles/test_dispatched.dir/DependInfo.cmake"
+  "tests/core/math/linear_algebra/CMakeFiles/test_vector_operations.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_inline_linear_memory.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_linear_memory.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_memory_system_allocator.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_memory_system_deleter.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_memory_utility.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_offset_pointer.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_ring_memory.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_slab_memory.dir/DependInfo.cmake"
+  "tests/core/memory/CMakeFiles/test_mapped_file_memory.dir/DependInfo.cmake"
+  "tests/core/simd/CMakeFiles/test_vec.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_bit_operations.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_bitset.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_is_close.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_morton_code.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_parameter_pack.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_pointer_operations.dir/DependInfo.cmake"
+  "tests/core/utility/CMakeFiles/test_type.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_array_reduction.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_bit_fields.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_broadcast_load.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_compaction.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_comparison.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_direct_access.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_dispatch.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_element_reduction.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_elementary_functions.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_element_summation.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_intrinsics.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_permutation.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_rounding.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_sign_manipulation.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_tolerance_comparison.dir/DependInfo.cmake"
+  "tests/core/x86/CMakeFiles/test_transposition.dir/DependInfo.cmake"
+  "tests/testing/CMakeFiles/test_new_delete_counter.dir/DependInfo.cmake"
+  "benchmarks/core/math/linear_algebra/CMakeFiles/benchmark_determinant.dir/DependInfo.cmake"
+  "benchmarks/core/memory/CMakeFiles/benchmark_false_sharing.dir/DependInfo.cmake"
+  "benchmarks/core/memory/CMakeFiles/benchmark_memory_systems.dir/DependInfo.cmake"
+  "benchmarks/core/memory/CMakeFiles/benchmark_ring_memory.dir/DependInfo.cmake"
+  "benchmarks/core/memory/CMakeFiles/benchmark_mapped_file_memory.dir/DependInfo.cmake"
+  "benchmarks/core/simd/CMakeFiles/benchmark_vec.dir/DependInfo.cmake"
+  "benchmarks/core/utility/CMakeFiles/benchmark_bitset.dir/DependInfo.cmake"
+  "benchmarks/core/utility/CMakeFiles/benchmark_morton_code.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_array_reduction.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_bit_fields.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_broadcast_load.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_compaction.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_direct_access.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_element_reduction.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_elementary_functions.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_permutation.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_primitives.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_tolerance_comparison.dir/DependInfo.cmake"
+  "benchmarks/core/x86/CMakeFiles/benchmark_transposition.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks/core
+# Build directory: /root/repo/_build_avx512/benchmarks/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("math")
+subdirs("memory")
+subdirs("simd")
+subdirs("utility")
+subdirs("x86")
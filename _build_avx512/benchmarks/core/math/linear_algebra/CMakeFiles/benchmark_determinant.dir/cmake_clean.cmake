@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_determinant.dir/benchmark_determinant.cpp.o"
+  "CMakeFiles/benchmark_determinant.dir/benchmark_determinant.cpp.o.d"
+  "benchmark_determinant"
+  "benchmark_determinant.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_determinant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmarks/core/math/linear_algebra
+# Build directory: /root/repo/_build_avx512/benchmarks/core/math/linear_algebra
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_vec.dir/benchmark_vec.cpp.o"
+  "CMakeFiles/benchmark_vec.dir/benchmark_vec.cpp.o.d"
+  "benchmark_vec"
+  "benchmark_vec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_vec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
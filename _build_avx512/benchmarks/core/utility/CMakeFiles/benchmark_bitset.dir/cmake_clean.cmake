@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_bitset.dir/benchmark_bitset.cpp.o"
+  "CMakeFiles/benchmark_bitset.dir/benchmark_bitset.cpp.o.d"
+  "benchmark_bitset"
+  "benchmark_bitset.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_bitset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_morton_code.dir/benchmark_morton_code.cpp.o"
+  "CMakeFiles/benchmark_morton_code.dir/benchmark_morton_code.cpp.o.d"
+  "benchmark_morton_code"
+  "benchmark_morton_code.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_morton_code.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_bit_fields.dir/benchmark_bit_fields.cpp.o"
+  "CMakeFiles/benchmark_bit_fields.dir/benchmark_bit_fields.cpp.o.d"
+  "benchmark_bit_fields"
+  "benchmark_bit_fields.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_bit_fields.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
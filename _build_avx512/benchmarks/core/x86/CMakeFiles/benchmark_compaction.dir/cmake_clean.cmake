@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_compaction.dir/benchmark_compaction.cpp.o"
+  "CMakeFiles/benchmark_compaction.dir/benchmark_compaction.cpp.o.d"
+  "benchmark_compaction"
+  "benchmark_compaction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_compaction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
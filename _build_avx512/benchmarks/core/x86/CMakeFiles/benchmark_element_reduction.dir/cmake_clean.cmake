@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_element_reduction.dir/benchmark_element_reduction.cpp.o"
+  "CMakeFiles/benchmark_element_reduction.dir/benchmark_element_reduction.cpp.o.d"
+  "benchmark_element_reduction"
+  "benchmark_element_reduction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_element_reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_transposition.dir/benchmark_transposition.cpp.o"
+  "CMakeFiles/benchmark_transposition.dir/benchmark_transposition.cpp.o.d"
+  "benchmark_transposition"
+  "benchmark_transposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_transposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
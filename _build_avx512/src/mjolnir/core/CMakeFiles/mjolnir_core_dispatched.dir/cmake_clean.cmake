@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx2.cpp.o"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx2.cpp.o.d"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx512.cpp.o"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx512.cpp.o.d"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_scalar.cpp.o"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_scalar.cpp.o.d"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_sse4_2.cpp.o"
+  "CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_sse4_2.cpp.o.d"
+  "libmjolnir_core_dispatched.a"
+  "libmjolnir_core_dispatched.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mjolnir_core_dispatched.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_linear_memory.dir/test_linear_memory.cpp.o"
+  "CMakeFiles/test_linear_memory.dir/test_linear_memory.cpp.o.d"
+  "test_linear_memory"
+  "test_linear_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_linear_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
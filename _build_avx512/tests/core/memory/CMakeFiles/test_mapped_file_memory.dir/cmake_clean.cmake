@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mapped_file_memory.dir/test_mapped_file_memory.cpp.o"
+  "CMakeFiles/test_mapped_file_memory.dir/test_mapped_file_memory.cpp.o.d"
+  "test_mapped_file_memory"
+  "test_mapped_file_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mapped_file_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
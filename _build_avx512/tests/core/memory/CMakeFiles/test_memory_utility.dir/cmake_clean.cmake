@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memory_utility.dir/test_memory_utility.cpp.o"
+  "CMakeFiles/test_memory_utility.dir/test_memory_utility.cpp.o.d"
+  "test_memory_utility"
+  "test_memory_utility.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_utility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_offset_pointer.dir/test_offset_pointer.cpp.o"
+  "CMakeFiles/test_offset_pointer.dir/test_offset_pointer.cpp.o.d"
+  "test_offset_pointer"
+  "test_offset_pointer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_offset_pointer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/memory
+# Build directory: /root/repo/_build_avx512/tests/core/memory
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core::memory::inline_linear_memory "test_inline_linear_memory")
+set_tests_properties(core::memory::inline_linear_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;1;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::linear_memory "test_linear_memory")
+set_tests_properties(core::memory::linear_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;2;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::memory_system_allocator "test_memory_system_allocator")
+set_tests_properties(core::memory::memory_system_allocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;3;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::memory_system_deleter "test_memory_system_deleter")
+set_tests_properties(core::memory::memory_system_deleter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;4;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::memory_utility "test_memory_utility")
+set_tests_properties(core::memory::memory_utility PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;5;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::offset_pointer "test_offset_pointer")
+set_tests_properties(core::memory::offset_pointer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;6;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::ring_memory "test_ring_memory")
+set_tests_properties(core::memory::ring_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;7;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::slab_memory "test_slab_memory")
+set_tests_properties(core::memory::slab_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;8;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
+add_test(core::memory::mapped_file_memory "test_mapped_file_memory")
+set_tests_properties(core::memory::mapped_file_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/memory/CMakeLists.txt;11;add_mjolnir_core_test;/root/repo/tests/core/memory/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bit_operations.dir/test_bit_operations.cpp.o"
+  "CMakeFiles/test_bit_operations.dir/test_bit_operations.cpp.o.d"
+  "test_bit_operations"
+  "test_bit_operations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bit_operations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
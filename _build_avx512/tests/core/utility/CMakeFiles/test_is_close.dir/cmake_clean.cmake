@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_is_close.dir/test_is_close.cpp.o"
+  "CMakeFiles/test_is_close.dir/test_is_close.cpp.o.d"
+  "test_is_close"
+  "test_is_close.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_is_close.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
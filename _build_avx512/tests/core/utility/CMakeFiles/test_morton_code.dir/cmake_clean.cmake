@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_morton_code.dir/test_morton_code.cpp.o"
+  "CMakeFiles/test_morton_code.dir/test_morton_code.cpp.o.d"
+  "test_morton_code"
+  "test_morton_code.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_morton_code.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pointer_operations.dir/test_pointer_operations.cpp.o"
+  "CMakeFiles/test_pointer_operations.dir/test_pointer_operations.cpp.o.d"
+  "test_pointer_operations"
+  "test_pointer_operations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pointer_operations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
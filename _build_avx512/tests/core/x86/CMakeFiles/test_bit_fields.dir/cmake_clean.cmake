@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bit_fields.dir/test_bit_fields.cpp.o"
+  "CMakeFiles/test_bit_fields.dir/test_bit_fields.cpp.o.d"
+  "test_bit_fields"
+  "test_bit_fields.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bit_fields.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_broadcast_load.dir/test_broadcast_load.cpp.o"
+  "CMakeFiles/test_broadcast_load.dir/test_broadcast_load.cpp.o.d"
+  "test_broadcast_load"
+  "test_broadcast_load.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_broadcast_load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_rounding.dir/test_rounding.cpp.o"
+  "CMakeFiles/test_rounding.dir/test_rounding.cpp.o.d"
+  "test_rounding"
+  "test_rounding.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_rounding.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_transposition.dir/test_transposition.cpp.o"
+  "CMakeFiles/test_transposition.dir/test_transposition.cpp.o.d"
+  "test_transposition"
+  "test_transposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_transposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/testing
+# Build directory: /root/repo/_build_avx512/tests/testing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testing::new_delete_counter "test_new_delete_counter")
+set_tests_properties(testing::new_delete_counter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/testing/CMakeLists.txt;1;add_mjolnir_core_test;/root/repo/tests/testing/CMakeLists.txt;0;")
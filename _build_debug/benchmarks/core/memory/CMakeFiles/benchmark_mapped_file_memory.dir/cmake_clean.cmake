@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_mapped_file_memory.dir/benchmark_mapped_file_memory.cpp.o"
+  "CMakeFiles/benchmark_mapped_file_memory.dir/benchmark_mapped_file_memory.cpp.o.d"
+  "benchmark_mapped_file_memory"
+  "benchmark_mapped_file_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_mapped_file_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_memory_systems.dir/benchmark_memory_systems.cpp.o"
+  "CMakeFiles/benchmark_memory_systems.dir/benchmark_memory_systems.cpp.o.d"
+  "benchmark_memory_systems"
+  "benchmark_memory_systems.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_memory_systems.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_array_reduction.dir/benchmark_array_reduction.cpp.o"
+  "CMakeFiles/benchmark_array_reduction.dir/benchmark_array_reduction.cpp.o.d"
+  "benchmark_array_reduction"
+  "benchmark_array_reduction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_array_reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_broadcast_load.dir/benchmark_broadcast_load.cpp.o"
+  "CMakeFiles/benchmark_broadcast_load.dir/benchmark_broadcast_load.cpp.o.d"
+  "benchmark_broadcast_load"
+  "benchmark_broadcast_load.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_broadcast_load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_direct_access.dir/benchmark_direct_access.cpp.o"
+  "CMakeFiles/benchmark_direct_access.dir/benchmark_direct_access.cpp.o.d"
+  "benchmark_direct_access"
+  "benchmark_direct_access.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_direct_access.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_elementary_functions.dir/benchmark_elementary_functions.cpp.o"
+  "CMakeFiles/benchmark_elementary_functions.dir/benchmark_elementary_functions.cpp.o.d"
+  "benchmark_elementary_functions"
+  "benchmark_elementary_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_elementary_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_permutation.dir/benchmark_permutation.cpp.o"
+  "CMakeFiles/benchmark_permutation.dir/benchmark_permutation.cpp.o.d"
+  "benchmark_permutation"
+  "benchmark_permutation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_permutation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
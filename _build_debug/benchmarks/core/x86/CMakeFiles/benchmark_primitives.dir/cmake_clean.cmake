@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_primitives.dir/benchmark_primitives.cpp.o"
+  "CMakeFiles/benchmark_primitives.dir/benchmark_primitives.cpp.o.d"
+  "benchmark_primitives"
+  "benchmark_primitives.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_primitives.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/mjolnir/core/math/linear_algebra/dispatched_avx2.cpp" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx2.cpp.o" "gcc" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx2.cpp.o.d"
+  "/root/repo/src/mjolnir/core/math/linear_algebra/dispatched_avx512.cpp" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx512.cpp.o" "gcc" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_avx512.cpp.o.d"
+  "/root/repo/src/mjolnir/core/math/linear_algebra/dispatched_scalar.cpp" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_scalar.cpp.o" "gcc" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_scalar.cpp.o.d"
+  "/root/repo/src/mjolnir/core/math/linear_algebra/dispatched_sse4_2.cpp" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_sse4_2.cpp.o" "gcc" "src/mjolnir/core/CMakeFiles/mjolnir_core_dispatched.dir/math/linear_algebra/dispatched_sse4_2.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
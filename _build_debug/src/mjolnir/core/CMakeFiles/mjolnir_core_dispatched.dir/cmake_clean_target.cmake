@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libmjolnir_core_dispatched.a"
+)
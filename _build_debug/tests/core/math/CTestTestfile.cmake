@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/math
+# Build directory: /root/repo/_build_debug/tests/core/math
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core::math::math "test_math")
+set_tests_properties(core::math::math PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/math/CMakeLists.txt;2;add_mjolnir_core_test;/root/repo/tests/core/math/CMakeLists.txt;0;")
+subdirs("linear_algebra")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_slab_memory.dir/test_slab_memory.cpp.o"
+  "CMakeFiles/test_slab_memory.dir/test_slab_memory.cpp.o.d"
+  "test_slab_memory"
+  "test_slab_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_slab_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
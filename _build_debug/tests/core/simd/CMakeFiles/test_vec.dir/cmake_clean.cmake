@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vec.dir/test_vec.cpp.o"
+  "CMakeFiles/test_vec.dir/test_vec.cpp.o.d"
+  "test_vec"
+  "test_vec.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/utility
+# Build directory: /root/repo/_build_debug/tests/core/utility
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(core::utility::bit_operations "test_bit_operations")
+set_tests_properties(core::utility::bit_operations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;1;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
+add_test(core::utility::bitset "test_bitset")
+set_tests_properties(core::utility::bitset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;2;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
+add_test(core::utility::is_close "test_is_close")
+set_tests_properties(core::utility::is_close PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;3;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
+add_test(core::utility::morton_code "test_morton_code")
+set_tests_properties(core::utility::morton_code PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;4;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
+add_test(core::utility::parameter_pack "test_parameter_pack")
+set_tests_properties(core::utility::parameter_pack PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;5;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
+add_test(core::utility::pointer_operations "test_pointer_operations")
+set_tests_properties(core::utility::pointer_operations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;6;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
+add_test(core::utility::type "test_type")
+set_tests_properties(core::utility::type PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/functions/add_mjolnir_test.cmake;119;add_test;/root/repo/cmake/functions/add_mjolnir_core_test.cmake;69;add_mjolnir_test;/root/repo/tests/core/utility/CMakeLists.txt;7;add_mjolnir_core_test;/root/repo/tests/core/utility/CMakeLists.txt;0;")
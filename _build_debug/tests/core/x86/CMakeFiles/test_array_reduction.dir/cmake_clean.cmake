@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_array_reduction.dir/test_array_reduction.cpp.o"
+  "CMakeFiles/test_array_reduction.dir/test_array_reduction.cpp.o.d"
+  "test_array_reduction"
+  "test_array_reduction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_array_reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
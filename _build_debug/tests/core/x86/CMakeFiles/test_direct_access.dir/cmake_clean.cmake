@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_direct_access.dir/test_direct_access.cpp.o"
+  "CMakeFiles/test_direct_access.dir/test_direct_access.cpp.o.d"
+  "test_direct_access"
+  "test_direct_access.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_direct_access.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
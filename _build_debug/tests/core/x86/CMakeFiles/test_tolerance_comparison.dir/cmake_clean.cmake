@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tolerance_comparison.dir/test_tolerance_comparison.cpp.o"
+  "CMakeFiles/test_tolerance_comparison.dir/test_tolerance_comparison.cpp.o.d"
+  "test_tolerance_comparison"
+  "test_tolerance_comparison.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tolerance_comparison.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
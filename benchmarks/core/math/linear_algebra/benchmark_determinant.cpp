@@ -1,6 +1,8 @@
 #include "benchmark/benchmark.h"
 #include "mjolnir/core/math/linear_algebra/determinant.h"
+#include "mjolnir/core/math/linear_algebra/dispatched.h"
 #include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/dispatch.h"
 
 #include <algorithm>
 #include <array>
@@ -55,6 +57,37 @@ static void bm_determinant(benchmark::State& state)
 }
 
 
+template <Number T_Type, UST t_size, InstructionSetTier t_tier>
+static void bm_determinant_dispatched(benchmark::State& state)
+{
+    if (t_tier > get_supported_instruction_set_tier())
+    {
+        state.SkipWithError("Instruction set tier not supported.");
+        return;
+    }
+    force_instruction_set_tier(t_tier);
+
+    std::array<T_Type, t_size* t_size> data = {{0}};
+    benchmark::DoNotOptimize(data);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        T_Type res = 0.;
+
+        if constexpr (t_size == 2)
+            res = dispatched::determinant_2x2(data);
+        else if constexpr (t_size == 3)
+            res = dispatched::determinant_3x3(data);
+        else
+            res = dispatched::determinant_4x4(data);
+
+        std::ranges::fill(data, res);
+    }
+
+    reset_instruction_set_tier();
+}
+
+
 // --- benchmarks -----------------------------------------------------------------------------------------------------
 
 BENCHMARK(bm_determinant<F32, 2>)->Name("2x2 - F32");       // NOLINT
@@ -77,4 +110,10 @@ BENCHMARK(bm_determinant<__m256d, 4>)->Name("4x4 - m256d"); // NOLINT
 BENCHMARK(bm_determinant<__m256, 4>)->Name("4x4 - m256");   // NOLINT
 
 
+BENCHMARK(bm_determinant_dispatched<F32, 4, InstructionSetTier::SCALAR>)->Name("4x4 - F32 - scalar tier"); // NOLINT
+BENCHMARK(bm_determinant_dispatched<F32, 4, InstructionSetTier::AVX2>)->Name("4x4 - F32 - AVX2 tier");     // NOLINT
+BENCHMARK(bm_determinant_dispatched<F64, 4, InstructionSetTier::SCALAR>)->Name("4x4 - F64 - scalar tier"); // NOLINT
+BENCHMARK(bm_determinant_dispatched<F64, 4, InstructionSetTier::AVX2>)->Name("4x4 - F64 - AVX2 tier");     // NOLINT
+
+
 BENCHMARK_MAIN(); // NOLINT
@@ -0,0 +1,88 @@
+#include "mjolnir/core/definitions.h"
+#include "mjolnir/core/memory/linear_memory.h"
+#include "mjolnir/core/memory/utility.h"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+using namespace mjolnir;
+
+using Counter = std::atomic<U64>;
+
+constexpr UST memory_size    = 1U << 16U;
+constexpr UST num_increments = 100000;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! @brief
+//! Let each thread increment its own counter and return the number of performed increments.
+auto increment_counters(const std::vector<Counter*>& counters) -> U64
+{
+    std::vector<std::thread> threads;
+    threads.reserve(counters.size());
+
+    for (Counter* counter : counters)
+        threads.emplace_back(
+                [counter]()
+                {
+                    for (UST i = 0; i < num_increments; ++i)
+                        counter->fetch_add(1, std::memory_order_relaxed);
+                });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    U64 sum = 0;
+    for (Counter* counter : counters)
+        sum += counter->exchange(0, std::memory_order_relaxed);
+    return sum;
+}
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+void bm_counters_packed(benchmark::State& state)
+{
+    auto num_threads = static_cast<UST>(state.range(0));
+
+    auto mem = LinearMemory();
+    mem.initialize(memory_size);
+
+    std::vector<Counter*> counters(num_threads);
+    for (auto& counter : counters)
+        counter = mem.allocate_construct<Counter>(0);
+
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(increment_counters(counters));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_threads * num_increments));
+}
+
+
+void bm_counters_cache_isolated(benchmark::State& state)
+{
+    auto num_threads = static_cast<UST>(state.range(0));
+
+    auto mem = LinearMemory();
+    mem.initialize(memory_size);
+
+    std::vector<Counter*> counters(num_threads);
+    for (auto& counter : counters)
+        counter = allocate_construct_cache_isolated<Counter>(mem, 0);
+
+    for ([[maybe_unused]] auto _ : state)
+        benchmark::DoNotOptimize(increment_counters(counters));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_threads * num_increments));
+}
+
+
+// --- register benchmarks --------------------------------------------------------------------------------------------
+
+BENCHMARK(bm_counters_packed)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Name("packed");                 // NOLINT
+BENCHMARK(bm_counters_cache_isolated)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Name("cache isolated"); // NOLINT
+BENCHMARK_MAIN();                                                                                              // NOLINT
@@ -0,0 +1,212 @@
+#include "mjolnir/core/definitions.h"
+#include "mjolnir/core/memory/mapped_file_memory.h"
+#include "mjolnir/core/memory/offset_pointer.h"
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+
+using namespace mjolnir;
+
+constexpr UST num_records = 100000;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! @brief
+//! Record that is stored in the snapshot
+struct Record
+{
+    U64 id       = {0};
+    F64 position = {0};
+    F64 velocity = {0};
+    U32 flags    = {0};
+};
+
+
+//! @brief
+//! Root object of the snapshot inside the mapped memory
+struct Snapshot
+{
+    OffsetPointer<Record> records     = {};
+    UST                   num_records = {0};
+};
+
+
+auto get_snapshot_path(const std::string& name) -> std::filesystem::path
+{
+    return std::filesystem::temp_directory_path() / ("mjolnir_benchmark_snapshot_" + name);
+}
+
+
+auto get_memory_size() -> UST
+{
+    return sizeof(Snapshot) + num_records * sizeof(Record) + alignof(Record);
+}
+
+
+void fill_records(Record* records)
+{
+    for (UST i = 0; i < num_records; ++i)
+        records[i] = {i, static_cast<F64>(i), 0.5, static_cast<U32>(i % 7)}; // NOLINT
+}
+
+
+auto sum_records(const Record* records, UST size) -> F64
+{
+    F64 sum = 0;
+    for (UST i = 0; i < size; ++i)
+        sum += records[i].position + static_cast<F64>(records[i].id); // NOLINT
+    return sum;
+}
+
+
+// --- MappedFileMemory -----------------------------------------------------------------------------------------------
+
+void bm_save_mapped_file(benchmark::State& state)
+{
+    auto path = get_snapshot_path("save_mapped");
+    std::filesystem::remove(path);
+
+    auto mem = MappedFileMemory();
+    mem.initialize(path, get_memory_size());
+
+    auto* snapshot        = mem.allocate_construct<Snapshot>();
+    auto* records         = static_cast<Record*>(mem.allocate(num_records * sizeof(Record), alignof(Record)));
+    snapshot->records     = records;
+    snapshot->num_records = num_records;
+    mem.set_root(snapshot);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        fill_records(records);
+        mem.sync();
+    }
+
+    mem.deinitialize();
+    std::filesystem::remove(path);
+}
+
+
+void bm_load_mapped_file(benchmark::State& state)
+{
+    auto path = get_snapshot_path("load_mapped");
+    std::filesystem::remove(path);
+    {
+        auto mem = MappedFileMemory();
+        mem.initialize(path, get_memory_size());
+
+        auto* snapshot        = mem.allocate_construct<Snapshot>();
+        auto* records         = static_cast<Record*>(mem.allocate(num_records * sizeof(Record), alignof(Record)));
+        snapshot->records     = records;
+        snapshot->num_records = num_records;
+        fill_records(records);
+        mem.set_root(snapshot);
+        mem.deinitialize();
+    }
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto mem = MappedFileMemory();
+        mem.initialize(path, get_memory_size());
+
+        auto* snapshot = mem.get_root<Snapshot>();
+        if (snapshot == nullptr)
+        {
+            state.SkipWithError("Snapshot not found");
+            break;
+        }
+        benchmark::DoNotOptimize(sum_records(snapshot->records.get(), snapshot->num_records));
+
+        mem.deinitialize();
+    }
+
+    std::filesystem::remove(path);
+}
+
+
+// --- stream serialization -------------------------------------------------------------------------------------------
+
+void bm_save_serialization(benchmark::State& state)
+{
+    auto path = get_snapshot_path("save_serialization");
+
+    std::vector<Record> records(num_records);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        fill_records(records.data());
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            UST           size = records.size();
+            file.write(reinterpret_cast<const char*>(&size), sizeof(size)); // NOLINT
+            for (const auto& record : records)
+            {
+                file.write(reinterpret_cast<const char*>(&record.id), sizeof(record.id));             // NOLINT
+                file.write(reinterpret_cast<const char*>(&record.position), sizeof(record.position)); // NOLINT
+                file.write(reinterpret_cast<const char*>(&record.velocity), sizeof(record.velocity)); // NOLINT
+                file.write(reinterpret_cast<const char*>(&record.flags), sizeof(record.flags));       // NOLINT
+            }
+        }
+
+        // Flush the file to the storage device to match the guarantee of `MappedFileMemory::sync`
+        int file_descriptor = open(path.c_str(), O_WRONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        fsync(file_descriptor);
+        close(file_descriptor);
+    }
+
+    std::filesystem::remove(path);
+}
+
+
+void bm_load_serialization(benchmark::State& state)
+{
+    auto path = get_snapshot_path("load_serialization");
+    {
+        std::vector<Record> records(num_records);
+        fill_records(records.data());
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        UST           size = records.size();
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size)); // NOLINT
+        for (const auto& record : records)
+        {
+            file.write(reinterpret_cast<const char*>(&record.id), sizeof(record.id));             // NOLINT
+            file.write(reinterpret_cast<const char*>(&record.position), sizeof(record.position)); // NOLINT
+            file.write(reinterpret_cast<const char*>(&record.velocity), sizeof(record.velocity)); // NOLINT
+            file.write(reinterpret_cast<const char*>(&record.flags), sizeof(record.flags));       // NOLINT
+        }
+    }
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::ifstream file(path, std::ios::binary);
+        UST           size = 0;
+        file.read(reinterpret_cast<char*>(&size), sizeof(size)); // NOLINT
+
+        std::vector<Record> records(size);
+        for (auto& record : records)
+        {
+            file.read(reinterpret_cast<char*>(&record.id), sizeof(record.id));             // NOLINT
+            file.read(reinterpret_cast<char*>(&record.position), sizeof(record.position)); // NOLINT
+            file.read(reinterpret_cast<char*>(&record.velocity), sizeof(record.velocity)); // NOLINT
+            file.read(reinterpret_cast<char*>(&record.flags), sizeof(record.flags));       // NOLINT
+        }
+        benchmark::DoNotOptimize(sum_records(records.data(), records.size()));
+    }
+
+    std::filesystem::remove(path);
+}
+
+
+// --- register benchmarks --------------------------------------------------------------------------------------------
+
+BENCHMARK(bm_save_mapped_file)->Unit(benchmark::kMicrosecond)->Name("save snapshot - MappedFileMemory"); // NOLINT
+BENCHMARK(bm_save_serialization)->Unit(benchmark::kMicrosecond)->Name("save snapshot - serialization");  // NOLINT
+BENCHMARK(bm_load_mapped_file)->Unit(benchmark::kMicrosecond)->Name("load snapshot - MappedFileMemory"); // NOLINT
+BENCHMARK(bm_load_serialization)->Unit(benchmark::kMicrosecond)->Name("load snapshot - serialization");  // NOLINT
+BENCHMARK_MAIN();                                                                                        // NOLINT
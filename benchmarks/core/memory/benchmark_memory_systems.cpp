@@ -1,4 +1,5 @@
 #include "mjolnir/core/definitions.h"
+#include "mjolnir/core/memory/inline_linear_memory.h"
 #include "mjolnir/core/memory/linear_memory.h"
 #include <benchmark/benchmark.h>
 
@@ -10,6 +11,7 @@ using namespace mjolnir;
 
 constexpr UST memory_size     = 10000000;
 constexpr UST num_allocations = 10;
+constexpr UST inline_size     = 8192;
 
 auto get_allocation_sizes() -> std::array<UST, num_allocations>
 {
@@ -98,6 +100,38 @@ void bm_deallocate_10_fifo(benchmark::State& state)
 }
 
 
+// --- InlineLinearMemory ---------------------------------------------------------------------------------------------
+
+void bm_allocate_10_inline(benchmark::State& state)
+{
+    auto mem = InlineLinearMemory<inline_size>();
+
+    std::array<void*, num_allocations> mem_ptr    = {{nullptr}};
+    auto                               alloc_size = get_allocation_sizes();
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (UST i = 0; i < num_allocations; ++i)
+            mem_ptr[i] = mem.allocate(alloc_size[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        benchmark::ClobberMemory();
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        for (UST i = 0; i < num_allocations; ++i)
+            mem.deallocate(mem_ptr[i], alloc_size[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        mem.reset();
+
+
+        auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    benchmark::DoNotOptimize(mem_ptr);
+}
+
+
 // --- malloc/free ----------------------------------------------------------------------------------------------------
 
 void bm_allocate_10_malloc(benchmark::State& state)
@@ -160,6 +194,7 @@ void bm_deallocate_10_free_fifo(benchmark::State& state)
 
 BENCHMARK(bm_timing_baseline)->UseManualTime()->Name("baseline");                                  // NOLINT
 BENCHMARK(bm_allocate_10)->UseManualTime()->Name("10 allocations - LinearMemory");                 // NOLINT
+BENCHMARK(bm_allocate_10_inline)->UseManualTime()->Name("10 allocations - InlineLinearMemory");    // NOLINT
 BENCHMARK(bm_allocate_10_malloc)->UseManualTime()->Name("10 allocations - malloc");                // NOLINT
 BENCHMARK(bm_deallocate_10_fifo)->UseManualTime()->Name("10 deallocations (fifo) - LinearMemory"); // NOLINT
 BENCHMARK(bm_deallocate_10_free_fifo)->UseManualTime()->Name("10 deallocations (fifo) - free");    // NOLINT
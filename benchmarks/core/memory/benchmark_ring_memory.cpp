@@ -0,0 +1,223 @@
+#include "mjolnir/core/definitions.h"
+#include "mjolnir/core/memory/ring_memory.h"
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+using namespace mjolnir;
+
+constexpr UST memory_size  = 1U << 16U;
+constexpr UST num_messages = 10000;
+constexpr UST num_inflight = 64;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! @brief
+//! Message that is passed from the producer to the consumer
+struct Message
+{
+    U64                  id      = {0};
+    std::array<U8, 120> payload = {{0}};
+};
+
+
+//! @brief
+//! Minimal single-producer single-consumer pointer queue for the threaded benchmarks.
+class PointerQueue
+{
+public:
+    auto try_push(Message* message) noexcept -> bool
+    {
+        UST head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == capacity)
+            return false;
+
+        m_buffer.at(head % capacity) = message;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto try_pop() noexcept -> Message*
+    {
+        UST tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        Message* message = m_buffer.at(tail % capacity);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return message;
+    }
+
+private:
+    static constexpr UST capacity = 256;
+
+    std::array<Message*, capacity> m_buffer = {};
+    alignas(64) std::atomic<UST> m_head     = {0}; // NOLINT(readability-magic-numbers)
+    alignas(64) std::atomic<UST> m_tail     = {0}; // NOLINT(readability-magic-numbers)
+};
+
+
+// --- single thread --------------------------------------------------------------------------------------------------
+
+void bm_fifo_ring_memory(benchmark::State& state)
+{
+    auto mem = RingMemory();
+    mem.initialize(memory_size);
+
+    std::array<Message*, num_inflight> inflight = {};
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (UST i = 0; i < num_messages; ++i)
+        {
+            auto& slot = inflight.at(i % num_inflight);
+            if (slot != nullptr)
+            {
+                benchmark::DoNotOptimize(slot->id);
+                mem.destroy_deallocate(slot);
+            }
+            slot = mem.allocate_construct<Message>();
+            slot->id = i;
+        }
+        for (auto& slot : inflight)
+        {
+            mem.destroy_deallocate(slot);
+            slot = nullptr;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_messages));
+}
+
+
+void bm_fifo_deque(benchmark::State& state)
+{
+    std::deque<std::unique_ptr<Message>> queue;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (UST i = 0; i < num_messages; ++i)
+        {
+            if (queue.size() == num_inflight)
+            {
+                benchmark::DoNotOptimize(queue.front()->id);
+                queue.pop_front();
+            }
+            queue.push_back(std::make_unique<Message>());
+            queue.back()->id = i;
+        }
+        queue.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_messages));
+}
+
+
+// --- producer and consumer threads ----------------------------------------------------------------------------------
+
+void bm_spsc_ring_memory(benchmark::State& state)
+{
+    auto mem = RingMemory<true>();
+    mem.initialize(memory_size);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        PointerQueue queue;
+
+        std::thread consumer(
+                [&]()
+                {
+                    for (UST i = 0; i < num_messages; ++i)
+                    {
+                        Message* message = nullptr;
+                        while ((message = queue.try_pop()) == nullptr)
+                            std::this_thread::yield();
+
+                        benchmark::DoNotOptimize(message->id);
+                        mem.destroy_deallocate(message);
+                    }
+                });
+
+        for (UST i = 0; i < num_messages; ++i)
+        {
+            Message* message = nullptr;
+            while (message == nullptr)
+            {
+                try
+                {
+                    message = mem.allocate_construct<Message>();
+                }
+                catch (const AllocationError&)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            message->id = i;
+
+            while (! queue.try_push(message))
+                std::this_thread::yield();
+        }
+
+        consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_messages));
+}
+
+
+void bm_spsc_deque(benchmark::State& state)
+{
+    for ([[maybe_unused]] auto _ : state)
+    {
+        std::mutex                           mutex;
+        std::deque<std::unique_ptr<Message>> queue;
+
+        std::thread consumer(
+                [&]()
+                {
+                    for (UST i = 0; i < num_messages; ++i)
+                    {
+                        std::unique_ptr<Message> message;
+                        while (! message)
+                        {
+                            {
+                                std::lock_guard lock(mutex);
+                                if (! queue.empty())
+                                {
+                                    message = std::move(queue.front());
+                                    queue.pop_front();
+                                }
+                            }
+                            if (! message)
+                                std::this_thread::yield();
+                        }
+                        benchmark::DoNotOptimize(message->id);
+                    }
+                });
+
+        for (UST i = 0; i < num_messages; ++i)
+        {
+            auto message = std::make_unique<Message>();
+            message->id  = i;
+
+            std::lock_guard lock(mutex);
+            queue.push_back(std::move(message));
+        }
+
+        consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_messages));
+}
+
+
+// --- register benchmarks --------------------------------------------------------------------------------------------
+
+BENCHMARK(bm_fifo_ring_memory)->Name("FIFO - RingMemory");                            // NOLINT
+BENCHMARK(bm_fifo_deque)->Name("FIFO - std::deque");                                  // NOLINT
+BENCHMARK(bm_spsc_ring_memory)->UseRealTime()->Name("SPSC - RingMemory (lock-free)"); // NOLINT
+BENCHMARK(bm_spsc_deque)->UseRealTime()->Name("SPSC - std::deque (mutex)");           // NOLINT
+BENCHMARK_MAIN();                                                                     // NOLINT
@@ -0,0 +1,81 @@
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/simd/vec.h"
+#include "mjolnir/core/x86/element_summation.h"
+#include "mjolnir/core/x86/intrinsics.h"
+
+#include <array>
+#include <memory>
+
+using namespace mjolnir;
+using namespace mjolnir::simd;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_values = 4096;
+
+
+//! Dot product that is written once for all `Vec` backends.
+template <typename T_VecType>
+[[nodiscard]] auto dot_product(const typename T_VecType::ValueType* a, const typename T_VecType::ValueType* b) noexcept
+        -> typename T_VecType::ValueType
+{
+    auto sum = T_VecType::zero();
+    for (UST i = 0; i < num_values; i += T_VecType::num_elements)
+        sum = fmadd(T_VecType::load(a + i), T_VecType::load(b + i), sum); // NOLINT - pointer arithmetic
+    return element_sum(sum);
+}
+
+
+//! Dot product that uses the register wrappers directly.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto dot_product(const ElementType<T_RegisterType>* a, const ElementType<T_RegisterType>* b) noexcept
+        -> ElementType<T_RegisterType>
+{
+    auto sum = mm_setzero<T_RegisterType>();
+    for (UST i = 0; i < num_values; i += num_elements<T_RegisterType>)
+        sum = mm_fmadd(mm_load<T_RegisterType>(a + i), mm_load<T_RegisterType>(b + i), sum); // NOLINT
+    return element_sum(sum);
+}
+
+
+//! Aligned array with `num_values` elements.
+template <typename T_Type>
+struct AlignedValues
+{
+    alignas(alignment_bytes<__m256>) std::array<T_Type, num_values> values = {{0}};
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Type, typename T_Implementation>
+static void bm_dot_product(benchmark::State& state)
+{
+    auto a = std::make_unique<AlignedValues<T_Type>>();
+    auto b = std::make_unique<AlignedValues<T_Type>>();
+    for (UST i = 0; i < num_values; ++i)
+    {
+        a->values.at(i) = static_cast<T_Type>(i % 7);  // NOLINT(readability-magic-numbers)
+        b->values.at(i) = static_cast<T_Type>(i % 13); // NOLINT(readability-magic-numbers)
+    }
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(a->values);
+        benchmark::DoNotOptimize(b->values);
+        benchmark::DoNotOptimize(dot_product<T_Implementation>(a->values.data(), b->values.data()));
+    }
+}
+
+
+BENCHMARK(bm_dot_product<F32, __m256>)->Name("F32 - m256");                            // NOLINT
+BENCHMARK(bm_dot_product<F32, Vec<F32, 8, Backend::X86>>)->Name("F32 - Vec X86");       // NOLINT
+BENCHMARK(bm_dot_product<F32, Vec<F32, 8, Backend::SCALAR>>)->Name("F32 - Vec scalar"); // NOLINT
+BENCHMARK(bm_dot_product<F64, __m256d>)->Name("F64 - m256d");                          // NOLINT
+BENCHMARK(bm_dot_product<F64, Vec<F64, 4, Backend::X86>>)->Name("F64 - Vec X86");       // NOLINT
+BENCHMARK(bm_dot_product<F64, Vec<F64, 4, Backend::SCALAR>>)->Name("F64 - Vec scalar"); // NOLINT
+
+
+BENCHMARK_MAIN(); // NOLINT
@@ -0,0 +1,115 @@
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/utility/bitset.h"
+
+#include <bitset>
+
+using namespace mjolnir;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! Number of bits of the benchmarked bitsets
+constexpr UST bitset_size = 1 << 16;
+
+//! Every `sparse_stride`-th bit is set in the sparse test pattern
+constexpr UST sparse_stride = 997;
+
+
+//! Set every `stride`-th bit of `bitset`.
+template <typename T_Bitset>
+void set_every_nth_bit(T_Bitset& bitset, UST stride)
+{
+    for (UST i = 0; i < bitset_size; i += stride)
+        bitset.set(i);
+}
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Bitset>
+static void bm_and(benchmark::State& state)
+{
+    T_Bitset lhs;
+    T_Bitset rhs;
+    set_every_nth_bit(lhs, 3);
+    set_every_nth_bit(rhs, 5);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(lhs &= rhs);
+        benchmark::ClobberMemory();
+    }
+}
+
+
+template <typename T_Bitset>
+static void bm_any(benchmark::State& state)
+{
+    T_Bitset bitset;
+    bitset.set(bitset_size - 1);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(&bitset);
+        benchmark::DoNotOptimize(bitset.any());
+    }
+}
+
+
+template <typename T_Bitset>
+static void bm_count(benchmark::State& state)
+{
+    T_Bitset bitset;
+    set_every_nth_bit(bitset, 3);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(&bitset);
+        benchmark::DoNotOptimize(bitset.count());
+    }
+}
+
+
+static void bm_for_each_set_bit_std(benchmark::State& state)
+{
+    std::bitset<bitset_size> bitset;
+    set_every_nth_bit(bitset, sparse_stride);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        UST sum = 0;
+        for (UST i = 0; i < bitset_size; ++i)
+            if (bitset.test(i))
+                sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+
+static void bm_for_each_set_bit_mjolnir(benchmark::State& state)
+{
+    StaticBitset<bitset_size> bitset;
+    set_every_nth_bit(bitset, sparse_stride);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        UST sum = 0;
+        bitset.for_each_set_bit([&sum](UST index) { sum += index; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+
+// clang-format off
+BENCHMARK(bm_and<std::bitset<bitset_size>>)->Name("and - std::bitset");          // NOLINT
+BENCHMARK(bm_and<StaticBitset<bitset_size>>)->Name("and - StaticBitset");        // NOLINT
+BENCHMARK(bm_any<std::bitset<bitset_size>>)->Name("any - std::bitset");          // NOLINT
+BENCHMARK(bm_any<StaticBitset<bitset_size>>)->Name("any - StaticBitset");        // NOLINT
+BENCHMARK(bm_count<std::bitset<bitset_size>>)->Name("count - std::bitset");      // NOLINT
+BENCHMARK(bm_count<StaticBitset<bitset_size>>)->Name("count - StaticBitset");    // NOLINT
+BENCHMARK(bm_for_each_set_bit_std)->Name("for_each_set_bit - std::bitset");      // NOLINT
+BENCHMARK(bm_for_each_set_bit_mjolnir)->Name("for_each_set_bit - StaticBitset"); // NOLINT
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
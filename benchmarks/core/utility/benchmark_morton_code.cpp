@@ -0,0 +1,218 @@
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/utility/morton_code.h"
+
+#include <vector>
+
+using namespace mjolnir;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! Number of encoded or decoded coordinates per benchmark iteration
+constexpr UST num_coordinates = 1 << 12;
+
+
+//! Return `size` pseudo random coordinates.
+[[nodiscard]] auto get_coordinates(UST size) -> std::vector<U32>
+{
+    std::vector<U32> coordinates(size);
+
+    U64 state = 1;
+    for (auto& coordinate : coordinates)
+    {
+        state      = state * 6364136223846793005U + 1442695040888963407U; // NOLINT(*-magic-numbers)
+        coordinate = static_cast<U32>(state >> 43U);
+    }
+    return coordinates;
+}
+
+
+// --- encoders and decoders ------------------------------------------------------------------------------------------
+
+//! Uses the public functions, which select `pdep`/`pext` if BMI2 is enabled and shifts and masks otherwise
+struct Default
+{
+    static auto encode_2d(U32 x, U32 y) noexcept -> U64
+    {
+        return morton_encode_2d(x, y);
+    }
+
+    static auto encode_3d(U32 x, U32 y, U32 z) noexcept -> U64
+    {
+        return morton_encode_3d(x, y, z);
+    }
+
+    static auto decode_2d(U64 code) noexcept -> U32
+    {
+        auto xy = morton_decode_2d(code);
+        return xy[0] ^ xy[1];
+    }
+
+    static auto decode_3d(U64 code) noexcept -> U32
+    {
+        auto xyz = morton_decode_3d(code);
+        return xyz[0] ^ xyz[1] ^ xyz[2];
+    }
+};
+
+
+//! Uses fixed sequences of shifts and masks
+struct MagicBits
+{
+    static auto encode_2d(U32 x, U32 y) noexcept -> U64
+    {
+        return internal::morton_spread_bits_2d(x) | (internal::morton_spread_bits_2d(y) << 1U);
+    }
+
+    static auto encode_3d(U32 x, U32 y, U32 z) noexcept -> U64
+    {
+        using namespace internal;
+        return morton_spread_bits_3d(x) | (morton_spread_bits_3d(y) << 1U) | (morton_spread_bits_3d(z) << 2U);
+    }
+
+    static auto decode_2d(U64 code) noexcept -> U32
+    {
+        return internal::morton_compact_bits_2d(code) ^ internal::morton_compact_bits_2d(code >> 1U);
+    }
+
+    static auto decode_3d(U64 code) noexcept -> U32
+    {
+        using namespace internal;
+        return morton_compact_bits_3d(code) ^ morton_compact_bits_3d(code >> 1U) ^ morton_compact_bits_3d(code >> 2U);
+    }
+};
+
+
+//! Uses the software implementations of `deposit_bits` and `extract_bits`
+struct SoftwareDeposit
+{
+    static auto encode_2d(U32 x, U32 y) noexcept -> U64
+    {
+        using namespace internal;
+        return deposit_bits_software(U64{x}, morton_2d_mask) | deposit_bits_software(U64{y}, morton_2d_mask << 1U);
+    }
+
+    static auto encode_3d(U32 x, U32 y, U32 z) noexcept -> U64
+    {
+        using namespace internal;
+        return deposit_bits_software(U64{x}, morton_3d_mask) | deposit_bits_software(U64{y}, morton_3d_mask << 1U)
+               | deposit_bits_software(U64{z}, morton_3d_mask << 2U);
+    }
+
+    static auto decode_2d(U64 code) noexcept -> U32
+    {
+        using namespace internal;
+        return static_cast<U32>(extract_bits_software(code, morton_2d_mask)
+                                ^ extract_bits_software(code, morton_2d_mask << 1U));
+    }
+
+    static auto decode_3d(U64 code) noexcept -> U32
+    {
+        using namespace internal;
+        return static_cast<U32>(extract_bits_software(code, morton_3d_mask)
+                                ^ extract_bits_software(code, morton_3d_mask << 1U)
+                                ^ extract_bits_software(code, morton_3d_mask << 2U));
+    }
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Implementation>
+static void bm_encode_2d(benchmark::State& state)
+{
+    const auto       coordinates = get_coordinates(2 * num_coordinates);
+    std::vector<U64> codes(num_coordinates);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        for (UST i = 0; i < num_coordinates; ++i)
+            codes[i] = T_Implementation::encode_2d(coordinates[2 * i], coordinates[2 * i + 1]);
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_coordinates));
+    state.SetLabel(is_bmi2_enabled ? "BMI2" : "no BMI2");
+}
+
+
+template <typename T_Implementation>
+static void bm_encode_3d(benchmark::State& state)
+{
+    const auto       coordinates = get_coordinates(3 * num_coordinates);
+    std::vector<U64> codes(num_coordinates);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        for (UST i = 0; i < num_coordinates; ++i)
+            codes[i] = T_Implementation::encode_3d(
+                    coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]);
+        benchmark::DoNotOptimize(codes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_coordinates));
+    state.SetLabel(is_bmi2_enabled ? "BMI2" : "no BMI2");
+}
+
+
+template <typename T_Implementation>
+static void bm_decode_2d(benchmark::State& state)
+{
+    std::vector<U64> codes(num_coordinates);
+    std::vector<U32> results(num_coordinates);
+
+    const auto coordinates = get_coordinates(2 * num_coordinates);
+    for (UST i = 0; i < num_coordinates; ++i)
+        codes[i] = morton_encode_2d(coordinates[2 * i], coordinates[2 * i + 1]);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        for (UST i = 0; i < num_coordinates; ++i)
+            results[i] = T_Implementation::decode_2d(codes[i]);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_coordinates));
+    state.SetLabel(is_bmi2_enabled ? "BMI2" : "no BMI2");
+}
+
+
+template <typename T_Implementation>
+static void bm_decode_3d(benchmark::State& state)
+{
+    std::vector<U64> codes(num_coordinates);
+    std::vector<U32> results(num_coordinates);
+
+    const auto coordinates = get_coordinates(3 * num_coordinates);
+    for (UST i = 0; i < num_coordinates; ++i)
+        codes[i] = morton_encode_3d(coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2]);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        for (UST i = 0; i < num_coordinates; ++i)
+            results[i] = T_Implementation::decode_3d(codes[i]);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_coordinates));
+    state.SetLabel(is_bmi2_enabled ? "BMI2" : "no BMI2");
+}
+
+
+// clang-format off
+BENCHMARK(bm_encode_2d<Default>)->Name("encode 2d - default");                     // NOLINT
+BENCHMARK(bm_encode_2d<MagicBits>)->Name("encode 2d - magic bits");                // NOLINT
+BENCHMARK(bm_encode_2d<SoftwareDeposit>)->Name("encode 2d - software deposit");    // NOLINT
+BENCHMARK(bm_encode_3d<Default>)->Name("encode 3d - default");                     // NOLINT
+BENCHMARK(bm_encode_3d<MagicBits>)->Name("encode 3d - magic bits");                // NOLINT
+BENCHMARK(bm_encode_3d<SoftwareDeposit>)->Name("encode 3d - software deposit");    // NOLINT
+BENCHMARK(bm_decode_2d<Default>)->Name("decode 2d - default");                     // NOLINT
+BENCHMARK(bm_decode_2d<MagicBits>)->Name("decode 2d - magic bits");                // NOLINT
+BENCHMARK(bm_decode_2d<SoftwareDeposit>)->Name("decode 2d - software extract");    // NOLINT
+BENCHMARK(bm_decode_3d<Default>)->Name("decode 3d - default");                     // NOLINT
+BENCHMARK(bm_decode_3d<MagicBits>)->Name("decode 3d - magic bits");                // NOLINT
+BENCHMARK(bm_decode_3d<SoftwareDeposit>)->Name("decode 3d - software extract");    // NOLINT
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
@@ -0,0 +1,170 @@
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/x86/array_reduction.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#ifdef MJOLNIR_CORE_BENCHMARK_PARALLEL_STL
+#    include <execution>
+#endif
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr SummationMode standard    = SummationMode::STANDARD;
+constexpr SummationMode compensated = SummationMode::COMPENSATED;
+
+
+//! Return a vector with `size` test values.
+template <typename T_Type>
+[[nodiscard]] auto get_values(UST size) -> std::vector<T_Type>
+{
+    std::vector<T_Type> values(size);
+    for (UST i = 0; i < size; ++i)
+        values[i] = static_cast<T_Type>(i % 7) * T_Type(0.25); // NOLINT(readability-magic-numbers)
+    return values;
+}
+
+
+//! Register the array sizes of a benchmark: one that fits into the L1 cache and one with a million elements.
+void set_sizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1U << 12U)->Arg(1U << 20U); // NOLINT(readability-magic-numbers)
+}
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+static void bm_sum_std_accumulate(benchmark::State& state)
+{
+    auto values = get_values<T_Type>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(std::accumulate(values.begin(), values.end(), T_Type(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+#ifdef MJOLNIR_CORE_BENCHMARK_PARALLEL_STL
+template <typename T_Type>
+static void bm_sum_std_reduce_par_unseq(benchmark::State& state)
+{
+    auto values = get_values<T_Type>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(std::reduce(std::execution::par_unseq, values.begin(), values.end(), T_Type(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+
+
+template <FloatVectorRegister T_RegisterType, SummationMode t_mode, UST t_num_accumulators>
+static void bm_array_sum(benchmark::State& state)
+{
+    auto values = get_values<ElementType<T_RegisterType>>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(
+                array_sum<T_RegisterType, t_mode, t_num_accumulators>(values.data(), values.size()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename T_Type>
+static void bm_dot_product_std_inner_product(benchmark::State& state)
+{
+    auto lhs = get_values<T_Type>(static_cast<UST>(state.range(0)));
+    auto rhs = get_values<T_Type>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        benchmark::DoNotOptimize(std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), T_Type(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <FloatVectorRegister T_RegisterType, SummationMode t_mode>
+static void bm_array_dot_product(benchmark::State& state)
+{
+    auto lhs = get_values<ElementType<T_RegisterType>>(static_cast<UST>(state.range(0)));
+    auto rhs = get_values<ElementType<T_RegisterType>>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+        benchmark::DoNotOptimize(array_dot_product<T_RegisterType, t_mode>(lhs.data(), rhs.data(), lhs.size()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <typename T_Type>
+static void bm_max_std_max_element(benchmark::State& state)
+{
+    auto values = get_values<T_Type>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(*std::max_element(values.begin(), values.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template <FloatVectorRegister T_RegisterType>
+static void bm_array_max(benchmark::State& state)
+{
+    auto values = get_values<ElementType<T_RegisterType>>(static_cast<UST>(state.range(0)));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(array_max<T_RegisterType>(values.data(), values.size()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(bm_sum_std_accumulate<F32>)->Name("sum F32 - std::accumulate")->Apply(set_sizes); // NOLINT
+#ifdef MJOLNIR_CORE_BENCHMARK_PARALLEL_STL
+BENCHMARK(bm_sum_std_reduce_par_unseq<F32>)->Name("sum F32 - std::reduce par_unseq")->Apply(set_sizes); // NOLINT
+#endif
+BENCHMARK(bm_array_sum<__m256, standard, 1>)->Name("sum F32 - m256 - 1 accumulator")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_sum<__m256, standard, 4>)->Name("sum F32 - m256 - 4 accumulators")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_sum<__m256, compensated, 4>)->Name("sum F32 - m256 - compensated")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_sum_std_accumulate<F64>)->Name("sum F64 - std::accumulate")->Apply(set_sizes); // NOLINT
+#ifdef MJOLNIR_CORE_BENCHMARK_PARALLEL_STL
+BENCHMARK(bm_sum_std_reduce_par_unseq<F64>)->Name("sum F64 - std::reduce par_unseq")->Apply(set_sizes); // NOLINT
+#endif
+BENCHMARK(bm_array_sum<__m256d, standard, 1>)->Name("sum F64 - m256d - 1 accumulator")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_sum<__m256d, standard, 4>)->Name("sum F64 - m256d - 4 accumulators")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_sum<__m256d, compensated, 4>)->Name("sum F64 - m256d - compensated")->Apply(set_sizes); // NOLINT
+
+BENCHMARK(bm_dot_product_std_inner_product<F32>)->Name("dot F32 - std::inner_product")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_dot_product<__m256, standard>)->Name("dot F32 - m256")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_dot_product<__m256, compensated>)->Name("dot F32 - m256 - compensated")->Apply(set_sizes); // NOLINT
+
+BENCHMARK(bm_max_std_max_element<F32>)->Name("max F32 - std::max_element")->Apply(set_sizes); // NOLINT
+BENCHMARK(bm_array_max<__m256>)->Name("max F32 - m256")->Apply(set_sizes); // NOLINT
+
+
+BENCHMARK_MAIN(); // NOLINT
@@ -0,0 +1,166 @@
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/utility/bit_operations.h"
+#include "mjolnir/core/x86/bit_fields.h"
+
+#include <array>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! Number of bits of the x, y and z components of a quantized normal. The two remaining bits store flags.
+constexpr UST component_bits = 10;
+
+//! Number of bits of the flags of a quantized normal.
+constexpr UST flag_bits = 2;
+
+//! Number of normals whose fields fit into the L2 cache
+constexpr I64 size_cached = 1 << 12;
+
+//! Number of normals whose fields exceed the caches, so that the throughput is limited by the memory bandwidth
+constexpr I64 size_memory = 1 << 22;
+
+
+//! Return an array with `size` values that are smaller than 2 to the power of `num_bits`.
+[[nodiscard]] auto get_field_values(UST size, UST num_bits) -> std::vector<U32>
+{
+    std::vector<U32> values(size);
+    for (UST i = 0; i < size; ++i)
+        values[i] = static_cast<U32>((i * 7919U + 17U) & ((1U << num_bits) - 1U));
+    return values;
+}
+
+
+//! Return an array with `size` arbitrary packed values.
+[[nodiscard]] auto get_packed_values(UST size) -> std::vector<U32>
+{
+    std::vector<U32> values(size);
+    for (UST i = 0; i < size; ++i)
+        values[i] = static_cast<U32>(i * 2654435761U); // NOLINT(*-magic-numbers)
+    return values;
+}
+
+
+//! Arrays with the individual fields of quantized normals.
+struct Fields
+{
+    std::vector<U32> x;     //!< x component
+    std::vector<U32> y;     //!< y component
+    std::vector<U32> z;     //!< z component
+    std::vector<U32> flags; //!< flags
+
+    //! Construct the fields of `size` normals.
+    explicit Fields(UST size)
+        : x{get_field_values(size, component_bits)}
+        , y{get_field_values(size, component_bits)}
+        , z{get_field_values(size, component_bits)}
+        , flags{get_field_values(size, flag_bits)}
+    {
+    }
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+static void bm_pack_scalar(benchmark::State& state)
+{
+    const auto       size = static_cast<UST>(state.range(0));
+    Fields           fields(size);
+    std::vector<U32> packed(size);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        for (UST i = 0; i < size; ++i)
+        {
+            U32 value = 0;
+            set_bits_with_int<component_bits, false>(value, 0, fields.x[i]);
+            set_bits_with_int<component_bits, false>(value, component_bits, fields.y[i]);
+            set_bits_with_int<component_bits, false>(value, 2 * component_bits, fields.z[i]);
+            set_bits_with_int<flag_bits, false>(value, 3 * component_bits, fields.flags[i]);
+            packed[i] = value;
+        }
+        benchmark::DoNotOptimize(packed.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<I64>(5 * size * sizeof(U32)));
+}
+
+
+template <IntegerSSEAVXRegister T_RegisterType>
+static void bm_pack_simd(benchmark::State& state)
+{
+    const auto       size = static_cast<UST>(state.range(0));
+    Fields           fields(size);
+    std::vector<U32> packed(size);
+
+    const std::array<const U32*, 4> field_ptr = {
+            {fields.x.data(), fields.y.data(), fields.z.data(), fields.flags.data()}};
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        array_pack_bit_fields<T_RegisterType, U32, component_bits, component_bits, component_bits, flag_bits>(
+                field_ptr, size, packed.data());
+        benchmark::DoNotOptimize(packed.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<I64>(5 * size * sizeof(U32)));
+}
+
+
+static void bm_unpack_scalar(benchmark::State& state)
+{
+    const auto       size = static_cast<UST>(state.range(0));
+    Fields           fields(size);
+    std::vector<U32> packed = get_packed_values(size);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        for (UST i = 0; i < size; ++i)
+        {
+            fields.x[i]     = get_bits<0, component_bits>(packed[i]);
+            fields.y[i]     = get_bits<component_bits, component_bits, -I32{component_bits}>(packed[i]);
+            fields.z[i]     = get_bits<2 * component_bits, component_bits, -I32{2 * component_bits}>(packed[i]);
+            fields.flags[i] = get_bits<3 * component_bits, flag_bits, -I32{3 * component_bits}>(packed[i]);
+        }
+        benchmark::DoNotOptimize(fields.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<I64>(5 * size * sizeof(U32)));
+}
+
+
+template <IntegerSSEAVXRegister T_RegisterType>
+static void bm_unpack_simd(benchmark::State& state)
+{
+    const auto       size = static_cast<UST>(state.range(0));
+    Fields           fields(size);
+    std::vector<U32> packed = get_packed_values(size);
+
+    const std::array<U32*, 4> field_ptr = {{fields.x.data(), fields.y.data(), fields.z.data(), fields.flags.data()}};
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        array_unpack_bit_fields<T_RegisterType, U32, component_bits, component_bits, component_bits, flag_bits>(
+                packed.data(), size, field_ptr);
+        benchmark::DoNotOptimize(fields.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<I64>(5 * size * sizeof(U32)));
+}
+
+
+// clang-format off
+BENCHMARK(bm_pack_scalar)->Name("pack - scalar")->Arg(size_cached)->Arg(size_memory);           // NOLINT
+BENCHMARK(bm_pack_simd<__m128i>)->Name("pack - m128i")->Arg(size_cached)->Arg(size_memory);     // NOLINT
+BENCHMARK(bm_pack_simd<__m256i>)->Name("pack - m256i")->Arg(size_cached)->Arg(size_memory);     // NOLINT
+BENCHMARK(bm_unpack_scalar)->Name("unpack - scalar")->Arg(size_cached)->Arg(size_memory);       // NOLINT
+BENCHMARK(bm_unpack_simd<__m128i>)->Name("unpack - m128i")->Arg(size_cached)->Arg(size_memory); // NOLINT
+BENCHMARK(bm_unpack_simd<__m256i>)->Name("unpack - m256i")->Arg(size_cached)->Arg(size_memory); // NOLINT
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
+
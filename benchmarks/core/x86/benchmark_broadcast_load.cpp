@@ -0,0 +1,98 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/x86/broadcast_load.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/permutation.h"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! Number of rows of the matrix block that is processed by the kernel
+constexpr UST num_rows = 4;
+
+//! Length of the inner dimension of the matrix product
+constexpr UST num_inner = 256;
+
+
+//! Splat the values of a column with one broadcasting load per value.
+struct BroadcastLoad
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] static auto splat(const ElementType<T_RegisterType>* ptr) noexcept
+    {
+        return broadcast_load_consecutive<num_rows, T_RegisterType>(ptr);
+    }
+};
+
+
+//! Splat the values of a column by loading them into a single register and broadcasting each element in registers.
+struct LoadAndShuffle
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] static auto splat(const ElementType<T_RegisterType>* ptr) noexcept
+    {
+        const auto column = broadcast_lane_load<T_RegisterType>(ptr);
+        return [column]<UST... t_i>(std::index_sequence<t_i...>) -> std::array<T_RegisterType, num_rows>
+        {
+            return {{broadcast<t_i>(column)...}};
+        }(std::make_index_sequence<num_rows>());
+    }
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+//! Multiply a packed `num_rows` x `num_inner` matrix block with a `num_inner` x register width block. This is the inner
+//! loop of a matrix product, where each scalar of the first matrix is splatted and multiplied with a full register.
+template <FloatVectorRegister T_RegisterType, typename T_Splat>
+static void bm_kernel(benchmark::State& state)
+{
+    using EType       = ElementType<T_RegisterType>;
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    std::vector<EType> lhs(num_rows * num_inner, EType(1));
+    std::vector<EType> rhs(num_inner * n_e, EType(1));
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        std::array<T_RegisterType, num_rows> acc = {};
+        for (auto& reg : acc)
+            reg = mm_setzero<T_RegisterType>();
+
+        for (UST k = 0; k < num_inner; ++k)
+        {
+            const auto row        = mm_loadu<T_RegisterType>(&rhs[k * n_e]);
+            const auto lhs_values = T_Splat::template splat<T_RegisterType>(&lhs[k * num_rows]);
+
+            for (UST i = 0; i < num_rows; ++i)
+                acc.at(i) = mm_fmadd(lhs_values.at(i), row, acc.at(i));
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_inner * num_rows));
+}
+
+
+// clang-format off
+BENCHMARK(bm_kernel<__m128, BroadcastLoad>)->Name("m128 - broadcast load");    // NOLINT
+BENCHMARK(bm_kernel<__m128, LoadAndShuffle>)->Name("m128 - load and shuffle"); // NOLINT
+BENCHMARK(bm_kernel<__m256, BroadcastLoad>)->Name("m256 - broadcast load");    // NOLINT
+BENCHMARK(bm_kernel<__m256, LoadAndShuffle>)->Name("m256 - load and shuffle"); // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_kernel<__m512, BroadcastLoad>)->Name("m512 - broadcast load");    // NOLINT
+BENCHMARK(bm_kernel<__m512, LoadAndShuffle>)->Name("m512 - load and shuffle"); // NOLINT
+#endif
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
@@ -0,0 +1,102 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/x86/compaction.h"
+#include "mjolnir/core/x86/comparison.h"
+#include "mjolnir/core/x86/intrinsics.h"
+
+#include <random>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_values = 4096;
+
+
+//! Return uniformly distributed values in [0, 1). Filtering them with a threshold of 0.5 makes the branches of a scalar
+//! implementation unpredictable.
+template <typename T_Type>
+[[nodiscard]] auto get_random_values() -> std::vector<T_Type>
+{
+    std::mt19937                           generator(42); // NOLINT(readability-magic-numbers)
+    std::uniform_real_distribution<T_Type> distribution(0, 1);
+
+    std::vector<T_Type> values(num_values);
+    for (auto& v : values)
+        v = distribution(generator);
+    return values;
+}
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+static void bm_filter_scalar(benchmark::State& state)
+{
+    auto                values    = get_random_values<T_Type>();
+    std::vector<T_Type> dst       = std::vector<T_Type>(num_values);
+    const T_Type        threshold = 0.5;
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+
+        UST n = 0;
+        for (const auto& v : values)
+            if (v > threshold)
+                dst[n++] = v;
+
+        benchmark::DoNotOptimize(n);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_values));
+}
+
+
+template <FloatVectorRegister T_RegisterType>
+static void bm_filter_compress_store(benchmark::State& state)
+{
+    using EType       = ElementType<T_RegisterType>;
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto               values    = get_random_values<EType>();
+    std::vector<EType> dst       = std::vector<EType>(num_values);
+    const auto         threshold = mm_set1<T_RegisterType>(0.5);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+
+        UST n = 0;
+        for (UST i = 0; i < num_values; i += n_e)
+        {
+            auto src = mm_loadu<T_RegisterType>(&values[i]);
+            n += compress_store(&dst[n], src, compare_mask_greater(src, threshold));
+        }
+
+        benchmark::DoNotOptimize(n);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_values));
+}
+
+
+BENCHMARK(bm_filter_scalar<F32>)->Name("f32 - scalar branches");              // NOLINT
+BENCHMARK(bm_filter_compress_store<__m128>)->Name("m128 - compress_store");   // NOLINT
+BENCHMARK(bm_filter_compress_store<__m256>)->Name("m256 - compress_store");   // NOLINT
+BENCHMARK(bm_filter_scalar<F64>)->Name("f64 - scalar branches");              // NOLINT
+BENCHMARK(bm_filter_compress_store<__m128d>)->Name("m128d - compress_store"); // NOLINT
+BENCHMARK(bm_filter_compress_store<__m256d>)->Name("m256d - compress_store"); // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_filter_compress_store<__m512>)->Name("m512 - compress_store");   // NOLINT
+BENCHMARK(bm_filter_compress_store<__m512d>)->Name("m512d - compress_store"); // NOLINT
+#endif
+
+
+BENCHMARK_MAIN(); // NOLINT
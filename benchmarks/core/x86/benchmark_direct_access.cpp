@@ -0,0 +1,90 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/intrinsics.h"
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, bool t_permuted>
+static void bm_get(benchmark::State& state)
+{
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto src   = mm_set1<T_RegisterType>(1.);
+    auto index = UST{0};
+    benchmark::DoNotOptimize(src);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        // Feeding the result back into the register creates a dependency chain, so that the latency is measured
+        ElementType<T_RegisterType> value = t_permuted ? get_permuted(src, index) : get(src, index);
+        src                               = mm_mul(src, mm_set1<T_RegisterType>(value));
+        index                             = (index + 1) % num_elements<T_RegisterType>;
+    }
+
+    benchmark::DoNotOptimize(src);
+}
+
+
+template <FloatVectorRegister T_RegisterType, bool t_blended>
+static void bm_set(benchmark::State& state)
+{
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto dst   = mm_set1<T_RegisterType>(1.);
+    auto value = ElementType<T_RegisterType>(1.);
+    auto index = UST{0};
+    benchmark::DoNotOptimize(dst);
+    benchmark::DoNotOptimize(value);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        if constexpr (t_blended)
+            set_blended(dst, index, value);
+        else
+            set(dst, index, value);
+        index = (index + 1) % num_elements<T_RegisterType>;
+    }
+
+    benchmark::DoNotOptimize(dst);
+}
+
+
+BENCHMARK(bm_get<__m128, false>)->Name("get - m128 - memory");    // NOLINT
+BENCHMARK(bm_get<__m128, true>)->Name("get - m128 - permute");    // NOLINT
+BENCHMARK(bm_get<__m128d, false>)->Name("get - m128d - memory");  // NOLINT
+BENCHMARK(bm_get<__m128d, true>)->Name("get - m128d - permute");  // NOLINT
+BENCHMARK(bm_get<__m256, false>)->Name("get - m256 - memory");    // NOLINT
+BENCHMARK(bm_get<__m256, true>)->Name("get - m256 - permute");    // NOLINT
+BENCHMARK(bm_get<__m256d, false>)->Name("get - m256d - memory");  // NOLINT
+BENCHMARK(bm_get<__m256d, true>)->Name("get - m256d - permute");  // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_get<__m512, false>)->Name("get - m512 - memory");    // NOLINT
+BENCHMARK(bm_get<__m512, true>)->Name("get - m512 - permute");    // NOLINT
+BENCHMARK(bm_get<__m512d, false>)->Name("get - m512d - memory");  // NOLINT
+BENCHMARK(bm_get<__m512d, true>)->Name("get - m512d - permute");  // NOLINT
+#endif
+
+BENCHMARK(bm_set<__m128, false>)->Name("set - m128 - memory");    // NOLINT
+BENCHMARK(bm_set<__m128, true>)->Name("set - m128 - blend");      // NOLINT
+BENCHMARK(bm_set<__m128d, false>)->Name("set - m128d - memory");  // NOLINT
+BENCHMARK(bm_set<__m128d, true>)->Name("set - m128d - blend");    // NOLINT
+BENCHMARK(bm_set<__m256, false>)->Name("set - m256 - memory");    // NOLINT
+BENCHMARK(bm_set<__m256, true>)->Name("set - m256 - blend");      // NOLINT
+BENCHMARK(bm_set<__m256d, false>)->Name("set - m256d - memory");  // NOLINT
+BENCHMARK(bm_set<__m256d, true>)->Name("set - m256d - blend");    // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_set<__m512, false>)->Name("set - m512 - memory");    // NOLINT
+BENCHMARK(bm_set<__m512, true>)->Name("set - m512 - blend");      // NOLINT
+BENCHMARK(bm_set<__m512d, false>)->Name("set - m512d - memory");  // NOLINT
+BENCHMARK(bm_set<__m512d, true>)->Name("set - m512d - blend");    // NOLINT
+#endif
+
+
+BENCHMARK_MAIN(); // NOLINT
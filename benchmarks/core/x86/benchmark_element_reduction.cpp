@@ -0,0 +1,127 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/x86/element_reduction.h"
+#include "mjolnir/core/x86/element_summation.h"
+#include "mjolnir/core/x86/intrinsics.h"
+
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_registers = 1024;
+
+
+struct Sum
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> ElementType<T_RegisterType>
+    {
+        return element_sum(src);
+    }
+};
+
+
+struct ReductionSum
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> ElementType<T_RegisterType>
+    {
+        return element_reduction(src, [](T_RegisterType lhs, T_RegisterType rhs) { return mm_add(lhs, rhs); });
+    }
+};
+
+
+struct Max
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> ElementType<T_RegisterType>
+    {
+        return element_max(src);
+    }
+};
+
+
+struct Product
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> ElementType<T_RegisterType>
+    {
+        return element_product(src);
+    }
+};
+
+
+struct ArgMax
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> ElementType<T_RegisterType>
+    {
+        return static_cast<ElementType<T_RegisterType>>(element_argmax(src));
+    }
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, typename T_Reduction>
+static void bm_reduction(benchmark::State& state)
+{
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    std::vector<T_RegisterType> registers(num_registers);
+    for (UST i = 0; i < num_registers; ++i)
+        registers[i] = mm_set1<T_RegisterType>(static_cast<ElementType<T_RegisterType>>(i % 7)); // NOLINT
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(registers.data());
+
+        ElementType<T_RegisterType> result = 0;
+        for (const auto& reg : registers)
+            result += T_Reduction()(reg);
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+
+BENCHMARK(bm_reduction<__m128, Sum>)->Name("m128 - element_sum");                     // NOLINT
+BENCHMARK(bm_reduction<__m128, ReductionSum>)->Name("m128 - element_reduction add");   // NOLINT
+BENCHMARK(bm_reduction<__m128, Max>)->Name("m128 - element_max");                     // NOLINT
+BENCHMARK(bm_reduction<__m128, Product>)->Name("m128 - element_product");             // NOLINT
+BENCHMARK(bm_reduction<__m128, ArgMax>)->Name("m128 - element_argmax");               // NOLINT
+BENCHMARK(bm_reduction<__m128d, Sum>)->Name("m128d - element_sum");                   // NOLINT
+BENCHMARK(bm_reduction<__m128d, ReductionSum>)->Name("m128d - element_reduction add"); // NOLINT
+BENCHMARK(bm_reduction<__m128d, Max>)->Name("m128d - element_max");                   // NOLINT
+BENCHMARK(bm_reduction<__m128d, Product>)->Name("m128d - element_product");           // NOLINT
+BENCHMARK(bm_reduction<__m128d, ArgMax>)->Name("m128d - element_argmax");             // NOLINT
+BENCHMARK(bm_reduction<__m256, Sum>)->Name("m256 - element_sum");                     // NOLINT
+BENCHMARK(bm_reduction<__m256, ReductionSum>)->Name("m256 - element_reduction add");   // NOLINT
+BENCHMARK(bm_reduction<__m256, Max>)->Name("m256 - element_max");                     // NOLINT
+BENCHMARK(bm_reduction<__m256, Product>)->Name("m256 - element_product");             // NOLINT
+BENCHMARK(bm_reduction<__m256, ArgMax>)->Name("m256 - element_argmax");               // NOLINT
+BENCHMARK(bm_reduction<__m256d, Sum>)->Name("m256d - element_sum");                   // NOLINT
+BENCHMARK(bm_reduction<__m256d, ReductionSum>)->Name("m256d - element_reduction add"); // NOLINT
+BENCHMARK(bm_reduction<__m256d, Max>)->Name("m256d - element_max");                   // NOLINT
+BENCHMARK(bm_reduction<__m256d, Product>)->Name("m256d - element_product");           // NOLINT
+BENCHMARK(bm_reduction<__m256d, ArgMax>)->Name("m256d - element_argmax");             // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_reduction<__m512, Sum>)->Name("m512 - element_sum");                     // NOLINT
+BENCHMARK(bm_reduction<__m512, ReductionSum>)->Name("m512 - element_reduction add");   // NOLINT
+BENCHMARK(bm_reduction<__m512, Max>)->Name("m512 - element_max");                     // NOLINT
+BENCHMARK(bm_reduction<__m512, Product>)->Name("m512 - element_product");             // NOLINT
+BENCHMARK(bm_reduction<__m512, ArgMax>)->Name("m512 - element_argmax");               // NOLINT
+BENCHMARK(bm_reduction<__m512d, Sum>)->Name("m512d - element_sum");                   // NOLINT
+BENCHMARK(bm_reduction<__m512d, ReductionSum>)->Name("m512d - element_reduction add"); // NOLINT
+BENCHMARK(bm_reduction<__m512d, Max>)->Name("m512d - element_max");                   // NOLINT
+BENCHMARK(bm_reduction<__m512d, Product>)->Name("m512d - element_product");           // NOLINT
+BENCHMARK(bm_reduction<__m512d, ArgMax>)->Name("m512d - element_argmax");             // NOLINT
+#endif
+
+
+BENCHMARK_MAIN(); // NOLINT
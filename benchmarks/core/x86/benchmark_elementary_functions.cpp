@@ -0,0 +1,134 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/x86/elementary_functions.h"
+#include "mjolnir/core/x86/intrinsics.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_values = 4096;
+
+
+//! Return values in (0, 4], which are valid arguments of all benchmarked functions.
+template <typename T_Type>
+[[nodiscard]] auto get_values() -> std::vector<T_Type>
+{
+    std::vector<T_Type> values(num_values);
+    for (UST i = 0; i < num_values; ++i)
+        values[i] = static_cast<T_Type>(i + 1) * T_Type(4) / static_cast<T_Type>(num_values);
+    return values;
+}
+
+
+// clang-format off
+struct Exp   { template <typename T> auto operator()(T x) const { return std::exp(x); } };
+struct Log   { template <typename T> auto operator()(T x) const { return std::log(x); } };
+struct Sin   { template <typename T> auto operator()(T x) const { return std::sin(x); } };
+struct Atan2 { template <typename T> auto operator()(T x) const { return std::atan2(x, x - T(2)); } };
+struct Rsqrt { template <typename T> auto operator()(T x) const { return T(1) / std::sqrt(x); } };
+
+template <Accuracy a> struct RegExp   { template <typename R> auto operator()(R x) const { return exp<a>(x); } };
+template <Accuracy a> struct RegLog   { template <typename R> auto operator()(R x) const { return log<a>(x); } };
+template <Accuracy a> struct RegSin   { template <typename R> auto operator()(R x) const { return sin<a>(x); } };
+template <Accuracy a> struct RegRsqrt { template <typename R> auto operator()(R x) const { return rsqrt<a>(x); } };
+template <Accuracy a> struct RegAtan2
+{
+    template <typename R> auto operator()(R x) const { return atan2<a>(x, mm_sub(x, mm_set1<R>(2))); }
+};
+// clang-format on
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Type, typename T_Function>
+static void bm_libm(benchmark::State& state)
+{
+    auto                values  = get_values<T_Type>();
+    std::vector<T_Type> results = std::vector<T_Type>(num_values);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+
+        for (UST i = 0; i < num_values; ++i)
+            results[i] = T_Function()(values[i]);
+
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_values));
+}
+
+
+template <FloatVectorRegister T_RegisterType, typename T_Function>
+static void bm_register(benchmark::State& state)
+{
+    using EType = ElementType<T_RegisterType>;
+
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto               values  = get_values<EType>();
+    std::vector<EType> results = std::vector<EType>(num_values);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(values.data());
+
+        for (UST i = 0; i < num_values; i += num_elements<T_RegisterType>)
+            mm_storeu(&results[i], T_Function()(mm_loadu<T_RegisterType>(&values[i])));
+
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_values));
+}
+
+
+constexpr Accuracy precise = Accuracy::PRECISE;
+constexpr Accuracy fast    = Accuracy::FAST;
+
+
+// clang-format off
+BENCHMARK(bm_libm<F32, Exp>)->Name("f32 - std::exp");                          // NOLINT
+BENCHMARK(bm_register<__m256, RegExp<precise>>)->Name("m256 - exp");            // NOLINT
+BENCHMARK(bm_register<__m256, RegExp<fast>>)->Name("m256 - exp fast");          // NOLINT
+BENCHMARK(bm_libm<F64, Exp>)->Name("f64 - std::exp");                          // NOLINT
+BENCHMARK(bm_register<__m256d, RegExp<precise>>)->Name("m256d - exp");          // NOLINT
+BENCHMARK(bm_register<__m256d, RegExp<fast>>)->Name("m256d - exp fast");        // NOLINT
+BENCHMARK(bm_libm<F32, Log>)->Name("f32 - std::log");                          // NOLINT
+BENCHMARK(bm_register<__m256, RegLog<precise>>)->Name("m256 - log");            // NOLINT
+BENCHMARK(bm_register<__m256, RegLog<fast>>)->Name("m256 - log fast");          // NOLINT
+BENCHMARK(bm_libm<F64, Log>)->Name("f64 - std::log");                          // NOLINT
+BENCHMARK(bm_register<__m256d, RegLog<precise>>)->Name("m256d - log");          // NOLINT
+BENCHMARK(bm_register<__m256d, RegLog<fast>>)->Name("m256d - log fast");        // NOLINT
+BENCHMARK(bm_libm<F32, Sin>)->Name("f32 - std::sin");                          // NOLINT
+BENCHMARK(bm_register<__m256, RegSin<precise>>)->Name("m256 - sin");            // NOLINT
+BENCHMARK(bm_register<__m256, RegSin<fast>>)->Name("m256 - sin fast");          // NOLINT
+BENCHMARK(bm_libm<F64, Sin>)->Name("f64 - std::sin");                          // NOLINT
+BENCHMARK(bm_register<__m256d, RegSin<precise>>)->Name("m256d - sin");          // NOLINT
+BENCHMARK(bm_register<__m256d, RegSin<fast>>)->Name("m256d - sin fast");        // NOLINT
+BENCHMARK(bm_libm<F32, Atan2>)->Name("f32 - std::atan2");                      // NOLINT
+BENCHMARK(bm_register<__m256, RegAtan2<precise>>)->Name("m256 - atan2");        // NOLINT
+BENCHMARK(bm_register<__m256, RegAtan2<fast>>)->Name("m256 - atan2 fast");      // NOLINT
+BENCHMARK(bm_libm<F64, Atan2>)->Name("f64 - std::atan2");                      // NOLINT
+BENCHMARK(bm_register<__m256d, RegAtan2<precise>>)->Name("m256d - atan2");      // NOLINT
+BENCHMARK(bm_register<__m256d, RegAtan2<fast>>)->Name("m256d - atan2 fast");    // NOLINT
+BENCHMARK(bm_libm<F32, Rsqrt>)->Name("f32 - 1 / std::sqrt");                   // NOLINT
+BENCHMARK(bm_register<__m256, RegRsqrt<precise>>)->Name("m256 - rsqrt");        // NOLINT
+BENCHMARK(bm_register<__m256, RegRsqrt<fast>>)->Name("m256 - rsqrt fast");      // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_register<__m512, RegExp<precise>>)->Name("m512 - exp");            // NOLINT
+BENCHMARK(bm_register<__m512d, RegExp<precise>>)->Name("m512d - exp");          // NOLINT
+BENCHMARK(bm_register<__m512, RegSin<precise>>)->Name("m512 - sin");            // NOLINT
+BENCHMARK(bm_register<__m512d, RegSin<precise>>)->Name("m512d - sin");          // NOLINT
+BENCHMARK(bm_register<__m512d, RegRsqrt<fast>>)->Name("m512d - rsqrt fast");    // NOLINT
+#endif
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
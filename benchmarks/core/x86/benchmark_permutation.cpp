@@ -0,0 +1,185 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/utility/bit_operations.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/permutation.h"
+
+#include <array>
+#include <type_traits>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_chained_permutations = 64;
+
+
+//! Permutation that uses the instruction sequence selected by `permute_across_lanes`.
+template <UST... t_indices>
+struct Planned
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        return permute_across_lanes<t_indices...>(src);
+    }
+};
+
+
+//! Permutation that always uses a single cross-lane permutation instruction, regardless of the index pattern.
+template <UST... t_indices>
+struct CrossLane
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        if constexpr (is_m256<T_RegisterType>)
+            return _mm256_permutevar8x32_ps(src, _mm256_setr_epi32(t_indices...));
+        else if constexpr (is_m256d<T_RegisterType>)
+        {
+            constexpr UST mask = bit_construct_from_ints<2, UST, t_indices...>(true);
+            return _mm256_permute4x64_pd(src, mask);
+        }
+        else
+        {
+            using IndexType = std::conditional_t<is_m512<T_RegisterType>, I32, I64>;
+            const auto indices = std::array<IndexType, sizeof...(t_indices)>{{t_indices...}};
+            const auto mask    = x86::internal::mm512_setr<__m512i>(indices);
+
+            if constexpr (is_m512<T_RegisterType>)
+                return _mm512_maskz_permutexvar_ps(x86::internal::mm512_full_mask<T_RegisterType>, mask, src);
+            else
+                return _mm512_maskz_permutexvar_pd(x86::internal::mm512_full_mask<T_RegisterType>, mask, src);
+        }
+    }
+};
+
+
+//! Insert an element of the register into another position of the same register with `insert`.
+template <UST t_index_src, UST t_index_dst>
+struct Insert
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        return insert<t_index_src, t_index_dst>(src, src);
+    }
+};
+
+
+//! Same as `Insert`, but the element is copied in memory. The scalar store prevents that the reload is forwarded from
+//! the vector store, which is what happens in code that falls back to modifying a register through an array.
+template <UST t_index_src, UST t_index_dst>
+struct StoreReloadInsert
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        alignas(alignment_bytes<T_RegisterType>) std::array<ElementType<T_RegisterType>, num_elements<T_RegisterType>>
+                values = {};
+
+        mm_store(values.data(), src);
+        values[t_index_dst] = values[t_index_src];
+        benchmark::DoNotOptimize(values);
+        return mm_load<T_RegisterType>(values.data());
+    }
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, typename T_Permutation>
+static void bm_permute_chain(benchmark::State& state)
+{
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto src = mm_set1<T_RegisterType>(1.);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        // Each permutation depends on the previous one, so that the latency of the sequence is measured
+        for (UST i = 0; i < num_chained_permutations; ++i)
+        {
+            src = T_Permutation()(src);
+            clobber_register(src);
+        }
+    }
+
+    auto result = src;
+    benchmark::DoNotOptimize(result);
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_chained_permutations));
+}
+
+
+// clang-format off
+// __m256: identity, in-lane uniform, in-lane variable, lane swap, broadcast, arbitrary
+using M256Identity  = Planned<0, 1, 2, 3, 4, 5, 6, 7>;
+using M256InLane    = Planned<1, 0, 3, 2, 5, 4, 7, 6>;
+using M256InLaneVar = Planned<1, 0, 3, 2, 6, 7, 5, 4>;
+using M256LaneSwap  = Planned<4, 5, 6, 7, 0, 1, 2, 3>;
+using M256Broadcast = Planned<0, 0, 0, 0, 0, 0, 0, 0>;
+using M256Arbitrary = Planned<1, 6, 4, 3, 2, 0, 7, 5>;
+
+BENCHMARK(bm_permute_chain<__m256, M256Identity>)->Name("m256 - identity - planned");                          // NOLINT
+BENCHMARK(bm_permute_chain<__m256, CrossLane<0, 1, 2, 3, 4, 5, 6, 7>>)->Name("m256 - identity - vpermps");     // NOLINT
+BENCHMARK(bm_permute_chain<__m256, M256InLane>)->Name("m256 - in-lane - planned");                             // NOLINT
+BENCHMARK(bm_permute_chain<__m256, CrossLane<1, 0, 3, 2, 5, 4, 7, 6>>)->Name("m256 - in-lane - vpermps");      // NOLINT
+BENCHMARK(bm_permute_chain<__m256, M256InLaneVar>)->Name("m256 - in-lane var - planned");                      // NOLINT
+BENCHMARK(bm_permute_chain<__m256, CrossLane<1, 0, 3, 2, 6, 7, 5, 4>>)->Name("m256 - in-lane var - vpermps");  // NOLINT
+BENCHMARK(bm_permute_chain<__m256, M256LaneSwap>)->Name("m256 - lane swap - planned");                         // NOLINT
+BENCHMARK(bm_permute_chain<__m256, CrossLane<4, 5, 6, 7, 0, 1, 2, 3>>)->Name("m256 - lane swap - vpermps");    // NOLINT
+BENCHMARK(bm_permute_chain<__m256, M256Broadcast>)->Name("m256 - broadcast - planned");                        // NOLINT
+BENCHMARK(bm_permute_chain<__m256, CrossLane<0, 0, 0, 0, 0, 0, 0, 0>>)->Name("m256 - broadcast - vpermps");    // NOLINT
+BENCHMARK(bm_permute_chain<__m256, M256Arbitrary>)->Name("m256 - arbitrary - planned");                        // NOLINT
+BENCHMARK(bm_permute_chain<__m256, CrossLane<1, 6, 4, 3, 2, 0, 7, 5>>)->Name("m256 - arbitrary - vpermps");    // NOLINT
+
+// __m256d: in-lane, lane swap, arbitrary
+BENCHMARK(bm_permute_chain<__m256d, Planned<1, 0, 3, 2>>)->Name("m256d - in-lane - planned");                  // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, CrossLane<1, 0, 3, 2>>)->Name("m256d - in-lane - vpermpd");                // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, Planned<2, 3, 0, 1>>)->Name("m256d - lane swap - planned");                // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, CrossLane<2, 3, 0, 1>>)->Name("m256d - lane swap - vpermpd");              // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, Planned<3, 1, 0, 0>>)->Name("m256d - arbitrary - planned");                // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, CrossLane<3, 1, 0, 0>>)->Name("m256d - arbitrary - vpermpd");              // NOLINT
+
+// insert: same lane, lane crossing with equal lane position, arbitrary lane crossing
+BENCHMARK(bm_permute_chain<__m128, Insert<2, 1>>)->Name("m128 - insert - register");                           // NOLINT
+BENCHMARK(bm_permute_chain<__m128, StoreReloadInsert<2, 1>>)->Name("m128 - insert - store/reload");            // NOLINT
+BENCHMARK(bm_permute_chain<__m128d, Insert<1, 0>>)->Name("m128d - insert - register");                         // NOLINT
+BENCHMARK(bm_permute_chain<__m128d, StoreReloadInsert<1, 0>>)->Name("m128d - insert - store/reload");          // NOLINT
+BENCHMARK(bm_permute_chain<__m256, Insert<2, 1>>)->Name("m256 - insert in-lane - register");                   // NOLINT
+BENCHMARK(bm_permute_chain<__m256, StoreReloadInsert<2, 1>>)->Name("m256 - insert in-lane - store/reload");    // NOLINT
+BENCHMARK(bm_permute_chain<__m256, Insert<1, 5>>)->Name("m256 - insert lane copy - register");                 // NOLINT
+BENCHMARK(bm_permute_chain<__m256, StoreReloadInsert<1, 5>>)->Name("m256 - insert lane copy - store/reload");  // NOLINT
+BENCHMARK(bm_permute_chain<__m256, Insert<1, 6>>)->Name("m256 - insert arbitrary - register");                 // NOLINT
+BENCHMARK(bm_permute_chain<__m256, StoreReloadInsert<1, 6>>)->Name("m256 - insert arbitrary - store/reload");  // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, Insert<0, 1>>)->Name("m256d - insert in-lane - register");                 // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, StoreReloadInsert<0, 1>>)->Name("m256d - insert in-lane - store/reload");  // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, Insert<0, 3>>)->Name("m256d - insert crossing - register");                // NOLINT
+BENCHMARK(bm_permute_chain<__m256d, StoreReloadInsert<0, 3>>)->Name("m256d - insert crossing - store/reload"); // NOLINT
+
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+using M512InLane   = Planned<1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14>;
+using M512InLaneX  = CrossLane<1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14>;
+using M512Lanes    = Planned<4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11>;
+using M512LanesX   = CrossLane<4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11>;
+using M512DHalves  = Planned<1, 2, 3, 0, 5, 6, 7, 4>;
+using M512DHalvesX = CrossLane<1, 2, 3, 0, 5, 6, 7, 4>;
+
+BENCHMARK(bm_permute_chain<__m512, M512InLane>)->Name("m512 - in-lane - planned");                             // NOLINT
+BENCHMARK(bm_permute_chain<__m512, M512InLaneX>)->Name("m512 - in-lane - vpermps");                            // NOLINT
+BENCHMARK(bm_permute_chain<__m512, M512Lanes>)->Name("m512 - lane permutation - planned");                     // NOLINT
+BENCHMARK(bm_permute_chain<__m512, M512LanesX>)->Name("m512 - lane permutation - vpermps");                    // NOLINT
+BENCHMARK(bm_permute_chain<__m512d, M512DHalves>)->Name("m512d - uniform halves - planned");                   // NOLINT
+BENCHMARK(bm_permute_chain<__m512d, M512DHalvesX>)->Name("m512d - uniform halves - vpermpd");                  // NOLINT
+BENCHMARK(bm_permute_chain<__m512, Insert<1, 14>>)->Name("m512 - insert - register");                          // NOLINT
+BENCHMARK(bm_permute_chain<__m512, StoreReloadInsert<1, 14>>)->Name("m512 - insert - store/reload");           // NOLINT
+BENCHMARK(bm_permute_chain<__m512d, Insert<1, 6>>)->Name("m512d - insert - register");                         // NOLINT
+BENCHMARK(bm_permute_chain<__m512d, StoreReloadInsert<1, 6>>)->Name("m512d - insert - store/reload");          // NOLINT
+#endif
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
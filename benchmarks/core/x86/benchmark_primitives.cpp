@@ -0,0 +1,260 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/x86/comparison.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/element_summation.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/permutation.h"
+#include "mjolnir/core/x86/sign_manipulation.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <array>
+#include <utility>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+//! Number of calls per benchmark iteration
+constexpr UST num_calls = 64;
+
+//! Number of independent registers that are processed by the throughput benchmarks
+constexpr UST num_independent = 8;
+
+
+//! Add the number of time stamp counter cycles per call to the benchmark output. The time stamp counter runs at the
+//! nominal CPU frequency, so the values are reference cycles that differ from core cycles if the CPU boosts.
+inline void set_cycles_per_call(benchmark::State& state, U64 num_cycles)
+{
+    const auto num_total_calls    = static_cast<F64>(state.iterations()) * static_cast<F64>(num_calls);
+    state.counters["cycles/call"] = benchmark::Counter(static_cast<F64>(num_cycles) / num_total_calls);
+}
+
+
+// --- primitives -----------------------------------------------------------------------------------------------------
+
+// All primitives take a register and return a register of the same type, so that calls can be chained. Primitives that
+// return a scalar broadcast it, which is included in the measured cost.
+
+//! `permute` - swaps neighboring elements in each lane
+struct Permute
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        if constexpr (num_lane_elements<T_RegisterType> == 2)
+            return permute<1, 0>(src);
+        else
+            return permute<1, 0, 3, 2>(src);
+    }
+};
+
+
+//! `permute_across_lanes` - reverses the element order
+struct PermuteAcrossLanes
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        constexpr UST n_e = num_elements<T_RegisterType>;
+        return [src]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+        {
+            return permute_across_lanes<(n_e - 1 - t_i)...>(src);
+        }(std::make_index_sequence<n_e>());
+    }
+};
+
+
+//! `blend` - takes every second element from a permuted copy
+struct Blend
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        return [src]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+        {
+            return blend<(t_i % 2)...>(src, Permute()(src));
+        }(std::make_index_sequence<num_elements<T_RegisterType>>());
+    }
+};
+
+
+//! `shuffle` - combines the lower and upper half of each lane
+struct Shuffle
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        if constexpr (num_lane_elements<T_RegisterType> == 2)
+            return shuffle<1, 0>(src, src);
+        else
+            return shuffle<2, 3, 0, 1>(src, src);
+    }
+};
+
+
+//! `exchange` - exchanges the first and the last element with a second register
+struct Exchange
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        auto other = Permute()(src);
+        exchange<0, num_elements<T_RegisterType> - 1>(src, other);
+        return src;
+    }
+};
+
+
+//! `broadcast_element_sum` - horizontal sum
+struct ElementSum
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        return broadcast_element_sum(src);
+    }
+};
+
+
+//! `compare_all_less` - the result is added to all elements
+struct CompareAllLess
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        using EType = ElementType<T_RegisterType>;
+
+        bool result = compare_all_less(src, mm_setzero<T_RegisterType>());
+        return mm_add(src, mm_set1<T_RegisterType>(static_cast<EType>(result)));
+    }
+};
+
+
+//! `negate_selected` - negates every second element
+struct NegateSelected
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        return [src]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+        {
+            return negate_selected<(t_i % 2 == 1)...>(src);
+        }(std::make_index_sequence<num_elements<T_RegisterType>>());
+    }
+};
+
+
+//! `get` - reads the last element
+struct Get
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        return mm_set1<T_RegisterType>(get<num_elements<T_RegisterType> - 1>(src));
+    }
+};
+
+
+//! `set` - writes the first element to the last element
+struct Set
+{
+    template <FloatVectorRegister T_RegisterType>
+    [[nodiscard]] auto operator()(T_RegisterType src) const noexcept -> T_RegisterType
+    {
+        set<num_elements<T_RegisterType> - 1>(src, mm_cvt_float(src));
+        return src;
+    }
+};
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+//! Measure the latency of a primitive. Each call depends on the result of the previous one.
+template <FloatVectorRegister T_RegisterType, typename T_Primitive>
+static void bm_latency(benchmark::State& state)
+{
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto reg = mm_set1<T_RegisterType>(1.);
+
+    const U64 start = __rdtsc();
+    for ([[maybe_unused]] auto s : state)
+        for (UST i = 0; i < num_calls; ++i)
+        {
+            reg = T_Primitive()(reg);
+            clobber_register(reg);
+        }
+    const U64 end = __rdtsc();
+
+    auto result = reg;
+    benchmark::DoNotOptimize(result);
+    set_cycles_per_call(state, end - start);
+}
+
+
+//! Measure the reciprocal throughput of a primitive. The calls are distributed over multiple independent registers.
+template <FloatVectorRegister T_RegisterType, typename T_Primitive>
+static void bm_throughput(benchmark::State& state)
+{
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    std::array<T_RegisterType, num_independent> regs = {};
+    for (auto& reg : regs)
+        reg = mm_set1<T_RegisterType>(1.);
+
+    const U64 start = __rdtsc();
+    for ([[maybe_unused]] auto s : state)
+        for (UST i = 0; i < num_calls; i += num_independent)
+            for (auto& reg : regs)
+            {
+                reg = T_Primitive()(reg);
+                clobber_register(reg);
+            }
+    const U64 end = __rdtsc();
+
+    auto result = regs;
+    benchmark::DoNotOptimize(result);
+    set_cycles_per_call(state, end - start);
+}
+
+
+// Registers the latency and throughput benchmarks of a primitive for a register type
+#define BENCHMARK_PRIMITIVE(primitive, reg)                                                                            \
+    BENCHMARK(bm_latency<__##reg, primitive>)->Name(#primitive " - " #reg " - latency");       /* NOLINT */            \
+    BENCHMARK(bm_throughput<__##reg, primitive>)->Name(#primitive " - " #reg " - throughput") /* NOLINT */
+
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+#    define BENCHMARK_PRIMITIVE_ALL_REGISTERS(primitive)                                                               \
+        BENCHMARK_PRIMITIVE(primitive, m128);                                                                          \
+        BENCHMARK_PRIMITIVE(primitive, m128d);                                                                         \
+        BENCHMARK_PRIMITIVE(primitive, m256);                                                                          \
+        BENCHMARK_PRIMITIVE(primitive, m256d);                                                                         \
+        BENCHMARK_PRIMITIVE(primitive, m512);                                                                          \
+        BENCHMARK_PRIMITIVE(primitive, m512d)
+#else
+#    define BENCHMARK_PRIMITIVE_ALL_REGISTERS(primitive)                                                               \
+        BENCHMARK_PRIMITIVE(primitive, m128);                                                                          \
+        BENCHMARK_PRIMITIVE(primitive, m128d);                                                                         \
+        BENCHMARK_PRIMITIVE(primitive, m256);                                                                          \
+        BENCHMARK_PRIMITIVE(primitive, m256d)
+#endif
+
+
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(Permute);            // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(PermuteAcrossLanes); // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(Blend);              // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(Shuffle);            // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(Exchange);           // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(ElementSum);         // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(CompareAllLess);     // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(NegateSelected);     // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(Get);                // NOLINT
+BENCHMARK_PRIMITIVE_ALL_REGISTERS(Set);                // NOLINT
+
+
+BENCHMARK_MAIN(); // NOLINT
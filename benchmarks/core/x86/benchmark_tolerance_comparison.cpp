@@ -0,0 +1,104 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_utility.h"
+#include "mjolnir/core/utility/is_close.h"
+#include "mjolnir/core/x86/tolerance_comparison.h"
+
+#include <utility>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_values = 65536;
+
+//! Tolerance of the relative comparisons. The absolute comparisons use 1.
+constexpr F64 tolerance_rel = 1E-5;
+
+
+//! Return two arrays whose elements are all close, so that no comparison exits early.
+template <typename T_Type>
+[[nodiscard]] auto get_values() -> std::pair<std::vector<T_Type>, std::vector<T_Type>>
+{
+    std::vector<T_Type> lhs(num_values);
+    std::vector<T_Type> rhs(num_values);
+    for (UST i = 0; i < num_values; ++i)
+    {
+        lhs[i] = static_cast<T_Type>(i + 1);
+        rhs[i] = lhs[i] * (T_Type(1) + T_Type(1E-7));
+    }
+    return {lhs, rhs};
+}
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+template <typename T_Type, bool t_relative>
+static void bm_scalar(benchmark::State& state)
+{
+    auto [lhs, rhs] = get_values<T_Type>();
+    auto tolerance  = static_cast<T_Type>(t_relative ? tolerance_rel : 1.);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(lhs.data());
+
+        bool result = true;
+        for (UST i = 0; i < num_values && result; ++i)
+            if constexpr (t_relative)
+                result = is_close_rel(lhs[i], rhs[i], tolerance);
+            else
+                result = is_close_abs(lhs[i], rhs[i], tolerance);
+
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_values));
+}
+
+
+template <FloatVectorRegister T_RegisterType, bool t_relative>
+static void bm_register(benchmark::State& state)
+{
+    using EType = ElementType<T_RegisterType>;
+
+    if (skip_unsupported<T_RegisterType>(state))
+        return;
+
+    auto [lhs, rhs] = get_values<EType>();
+    auto tolerance  = static_cast<EType>(t_relative ? tolerance_rel : 1.);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(lhs.data());
+
+        bool result = false;
+        if constexpr (t_relative)
+            result = array_is_close_rel<T_RegisterType>(lhs.data(), rhs.data(), num_values, tolerance);
+        else
+            result = array_is_close_abs<T_RegisterType>(lhs.data(), rhs.data(), num_values, tolerance);
+
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(num_values));
+}
+
+
+// clang-format off
+BENCHMARK(bm_scalar<F32, false>)->Name("f32 - is_close_abs - scalar");        // NOLINT
+BENCHMARK(bm_register<__m128, false>)->Name("m128 - array_is_close_abs");     // NOLINT
+BENCHMARK(bm_register<__m256, false>)->Name("m256 - array_is_close_abs");     // NOLINT
+BENCHMARK(bm_scalar<F32, true>)->Name("f32 - is_close_rel - scalar");         // NOLINT
+BENCHMARK(bm_register<__m128, true>)->Name("m128 - array_is_close_rel");      // NOLINT
+BENCHMARK(bm_register<__m256, true>)->Name("m256 - array_is_close_rel");      // NOLINT
+BENCHMARK(bm_scalar<F64, true>)->Name("f64 - is_close_rel - scalar");         // NOLINT
+BENCHMARK(bm_register<__m256d, true>)->Name("m256d - array_is_close_rel");    // NOLINT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+BENCHMARK(bm_register<__m512, true>)->Name("m512 - array_is_close_rel");      // NOLINT
+BENCHMARK(bm_register<__m512d, true>)->Name("m512d - array_is_close_rel");    // NOLINT
+#endif
+// clang-format on
+
+
+BENCHMARK_MAIN(); // NOLINT
@@ -0,0 +1,142 @@
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/transposition.h"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- setup ----------------------------------------------------------------------------------------------------------
+
+constexpr UST num_structs = 512;
+
+
+//! Scalar reference implementation of `aos_to_soa`.
+template <typename T_Type, UST t_num_components>
+void aos_to_soa_scalar(const T_Type* aos, const std::array<T_Type*, t_num_components>& soa, UST num_elements)
+{
+    for (UST i = 0; i < num_elements; ++i)
+        for (UST c = 0; c < t_num_components; ++c)
+            soa[c][i] = aos[i * t_num_components + c]; // NOLINT - pointer arithmetic and array index
+}
+
+
+//! Scalar reference implementation of `soa_to_aos`.
+template <typename T_Type, UST t_num_components>
+void soa_to_aos_scalar(const std::array<const T_Type*, t_num_components>& soa, T_Type* aos, UST num_elements)
+{
+    for (UST i = 0; i < num_elements; ++i)
+        for (UST c = 0; c < t_num_components; ++c)
+            aos[i * t_num_components + c] = soa[c][i]; // NOLINT - pointer arithmetic and array index
+}
+
+
+// --- benchmarks -----------------------------------------------------------------------------------------------------
+
+//! Use `F32` as `T_RegisterType` for the scalar version.
+template <typename T_RegisterType, UST t_num_components>
+static void bm_aos_to_soa(benchmark::State& state)
+{
+    std::vector<F32> aos(num_structs * t_num_components, 1.F);
+
+    std::array<std::vector<F32>, t_num_components> soa_data = {};
+    std::array<F32*, t_num_components>             soa      = {};
+    for (UST c = 0; c < t_num_components; ++c)
+    {
+        soa_data.at(c).resize(num_structs);
+        soa.at(c) = soa_data.at(c).data();
+    }
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(aos.data());
+        if constexpr (std::is_same_v<T_RegisterType, F32>)
+            aos_to_soa_scalar<F32, t_num_components>(aos.data(), soa, num_structs);
+        else
+            aos_to_soa<T_RegisterType, t_num_components>(aos.data(), soa, num_structs);
+        benchmark::ClobberMemory();
+    }
+}
+
+
+//! Use `F32` as `T_RegisterType` for the scalar version.
+template <typename T_RegisterType, UST t_num_components>
+static void bm_soa_to_aos(benchmark::State& state)
+{
+    std::vector<F32> aos(num_structs * t_num_components);
+
+    std::array<std::vector<F32>, t_num_components> soa_data = {};
+    std::array<const F32*, t_num_components>       soa      = {};
+    for (UST c = 0; c < t_num_components; ++c)
+    {
+        soa_data.at(c).resize(num_structs, 1.F);
+        soa.at(c) = soa_data.at(c).data();
+    }
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        benchmark::DoNotOptimize(soa_data);
+        if constexpr (std::is_same_v<T_RegisterType, F32>)
+            soa_to_aos_scalar<F32, t_num_components>(soa, aos.data(), num_structs);
+        else
+            soa_to_aos<T_RegisterType, t_num_components>(soa, aos.data(), num_structs);
+        benchmark::ClobberMemory();
+    }
+}
+
+
+//! Use `F32` as `T_RegisterType` for the scalar version.
+template <typename T_RegisterType>
+static void bm_transpose_8x8(benchmark::State& state)
+{
+    constexpr UST size = 8;
+
+    alignas(alignment_bytes<__m256>) std::array<F32, size * size> data = {{0}};
+    benchmark::DoNotOptimize(data);
+
+    for ([[maybe_unused]] auto s : state)
+    {
+        if constexpr (std::is_same_v<T_RegisterType, F32>)
+        {
+            for (UST i = 0; i < size; ++i)
+                for (UST j = i + 1; j < size; ++j)
+                    std::swap(data.at(i * size + j), data.at(j * size + i));
+        }
+        else
+        {
+            std::array<__m256, size> rows = {};
+            for (UST i = 0; i < size; ++i)
+                rows.at(i) = mm_load<__m256>(&data.at(i * size));
+            rows = transpose(rows);
+            for (UST i = 0; i < size; ++i)
+                mm_store(&data.at(i * size), rows.at(i));
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+
+BENCHMARK(bm_aos_to_soa<F32, 3>)->Name("aos_to_soa - 3 components - scalar");    // NOLINT
+BENCHMARK(bm_aos_to_soa<__m128, 3>)->Name("aos_to_soa - 3 components - m128");   // NOLINT
+BENCHMARK(bm_aos_to_soa<__m256, 3>)->Name("aos_to_soa - 3 components - m256");   // NOLINT
+BENCHMARK(bm_aos_to_soa<F32, 4>)->Name("aos_to_soa - 4 components - scalar");    // NOLINT
+BENCHMARK(bm_aos_to_soa<__m128, 4>)->Name("aos_to_soa - 4 components - m128");   // NOLINT
+BENCHMARK(bm_aos_to_soa<__m256, 4>)->Name("aos_to_soa - 4 components - m256");   // NOLINT
+
+BENCHMARK(bm_soa_to_aos<F32, 3>)->Name("soa_to_aos - 3 components - scalar");    // NOLINT
+BENCHMARK(bm_soa_to_aos<__m128, 3>)->Name("soa_to_aos - 3 components - m128");   // NOLINT
+BENCHMARK(bm_soa_to_aos<__m256, 3>)->Name("soa_to_aos - 3 components - m256");   // NOLINT
+BENCHMARK(bm_soa_to_aos<F32, 4>)->Name("soa_to_aos - 4 components - scalar");    // NOLINT
+BENCHMARK(bm_soa_to_aos<__m128, 4>)->Name("soa_to_aos - 4 components - m128");   // NOLINT
+BENCHMARK(bm_soa_to_aos<__m256, 4>)->Name("soa_to_aos - 4 components - m256");   // NOLINT
+
+BENCHMARK(bm_transpose_8x8<F32>)->Name("transpose 8x8 - scalar");                // NOLINT
+BENCHMARK(bm_transpose_8x8<__m256>)->Name("transpose 8x8 - m256");               // NOLINT
+
+
+BENCHMARK_MAIN(); // NOLINT
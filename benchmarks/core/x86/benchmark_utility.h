@@ -0,0 +1,60 @@
+//! @file
+//! benchmark_utility.h
+//!
+//! @brief
+//! Contains utility functions that are shared by the x86 benchmarks
+
+
+#pragma once
+
+
+#include "benchmark/benchmark.h"
+#include "mjolnir/core/x86/cpu_features.h"
+#include "mjolnir/core/x86/definitions.h"
+
+
+//! @brief
+//! Return `true` if the benchmark can't be executed on the current CPU and mark it as skipped.
+//!
+//! @tparam T_RegisterType
+//! Register type that is used by the benchmark
+//!
+//! @param[in, out] state:
+//! State of the benchmark
+//!
+//! @return
+//! `true` if the benchmark must be skipped
+template <mjolnir::x86::FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto skip_unsupported(benchmark::State& state) -> bool
+{
+    if (mjolnir::x86::is_avx512_register<T_RegisterType> && ! mjolnir::x86::get_cpu_features().avx512f)
+    {
+        state.SkipWithError("The CPU doesn't support AVX-512F.");
+        return true;
+    }
+    return false;
+}
+
+
+//! @brief
+//! Hide the value of a register from the compiler.
+//!
+//! @details
+//! This keeps the register in place and prevents that consecutive calls are merged or removed. With GCC and Clang,
+//! an empty assembly statement does this without any instruction. `benchmark::DoNotOptimize` would force a round
+//! trip through memory instead, so it is only used as fallback for other compilers.
+//!
+//! @tparam T_RegisterType
+//! Register type
+//!
+//! @param[in, out] reg:
+//! Register that should be hidden from the compiler
+template <mjolnir::x86::FloatVectorRegister T_RegisterType>
+inline void clobber_register(T_RegisterType& reg) noexcept
+{
+#if defined(__GNUC__)
+    asm volatile("" : "+x"(reg)); // NOLINT(hicpp-no-assembler)
+#else
+    benchmark::DoNotOptimize(reg);
+#endif
+}
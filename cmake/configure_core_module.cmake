@@ -11,6 +11,8 @@ option(MJOLNIR_CORE_ENABLE_BENCHMARKS "Enable the benchmarks" TRUE)
 option(MJOLNIR_CORE_ENABLE_COMPILER_EXTENSIONS "Enables compiler extensions"
        FALSE)
 option(MJOLNIR_CORE_ENABLE_LTO "Enables link time optimizations" FALSE)
+option(MJOLNIR_CORE_ENABLE_AVX512
+       "Enables the support for AVX-512 registers (requires AVX-512F)" FALSE)
 
 # ------------------------------------------------------------------------------
 # CMake setup
@@ -81,6 +83,11 @@ endif()
 set(MJOLNIR_CORE_COMPILE_DEFINITIONS
     ${MJOLNIR_CORE_ADDITIONAL_COMPILE_DEFINITIONS})
 
+if(${MJOLNIR_CORE_ENABLE_AVX512})
+    set(MJOLNIR_CORE_COMPILE_DEFINITIONS ${MJOLNIR_CORE_COMPILE_DEFINITIONS}
+                                         MJOLNIR_CORE_ENABLE_AVX512)
+endif()
+
 # Set compile features
 set(MJOLNIR_CORE_COMPILE_FEATURES cxx_std_20
                                   ${MJOLNIR_CORE_ADDITIONAL_COMPILE_FEATURES})
@@ -114,6 +121,11 @@ if(MSVC)
         set(MJOLNIR_CORE_COMPILE_OPTIONS ${MJOLNIR_CORE_COMPILE_OPTIONS}
                                          /bigobj)
     endif()
+    if(${MJOLNIR_CORE_ENABLE_AVX512})
+        list(REMOVE_ITEM MJOLNIR_CORE_COMPILE_OPTIONS /arch:AVX2)
+        set(MJOLNIR_CORE_COMPILE_OPTIONS ${MJOLNIR_CORE_COMPILE_OPTIONS}
+                                         /arch:AVX512)
+    endif()
 else()
     set(MJOLNIR_CORE_COMPILE_OPTIONS
         -Wall
@@ -138,6 +150,79 @@ else()
         -pthread
         -march=native
         ${MJOLNIR_CORE_ADDITIONAL_COMPILE_OPTIONS})
+    if(${MJOLNIR_CORE_ENABLE_AVX512})
+        set(MJOLNIR_CORE_COMPILE_OPTIONS ${MJOLNIR_CORE_COMPILE_OPTIONS}
+                                         -mavx512f)
+    endif()
+endif()
+
+# Instruction sets of the runtime dispatched kernels. Each kernel source is
+# compiled with the options of its tier, while the remaining sources of the
+# kernel library and the tests of the dispatch use the baseline options. This
+# way, the binaries only require the baseline instruction set and the higher
+# tiers are selected at runtime.
+if(MSVC)
+    set(MJOLNIR_CORE_BASELINE_ARCH_OPTIONS "")
+    set(MJOLNIR_CORE_AVX2_ARCH_OPTIONS /arch:AVX2)
+    set(MJOLNIR_CORE_AVX512_ARCH_OPTIONS /arch:AVX512)
+else()
+    set(MJOLNIR_CORE_BASELINE_ARCH_OPTIONS -msse4.2)
+    set(MJOLNIR_CORE_AVX2_ARCH_OPTIONS -mavx2 -mfma)
+    set(MJOLNIR_CORE_AVX512_ARCH_OPTIONS -mavx2 -mfma -mavx512f)
+endif()
+
+set(MJOLNIR_CORE_BASELINE_COMPILE_OPTIONS ${MJOLNIR_CORE_COMPILE_OPTIONS})
+list(REMOVE_ITEM MJOLNIR_CORE_BASELINE_COMPILE_OPTIONS -march=native -mavx512f
+     /arch:AVX2 /arch:AVX512)
+set(MJOLNIR_CORE_BASELINE_COMPILE_OPTIONS
+    ${MJOLNIR_CORE_BASELINE_COMPILE_OPTIONS}
+    ${MJOLNIR_CORE_BASELINE_ARCH_OPTIONS})
+
+set(MJOLNIR_CORE_BASELINE_COMPILE_DEFINITIONS
+    ${MJOLNIR_CORE_COMPILE_DEFINITIONS})
+list(REMOVE_ITEM MJOLNIR_CORE_BASELINE_COMPILE_DEFINITIONS
+     MJOLNIR_CORE_ENABLE_AVX512)
+
+# The tests of the AVX-512 registers can only be executed on CPUs with AVX-512F
+# support. Since the whole test executables are compiled for AVX-512, a missing
+# support would crash them before any check at runtime. Therefore, the support
+# of the building CPU is detected here, and if it is missing, the tests are
+# compiled without the AVX-512 registers.
+set(MJOLNIR_CORE_TEST_COMPILE_OPTIONS ${MJOLNIR_CORE_COMPILE_OPTIONS})
+set(MJOLNIR_CORE_TEST_COMPILE_DEFINITIONS ${MJOLNIR_CORE_COMPILE_DEFINITIONS})
+
+if(${MJOLNIR_CORE_ENABLE_AVX512} AND ${MJOLNIR_CORE_ENABLE_TESTS})
+    include(CheckCXXSourceRuns)
+
+    if(MSVC)
+        set(CMAKE_REQUIRED_FLAGS /std:c++20)
+    else()
+        set(CMAKE_REQUIRED_FLAGS -std=c++20)
+    endif()
+    set(CMAKE_REQUIRED_INCLUDES ${MJOLNIR_CORE_SOURCE_DIR})
+    check_cxx_source_runs(
+        [[
+        #include "mjolnir/core/x86/cpu_features.h"
+        int main() { return mjolnir::x86::get_cpu_features().avx512f ? 0 : 1; }
+        ]]
+        MJOLNIR_CORE_CPU_SUPPORTS_AVX512)
+    unset(CMAKE_REQUIRED_FLAGS)
+    unset(CMAKE_REQUIRED_INCLUDES)
+
+    if(NOT ${MJOLNIR_CORE_CPU_SUPPORTS_AVX512})
+        message(
+            WARNING
+                "The CPU doesn't support AVX-512F. The tests are compiled "
+                "without the AVX-512 registers.")
+        list(REMOVE_ITEM MJOLNIR_CORE_TEST_COMPILE_OPTIONS -mavx512f
+             /arch:AVX512)
+        if(MSVC)
+            set(MJOLNIR_CORE_TEST_COMPILE_OPTIONS
+                ${MJOLNIR_CORE_TEST_COMPILE_OPTIONS} /arch:AVX2)
+        endif()
+        list(REMOVE_ITEM MJOLNIR_CORE_TEST_COMPILE_DEFINITIONS
+             MJOLNIR_CORE_ENABLE_AVX512)
+    endif()
 endif()
 
 # Compiler extensions
@@ -24,6 +24,11 @@ PARAMETERS:
 KEYWORDS
 --------
 
+    BASELINE_INSTRUCTION_SET:
+        Option without values. If it is set, the test is compiled for the
+        baseline instruction set of the module instead of the one of the build
+        machine
+
     COMPILE_DEFINITIONS:
         Definitions that should be added
 
@@ -24,6 +24,11 @@ PARAMETERS:
 KEYWORDS
 --------
 
+    BASELINE_INSTRUCTION_SET:
+        Option without values. If it is set, the test is compiled for the
+        baseline instruction set of the module instead of the one of the build
+        machine
+
     COMPILE_DEFINITIONS:
         Definitions that should be added
 
@@ -73,20 +78,28 @@ function(add_mjolnir_test target module)
         set(test_source "/tests/${relative_path}/${target}.cpp")
         set(ctest_test_name "${test_prefix}::${test_name}")
 
-        add_to_list_after_keyword("${ARGN}" arguments LINK_LIBRARIES PRIVATE
-                                  gtest_main)
+        cmake_parse_arguments(ARG "BASELINE_INSTRUCTION_SET" "" "" ${ARGN})
+
+        if(${ARG_BASELINE_INSTRUCTION_SET})
+            set(prefix MJOLNIR_${module}_BASELINE)
+        else()
+            set(prefix MJOLNIR_${module}_TEST)
+        endif()
+
+        add_to_list_after_keyword("${ARG_UNPARSED_ARGUMENTS}" arguments
+                                  LINK_LIBRARIES PRIVATE gtest_main)
 
-        if(NOT "${MJOLNIR_${module}_COMPILE_DEFINITIONS}" STREQUAL "")
+        if(NOT "${${prefix}_COMPILE_DEFINITIONS}" STREQUAL "")
             add_to_list_after_keyword(
                 "${arguments}" arguments COMPILE_DEFINITIONS PRIVATE
-                ${MJOLNIR_${module}_COMPILE_DEFINITIONS})
+                ${${prefix}_COMPILE_DEFINITIONS})
         endif()
 
         add_to_list_after_keyword("${arguments}" arguments COMPILE_FEATURES
                                   PRIVATE ${MJOLNIR_${module}_COMPILE_FEATURES})
 
         add_to_list_after_keyword("${arguments}" arguments COMPILE_OPTIONS
-                                  PRIVATE ${MJOLNIR_${module}_COMPILE_OPTIONS})
+                                  PRIVATE ${${prefix}_COMPILE_OPTIONS})
 
         add_to_list_after_keyword("${arguments}" arguments INCLUDE_DIRECTORIES
                                   ${MJOLNIR_${module}_SOURCE_DIR})
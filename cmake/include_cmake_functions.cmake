@@ -7,6 +7,7 @@ include(functions/process_scopes)
 include(functions/target_apply_setup)
 
 include(functions/add_generic_executable)
+include(functions/add_generic_library)
 include(functions/add_generic_benchmark)
 include(functions/add_generic_test)
 
@@ -0,0 +1,329 @@
+//! @file
+//! math/linear_algebra/dispatched.h
+//!
+//! @brief
+//! Linear algebra functions that select their implementation at runtime depending on the CPU features.
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/type.h"
+#include "mjolnir/core/x86/dispatch.h"
+
+#include <array>
+#include <span>
+
+// === DECLARATIONS ===================================================================================================
+
+//! @brief
+//! Contains functions that are dispatched at runtime to the implementation of the active instruction set tier.
+//!
+//! @details
+//! The functions take their data as plain arrays, so that the caller doesn't need to know which vector registers are
+//! available on the executing CPU. See `x86::get_instruction_set_tier` and `x86::force_instruction_set_tier` for
+//! details about the tier selection.
+//!
+//! In contrast to the rest of the library, the implementations are not header-only. They are compiled into the static
+//! library `mjolnir_core_dispatched`, which has to be linked.
+namespace mjolnir::dispatched
+{
+//! \addtogroup core_math
+//! @{
+
+
+//! @brief
+//! Concept for the element types that are supported by the dispatched functions
+//!
+//! @tparam T_Type:
+//! Type
+template <typename T_Type>
+concept FloatingPoint = is_any_of<T_Type, F32, F64>();
+
+
+//! @brief
+//! Calculate the cross product of two 3d-vectors
+//!
+//! @tparam T_Type:
+//! Data type of the vector elements and the returned value
+//!
+//! @param[in] lhs:
+//! Data of the vector on the left-hand side of the operator
+//! @param[in] rhs:
+//! Data of the vector on the right-hand side of the operator
+//!
+//! @return
+//! Cross product
+template <FloatingPoint T_Type>
+[[nodiscard]] inline auto cross_product(const std::array<T_Type, 3>& lhs, const std::array<T_Type, 3>& rhs)
+        -> std::array<T_Type, 3>;
+
+
+//! @brief
+//! Calculate the determinant of a 2x2 matrix.
+//!
+//! @tparam T_Type
+//! The type of the matrix elements and the returned value
+//!
+//! @param[in] mat:
+//! The matrix data as array in row-major or column-major format
+//!
+//! @return
+//! Determinant of the matrix
+template <FloatingPoint T_Type>
+[[nodiscard]] inline auto determinant_2x2(const std::array<T_Type, 4>& mat) -> T_Type;
+
+
+//! @brief
+//! Calculate the determinant of a 3x3 matrix.
+//!
+//! @tparam T_Type
+//! The type of the matrix elements and the returned value
+//!
+//! @param[in] mat:
+//! The matrix data as array in row-major or column-major format
+//!
+//! @return
+//! Determinant of the matrix
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] inline auto determinant_3x3(const std::array<T_Type, 9>& mat) -> T_Type;
+
+
+//! @brief
+//! Calculate the determinant of a 4x4 matrix.
+//!
+//! @tparam T_Type
+//! The type of the matrix elements and the returned value
+//!
+//! @param[in] mat:
+//! The matrix data as array in row-major or column-major format
+//!
+//! @return
+//! Determinant of the matrix
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] inline auto determinant_4x4(const std::array<T_Type, 16>& mat) -> T_Type;
+
+
+//! @brief
+//! Calculate the dot product of 2 vectors
+//!
+//! @tparam t_size:
+//! Size of the vector
+//! @tparam T_Type:
+//! Data type of the vector elements and the returned value
+//!
+//! @param[in] lhs:
+//! Data of the vector on the left-hand side of the operator
+//! @param[in] rhs:
+//! Data of the vector on the right-hand side of the operator
+//!
+//! @return
+//! Dot product
+template <UST t_size, FloatingPoint T_Type>
+[[nodiscard]] inline auto dot_product(const std::array<T_Type, t_size>& lhs, const std::array<T_Type, t_size>& rhs)
+        -> T_Type;
+
+
+//! @brief
+//! Return the sum of all elements of an array.
+//!
+//! @tparam t_size:
+//! Size of the array
+//! @tparam T_Type:
+//! Data type of the array elements and the returned value
+//!
+//! @param[in] data:
+//! Array data
+//!
+//! @return
+//! Sum of all elements
+template <UST t_size, FloatingPoint T_Type>
+[[nodiscard]] inline auto element_sum(const std::array<T_Type, t_size>& data) -> T_Type;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// The kernels of each instruction set tier are defined in their own source file (`dispatched_<tier>.cpp`), which is
+// compiled for the instruction set of the tier. Each tier has its own namespace, so that the linker can't merge the
+// kernels of different tiers. Tiers that don't provide a kernel for an operation use the one of the next lower tier
+// instead.
+
+namespace scalar
+{
+template <FloatingPoint T_Type>
+[[nodiscard]] auto cross_product(const std::array<T_Type, 3>& lhs, const std::array<T_Type, 3>& rhs) noexcept
+        -> std::array<T_Type, 3>;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto determinant_2x2(const std::array<T_Type, 4>& mat) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_3x3(const std::array<T_Type, 9>& mat) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_4x4(const std::array<T_Type, 16>& mat) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto dot_product(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto element_sum(std::span<const T_Type> data) noexcept -> T_Type;
+} // namespace scalar
+
+namespace sse4_2
+{
+template <FloatingPoint T_Type>
+[[nodiscard]] auto dot_product(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto element_sum(std::span<const T_Type> data) noexcept -> T_Type;
+} // namespace sse4_2
+
+namespace avx2
+{
+template <FloatingPoint T_Type>
+[[nodiscard]] auto cross_product(const std::array<T_Type, 3>& lhs, const std::array<T_Type, 3>& rhs) noexcept
+        -> std::array<T_Type, 3>;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto determinant_2x2(const std::array<T_Type, 4>& mat) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_3x3(const std::array<T_Type, 9>& mat) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_4x4(const std::array<T_Type, 16>& mat) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto dot_product(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto element_sum(std::span<const T_Type> data) noexcept -> T_Type;
+} // namespace avx2
+
+namespace avx512
+{
+template <FloatingPoint T_Type>
+[[nodiscard]] auto dot_product(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type;
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto element_sum(std::span<const T_Type> data) noexcept -> T_Type;
+} // namespace avx512
+
+
+// The vectorized cross product and determinants are based on FMA instructions. Hence, they don't provide an `SSE4_2`
+// kernel. They also gain nothing from 512 bit registers and don't provide an `AVX512` kernel.
+
+template <FloatingPoint T_Type>
+inline constexpr x86::DispatchedFunction<std::array<T_Type, 3>(const std::array<T_Type, 3>&,
+                                                               const std::array<T_Type, 3>&)>
+        cross_product_function{&scalar::cross_product<T_Type>, nullptr, &avx2::cross_product<T_Type>};
+
+template <FloatingPoint T_Type>
+inline constexpr x86::DispatchedFunction<T_Type(const std::array<T_Type, 4>&)> determinant_2x2_function{
+        &scalar::determinant_2x2<T_Type>, nullptr, &avx2::determinant_2x2<T_Type>};
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+inline constexpr x86::DispatchedFunction<T_Type(const std::array<T_Type, 9>&)> determinant_3x3_function{
+        &scalar::determinant_3x3<T_Type>, nullptr, &avx2::determinant_3x3<T_Type>};
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+inline constexpr x86::DispatchedFunction<T_Type(const std::array<T_Type, 16>&)> determinant_4x4_function{
+        &scalar::determinant_4x4<T_Type>, nullptr, &avx2::determinant_4x4<T_Type>};
+
+template <FloatingPoint T_Type>
+inline constexpr x86::DispatchedFunction<T_Type(std::span<const T_Type>, std::span<const T_Type>)>
+        dot_product_function{&scalar::dot_product<T_Type>,
+                             &sse4_2::dot_product<T_Type>,
+                             &avx2::dot_product<T_Type>,
+                             &avx512::dot_product<T_Type>};
+
+template <FloatingPoint T_Type>
+inline constexpr x86::DispatchedFunction<T_Type(std::span<const T_Type>)> element_sum_function{
+        &scalar::element_sum<T_Type>,
+        &sse4_2::element_sum<T_Type>,
+        &avx2::element_sum<T_Type>,
+        &avx512::element_sum<T_Type>};
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::dispatched
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+namespace mjolnir::dispatched
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] inline auto cross_product(const std::array<T_Type, 3>& lhs, const std::array<T_Type, 3>& rhs)
+        -> std::array<T_Type, 3>
+{
+    return internal::cross_product_function<T_Type>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] inline auto determinant_2x2(const std::array<T_Type, 4>& mat) -> T_Type
+{
+    return internal::determinant_2x2_function<T_Type>(mat);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] inline auto determinant_3x3(const std::array<T_Type, 9>& mat) -> T_Type
+{
+    return internal::determinant_3x3_function<T_Type>(mat);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] inline auto determinant_4x4(const std::array<T_Type, 16>& mat) -> T_Type
+{
+    return internal::determinant_4x4_function<T_Type>(mat);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, FloatingPoint T_Type>
+[[nodiscard]] inline auto dot_product(const std::array<T_Type, t_size>& lhs, const std::array<T_Type, t_size>& rhs)
+        -> T_Type
+{
+    return internal::dot_product_function<T_Type>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, FloatingPoint T_Type>
+[[nodiscard]] inline auto element_sum(const std::array<T_Type, t_size>& data) -> T_Type
+{
+    return internal::element_sum_function<T_Type>(data);
+}
+
+
+} // namespace mjolnir::dispatched
@@ -0,0 +1,95 @@
+//! @file
+//! math/linear_algebra/dispatched_avx2.cpp
+//!
+//! @brief
+//! Defines the kernels of the `AVX2` tier. The file is compiled with AVX2 and FMA support.
+
+
+#include "mjolnir/core/math/linear_algebra/dispatched_kernels.h"
+
+
+//! \cond DO_NOT_DOCUMENT
+namespace mjolnir::dispatched::internal::avx2
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto cross_product(const std::array<T_Type, 3>& lhs, const std::array<T_Type, 3>& rhs) noexcept
+        -> std::array<T_Type, 3>
+{
+    return cross_product_kernel<InstructionSetTier::AVX2, T_Type>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto determinant_2x2(const std::array<T_Type, 4>& mat) noexcept -> T_Type
+{
+    return determinant_2x2_kernel<InstructionSetTier::AVX2, T_Type>(mat);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_3x3(const std::array<T_Type, 9>& mat) noexcept -> T_Type
+{
+    return determinant_3x3_kernel<InstructionSetTier::AVX2, T_Type>(mat);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_4x4(const std::array<T_Type, 16>& mat) noexcept -> T_Type
+{
+    return determinant_4x4_kernel<InstructionSetTier::AVX2, T_Type>(mat);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto dot_product(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type
+{
+    return dot_product_kernel<InstructionSetTier::AVX2, T_Type>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto element_sum(std::span<const T_Type> data) noexcept -> T_Type
+{
+    return element_sum_kernel<InstructionSetTier::AVX2, T_Type>(data);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// clang-format off
+template auto cross_product<F32>(const std::array<F32, 3>&, const std::array<F32, 3>&) noexcept -> std::array<F32, 3>;
+template auto cross_product<F64>(const std::array<F64, 3>&, const std::array<F64, 3>&) noexcept -> std::array<F64, 3>;
+
+template auto determinant_2x2<F32>(const std::array<F32, 4>&) noexcept -> F32;
+template auto determinant_2x2<F64>(const std::array<F64, 4>&) noexcept -> F64;
+
+template auto determinant_3x3<F32>(const std::array<F32, 9>&) noexcept -> F32;
+template auto determinant_3x3<F64>(const std::array<F64, 9>&) noexcept -> F64;
+
+template auto determinant_4x4<F32>(const std::array<F32, 16>&) noexcept -> F32;
+template auto determinant_4x4<F64>(const std::array<F64, 16>&) noexcept -> F64;
+
+template auto dot_product<F32>(std::span<const F32>, std::span<const F32>) noexcept -> F32;
+template auto dot_product<F64>(std::span<const F64>, std::span<const F64>) noexcept -> F64;
+
+template auto element_sum<F32>(std::span<const F32>) noexcept -> F32;
+template auto element_sum<F64>(std::span<const F64>) noexcept -> F64;
+// clang-format on
+
+
+} // namespace mjolnir::dispatched::internal::avx2
+//! \endcond
@@ -0,0 +1,44 @@
+//! @file
+//! math/linear_algebra/dispatched_avx512.cpp
+//!
+//! @brief
+//! Defines the kernels of the `AVX512` tier. The file is compiled with AVX2, FMA and AVX-512F support.
+
+
+#include "mjolnir/core/math/linear_algebra/dispatched_kernels.h"
+
+
+//! \cond DO_NOT_DOCUMENT
+namespace mjolnir::dispatched::internal::avx512
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto dot_product(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type
+{
+    return dot_product_kernel<InstructionSetTier::AVX512, T_Type>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatingPoint T_Type>
+[[nodiscard]] auto element_sum(std::span<const T_Type> data) noexcept -> T_Type
+{
+    return element_sum_kernel<InstructionSetTier::AVX512, T_Type>(data);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// clang-format off
+template auto dot_product<F32>(std::span<const F32>, std::span<const F32>) noexcept -> F32;
+template auto dot_product<F64>(std::span<const F64>, std::span<const F64>) noexcept -> F64;
+
+template auto element_sum<F32>(std::span<const F32>) noexcept -> F32;
+template auto element_sum<F64>(std::span<const F64>) noexcept -> F64;
+// clang-format on
+
+
+} // namespace mjolnir::dispatched::internal::avx512
+//! \endcond
@@ -0,0 +1,391 @@
+//! @file
+//! math/linear_algebra/dispatched_kernels.h
+//!
+//! @brief
+//! Contains the implementations of the kernels of the functions in `dispatched.h`.
+//!
+//! @details
+//! This header must only be included by the source files that define the kernels of an instruction set tier. Each of
+//! them is compiled for the instruction set of its tier, and the implementations inherit it from the translation unit.
+//!
+//! Inline functions that are compiled in more than one of these files are kept as a single copy by the linker, which
+//! might use the instruction set of a higher tier. Therefore, everything in this header is placed into an anonymous
+//! namespace, and the loops over arbitrarily sized arrays use the intrinsics directly instead of the functions of the
+//! x86 module. The vectorized cross product and determinants use the register functions of the library, since the
+//! `AVX2` tier is the only one that provides them.
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/math/linear_algebra/determinant.h"
+#include "mjolnir/core/math/linear_algebra/dispatched.h"
+#include "mjolnir/core/math/linear_algebra/vector_operations.h"
+#include "mjolnir/core/utility/type.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/dispatch.h"
+#include "mjolnir/core/x86/intrinsics.h"
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// === DECLARATIONS ===================================================================================================
+
+//! \cond DO_NOT_DOCUMENT
+namespace mjolnir::dispatched::internal
+{
+namespace // NOLINT(cert-dcl59-cpp, google-build-namespaces)
+{
+using x86::InstructionSetTier;
+
+//! Register type with 2 or more elements that is used by the vectorized kernels of 2d operations
+template <FloatingPoint T_Type>
+using Vector2RegisterType = std::conditional_t<std::is_same_v<T_Type, F32>, __m128, __m128d>;
+
+//! Register type with 4 or more elements that is used by the vectorized kernels of 3d and 4d operations
+template <FloatingPoint T_Type>
+using Vector4RegisterType = std::conditional_t<std::is_same_v<T_Type, F32>, __m128, __m256d>;
+
+//! Widest register type of a tier that is used by the vectorized kernels of operations on arbitrarily sized arrays
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+using WideRegisterType = std::conditional_t<
+        t_tier == InstructionSetTier::AVX512,
+        std::conditional_t<std::is_same_v<T_Type, F32>, __m512, __m512d>,
+        std::conditional_t<t_tier == InstructionSetTier::AVX2,
+                           std::conditional_t<std::is_same_v<T_Type, F32>, __m256, __m256d>,
+                           std::conditional_t<std::is_same_v<T_Type, F32>, __m128, __m128d>>>;
+
+//! Load `t_num_values` array values starting at `t_offset` into a register. The remaining elements are set to zero.
+template <x86::FloatVectorRegister T_RegisterType, UST t_offset, UST t_num_values, FloatingPoint T_Type, UST t_size>
+[[nodiscard]] inline auto load_values(const std::array<T_Type, t_size>& data) noexcept -> T_RegisterType;
+
+//! Return a register of the widest type of the tier with all elements set to zero
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_setzero() noexcept -> WideRegisterType<t_tier, T_Type>;
+
+//! Load a register of the widest type of the tier from a pointer without alignment requirements
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_loadu(const T_Type* ptr) noexcept -> WideRegisterType<t_tier, T_Type>;
+
+//! Return `lhs + rhs` for registers of the widest type of the tier
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_add(WideRegisterType<t_tier, T_Type> lhs, WideRegisterType<t_tier, T_Type> rhs) noexcept
+        -> WideRegisterType<t_tier, T_Type>;
+
+//! Return `a * b + c` for registers of the widest type of the tier. The `SSE4_2` tier has no FMA support and uses a
+//! separate multiplication and addition.
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_multiply_add(WideRegisterType<t_tier, T_Type> a,
+                                            WideRegisterType<t_tier, T_Type> b,
+                                            WideRegisterType<t_tier, T_Type> c) noexcept
+        -> WideRegisterType<t_tier, T_Type>;
+
+//! Return the sum of all elements of a register of the widest type of the tier
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_element_sum(WideRegisterType<t_tier, T_Type> reg) noexcept -> T_Type;
+} // namespace
+} // namespace mjolnir::dispatched::internal
+//! \endcond
+
+
+// === DEFINITIONS ====================================================================================================
+
+//! \cond DO_NOT_DOCUMENT
+namespace mjolnir::dispatched::internal
+{
+namespace // NOLINT(cert-dcl59-cpp, google-build-namespaces)
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <x86::FloatVectorRegister T_RegisterType, UST t_offset, UST t_num_values, FloatingPoint T_Type, UST t_size>
+[[nodiscard]] inline auto load_values(const std::array<T_Type, t_size>& data) noexcept -> T_RegisterType
+{
+    static_assert(t_num_values <= x86::num_elements<T_RegisterType>, "Values don't fit into the register.");
+    static_assert(t_offset + t_num_values <= t_size, "Values exceed the array size.");
+
+    // The index is clamped to avoid out of bounds warnings for the unused branch of the conditional operator
+    return [&data]<UST... t_i>(std::index_sequence<t_i...>) {
+        return x86::mm_setr<T_RegisterType>(
+                (t_i < t_num_values) ? std::get<std::min(t_offset + t_i, t_size - 1)>(data) : T_Type(0)...);
+    }(std::make_index_sequence<x86::num_elements<T_RegisterType>>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_setzero() noexcept -> WideRegisterType<t_tier, T_Type>
+{
+    using RegisterType = WideRegisterType<t_tier, T_Type>;
+
+    // NOLINTBEGIN(portability-simd-intrinsics)
+    if constexpr (std::is_same_v<RegisterType, __m128>)
+        return _mm_setzero_ps();
+    else if constexpr (std::is_same_v<RegisterType, __m128d>)
+        return _mm_setzero_pd();
+    else if constexpr (std::is_same_v<RegisterType, __m256>)
+        return _mm256_setzero_ps();
+    else if constexpr (std::is_same_v<RegisterType, __m256d>)
+        return _mm256_setzero_pd();
+    else if constexpr (std::is_same_v<RegisterType, __m512>)
+        return _mm512_setzero_ps();
+    else
+        return _mm512_setzero_pd();
+    // NOLINTEND(portability-simd-intrinsics)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_loadu(const T_Type* ptr) noexcept -> WideRegisterType<t_tier, T_Type>
+{
+    using RegisterType = WideRegisterType<t_tier, T_Type>;
+
+    // NOLINTBEGIN(portability-simd-intrinsics)
+    if constexpr (std::is_same_v<RegisterType, __m128>)
+        return _mm_loadu_ps(ptr);
+    else if constexpr (std::is_same_v<RegisterType, __m128d>)
+        return _mm_loadu_pd(ptr);
+    else if constexpr (std::is_same_v<RegisterType, __m256>)
+        return _mm256_loadu_ps(ptr);
+    else if constexpr (std::is_same_v<RegisterType, __m256d>)
+        return _mm256_loadu_pd(ptr);
+    else if constexpr (std::is_same_v<RegisterType, __m512>)
+        return _mm512_loadu_ps(ptr);
+    else
+        return _mm512_loadu_pd(ptr);
+    // NOLINTEND(portability-simd-intrinsics)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_add(WideRegisterType<t_tier, T_Type> lhs, WideRegisterType<t_tier, T_Type> rhs) noexcept
+        -> WideRegisterType<t_tier, T_Type>
+{
+    using RegisterType = WideRegisterType<t_tier, T_Type>;
+
+    // NOLINTBEGIN(portability-simd-intrinsics)
+    if constexpr (std::is_same_v<RegisterType, __m128>)
+        return _mm_add_ps(lhs, rhs);
+    else if constexpr (std::is_same_v<RegisterType, __m128d>)
+        return _mm_add_pd(lhs, rhs);
+    else if constexpr (std::is_same_v<RegisterType, __m256>)
+        return _mm256_add_ps(lhs, rhs);
+    else if constexpr (std::is_same_v<RegisterType, __m256d>)
+        return _mm256_add_pd(lhs, rhs);
+    else if constexpr (std::is_same_v<RegisterType, __m512>)
+        return _mm512_add_ps(lhs, rhs);
+    else
+        return _mm512_add_pd(lhs, rhs);
+    // NOLINTEND(portability-simd-intrinsics)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_multiply_add(WideRegisterType<t_tier, T_Type> a,
+                                            WideRegisterType<t_tier, T_Type> b,
+                                            WideRegisterType<t_tier, T_Type> c) noexcept
+        -> WideRegisterType<t_tier, T_Type>
+{
+    using RegisterType = WideRegisterType<t_tier, T_Type>;
+
+    // NOLINTBEGIN(portability-simd-intrinsics)
+    if constexpr (std::is_same_v<RegisterType, __m128>)
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    else if constexpr (std::is_same_v<RegisterType, __m128d>)
+        return _mm_add_pd(_mm_mul_pd(a, b), c);
+    else if constexpr (std::is_same_v<RegisterType, __m256>)
+        return _mm256_fmadd_ps(a, b, c);
+    else if constexpr (std::is_same_v<RegisterType, __m256d>)
+        return _mm256_fmadd_pd(a, b, c);
+    else if constexpr (std::is_same_v<RegisterType, __m512>)
+        return _mm512_fmadd_ps(a, b, c);
+    else
+        return _mm512_fmadd_pd(a, b, c);
+    // NOLINTEND(portability-simd-intrinsics)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] inline auto wide_element_sum(WideRegisterType<t_tier, T_Type> reg) noexcept -> T_Type
+{
+    using RegisterType = WideRegisterType<t_tier, T_Type>;
+
+    std::array<T_Type, sizeof(RegisterType) / sizeof(T_Type)> values = {};
+
+    // NOLINTBEGIN(portability-simd-intrinsics)
+    if constexpr (std::is_same_v<RegisterType, __m128>)
+        _mm_storeu_ps(values.data(), reg);
+    else if constexpr (std::is_same_v<RegisterType, __m128d>)
+        _mm_storeu_pd(values.data(), reg);
+    else if constexpr (std::is_same_v<RegisterType, __m256>)
+        _mm256_storeu_ps(values.data(), reg);
+    else if constexpr (std::is_same_v<RegisterType, __m256d>)
+        _mm256_storeu_pd(values.data(), reg);
+    else if constexpr (std::is_same_v<RegisterType, __m512>)
+        _mm512_storeu_ps(values.data(), reg);
+    else
+        _mm512_storeu_pd(values.data(), reg);
+    // NOLINTEND(portability-simd-intrinsics)
+
+    T_Type sum = 0;
+    for (auto value : values)
+        sum += value;
+    return sum;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] auto cross_product_kernel(const std::array<T_Type, 3>& lhs, const std::array<T_Type, 3>& rhs) noexcept
+        -> std::array<T_Type, 3>
+{
+    if constexpr (t_tier == InstructionSetTier::SCALAR)
+        return mjolnir::cross_product(lhs, rhs);
+    else
+    {
+        using RegisterType = Vector4RegisterType<T_Type>;
+
+        RegisterType result = mjolnir::cross_product(load_values<RegisterType, 0, 3>(lhs),
+                                                     load_values<RegisterType, 0, 3>(rhs));
+
+        return {{x86::get<0>(result), x86::get<1>(result), x86::get<2>(result)}};
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] auto determinant_2x2_kernel(const std::array<T_Type, 4>& mat) noexcept -> T_Type
+{
+    if constexpr (t_tier == InstructionSetTier::SCALAR)
+        return mjolnir::determinant_2x2(mat);
+    else
+    {
+        using RegisterType = Vector2RegisterType<T_Type>;
+
+        std::array<RegisterType, 2> rows = {{load_values<RegisterType, 0, 2>(mat),
+                                             load_values<RegisterType, 2, 2>(mat)}};
+        return mjolnir::determinant_2x2(rows);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_3x3_kernel(const std::array<T_Type, 9>& mat) noexcept -> T_Type
+{
+    if constexpr (t_tier == InstructionSetTier::SCALAR)
+        return mjolnir::determinant_3x3(mat);
+    else
+    {
+        using RegisterType = Vector4RegisterType<T_Type>;
+
+        std::array<RegisterType, 3> rows = {{load_values<RegisterType, 0, 3>(mat),
+                                             load_values<RegisterType, 3, 3>(mat),
+                                             load_values<RegisterType, 6, 3>(mat)}};
+        return mjolnir::determinant_3x3(rows);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+// NOLINTNEXTLINE(readability-magic-numbers)
+[[nodiscard]] auto determinant_4x4_kernel(const std::array<T_Type, 16>& mat) noexcept -> T_Type
+{
+    if constexpr (t_tier == InstructionSetTier::SCALAR)
+        return mjolnir::determinant_4x4(mat);
+    else
+    {
+        using RegisterType = Vector4RegisterType<T_Type>;
+
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        std::array<RegisterType, 4> rows = {{load_values<RegisterType, 0, 4>(mat),
+                                             load_values<RegisterType, 4, 4>(mat),
+                                             load_values<RegisterType, 8, 4>(mat),
+                                             load_values<RegisterType, 12, 4>(mat)}};
+        return mjolnir::determinant_4x4(rows);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] auto dot_product_kernel(std::span<const T_Type> lhs, std::span<const T_Type> rhs) noexcept -> T_Type
+{
+    const T_Type* lhs_data = lhs.data();
+    const T_Type* rhs_data = rhs.data();
+    const UST     size     = lhs.size();
+
+    T_Type sum = 0;
+    UST    idx = 0;
+
+    if constexpr (t_tier != InstructionSetTier::SCALAR)
+    {
+        constexpr UST n_e = sizeof(WideRegisterType<t_tier, T_Type>) / sizeof(T_Type);
+
+        auto sum_register = wide_setzero<t_tier, T_Type>();
+        for (; idx + n_e <= size; idx += n_e)
+            sum_register = wide_multiply_add<t_tier, T_Type>(wide_loadu<t_tier>(lhs_data + idx), // NOLINT
+                                                             wide_loadu<t_tier>(rhs_data + idx), // NOLINT
+                                                             sum_register);
+
+        sum = wide_element_sum<t_tier, T_Type>(sum_register);
+    }
+
+    for (; idx < size; ++idx)
+        sum += lhs_data[idx] * rhs_data[idx]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return sum;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <InstructionSetTier t_tier, FloatingPoint T_Type>
+[[nodiscard]] auto element_sum_kernel(std::span<const T_Type> data) noexcept -> T_Type
+{
+    const T_Type* values = data.data();
+    const UST     size   = data.size();
+
+    T_Type sum = 0;
+    UST    idx = 0;
+
+    if constexpr (t_tier != InstructionSetTier::SCALAR)
+    {
+        constexpr UST n_e = sizeof(WideRegisterType<t_tier, T_Type>) / sizeof(T_Type);
+
+        auto sum_register = wide_setzero<t_tier, T_Type>();
+        for (; idx + n_e <= size; idx += n_e)
+            sum_register = wide_add<t_tier, T_Type>(sum_register, wide_loadu<t_tier>(values + idx)); // NOLINT
+
+        sum = wide_element_sum<t_tier, T_Type>(sum_register);
+    }
+
+    for (; idx < size; ++idx)
+        sum += values[idx]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return sum;
+}
+
+
+} // namespace
+} // namespace mjolnir::dispatched::internal
+//! \endcond
@@ -14,6 +14,7 @@
 
 #include <concepts>
 #include <memory>
+#include <new>
 
 
 namespace mjolnir
@@ -26,6 +27,20 @@ namespace mjolnir
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
 using DefaultMemoryDeleter = std::default_delete<std::byte[]>;
 
+//! @brief
+//! Size of a cache line in bytes.
+//!
+//! @details
+//! Uses `std::hardware_destructive_interference_size` if the standard library provides it and 64 bytes otherwise.
+//! Objects that are accessed by different threads should be placed at least this far apart to avoid false sharing.
+//! GCC is excluded because it warns about using the value in headers since it depends on the `-mtune` option.
+#if defined(__cpp_lib_hardware_interference_size) && (!defined(__GNUC__) || defined(__clang__))
+inline constexpr UST cache_line_size = std::hardware_destructive_interference_size;
+#else
+inline constexpr UST cache_line_size = 64; // NOLINT(readability-magic-numbers)
+#endif
+
+
 //! @brief
 //! Concept for a memory system
 //!
@@ -0,0 +1,366 @@
+//! @file
+//! memory/inline_linear_memory.h
+//!
+//! @brief
+//! Defines a linear memory system with a fixed capacity that stores its memory inside of the class instance
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/math/math.h"
+#include "mjolnir/core/memory/definitions.h"
+#include "mjolnir/core/memory/memory_system_allocator.h"
+#include "mjolnir/core/memory/memory_system_deleter.h"
+#include "mjolnir/core/memory/utility.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace mjolnir
+{
+// --- InlineLinearMemory ---------------------------------------------------------------------------------------------
+
+//! \addtogroup core_memory
+//! @{
+
+//! @brief
+//! A linear memory system with a capacity that is fixed at compile-time.
+//!
+//! @details
+//! This memory system works like `LinearMemory`, but the managed memory is a member array of the class instead of a
+//! separate heap allocation. Therefore, it needs no initialization and the memory is located wherever the instance
+//! lives, for example, on the stack or inside of another object. Internally, the current position is stored as an
+//! offset from the start of the member array, which lets most of the functionality work in `constexpr` contexts.
+//!
+//! Since pointers to the memory refer to the member array, the class can neither be copied nor moved.
+//!
+//! @tparam t_size:
+//! Size of the internal memory in bytes
+//! @tparam t_alignment:
+//! Alignment of the internal memory. Allocations that require a larger alignment are supported, but they are not
+//! available in `constexpr` contexts and might waste memory for padding.
+template <UST t_size, UST t_alignment = alignof(std::max_align_t)>
+class InlineLinearMemory
+{
+    static_assert(t_size > 0, "Memory size must be larger than 0.");
+    static_assert(is_power_of_2(t_alignment), "Alignment must be a power of 2.");
+
+public:
+    //! @brief
+    //! Compatible allocator type that can be used with STL containers.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be allocated.
+    template <typename T_Type>
+    using MemoryAllocatorType = MemorySystemAllocator<T_Type, InlineLinearMemory<t_size, t_alignment>>;
+
+    //! @brief
+    //! Compatible deleter type that can be used with `std::unique_ptr` etc.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be deleted.
+    template <typename T_Type>
+    using MemoryDeleterType = MemorySystemDeleter<T_Type, InlineLinearMemory<t_size, t_alignment>>;
+
+    InlineLinearMemory(const InlineLinearMemory&)     = delete;
+    InlineLinearMemory(InlineLinearMemory&&) noexcept = delete;
+    ~InlineLinearMemory()                             = default;
+    auto operator=(const InlineLinearMemory&) -> InlineLinearMemory& = delete;
+    auto operator=(InlineLinearMemory&&) noexcept -> InlineLinearMemory& = delete;
+
+
+    //! @brief
+    //! Construct a new instance
+    //!
+    //! @details
+    //! The internal memory is not initialized.
+    constexpr InlineLinearMemory() noexcept = default;
+
+
+    //! @brief
+    //! Allocate a new memory block and return a pointer that points to it.
+    //!
+    //! @param[in] size:
+    //! Size of the allocation
+    //! @param[in] alignment:
+    //! Required alignment of the memory
+    //!
+    //! @return
+    //! Pointer to the newly allocated memory
+    //!
+    //! @exception AllocationError
+    //! There is not enough memory available
+    [[nodiscard]] constexpr auto allocate(UST size, UST alignment = 1) -> void*;
+
+
+    //! @brief
+    //! Create an instance of `T_Type` inside a newly allocated memory block and return the pointer to it.
+    //!
+    //! @tparam T_Type:
+    //! The type that should be created
+    //! @tparam T_Args:
+    //! Types of the constructor arguments
+    //!
+    //! @param[in] args:
+    //! Arguments that should be passed to the constructor of the created type.
+    //!
+    //! @return
+    //! Pointer to the created instance of `T_Type`
+    //!
+    //! @exception AllocationError
+    //! There is not enough memory available
+    template <typename T_Type, typename... T_Args>
+    [[nodiscard]] auto allocate_construct(T_Args&&... args) -> T_Type*;
+
+
+    //! @brief
+    //! Deallocate memory.
+    //!
+    //! @details
+    //! In release builds this function does nothing. In debug builds some additional checks are performed. In contrast
+    //! to `LinearMemory`, the function is not `const` since the debug bookkeeping can't use a `mutable` member in
+    //! `constexpr` contexts.
+    //!
+    //! @param[in] ptr:
+    //! Pointer to the memory that should be freed
+    //! @param[in] size:
+    //! Size of the memory that should be freed.
+    //! @param[in] alignment:
+    //! Alignment of the pointer.
+    constexpr void deallocate([[maybe_unused]] void* ptr,
+                              [[maybe_unused]] UST   size,
+                              [[maybe_unused]] UST   alignment = 1) noexcept;
+
+
+    //! @brief
+    //! Destroy the passed object and release its memory.
+    //!
+    //! @tparam T_Type
+    //! Type of the passed object
+    //!
+    //! @param[in] pointer:
+    //! Pointer to the object that should be destroyed
+    template <typename T_Type>
+    void destroy_deallocate(T_Type* pointer) noexcept;
+
+
+    //! @brief
+    //! Get an allocator that allocates and deallocates memory for the specified type from this memory system
+    //!
+    //! @tparam T_Type
+    //! Type that should be allocated
+    //!
+    //! @return
+    //! Allocator of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_allocator() noexcept -> MemoryAllocatorType<T_Type>;
+
+
+    //! @brief
+    //! Get a deleter that deletes the specified type from this memory system
+    //!
+    //! @tparam T_Type
+    //! Type that should be deleted
+    //!
+    //! @return
+    //! Deleter of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_deleter() noexcept -> MemoryDeleterType<T_Type>;
+
+
+    //! @brief
+    //! Get the size of the free memory.
+    //!
+    //! @return
+    //! Size of the free memory
+    [[nodiscard]] constexpr auto get_free_memory_size() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get the size of the internal memory.
+    //!
+    //! @return
+    //! Size of the memory
+    [[nodiscard]] static constexpr auto get_memory_size() noexcept -> UST;
+
+
+    //! @brief
+    //! Reset the internal memory
+    //!
+    //! @details
+    //! Resets the internal offset to the start of the memory block so that it can be reused. Only debug builds will
+    //! check if the number of deallocations matches the number of allocations. In release builds the memory is reset
+    //! without any further tests. So make sure none of the memory is used anymore.
+    constexpr void reset() noexcept;
+
+
+private:
+    //! @brief
+    //! Get the offset of the next address after the current position that fulfills the alignment requirement.
+    //!
+    //! @param[in] alignment:
+    //! Required alignment
+    //!
+    //! @return
+    //! Aligned offset
+    [[nodiscard]] constexpr auto get_aligned_offset(UST alignment) const noexcept -> UST;
+
+
+    UST m_offset = {0};
+    alignas(t_alignment) std::array<std::byte, t_size> m_memory;
+
+#ifndef NDEBUG
+    UST m_num_allocations = {0};
+#endif
+};
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+namespace mjolnir
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+[[nodiscard]] constexpr auto InlineLinearMemory<t_size, t_alignment>::allocate(UST size, UST alignment) -> void*
+{
+    assert(size != 0 && "Allocated memory size is 0."); // NOLINT
+
+    UST offset      = get_aligned_offset(alignment);
+    UST next_offset = offset + size;
+
+    THROW_EXCEPTION_IF(next_offset > t_size, AllocationError, "No more memory available.");
+
+    m_offset = next_offset;
+
+#ifndef NDEBUG
+    ++m_num_allocations;
+#endif
+
+    return m_memory.data() + offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+template <typename T_Type, typename... T_Args>
+[[nodiscard]] auto InlineLinearMemory<t_size, t_alignment>::allocate_construct(T_Args&&... args) -> T_Type*
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return new (allocate(sizeof(T_Type), alignof(T_Type))) T_Type(std::forward<T_Args>(args)...);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+constexpr void InlineLinearMemory<t_size, t_alignment>::deallocate([[maybe_unused]] void* ptr,
+                                                                   [[maybe_unused]] UST   size,
+                                                                   [[maybe_unused]] UST   alignment) noexcept
+{
+#ifndef NDEBUG
+    assert(ptr != nullptr && "Pointer is the `nullptr`.");                 // NOLINT
+    assert(m_num_allocations > 0 && "Deallocation was called too often"); // NOLINT
+
+    if (! std::is_constant_evaluated())
+    {
+        // NOLINTNEXTLINE
+        assert(is_pointer_in_memory(ptr, m_memory.data(), t_size) && "Pointer doesn't belong to memory.");
+    }
+
+    --m_num_allocations;
+#endif
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+template <typename T_Type>
+void InlineLinearMemory<t_size, t_alignment>::destroy_deallocate(T_Type* pointer) noexcept
+{
+    mjolnir::destroy(pointer);
+    deallocate(pointer, sizeof(T_Type), alignof(T_Type));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+template <typename T_Type>
+[[nodiscard]] auto InlineLinearMemory<t_size, t_alignment>::get_allocator() noexcept -> MemoryAllocatorType<T_Type>
+{
+    return MemoryAllocatorType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+template <typename T_Type>
+[[nodiscard]] auto InlineLinearMemory<t_size, t_alignment>::get_deleter() noexcept -> MemoryDeleterType<T_Type>
+{
+    return MemoryDeleterType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+[[nodiscard]] constexpr auto InlineLinearMemory<t_size, t_alignment>::get_free_memory_size() const noexcept -> UST
+{
+    return t_size - m_offset;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+[[nodiscard]] constexpr auto InlineLinearMemory<t_size, t_alignment>::get_memory_size() noexcept -> UST
+{
+    return t_size;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+constexpr void InlineLinearMemory<t_size, t_alignment>::reset() noexcept
+{
+    assert(m_num_allocations == 0 && "Memory still in use."); // NOLINT
+
+    m_offset = 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_size, UST t_alignment>
+[[nodiscard]] constexpr auto InlineLinearMemory<t_size, t_alignment>::get_aligned_offset(UST alignment) const noexcept
+        -> UST
+{
+    // The start of the memory fulfills `t_alignment`, so smaller alignments only depend on the offset
+    if (alignment <= t_alignment)
+        return align_address(m_offset, alignment);
+
+    UPT start_addr = pointer_to_integer(m_memory.data());
+    return align_address(start_addr + m_offset, alignment) - start_addr;
+}
+
+
+} // namespace mjolnir
@@ -0,0 +1,704 @@
+//! @file
+//! memory/mapped_file_memory.h
+//!
+//! @brief
+//! Defines a linear memory system that is backed by a memory-mapped file
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#if ! defined(__unix__) && ! defined(__APPLE__)
+#error "MappedFileMemory requires POSIX mmap"
+#endif
+
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/memory/definitions.h"
+#include "mjolnir/core/memory/memory_system_allocator.h"
+#include "mjolnir/core/memory/memory_system_deleter.h"
+#include "mjolnir/core/memory/utility.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+
+namespace mjolnir
+{
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! @brief
+//! Header that is stored at the beginning of every file that is managed by a `MappedFileMemory`.
+struct alignas(64) MappedFileHeader // NOLINT(readability-magic-numbers)
+{
+    U64 magic_number = {0};
+    U64 version      = {0};
+    U64 memory_size  = {0};
+    U64 used_size    = {0};
+    U64 root_offset  = {0};
+};
+} // namespace internal
+//! \endcond
+
+
+// --- MappedFileMemory -----------------------------------------------------------------------------------------------
+
+//! \addtogroup core_memory
+//! @{
+
+//! @brief
+//! A linear memory system that is backed by a memory-mapped file.
+//!
+//! @details
+//! This memory system works like the `LinearMemory`, but its memory is part of a file that is mapped into the address
+//! space of the process. The allocation state is stored inside the file. Therefore, all objects that were created in
+//! the memory can be used directly after the file was mapped again during a subsequent run of the program (warm
+//! start). No serialization or deserialization step is necessary.
+//!
+//! Since the file might be mapped to a different address, the stored objects must not contain absolute pointers.
+//! Use the `OffsetPointer` class to link objects that are stored in the same file. Additionally, the stored types
+//! should be trivially copyable or at least not depend on any resources outside of the mapped memory. A single object
+//! can be registered as root object with `set_root`. It can be retrieved after remapping the file with `get_root`.
+//!
+//! Changes are written back to the file by the operating system at an unspecified point in time. Use `sync` to force
+//! the write-back, for example, to create a consistent snapshot.
+//!
+//! @tparam T_Lock:
+//! The type of lock that should be used for thread safety. If the type is set to `void`, the memory is not protected.
+template <typename T_Lock = void>
+class MappedFileMemory
+{
+    static_assert(std::is_same_v<T_Lock, void>, "Not implemented yet");
+
+public:
+    //! @brief
+    //! Compatible allocator type that can be used with STL containers.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be allocated.
+    template <typename T_Type>
+    using MemoryAllocatorType = MemorySystemAllocator<T_Type, MappedFileMemory<T_Lock>>;
+
+    //! @brief
+    //! Compatible deleter type that can be used with `std::unique_ptr` etc.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be deleted.
+    template <typename T_Type>
+    using MemoryDeleterType = MemorySystemDeleter<T_Type, MappedFileMemory<T_Lock>>;
+
+    MappedFileMemory()                            = default;
+    MappedFileMemory(const MappedFileMemory&)     = delete;
+    MappedFileMemory(MappedFileMemory&&) noexcept = delete;
+    ~MappedFileMemory();
+    auto operator=(const MappedFileMemory&) -> MappedFileMemory& = delete;
+    auto operator=(MappedFileMemory&&) noexcept -> MappedFileMemory& = delete;
+
+
+    //! @brief
+    //! Allocate a new memory block and return a pointer that points to it.
+    //!
+    //! @details
+    //! The alignment is only guaranteed to persist if the file is mapped again as long as it does not exceed the page
+    //! size of the system.
+    //!
+    //! @param[in] size:
+    //! Size of the allocation
+    //! @param[in] alignment:
+    //! Required alignment of the memory
+    //!
+    //! @return
+    //! Pointer to the newly allocated memory
+    //!
+    //! @exception AllocationError
+    //! There is not enough memory available
+    [[nodiscard]] auto allocate(UST size, UST alignment = 1) -> void*;
+
+
+    //! @brief
+    //! Create an instance of `T_Type` inside a newly allocated memory block and return the pointer to it.
+    //!
+    //! @tparam T_Type:
+    //! The type that should be created
+    //! @tparam T_Args:
+    //! Types of the constructor arguments
+    //!
+    //! @param[in] args:
+    //! Arguments that should be passed to the constructor of the created type.
+    //!
+    //! @return
+    //! Pointer to the created instance of `T_Type`
+    //!
+    //! @exception AllocationError
+    //! There is not enough memory available
+    template <typename T_Type, typename... T_Args>
+    [[nodiscard]] auto allocate_construct(T_Args&&... args) -> T_Type*;
+
+
+    //! @brief
+    //! Deallocate memory.
+    //!
+    //! @details
+    //! In release builds this function does nothing. In debug builds some additional checks are performed.
+    //!
+    //! @param[in] ptr:
+    //! Pointer to the memory that should be freed
+    //! @param[in] size:
+    //! Size of the memory that should be freed.
+    //! @param[in] alignment:
+    //! Alignment of the pointer.
+    void deallocate([[maybe_unused]] void* ptr,
+                    [[maybe_unused]] UST   size,
+                    [[maybe_unused]] UST   alignment = 1) const noexcept;
+
+
+    //! @brief
+    //! Deinitialize the memory.
+    //!
+    //! @details
+    //! Writes all changes back to the file, unmaps the memory and closes the file. The file itself is not deleted and
+    //! can be used to initialize a memory system again.
+    //!
+    //! @exception RuntimeError
+    //! Memory is already deinitialized or the changes could not be written to the file
+    void deinitialize();
+
+
+    //! @brief
+    //! Destroy the passed object and release its memory.
+    //!
+    //! @tparam T_Type
+    //! Type of the passed object
+    //!
+    //! @param[in] pointer:
+    //! Pointer to the object that should be destroyed
+    template <typename T_Type>
+    void destroy_deallocate(T_Type* pointer) const noexcept;
+
+
+    //! @brief
+    //! Get an allocator that allocates and deallocates memory for the specified type from this memory system
+    //!
+    //! @details
+    //! Note that it is not necessary to initialize the memory system before calling this function. However, using the
+    //! returned allocator before the memory is initialized is undefined behavior.
+    //!
+    //! @tparam T_Type
+    //! Type that should be allocated
+    //!
+    //! @return
+    //! Allocator of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_allocator() noexcept -> MemoryAllocatorType<T_Type>;
+
+
+    //! @brief
+    //! Get a deleter that deletes the specified type from this memory system
+    //!
+    //! @details
+    //! Note that it is not necessary to initialize the memory system before calling this function. However, using the
+    //! returned deleter before the memory is initialized is undefined behavior.
+    //!
+    //! @tparam T_Type
+    //! Type that should be deleted
+    //!
+    //! @return
+    //! Deleter of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_deleter() noexcept -> MemoryDeleterType<T_Type>;
+
+
+    //! @brief
+    //! Get the size of the free memory.
+    //!
+    //! @details
+    //! If the memory was not initialized using `initialize`, this method will return 0
+    //!
+    //! @return
+    //! Size of the free memory
+    [[nodiscard]] auto get_free_memory_size() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get the size of the memory that can be used for allocations.
+    //!
+    //! @details
+    //! If the memory was not initialized using `initialize`, this method will return 0. Note that the file is slightly
+    //! larger since it also contains some management data.
+    //!
+    //! @return
+    //! Size of the memory
+    [[nodiscard]] auto get_memory_size() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get a pointer to the root object.
+    //!
+    //! @tparam T_Type:
+    //! Type of the root object
+    //!
+    //! @return
+    //! Pointer to the root object or `nullptr` if no root object was set.
+    template <typename T_Type>
+    [[nodiscard]] auto get_root() const noexcept -> T_Type*;
+
+
+    //! @brief
+    //! Initialize the class.
+    //!
+    //! @details
+    //! If the file does not exist or is empty, it is created with the required size. Otherwise, the existing file is
+    //! mapped and the allocation state that is stored inside the file is restored. Use `is_restored` to check which of
+    //! both cases occurred.
+    //!
+    //! @param[in] file_path:
+    //! Path of the file that backs the memory
+    //! @param[in] size:
+    //! Desired size of the memory that can be used for allocations.
+    //!
+    //! @exception RuntimeError
+    //! Memory is already initialized, the file could not be opened or mapped, or the file does not contain a valid
+    //! memory of the requested size
+    //! @exception ValueError
+    //! `size` must be larger than `0`
+    void initialize(const std::filesystem::path& file_path, UST size);
+
+
+    //! @brief
+    //! Return `true` if the memory is initialized and `false` otherwise.
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto is_initialized() const noexcept -> bool;
+
+
+    //! @brief
+    //! Return `true` if the memory was restored from an existing file and `false` if a new file was created.
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto is_restored() const noexcept -> bool;
+
+
+    //! @brief
+    //! Reset the internal memory
+    //!
+    //! @details
+    //! Resets the internal pointer to the start of the memory block so that it can be reused. The root object is
+    //! reset too. Only debug builds will check if the number of deallocations matches the number of allocations.
+    void reset() noexcept;
+
+
+    //! @brief
+    //! Register an object that is stored in the memory as root object.
+    //!
+    //! @details
+    //! The root object is the entry point to the data that is stored in the file after it was mapped again.
+    //!
+    //! @tparam T_Type:
+    //! Type of the root object
+    //!
+    //! @param[in] pointer:
+    //! Pointer to the root object. Passing the `nullptr` removes the current root object.
+    template <typename T_Type>
+    void set_root(const T_Type* pointer) noexcept;
+
+
+    //! @brief
+    //! Write all changes back to the file.
+    //!
+    //! @details
+    //! This function blocks until the operating system reports that the data was written.
+    //!
+    //! @exception RuntimeError
+    //! Memory is not initialized or the synchronization failed
+    void sync() const;
+
+
+private:
+    //! @brief
+    //! Get the header that is stored at the beginning of the mapped memory
+    //!
+    //! @return
+    //! Reference to the header
+    [[nodiscard]] auto get_header() const noexcept -> internal::MappedFileHeader&;
+
+
+    //! @brief
+    //! Get the start address of the memory that is used for allocations
+    [[nodiscard]] auto get_start_address() const noexcept -> UPT;
+
+
+    //! @brief
+    //! Map the file and validate or create the header.
+    //!
+    //! @param[in] size:
+    //! Desired size of the memory that can be used for allocations.
+    //!
+    //! @exception RuntimeError
+    //! File operations failed or the file content is invalid
+    void map_file(UST size);
+
+
+    //! @brief
+    //! Unmap the memory and close the file without writing the changes back explicitly.
+    void unmap_file() noexcept;
+
+
+    static constexpr U64 magic_number   = 0x4D4A4F4C4E495246; // "MJOLNIRF"
+    static constexpr U64 format_version = 1;
+    static constexpr UST header_size    = sizeof(internal::MappedFileHeader);
+
+    int        m_file_descriptor = {-1};
+    UST        m_file_size       = {0};
+    std::byte* m_memory          = {nullptr};
+    bool       m_is_restored     = {false};
+
+#ifndef NDEBUG
+    mutable UST m_num_allocations = {0};
+#endif
+};
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+namespace mjolnir
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+MappedFileMemory<T_Lock>::~MappedFileMemory()
+{
+    if (is_initialized())
+        unmap_file();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+auto MappedFileMemory<T_Lock>::allocate(UST size, UST alignment) -> void*
+{
+    assert(size != 0 && "Allocated memory size is 0.");                   // NOLINT
+    assert(is_initialized() && "Mapped file memory is not initialized."); // NOLINT
+
+    auto& header = get_header();
+
+    UPT current_addr   = get_start_address() + header.used_size;
+    UPT allocated_addr = align_address(current_addr, alignment);
+    UPT next_addr      = allocated_addr + size;
+
+    THROW_EXCEPTION_IF(get_start_address() + header.memory_size < next_addr,
+                       AllocationError,
+                       "No more memory available.");
+
+    header.used_size = next_addr - get_start_address();
+
+#ifndef NDEBUG
+    ++m_num_allocations;
+#endif
+
+    return integer_to_pointer(allocated_addr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+template <typename T_Type, typename... T_Args>
+auto MappedFileMemory<T_Lock>::allocate_construct(T_Args&&... args) -> T_Type*
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return new (allocate(sizeof(T_Type), alignof(T_Type))) T_Type(std::forward<T_Args>(args)...);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::deallocate([[maybe_unused]] void* ptr,
+                                          [[maybe_unused]] UST   size,
+                                          [[maybe_unused]] UST   alignment) const noexcept
+{
+#ifndef NDEBUG
+    assert(ptr != nullptr && "Pointer is the `nullptr`.");                                           // NOLINT
+    assert(is_pointer_in_memory(ptr, m_memory, m_file_size) && "Pointer doesn't belong to memory."); // NOLINT
+
+    // Allocations of previous runs are not counted
+    if (m_is_restored && m_num_allocations == 0)
+        return;
+
+    assert(m_num_allocations > 0 && "Deallocation was called too often"); // NOLINT
+    --m_num_allocations;
+#endif
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::deinitialize()
+{
+    THROW_EXCEPTION_IF(! is_initialized(), RuntimeError, "Memory already deinitialized.");
+
+    sync();
+    unmap_file();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+template <typename T_Type>
+void MappedFileMemory<T_Lock>::destroy_deallocate(T_Type* pointer) const noexcept
+{
+    mjolnir::destroy(pointer);
+    deallocate(pointer, sizeof(T_Type), alignof(T_Type));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+template <typename T_Type>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_allocator() noexcept -> MemoryAllocatorType<T_Type>
+{
+    return MemoryAllocatorType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+template <typename T_Type>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_deleter() noexcept -> MemoryDeleterType<T_Type>
+{
+    return MemoryDeleterType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_free_memory_size() const noexcept -> UST
+{
+    if (! is_initialized())
+        return 0;
+
+    return get_header().memory_size - get_header().used_size;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_memory_size() const noexcept -> UST
+{
+    if (! is_initialized())
+        return 0;
+
+    return get_header().memory_size;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+template <typename T_Type>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_root() const noexcept -> T_Type*
+{
+    assert(is_initialized() && "Mapped file memory is not initialized."); // NOLINT
+
+    UST root_offset = get_header().root_offset;
+    if (root_offset == 0)
+        return nullptr;
+
+    return integer_to_pointer<T_Type>(pointer_to_integer(m_memory) + root_offset);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::initialize(const std::filesystem::path& file_path, UST size)
+{
+    THROW_EXCEPTION_IF(is_initialized(), RuntimeError, "Memory is already initialized");
+    THROW_EXCEPTION_IF(size == 0, ValueError, "Memory size must be larger than 0.");
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    m_file_descriptor = ::open(file_path.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    THROW_EXCEPTION_IF(m_file_descriptor == -1, RuntimeError, "Could not open file: " + file_path.string());
+
+    try
+    {
+        map_file(size);
+    }
+    catch (...)
+    {
+        unmap_file();
+        throw;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::is_initialized() const noexcept -> bool
+{
+    return m_memory != nullptr;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::is_restored() const noexcept -> bool
+{
+    return m_is_restored;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::reset() noexcept
+{
+    assert(m_num_allocations == 0 && "Memory still in use.");             // NOLINT
+    assert(is_initialized() && "Mapped file memory is not initialized."); // NOLINT
+
+    get_header().used_size   = 0;
+    get_header().root_offset = 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+template <typename T_Type>
+void MappedFileMemory<T_Lock>::set_root(const T_Type* pointer) noexcept
+{
+    assert(is_initialized() && "Mapped file memory is not initialized."); // NOLINT
+
+    if (pointer == nullptr)
+    {
+        get_header().root_offset = 0;
+        return;
+    }
+
+    assert(is_pointer_in_memory(pointer, m_memory, m_file_size) && "Pointer doesn't belong to memory."); // NOLINT
+    get_header().root_offset = pointer_to_integer(pointer) - pointer_to_integer(m_memory);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::sync() const
+{
+    THROW_EXCEPTION_IF(! is_initialized(), RuntimeError, "Memory is not initialized.");
+    THROW_EXCEPTION_IF(::msync(m_memory, m_file_size, MS_SYNC) != 0, RuntimeError, "Synchronization failed.");
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_header() const noexcept -> internal::MappedFileHeader&
+{
+    return *integer_to_pointer<internal::MappedFileHeader>(pointer_to_integer(m_memory));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+[[nodiscard]] auto MappedFileMemory<T_Lock>::get_start_address() const noexcept -> UPT
+{
+    return pointer_to_integer(m_memory) + header_size;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::map_file(UST size)
+{
+    struct stat file_status = {};
+    THROW_EXCEPTION_IF(::fstat(m_file_descriptor, &file_status) != 0, RuntimeError, "Could not read file status.");
+
+    UST file_size = header_size + size;
+    m_is_restored = file_status.st_size != 0;
+
+    if (m_is_restored)
+    {
+        THROW_EXCEPTION_IF(static_cast<UST>(file_status.st_size) != file_size,
+                           RuntimeError,
+                           "The file size does not match the requested memory size.");
+    }
+    else
+    {
+        THROW_EXCEPTION_IF(::ftruncate(m_file_descriptor, static_cast<off_t>(file_size)) != 0,
+                           RuntimeError,
+                           "Could not resize file.");
+    }
+
+    void* mapped_memory = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file_descriptor, 0);
+    THROW_EXCEPTION_IF(mapped_memory == MAP_FAILED, RuntimeError, "Could not map file."); // NOLINT
+
+    m_memory    = static_cast<std::byte*>(mapped_memory);
+    m_file_size = file_size;
+
+    auto& header = get_header();
+    if (m_is_restored)
+    {
+        THROW_EXCEPTION_IF(header.magic_number != magic_number || header.version != format_version
+                                   || header.memory_size != size || header.used_size > size,
+                           RuntimeError,
+                           "The file does not contain a valid memory.");
+    }
+    else
+    {
+        header = internal::MappedFileHeader{magic_number, format_version, size, 0, 0};
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Lock>
+void MappedFileMemory<T_Lock>::unmap_file() noexcept
+{
+    if (m_memory != nullptr)
+        ::munmap(m_memory, m_file_size);
+    if (m_file_descriptor != -1)
+        ::close(m_file_descriptor);
+
+    m_file_descriptor = -1;
+    m_file_size       = 0;
+    m_memory          = nullptr;
+    m_is_restored     = false;
+
+#ifndef NDEBUG
+    m_num_allocations = 0;
+#endif
+}
+
+
+} // namespace mjolnir
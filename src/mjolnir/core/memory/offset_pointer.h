@@ -0,0 +1,427 @@
+//! @file
+//! memory/offset_pointer.h
+//!
+//! @brief
+//! Defines a relocation-safe pointer type that stores the distance to its target instead of an absolute address
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+
+#include <cassert>
+#include <cstddef>
+
+
+namespace mjolnir
+{
+// --- OffsetPointer --------------------------------------------------------------------------------------------------
+
+//! \addtogroup core_memory
+//! @{
+
+//! @brief
+//! A pointer that stores the offset between its own address and the address of the referenced object.
+//!
+//! @details
+//! As long as the pointer and the referenced object are moved together (for example, because they are both part of
+//! the same memory-mapped file that gets mapped to a different address), the pointer stays valid. This makes it
+//! possible to store linked data structures inside of a `MappedFileMemory` and use them directly after remapping the
+//! file without any fix-ups.
+//!
+//! Copying or assigning an `OffsetPointer` recalculates the offset with respect to the address of the destination.
+//! An offset of 0 is used to represent the `nullptr`. Therefore, an `OffsetPointer` can not point to its own address.
+//!
+//! @tparam T_Type:
+//! Type of the referenced object
+template <typename T_Type>
+class OffsetPointer
+{
+public:
+    //! @brief
+    //! Type of the referenced object
+    using ElementType = T_Type;
+
+
+    //! @brief
+    //! Construct a `nullptr`
+    OffsetPointer() noexcept = default;
+
+
+    //! @brief
+    //! Construct a `nullptr`
+    OffsetPointer(std::nullptr_t) noexcept; // NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+
+
+    //! @brief
+    //! Construct a new instance that points to the passed address.
+    //!
+    //! @param[in] pointer:
+    //! Address of the referenced object
+    OffsetPointer(T_Type* pointer) noexcept; // NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+
+
+    //! @brief
+    //! Copy constructor
+    //!
+    //! @param[in] other:
+    //! Pointer that should be copied
+    OffsetPointer(const OffsetPointer& other) noexcept;
+
+
+    //! @brief
+    //! Move constructor
+    //!
+    //! @details
+    //! Since the stored offset depends on the address of the pointer, moving is identical to copying.
+    //!
+    //! @param[in] other:
+    //! Pointer that should be moved
+    OffsetPointer(OffsetPointer&& other) noexcept;
+
+
+    //! \cond DO_NOT_DOCUMENT
+    ~OffsetPointer() = default;
+    //! \endcond
+
+
+    //! @brief
+    //! Copy assignment operator
+    //!
+    //! @param[in] other:
+    //! Pointer that should be copied
+    //!
+    //! @return
+    //! Reference to this instance
+    auto operator=(const OffsetPointer& other) noexcept -> OffsetPointer&;
+
+
+    //! @brief
+    //! Move assignment operator
+    //!
+    //! @param[in] other:
+    //! Pointer that should be moved
+    //!
+    //! @return
+    //! Reference to this instance
+    auto operator=(OffsetPointer&& other) noexcept -> OffsetPointer&;
+
+
+    //! @brief
+    //! Let the pointer refer to the passed address.
+    //!
+    //! @param[in] pointer:
+    //! Address of the referenced object
+    //!
+    //! @return
+    //! Reference to this instance
+    auto operator=(T_Type* pointer) noexcept -> OffsetPointer&;
+
+
+    //! @brief
+    //! Get the address of the referenced object.
+    //!
+    //! @return
+    //! Address of the referenced object or `nullptr`
+    [[nodiscard]] auto get() const noexcept -> T_Type*;
+
+
+    //! @brief
+    //! Get the stored offset between this pointer and the referenced object in bytes.
+    //!
+    //! @return
+    //! Stored offset in bytes. A value of 0 represents the `nullptr`.
+    [[nodiscard]] auto get_offset() const noexcept -> IPT;
+
+
+    //! @brief
+    //! Set the pointer to `nullptr`.
+    void reset() noexcept;
+
+
+    //! @brief
+    //! Dereference the pointer.
+    //!
+    //! @return
+    //! Reference to the referenced object
+    [[nodiscard]] auto operator*() const noexcept -> T_Type&;
+
+
+    //! @brief
+    //! Access members of the referenced object.
+    //!
+    //! @return
+    //! Address of the referenced object
+    [[nodiscard]] auto operator->() const noexcept -> T_Type*;
+
+
+    //! @brief
+    //! Access the object with the given index if the pointer refers to an array.
+    //!
+    //! @param[in] index:
+    //! Index of the object
+    //!
+    //! @return
+    //! Reference to the object
+    [[nodiscard]] auto operator[](UST index) const noexcept -> T_Type&;
+
+
+    //! @brief
+    //! Return `true` if the pointer is not the `nullptr` and `false` otherwise.
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+
+    //! @brief
+    //! Return `true` if both pointers refer to the same address and `false` otherwise.
+    //!
+    //! @param[in] other:
+    //! Other pointer
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto operator==(const OffsetPointer& other) const noexcept -> bool;
+
+
+    //! @brief
+    //! Return `true` if the pointer refers to the passed address and `false` otherwise.
+    //!
+    //! @param[in] pointer:
+    //! Address that should be compared
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto operator==(const T_Type* pointer) const noexcept -> bool;
+
+
+    //! @brief
+    //! Return `true` if the pointer is the `nullptr` and `false` otherwise.
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto operator==(std::nullptr_t) const noexcept -> bool;
+
+
+private:
+    //! @brief
+    //! Calculate the offset between this instance and the passed address.
+    //!
+    //! @param[in] pointer:
+    //! Address of the referenced object
+    //!
+    //! @return
+    //! Offset in bytes
+    [[nodiscard]] auto calculate_offset(const T_Type* pointer) const noexcept -> IPT;
+
+
+    //! @brief
+    //! Get the address of the referenced object without checking for the `nullptr`.
+    //!
+    //! @return
+    //! Address of the referenced object
+    [[nodiscard]] auto get_address() const noexcept -> T_Type*;
+
+
+    IPT m_offset = {0};
+};
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+namespace mjolnir
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+OffsetPointer<T_Type>::OffsetPointer(std::nullptr_t) noexcept
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+OffsetPointer<T_Type>::OffsetPointer(T_Type* pointer) noexcept : m_offset{calculate_offset(pointer)}
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+OffsetPointer<T_Type>::OffsetPointer(const OffsetPointer& other) noexcept : m_offset{calculate_offset(other.get())}
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+OffsetPointer<T_Type>::OffsetPointer(OffsetPointer&& other) noexcept : m_offset{calculate_offset(other.get())}
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+auto OffsetPointer<T_Type>::operator=(const OffsetPointer& other) noexcept -> OffsetPointer&
+{
+    m_offset = calculate_offset(other.get());
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+auto OffsetPointer<T_Type>::operator=(OffsetPointer&& other) noexcept -> OffsetPointer&
+{
+    m_offset = calculate_offset(other.get());
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+auto OffsetPointer<T_Type>::operator=(T_Type* pointer) noexcept -> OffsetPointer&
+{
+    m_offset = calculate_offset(pointer);
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::get() const noexcept -> T_Type*
+{
+    if (m_offset == 0)
+        return nullptr;
+
+    return get_address();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::get_offset() const noexcept -> IPT
+{
+    return m_offset;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+void OffsetPointer<T_Type>::reset() noexcept
+{
+    m_offset = 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::operator*() const noexcept -> T_Type&
+{
+    assert(m_offset != 0 && "Dereferencing a `nullptr`."); // NOLINT
+    return *get_address();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::operator->() const noexcept -> T_Type*
+{
+    assert(m_offset != 0 && "Dereferencing a `nullptr`."); // NOLINT
+    return get_address();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::operator[](UST index) const noexcept -> T_Type&
+{
+    assert(m_offset != 0 && "Dereferencing a `nullptr`."); // NOLINT
+    return get_address()[index];                           // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] OffsetPointer<T_Type>::operator bool() const noexcept
+{
+    return m_offset != 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::operator==(const OffsetPointer& other) const noexcept -> bool
+{
+    return get() == other.get();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::operator==(const T_Type* pointer) const noexcept -> bool
+{
+    return get() == pointer;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::operator==(std::nullptr_t) const noexcept -> bool
+{
+    return m_offset == 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::calculate_offset(const T_Type* pointer) const noexcept -> IPT
+{
+    if (pointer == nullptr)
+        return 0;
+
+    // NOLINTNEXTLINE
+    assert(static_cast<const void*>(pointer) != static_cast<const void*>(this) && "Pointer can't refer to itself.");
+
+    return static_cast<IPT>(pointer_to_integer(pointer)) - static_cast<IPT>(pointer_to_integer(this));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto OffsetPointer<T_Type>::get_address() const noexcept -> T_Type*
+{
+    auto this_addr = static_cast<IPT>(pointer_to_integer(this));
+    return integer_to_pointer<T_Type>(static_cast<UPT>(this_addr + m_offset));
+}
+
+
+} // namespace mjolnir
@@ -0,0 +1,667 @@
+//! @file
+//! memory/ring_memory.h
+//!
+//! @brief
+//! Defines a memory system that manages its memory as a ring buffer
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/memory/definitions.h"
+#include "mjolnir/core/memory/memory_system_allocator.h"
+#include "mjolnir/core/memory/memory_system_deleter.h"
+#include "mjolnir/core/memory/utility.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+
+namespace mjolnir
+{
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! @brief
+//! Header that precedes every memory block of a `RingMemory`.
+struct RingMemoryBlockHeader
+{
+    UST block_size = {0};
+    UST is_free    = {0};
+};
+} // namespace internal
+//! \endcond
+
+
+// --- RingMemory -----------------------------------------------------------------------------------------------------
+
+//! \addtogroup core_memory
+//! @{
+
+//! @brief
+//! A memory system that manages its memory as a ring buffer.
+//!
+//! @details
+//! This memory system is meant for data that is allocated in FIFO order and freed in roughly the same order, for
+//! example, messages of a producer/consumer pipeline. Allocations are placed behind the previous allocation (head).
+//! If the remaining memory at the end of the buffer is too small, the allocation continues at the beginning of the
+//! buffer. An allocation is never split. Freed memory becomes available again once all older allocations were freed
+//! too (tail). Memory can be freed in any order, but an unfreed block prevents the reuse of all newer blocks.
+//!
+//! Each memory block has a small header. The exact size of the overhead is given by `block_overhead` plus the padding
+//! required to fulfill alignment requirements.
+//!
+//! @tparam t_lock_free_spsc:
+//! If `true`, head and tail are atomic variables on separate cache lines. This allows a single producer thread to
+//! allocate memory while a single consumer thread deallocates it without any locks. All allocations must happen on the
+//! producer thread and all deallocations on the consumer thread. If `false`, the memory is not protected.
+//! @tparam T_Deleter
+//! The Type of the deleter that is used to delete the internal memory (see `LinearMemory`).
+template <bool t_lock_free_spsc = false, typename T_Deleter = DefaultMemoryDeleter>
+class RingMemory
+{
+public:
+    //! @brief
+    //! Compatible allocator type that can be used with STL containers.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be allocated.
+    template <typename T_Type>
+    using MemoryAllocatorType = MemorySystemAllocator<T_Type, RingMemory<t_lock_free_spsc, T_Deleter>>;
+
+    //! @brief
+    //! Compatible deleter type that can be used with `std::unique_ptr` etc.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be deleted.
+    template <typename T_Type>
+    using MemoryDeleterType = MemorySystemDeleter<T_Type, RingMemory<t_lock_free_spsc, T_Deleter>>;
+
+    //! @brief
+    //! Minimal number of bytes that are added to each allocation for management purposes.
+    static constexpr UST block_overhead = sizeof(internal::RingMemoryBlockHeader) + sizeof(UST);
+
+    RingMemory(const RingMemory&)     = delete;
+    RingMemory(RingMemory&&) noexcept = delete;
+    ~RingMemory()                     = default;
+    auto operator=(const RingMemory&) -> RingMemory& = delete;
+    auto operator=(RingMemory&&) noexcept -> RingMemory& = delete;
+
+
+    //! @brief
+    //! Construct a new instance
+    //!
+    //! @param[in] deleter:
+    //! A deleter instance that is used to free the internal memory (see documentation of `T_Deleter` in the class
+    //! documentation). This parameter is optional if you did not explicitly set the template parameter `T_Deleter` or
+    //! if the utilized deleter type is default constructable.
+    explicit RingMemory(T_Deleter deleter = T_Deleter()) noexcept;
+
+
+    //! @brief
+    //! Allocate a new memory block and return a pointer that points to it.
+    //!
+    //! @param[in] size:
+    //! Size of the allocation
+    //! @param[in] alignment:
+    //! Required alignment of the memory
+    //!
+    //! @return
+    //! Pointer to the newly allocated memory
+    //!
+    //! @exception AllocationError
+    //! There is not enough contiguous memory available
+    [[nodiscard]] auto allocate(UST size, UST alignment = 1) -> void*;
+
+
+    //! @brief
+    //! Create an instance of `T_Type` inside a newly allocated memory block and return the pointer to it.
+    //!
+    //! @tparam T_Type:
+    //! The type that should be created
+    //! @tparam T_Args:
+    //! Types of the constructor arguments
+    //!
+    //! @param[in] args:
+    //! Arguments that should be passed to the constructor of the created type.
+    //!
+    //! @return
+    //! Pointer to the created instance of `T_Type`
+    //!
+    //! @exception AllocationError
+    //! There is not enough contiguous memory available
+    template <typename T_Type, typename... T_Args>
+    [[nodiscard]] auto allocate_construct(T_Args&&... args) -> T_Type*;
+
+
+    //! @brief
+    //! Deallocate memory.
+    //!
+    //! @param[in] ptr:
+    //! Pointer to the memory that should be freed
+    //! @param[in] size:
+    //! Size of the memory that should be freed.
+    //! @param[in] alignment:
+    //! Alignment of the pointer.
+    void deallocate(void* ptr, [[maybe_unused]] UST size, [[maybe_unused]] UST alignment = 1) noexcept;
+
+
+    //! @brief
+    //! Deinitialize the memory.
+    //!
+    //! @details
+    //! Resets the internal variables and frees the memory.
+    //!
+    //! @exception RuntimeError
+    //! Memory is already deinitialized
+    void deinitialize();
+
+
+    //! @brief
+    //! Destroy the passed object and release its memory.
+    //!
+    //! @tparam T_Type
+    //! Type of the passed object
+    //!
+    //! @param[in] pointer:
+    //! Pointer to the object that should be destroyed
+    template <typename T_Type>
+    void destroy_deallocate(T_Type* pointer) noexcept;
+
+
+    //! @brief
+    //! Get an allocator that allocates and deallocates memory for the specified type from this memory system
+    //!
+    //! @tparam T_Type
+    //! Type that should be allocated
+    //!
+    //! @return
+    //! Allocator of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_allocator() noexcept -> MemoryAllocatorType<T_Type>;
+
+
+    //! @brief
+    //! Get a deleter that deletes the specified type from this memory system
+    //!
+    //! @tparam T_Type
+    //! Type that should be deleted
+    //!
+    //! @return
+    //! Deleter of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_deleter() noexcept -> MemoryDeleterType<T_Type>;
+
+
+    //! @brief
+    //! Get the size of the memory that is currently occupied by allocated memory blocks including their overhead.
+    //!
+    //! @details
+    //! In lock-free mode, the result is only a snapshot if it is not called from the producer or consumer thread.
+    //!
+    //! @return
+    //! Size of the occupied memory
+    [[nodiscard]] auto get_used_memory_size() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get the size of the allocated memory.
+    //!
+    //! @details
+    //! If the memory was not initialized using `initialize`, this method will return 0
+    //!
+    //! @return
+    //! Size of the memory
+    [[nodiscard]] auto get_memory_size() const noexcept -> UST;
+
+
+    //! @brief
+    //! Initialize the class.
+    //!
+    //! @details
+    //! This function allocates memory from the heap that is further managed by the class.
+    //!
+    //! @param[in] size:
+    //! Desired size of the internal memory. It must be a multiple of `sizeof(UST)`.
+    //!
+    //! @exception RuntimeError
+    //! Memory is already initialized
+    //! @exception ValueError
+    //! `size` is too small or not a multiple of `sizeof(UST)`
+    //! @exception std::bad_alloc
+    //! Heap allocation failed
+    void initialize(UST size);
+
+
+    //! @brief
+    //! Initialize the class.
+    //!
+    //! @details
+    //! This function passes a pointer to a memory block that the class should use as internal memory. The memory system
+    //! takes ownership of the memory and will take care of its deallocation once the memory is not needed anymore.
+    //!
+    //! @param[in] size:
+    //! Size of the passed memory. It must be a multiple of `sizeof(UST)`.
+    //! @param[in] memory_ptr:
+    //! Pointer to the memory that the class should use internally. It must be aligned to `sizeof(UST)`.
+    //!
+    //! @exception RuntimeError
+    //! Memory is already initialized
+    //! @exception ValueError
+    //! `size` is too small or not a multiple of `sizeof(UST)` or the pointer is not aligned
+    void initialize(UST size, std::byte* memory_ptr);
+
+
+    //! @brief
+    //! Return `true` if all allocated memory blocks were freed and `false` otherwise.
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto is_empty() const noexcept -> bool;
+
+
+    //! @brief
+    //! Return `true` if the memory is initialized and `false` otherwise.
+    //!
+    //! @return
+    //! `true` or `false`
+    [[nodiscard]] auto is_initialized() const noexcept -> bool;
+
+
+private:
+    using Header     = internal::RingMemoryBlockHeader;
+    using OffsetType = std::conditional_t<t_lock_free_spsc, std::atomic<UST>, UST>;
+
+    static constexpr UST block_alignment = alignof(Header);
+    static constexpr UST offset_alignment =
+            t_lock_free_spsc ? 64 : alignof(UST); // NOLINT(readability-magic-numbers) avoid false sharing
+
+
+    //! @brief
+    //! Advance the tail over all freed memory blocks.
+    void advance_tail() noexcept;
+
+
+    //! @brief
+    //! Get the address of the memory block header at the given offset.
+    //!
+    //! @param[in] offset:
+    //! Offset of the block
+    //!
+    //! @return
+    //! Pointer to the header
+    [[nodiscard]] auto get_header(UST offset) const noexcept -> Header*;
+
+
+    //! @brief
+    //! Get the start address of the internal memory
+    [[nodiscard]] auto get_start_address() const noexcept -> UPT;
+
+
+    //! @brief
+    //! Initialize the memory after all parameters were checked.
+    //!
+    //! @param[in] size:
+    //! Size of the memory
+    //! @param[in] memory_ptr:
+    //! Pointer to the memory
+    void initialize_internal(UST size, std::byte* memory_ptr);
+
+
+    //! @brief
+    //! Read an offset variable.
+    //!
+    //! @param[in] offset:
+    //! Offset variable
+    //! @param[in] order:
+    //! Memory order that is used in lock-free mode
+    //!
+    //! @return
+    //! Value of the offset
+    [[nodiscard]] static auto load(const OffsetType& offset, std::memory_order order) noexcept -> UST;
+
+
+    //! @brief
+    //! Write an offset variable.
+    //!
+    //! @param[in] offset:
+    //! Offset variable
+    //! @param[in] value:
+    //! New value
+    //! @param[in] order:
+    //! Memory order that is used in lock-free mode
+    static void store(OffsetType& offset, UST value, std::memory_order order) noexcept;
+
+
+    UST m_memory_size = {0};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::unique_ptr<std::byte[], T_Deleter> m_memory;
+
+    alignas(offset_alignment) OffsetType m_head = {0};
+    alignas(offset_alignment) OffsetType m_tail = {0};
+};
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+namespace mjolnir
+{
+template <bool t_lock_free_spsc, typename T_Deleter>
+RingMemory<t_lock_free_spsc, T_Deleter>::RingMemory(T_Deleter deleter) noexcept : m_memory{nullptr, deleter}
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+auto RingMemory<t_lock_free_spsc, T_Deleter>::allocate(UST size, UST alignment) -> void*
+{
+    assert(size != 0 && "Allocated memory size is 0.");            // NOLINT
+    assert(is_initialized() && "Ring memory is not initialized."); // NOLINT
+
+    UST head = load(m_head, std::memory_order_relaxed);
+    UST tail = load(m_tail, std::memory_order_acquire);
+
+    // Without concurrent access, an empty buffer can be reset to reduce fragmentation
+    if constexpr (! t_lock_free_spsc)
+        if (head == tail)
+        {
+            head = 0;
+            tail = 0;
+            store(m_tail, 0, std::memory_order_relaxed);
+        }
+
+    auto get_block_end = [size, alignment, this](UST block_start) noexcept -> UST
+    {
+        UPT payload_addr = align_address(get_start_address() + block_start + block_overhead, alignment);
+        return align_address(payload_addr + size, block_alignment) - get_start_address();
+    };
+
+    UST block_start = head;
+    UST block_end   = get_block_end(block_start);
+
+    // A full buffer must not have the same head and tail as an empty one. Therefore, the head must never catch up
+    // with the tail.
+    bool fits = (head >= tail) ? block_end < m_memory_size || (block_end == m_memory_size && tail != 0)
+                               : block_end < tail;
+
+    if (! fits && head >= tail)
+    {
+        block_start = 0;
+        block_end   = get_block_end(block_start);
+        fits        = block_end < tail;
+
+        if (fits && m_memory_size - head >= sizeof(Header))
+            *get_header(head) = Header{m_memory_size - head, 1};
+    }
+
+    THROW_EXCEPTION_IF(! fits, AllocationError, "No more memory available.");
+
+    UPT block_addr   = get_start_address() + block_start;
+    UPT payload_addr = align_address(block_addr + block_overhead, alignment);
+
+    *get_header(block_start) = Header{block_end - block_start, 0};
+    *integer_to_pointer<UST>(payload_addr - sizeof(UST)) = payload_addr - block_addr;
+
+    store(m_head, (block_end == m_memory_size) ? 0 : block_end, std::memory_order_release);
+
+    return integer_to_pointer(payload_addr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+template <typename T_Type, typename... T_Args>
+auto RingMemory<t_lock_free_spsc, T_Deleter>::allocate_construct(T_Args&&... args) -> T_Type*
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    return new (allocate(sizeof(T_Type), alignof(T_Type))) T_Type(std::forward<T_Args>(args)...);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::deallocate(void*                  ptr,
+                                                         [[maybe_unused]] UST   size,
+                                                         [[maybe_unused]] UST   alignment) noexcept
+{
+    assert(ptr != nullptr && "Pointer is the `nullptr`.");                                                   // NOLINT
+    assert(is_pointer_in_memory(ptr, m_memory.get(), m_memory_size) && "Pointer doesn't belong to memory."); // NOLINT
+
+    UPT payload_addr = pointer_to_integer(ptr);
+    UST back_offset  = *integer_to_pointer<UST>(payload_addr - sizeof(UST));
+    auto* header     = integer_to_pointer<Header>(payload_addr - back_offset);
+
+    assert(header->is_free == 0 && "Memory was already freed."); // NOLINT
+    header->is_free = 1;
+
+    advance_tail();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::deinitialize()
+{
+    THROW_EXCEPTION_IF(! is_initialized(), RuntimeError, "Memory already deinitialized.");
+    assert(is_empty() && "Memory still in use."); // NOLINT
+
+    m_memory_size = 0;
+    m_memory      = nullptr;
+    store(m_head, 0, std::memory_order_relaxed);
+    store(m_tail, 0, std::memory_order_relaxed);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+template <typename T_Type>
+void RingMemory<t_lock_free_spsc, T_Deleter>::destroy_deallocate(T_Type* pointer) noexcept
+{
+    mjolnir::destroy(pointer);
+    deallocate(pointer, sizeof(T_Type), alignof(T_Type));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+template <typename T_Type>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::get_allocator() noexcept -> MemoryAllocatorType<T_Type>
+{
+    return MemoryAllocatorType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+template <typename T_Type>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::get_deleter() noexcept -> MemoryDeleterType<T_Type>
+{
+    return MemoryDeleterType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::get_used_memory_size() const noexcept -> UST
+{
+    UST tail = load(m_tail, std::memory_order_acquire);
+    UST head = load(m_head, std::memory_order_acquire);
+
+    if (head >= tail)
+        return head - tail;
+    return m_memory_size - tail + head;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::get_memory_size() const noexcept -> UST
+{
+    if (m_memory)
+        return m_memory_size;
+    return 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::initialize(UST size)
+{
+    static_assert(std::is_same_v<T_Deleter, DefaultMemoryDeleter>,
+                  "Function can only be used if the classes deleter type is the default deleter.");
+
+    THROW_EXCEPTION_IF(is_initialized(), RuntimeError, "Memory is already initialized");
+    THROW_EXCEPTION_IF(size < 2 * block_overhead || size % block_alignment != 0,
+                       ValueError,
+                       "Memory size is too small or not a multiple of `sizeof(UST)`.");
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    initialize_internal(size, std::make_unique<std::byte[]>(size).release());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::initialize(UST size, std::byte* memory_ptr)
+{
+    THROW_EXCEPTION_IF(is_initialized(), RuntimeError, "Memory is already initialized");
+    THROW_EXCEPTION_IF(size < 2 * block_overhead || size % block_alignment != 0,
+                       ValueError,
+                       "Memory size is too small or not a multiple of `sizeof(UST)`.");
+    THROW_EXCEPTION_IF(! is_aligned(memory_ptr, block_alignment), ValueError, "Memory is misaligned.");
+
+    initialize_internal(size, memory_ptr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::is_empty() const noexcept -> bool
+{
+    return load(m_head, std::memory_order_acquire) == load(m_tail, std::memory_order_acquire);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::is_initialized() const noexcept -> bool
+{
+    return m_memory != nullptr;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::advance_tail() noexcept
+{
+    UST tail = load(m_tail, std::memory_order_relaxed);
+    UST head = load(m_head, std::memory_order_acquire);
+
+    while (tail != head)
+    {
+        if (m_memory_size - tail < sizeof(Header))
+        {
+            tail = 0;
+            continue;
+        }
+
+        const Header* header = get_header(tail);
+        if (header->is_free == 0)
+            break;
+
+        tail += header->block_size;
+        if (tail == m_memory_size)
+            tail = 0;
+    }
+
+    store(m_tail, tail, std::memory_order_release);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::get_header(UST offset) const noexcept -> Header*
+{
+    return integer_to_pointer<Header>(get_start_address() + offset);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::get_start_address() const noexcept -> UPT
+{
+    return pointer_to_integer(m_memory.get());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::initialize_internal(UST size, std::byte* memory_ptr)
+{
+    m_memory.reset(memory_ptr);
+    m_memory_size = size;
+    store(m_head, 0, std::memory_order_relaxed);
+    store(m_tail, 0, std::memory_order_relaxed);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+[[nodiscard]] auto RingMemory<t_lock_free_spsc, T_Deleter>::load(const OffsetType& offset,
+                                                                 [[maybe_unused]] std::memory_order order) noexcept
+        -> UST
+{
+    if constexpr (t_lock_free_spsc)
+        return offset.load(order);
+    else
+        return offset;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <bool t_lock_free_spsc, typename T_Deleter>
+void RingMemory<t_lock_free_spsc, T_Deleter>::store(OffsetType&                        offset,
+                                                    UST                                value,
+                                                    [[maybe_unused]] std::memory_order order) noexcept
+{
+    if constexpr (t_lock_free_spsc)
+        offset.store(value, order);
+    else
+        offset = value;
+}
+
+
+} // namespace mjolnir
@@ -0,0 +1,718 @@
+//! @file
+//! memory/slab_memory.h
+//!
+//! @brief
+//! Defines a memory system that caches constructed objects in per-type slabs
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/memory/definitions.h"
+#include "mjolnir/core/memory/memory_system_allocator.h"
+#include "mjolnir/core/memory/memory_system_deleter.h"
+#include "mjolnir/core/memory/utility.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/core/utility/type.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+
+namespace mjolnir
+{
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! @brief
+//! Cache for a single object type that is used by the `SlabMemory`.
+//!
+//! @details
+//! The memory for the objects is allocated in slabs that can store multiple objects. Every slot of a slab is either
+//! in use, cached as a constructed object or free (not constructed).
+//!
+//! @tparam T_Type:
+//! Type of the cached objects
+template <typename T_Type>
+class SlabCache
+{
+public:
+    SlabCache()                     = delete;
+    SlabCache(const SlabCache&)     = delete;
+    SlabCache(SlabCache&&) noexcept = default;
+    ~SlabCache();
+    auto operator=(const SlabCache&) -> SlabCache& = delete;
+    auto operator=(SlabCache&&) noexcept -> SlabCache& = default;
+
+
+    //! @brief
+    //! Constructor
+    //!
+    //! @param[in] num_objects_per_slab:
+    //! Number of objects that fit into a single slab
+    explicit SlabCache(UST num_objects_per_slab) noexcept;
+
+
+    //! @brief
+    //! Destroy all cached objects and turn their slots into free slots.
+    void clear() noexcept;
+
+
+    //! @brief
+    //! Get the number of constructed objects that are stored in the cache.
+    [[nodiscard]] auto get_num_cached_objects() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get the number of free slots that do not contain a constructed object.
+    [[nodiscard]] auto get_num_free_slots() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get the number of slots that are currently in use.
+    [[nodiscard]] auto get_num_used_slots() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get a constructed object from the cache or `nullptr` if the cache is empty.
+    [[nodiscard]] auto pop_object() noexcept -> T_Type*;
+
+
+    //! @brief
+    //! Get a free slot. A new slab is allocated if no free slots are available.
+    [[nodiscard]] auto pop_slot() -> void*;
+
+
+    //! @brief
+    //! Store a constructed object in the cache.
+    void push_object(T_Type* pointer) noexcept;
+
+
+    //! @brief
+    //! Return a slot that does not contain a constructed object.
+    void push_slot(void* pointer) noexcept;
+
+
+private:
+    //! @brief
+    //! Allocate a new slab and add all of its slots to the free slots.
+    void allocate_slab();
+
+
+    UST m_num_objects_per_slab = {0};
+    UST m_num_used_slots       = {0};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::vector<std::unique_ptr<std::byte[]>> m_slabs;
+    std::vector<T_Type*>                      m_cached_objects;
+    std::vector<void*>                        m_free_slots;
+};
+} // namespace internal
+//! \endcond
+
+
+// --- SlabMemory -----------------------------------------------------------------------------------------------------
+
+//! \addtogroup core_memory
+//! @{
+
+//! @brief
+//! A memory system that reuses constructed objects.
+//!
+//! @details
+//! This memory system is meant for objects that are expensive to construct but cheap to reset. Each of the supported
+//! types gets its own cache. Objects are stored in slabs that can hold multiple objects of the same type.
+//!
+//! If an object is released with `destroy_deallocate`, its destructor is not called. Instead, it is stored in the
+//! cache of its type. The next call to `allocate_construct` with the same type returns the cached object in the state
+//! it was released. The constructor arguments are only used if a new object needs to be constructed. Resetting the
+//! state of a reused object is the responsibility of the user. All cached objects are destroyed when the memory system
+//! is destroyed or `clear` is called.
+//!
+//! Since the `MemorySystemDeleter` forwards to `destroy_deallocate`, objects managed by a `std::unique_ptr` with a
+//! deleter of this memory system are also returned to the cache.
+//!
+//! The raw `allocate` and `deallocate` functions use the free slots of the first type that is large enough and has a
+//! sufficient alignment. They never return a cached object.
+//!
+//! @tparam T_Types:
+//! List of the types that can be managed by the memory system. Each type must be unique.
+template <typename... T_Types>
+class SlabMemory
+{
+    static_assert(sizeof...(T_Types) > 0, "At least one type is required.");
+
+public:
+    //! @brief
+    //! Compatible allocator type that can be used with STL containers.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be allocated.
+    template <typename T_Type>
+    using MemoryAllocatorType = MemorySystemAllocator<T_Type, SlabMemory<T_Types...>>;
+
+    //! @brief
+    //! Compatible deleter type that can be used with `std::unique_ptr` etc.
+    //!
+    //! @tparam T_Type:
+    //! Type of the object that should be deleted.
+    template <typename T_Type>
+    using MemoryDeleterType = MemorySystemDeleter<T_Type, SlabMemory<T_Types...>>;
+
+    //! @brief
+    //! Default number of objects that are stored in a single slab
+    static constexpr UST default_num_objects_per_slab = 64;
+
+    SlabMemory(const SlabMemory&)     = delete;
+    SlabMemory(SlabMemory&&) noexcept = delete;
+    ~SlabMemory()                     = default;
+    auto operator=(const SlabMemory&) -> SlabMemory& = delete;
+    auto operator=(SlabMemory&&) noexcept -> SlabMemory& = delete;
+
+
+    //! @brief
+    //! Construct a new instance
+    //!
+    //! @param[in] num_objects_per_slab:
+    //! Number of objects that fit into a single slab. A new slab is allocated each time a cache runs out of slots.
+    explicit SlabMemory(UST num_objects_per_slab = default_num_objects_per_slab) noexcept;
+
+
+    //! @brief
+    //! Allocate a new memory block and return a pointer that points to it.
+    //!
+    //! @param[in] size:
+    //! Size of the allocation
+    //! @param[in] alignment:
+    //! Required alignment of the memory
+    //!
+    //! @return
+    //! Pointer to the newly allocated memory
+    //!
+    //! @exception AllocationError
+    //! None of the supported types is large enough
+    //! @exception std::bad_alloc
+    //! Allocation of a new slab failed
+    [[nodiscard]] auto allocate(UST size, UST alignment = 1) -> void*;
+
+
+    //! @brief
+    //! Get an instance of `T_Type`.
+    //!
+    //! @details
+    //! If the cache of `T_Type` contains an object, it is returned without any modification. Otherwise, a new object
+    //! is constructed with the passed arguments.
+    //!
+    //! @tparam T_Type
+    //! The type of the object
+    //! @tparam T_Args:
+    //! Types of the constructor arguments
+    //!
+    //! @param[in] args:
+    //! Arguments that should be passed to the constructor if a new object needs to be created.
+    //!
+    //! @return
+    //! Pointer to the instance of `T_Type`
+    //!
+    //! @exception std::bad_alloc
+    //! Allocation of a new slab failed
+    template <typename T_Type, typename... T_Args>
+    [[nodiscard]] auto allocate_construct(T_Args&&... args) -> T_Type*;
+
+
+    //! @brief
+    //! Destroy all cached objects.
+    //!
+    //! @details
+    //! The memory of the destroyed objects is kept and can be used for new objects.
+    void clear() noexcept;
+
+
+    //! @brief
+    //! Deallocate memory that was obtained with `allocate`.
+    //!
+    //! @param[in] ptr:
+    //! Pointer to the memory that should be freed
+    //! @param[in] size:
+    //! Size of the memory that should be freed.
+    //! @param[in] alignment:
+    //! Alignment of the pointer.
+    void deallocate(void* ptr, UST size, UST alignment = 1) noexcept;
+
+
+    //! @brief
+    //! Return the passed object to the cache of its type without calling its destructor.
+    //!
+    //! @tparam T_Type
+    //! Type of the passed object
+    //!
+    //! @param[in] pointer:
+    //! Pointer to the object that should be returned
+    template <typename T_Type>
+    void destroy_deallocate(T_Type* pointer) noexcept;
+
+
+    //! @brief
+    //! Get an allocator that allocates and deallocates memory for the specified type from this memory system
+    //!
+    //! @tparam T_Type
+    //! Type that should be allocated
+    //!
+    //! @return
+    //! Allocator of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_allocator() noexcept -> MemoryAllocatorType<T_Type>;
+
+
+    //! @brief
+    //! Get a deleter that returns objects of the specified type to the cache of this memory system
+    //!
+    //! @tparam T_Type
+    //! Type that should be deleted
+    //!
+    //! @return
+    //! Deleter of the specified type
+    template <typename T_Type>
+    [[nodiscard]] auto get_deleter() noexcept -> MemoryDeleterType<T_Type>;
+
+
+    //! @brief
+    //! Get the number of constructed objects in the cache of `T_Type`.
+    //!
+    //! @tparam T_Type
+    //! Object type
+    //!
+    //! @return
+    //! Number of cached objects
+    template <typename T_Type>
+    [[nodiscard]] auto get_num_cached_objects() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get the number of objects of type `T_Type` that are currently in use.
+    //!
+    //! @details
+    //! Memory blocks obtained from `allocate` are counted for the type whose slot was used.
+    //!
+    //! @tparam T_Type
+    //! Object type
+    //!
+    //! @return
+    //! Number of objects in use
+    template <typename T_Type>
+    [[nodiscard]] auto get_num_used_objects() const noexcept -> UST;
+
+
+    //! @brief
+    //! Construct objects until the cache of `T_Type` contains at least the requested number of objects.
+    //!
+    //! @tparam T_Type
+    //! The type of the objects
+    //! @tparam T_Args:
+    //! Types of the constructor arguments
+    //!
+    //! @param[in] num_objects:
+    //! Number of objects that should be available in the cache.
+    //! @param[in] args:
+    //! Arguments that are passed to the constructor of each new object. They are not forwarded since they are used
+    //! multiple times.
+    //!
+    //! @exception std::bad_alloc
+    //! Allocation of a new slab failed
+    template <typename T_Type, typename... T_Args>
+    void reserve(UST num_objects, T_Args&&... args);
+
+
+private:
+    //! @brief
+    //! Get the cache of a specific type.
+    //!
+    //! @tparam T_Type
+    //! Object type
+    //!
+    //! @return
+    //! Cache of the type
+    template <typename T_Type>
+    [[nodiscard]] auto get_cache() noexcept -> internal::SlabCache<T_Type>&;
+
+
+    //! @brief
+    //! Get the cache of a specific type.
+    //!
+    //! @tparam T_Type
+    //! Object type
+    //!
+    //! @return
+    //! Cache of the type
+    template <typename T_Type>
+    [[nodiscard]] auto get_cache() const noexcept -> const internal::SlabCache<T_Type>&;
+
+
+    //! @brief
+    //! Return `true` if the slots of `T_Type` can store a memory block with the given size and alignment.
+    //!
+    //! @tparam T_Type
+    //! Object type
+    //!
+    //! @param[in] size:
+    //! Size of the memory block
+    //! @param[in] alignment:
+    //! Alignment of the memory block
+    //!
+    //! @return
+    //! `true` or `false`
+    template <typename T_Type>
+    [[nodiscard]] static constexpr auto slot_fits(UST size, UST alignment) noexcept -> bool;
+
+
+    std::tuple<internal::SlabCache<T_Types>...> m_caches;
+};
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+namespace mjolnir
+{
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+SlabCache<T_Type>::SlabCache(UST num_objects_per_slab) noexcept : m_num_objects_per_slab{num_objects_per_slab}
+{
+    assert(num_objects_per_slab > 0 && "Number of objects per slab must be larger than 0."); // NOLINT
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+SlabCache<T_Type>::~SlabCache()
+{
+    assert(m_num_used_slots == 0 && "Memory still in use."); // NOLINT
+    clear();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+void SlabCache<T_Type>::clear() noexcept
+{
+    for (T_Type* pointer : m_cached_objects)
+    {
+        destroy(pointer);
+        m_free_slots.push_back(pointer); // never reallocates since the capacity is reserved for each slab
+    }
+    m_cached_objects.clear();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto SlabCache<T_Type>::get_num_cached_objects() const noexcept -> UST
+{
+    return m_cached_objects.size();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto SlabCache<T_Type>::get_num_free_slots() const noexcept -> UST
+{
+    return m_free_slots.size();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto SlabCache<T_Type>::get_num_used_slots() const noexcept -> UST
+{
+    return m_num_used_slots;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto SlabCache<T_Type>::pop_object() noexcept -> T_Type*
+{
+    if (m_cached_objects.empty())
+        return nullptr;
+
+    T_Type* pointer = m_cached_objects.back();
+    m_cached_objects.pop_back();
+    ++m_num_used_slots;
+
+    return pointer;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+[[nodiscard]] auto SlabCache<T_Type>::pop_slot() -> void*
+{
+    if (m_free_slots.empty())
+        allocate_slab();
+
+    void* pointer = m_free_slots.back();
+    m_free_slots.pop_back();
+    ++m_num_used_slots;
+
+    return pointer;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+void SlabCache<T_Type>::push_object(T_Type* pointer) noexcept
+{
+    assert(m_num_used_slots > 0 && "Deallocation was called too often"); // NOLINT
+
+    m_cached_objects.push_back(pointer);
+    --m_num_used_slots;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+void SlabCache<T_Type>::push_slot(void* pointer) noexcept
+{
+    assert(m_num_used_slots > 0 && "Deallocation was called too often"); // NOLINT
+
+    m_free_slots.push_back(pointer);
+    --m_num_used_slots;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+void SlabCache<T_Type>::allocate_slab()
+{
+    UST slab_size = m_num_objects_per_slab * sizeof(T_Type) + alignof(T_Type) - 1;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    m_slabs.push_back(std::make_unique<std::byte[]>(slab_size));
+
+    // Each slot is either used, cached or free. Reserving enough space for all slots in both vectors ensures that
+    // returning objects or slots to the cache never allocates.
+    UST num_slots = m_slabs.size() * m_num_objects_per_slab;
+    m_cached_objects.reserve(num_slots);
+    m_free_slots.reserve(num_slots);
+
+    UPT slot_addr = align_address(pointer_to_integer(m_slabs.back().get()), alignof(T_Type));
+    for (UST i = 0; i < m_num_objects_per_slab; ++i)
+        m_free_slots.push_back(integer_to_pointer(slot_addr + (m_num_objects_per_slab - i - 1) * sizeof(T_Type)));
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+SlabMemory<T_Types...>::SlabMemory(UST num_objects_per_slab) noexcept
+    : m_caches{internal::SlabCache<T_Types>(num_objects_per_slab)...}
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+auto SlabMemory<T_Types...>::allocate(UST size, UST alignment) -> void*
+{
+    assert(size != 0 && "Allocated memory size is 0."); // NOLINT
+
+    void* pointer = nullptr;
+    ((slot_fits<T_Types>(size, alignment) && (pointer = get_cache<T_Types>().pop_slot(), true)) || ...);
+
+    THROW_EXCEPTION_IF(pointer == nullptr, AllocationError, "No slot type is large enough for the requested memory.");
+
+    return pointer;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type, typename... T_Args>
+auto SlabMemory<T_Types...>::allocate_construct(T_Args&&... args) -> T_Type*
+{
+    auto& cache = get_cache<T_Type>();
+
+    T_Type* pointer = cache.pop_object();
+    if (pointer != nullptr)
+        return pointer;
+
+    void* slot = cache.pop_slot();
+    try
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        return new (slot) T_Type(std::forward<T_Args>(args)...);
+    }
+    catch (...)
+    {
+        cache.push_slot(slot);
+        throw;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+void SlabMemory<T_Types...>::clear() noexcept
+{
+    (get_cache<T_Types>().clear(), ...);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+void SlabMemory<T_Types...>::deallocate(void* ptr, UST size, UST alignment) noexcept
+{
+    assert(ptr != nullptr && "Pointer is the `nullptr`."); // NOLINT
+
+    [[maybe_unused]] bool is_deallocated =
+            ((slot_fits<T_Types>(size, alignment) && (get_cache<T_Types>().push_slot(ptr), true)) || ...);
+
+    assert(is_deallocated && "Memory does not belong to the memory system."); // NOLINT
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+void SlabMemory<T_Types...>::destroy_deallocate(T_Type* pointer) noexcept
+{
+    assert(pointer != nullptr && "Pointer is the `nullptr`."); // NOLINT
+
+    get_cache<T_Type>().push_object(pointer);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] auto SlabMemory<T_Types...>::get_allocator() noexcept -> MemoryAllocatorType<T_Type>
+{
+    return MemoryAllocatorType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] auto SlabMemory<T_Types...>::get_deleter() noexcept -> MemoryDeleterType<T_Type>
+{
+    return MemoryDeleterType<T_Type>(*this);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] auto SlabMemory<T_Types...>::get_num_cached_objects() const noexcept -> UST
+{
+    return get_cache<T_Type>().get_num_cached_objects();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] auto SlabMemory<T_Types...>::get_num_used_objects() const noexcept -> UST
+{
+    return get_cache<T_Type>().get_num_used_slots();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type, typename... T_Args>
+void SlabMemory<T_Types...>::reserve(UST num_objects, T_Args&&... args)
+{
+    auto& cache = get_cache<T_Type>();
+
+    while (cache.get_num_cached_objects() < num_objects)
+    {
+        void* slot = cache.pop_slot();
+        try
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            cache.push_object(new (slot) T_Type(args...));
+        }
+        catch (...)
+        {
+            cache.push_slot(slot);
+            throw;
+        }
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] auto SlabMemory<T_Types...>::get_cache() noexcept -> internal::SlabCache<T_Type>&
+{
+    static_assert(is_any_of<T_Type, T_Types...>(), "Type is not supported by the memory system.");
+
+    return std::get<internal::SlabCache<T_Type>>(m_caches);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] auto SlabMemory<T_Types...>::get_cache() const noexcept -> const internal::SlabCache<T_Type>&
+{
+    static_assert(is_any_of<T_Type, T_Types...>(), "Type is not supported by the memory system.");
+
+    return std::get<internal::SlabCache<T_Type>>(m_caches);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename... T_Types>
+template <typename T_Type>
+[[nodiscard]] constexpr auto SlabMemory<T_Types...>::slot_fits(UST size, UST alignment) noexcept -> bool
+{
+    return size <= sizeof(T_Type) && alignment <= alignof(T_Type);
+}
+
+
+} // namespace mjolnir
@@ -15,8 +15,10 @@
 #include "mjolnir/core/memory/definitions.h"
 #include "mjolnir/core/utility/pointer_operations.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
+#include <utility>
 
 namespace mjolnir
 {
@@ -39,6 +41,90 @@ namespace mjolnir
 [[nodiscard]] constexpr auto align_address(UPT address, UST alignment) noexcept -> UPT;
 
 
+//! @brief
+//! Allocate memory that occupies its own cache lines.
+//!
+//! @details
+//! The returned memory starts at a cache line boundary and its size is padded to a multiple of `cache_line_size`.
+//! Therefore, it never shares a cache line with any other allocation from the same memory system. Use this function
+//! for data that is frequently written by a single thread, like per-thread counters, to avoid false sharing.
+//! Memory obtained from this function must be freed with `deallocate_cache_isolated`.
+//!
+//! @tparam T_MemorySystem:
+//! Type of the memory system
+//!
+//! @param[in] size:
+//! Requested size in bytes
+//! @param[in] alignment:
+//! Required alignment of the memory. Values smaller than `cache_line_size` are increased to `cache_line_size`.
+//! @param[in] memory_system:
+//! Memory system that should provide the memory
+//!
+//! @return
+//! Pointer to the allocated memory
+template <MemorySystem T_MemorySystem>
+[[nodiscard]] inline auto allocate_cache_isolated(UST size, UST alignment, T_MemorySystem& memory_system) -> void*;
+
+
+//! @brief
+//! Allocate memory that occupies its own cache lines and construct an object of type `T_Type` inside of it.
+//!
+//! @details
+//! The object must be destroyed with `destroy_deallocate_cache_isolated`.
+//!
+//! @tparam T_Type:
+//! Type of the object
+//! @tparam T_MemorySystem:
+//! Type of the memory system
+//! @tparam T_Args:
+//! Parameter pack of the constructor argument types
+//!
+//! @param[in] memory_system:
+//! Memory system that should provide the memory
+//! @param[in] args:
+//! Constructor arguments
+//!
+//! @return
+//! Pointer to the constructed object
+template <typename T_Type, MemorySystem T_MemorySystem, typename... T_Args>
+[[nodiscard]] inline auto allocate_construct_cache_isolated(T_MemorySystem& memory_system, T_Args&&... args)
+        -> T_Type*;
+
+
+//! @brief
+//! Deallocate memory that was obtained from `allocate_cache_isolated`.
+//!
+//! @tparam T_MemorySystem:
+//! Type of the memory system
+//!
+//! @param[in] pointer:
+//! Pointer to the memory that should be freed
+//! @param[in] size:
+//! Size that was passed to `allocate_cache_isolated`
+//! @param[in] alignment:
+//! Alignment that was passed to `allocate_cache_isolated`
+//! @param[in] memory_system:
+//! Memory system that manages the memory of the passed pointer
+template <MemorySystem T_MemorySystem>
+inline void deallocate_cache_isolated(void* pointer, UST size, UST alignment, T_MemorySystem& memory_system) noexcept;
+
+
+//! @brief
+//! Destroy an object that was created with `allocate_construct_cache_isolated` and deallocate its memory.
+//!
+//! @tparam T_Type:
+//! Type of the object
+//! @tparam T_MemorySystem:
+//! Type of the memory system
+//!
+//! @param[in] pointer:
+//! Pointer pointing to the object that should be destroyed and the memory that should be freed
+//! @param[in] memory_system:
+//! Memory system that manages the memory of the passed pointer
+template <typename T_Type, MemorySystem T_MemorySystem>
+inline void destroy_deallocate_cache_isolated(T_Type* pointer, T_MemorySystem& memory_system) noexcept;
+
+
 //! @brief
 //! Destroy the object that the passed pointer points to.
 //!
@@ -57,6 +143,11 @@ inline void destroy(T_Type* pointer) noexcept;
 //! @brief
 //! Destroy the object that the passed pointer points to and deallocate its memory from the passed memory system.
 //!
+//! @details
+//! If the memory system provides its own `destroy_deallocate` member function, the call is forwarded to it. This
+//! allows memory systems to handle the destruction differently, for example, by caching the object instead of
+//! destroying it.
+//!
 //! @tparam T_Type:
 //! Type of the object
 //! @tparam T_MemorySystem:
@@ -70,6 +161,17 @@ template <typename T_Type, MemorySystem T_MemorySystem>
 inline void destroy_deallocate(T_Type* pointer, T_MemorySystem& memory_system) noexcept;
 
 
+//! @brief
+//! Get the size that `allocate_cache_isolated` reserves for the passed size.
+//!
+//! @param[in] size:
+//! Requested size in bytes
+//!
+//! @return
+//! Smallest multiple of `cache_line_size` that is equal to or larger than `size`
+[[nodiscard]] constexpr auto get_cache_isolated_size(UST size) noexcept -> UST;
+
+
 //! @brief
 //! Return `true` if `pointer` is part of the memory starting at `memory_start_ptr`.
 //!
@@ -113,6 +215,54 @@ namespace mjolnir
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <MemorySystem T_MemorySystem>
+[[nodiscard]] inline auto allocate_cache_isolated(UST size, UST alignment, T_MemorySystem& memory_system) -> void*
+{
+    return memory_system.allocate(get_cache_isolated_size(size), std::max(alignment, cache_line_size));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type, MemorySystem T_MemorySystem, typename... T_Args>
+[[nodiscard]] inline auto allocate_construct_cache_isolated(T_MemorySystem& memory_system, T_Args&&... args)
+        -> T_Type*
+{
+    // the memory is owned by the `std::unique_ptr` until the object is constructed, so that it is returned to the memory
+    // system if the constructor throws
+    auto deleter = [&memory_system](void* pointer) noexcept
+    { deallocate_cache_isolated(pointer, sizeof(T_Type), alignof(T_Type), memory_system); };
+    std::unique_ptr<void, decltype(deleter)> memory{
+            allocate_cache_isolated(sizeof(T_Type), alignof(T_Type), memory_system), deleter};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* object = new (memory.get()) T_Type(std::forward<T_Args>(args)...);
+    memory.release();
+    return object;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <MemorySystem T_MemorySystem>
+inline void deallocate_cache_isolated(void* pointer, UST size, UST alignment, T_MemorySystem& memory_system) noexcept
+{
+    memory_system.deallocate(pointer, get_cache_isolated_size(size), std::max(alignment, cache_line_size));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Type, MemorySystem T_MemorySystem>
+inline void destroy_deallocate_cache_isolated(T_Type* pointer, T_MemorySystem& memory_system) noexcept
+{
+    destroy(pointer);
+    deallocate_cache_isolated(pointer, sizeof(T_Type), alignof(T_Type), memory_system);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <typename T_Type>
@@ -128,8 +278,21 @@ inline void destroy(T_Type* pointer) noexcept
 template <typename T_Type, MemorySystem T_MemorySystem>
 inline void destroy_deallocate(T_Type* pointer, T_MemorySystem& memory_system) noexcept
 {
-    destroy(pointer);
-    memory_system.deallocate(pointer, sizeof(T_Type), alignof(T_Type));
+    if constexpr (requires { memory_system.destroy_deallocate(pointer); })
+        memory_system.destroy_deallocate(pointer);
+    else
+    {
+        destroy(pointer);
+        memory_system.deallocate(pointer, sizeof(T_Type), alignof(T_Type));
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto get_cache_isolated_size(UST size) noexcept -> UST
+{
+    return (size + cache_line_size - 1) / cache_line_size * cache_line_size;
 }
 
 
@@ -0,0 +1,694 @@
+//! @file
+//! simd/vec.h
+//!
+//! @brief
+//! Contains a fixed-size vector type that is backed either by an x86 vector register or by a plain array.
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/core/utility/type.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+// The x86 backend is only available on x86 targets. On other targets, all vectors use the scalar backend.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#    define MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+#    include "mjolnir/core/x86/definitions.h"
+#    include "mjolnir/core/x86/direct_access.h"
+#    include "mjolnir/core/x86/element_summation.h"
+#    include "mjolnir/core/x86/intrinsics.h"
+#endif
+
+
+// === DECLARATIONS ===================================================================================================
+
+namespace mjolnir::simd
+{
+//! \addtogroup core_simd
+//! @{
+
+
+//! @brief
+//! The implementations that can be selected for a `Vec`.
+enum class Backend
+{
+    SCALAR, //!< Plain array where each operation is performed element by element
+    X86     //!< x86 vector register that uses the wrappers from `core/x86`
+};
+
+
+//! @brief
+//! Concept for the element types that are supported by `Vec`.
+//!
+//! @tparam T_Type
+//! Type
+template <typename T_Type>
+concept VecElement = is_any_of<T_Type, F32, F64>();
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Return a default constructed x86 register that stores `t_size` values of `T_Type` or `void` if there is none.
+template <VecElement T_Type, UST t_size>
+[[nodiscard]] consteval auto get_x86_register() noexcept;
+} // namespace internal
+//! \endcond
+
+
+// --- continued public declarations ----------------------------------------------------------------------------------
+
+//! @brief
+//! `true` if there is an enabled x86 vector register that stores exactly `t_size` values of `T_Type`.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+template <VecElement T_Type, UST t_size>
+inline constexpr bool is_x86_backend_available =
+        ! std::is_void_v<decltype(internal::get_x86_register<T_Type, t_size>())>;
+
+
+//! @brief
+//! The backend that is used by `Vec` if none is specified.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+template <VecElement T_Type, UST t_size>
+inline constexpr Backend default_backend =
+        is_x86_backend_available<T_Type, t_size> ? Backend::X86 : Backend::SCALAR;
+
+
+//! @brief
+//! A fixed-size vector of floating-point values with element-wise arithmetic.
+//!
+//! @details
+//! Algorithms that are written in terms of `Vec` compile for every backend. The `X86` backend stores an x86 vector
+//! register and forwards all operations to the wrappers in `core/x86`. Since those are inlined, it generates the same
+//! code as the raw register path. The `SCALAR` backend stores a plain array and serves as reference implementation,
+//! for example, for deterministic replays or platforms without vector registers. Element-wise operations give
+//! bitwise identical results for both backends, because `fmadd` uses `std::fma` in the scalar case. The scalar
+//! `element_sum` uses the same summation order as the x86 registers, so it is bitwise identical, too.
+//!
+//! Like the underlying registers, the default constructor doesn't initialize the elements.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+//! @tparam t_backend
+//! The backend of the vector. The `X86` backend requires `is_x86_backend_available` to be `true`.
+template <VecElement T_Type, UST t_size, Backend t_backend = default_backend<T_Type, t_size>>
+class Vec
+{
+    static_assert(t_size > 0, "Vector size must be larger than 0.");
+    static_assert(t_backend == Backend::SCALAR || is_x86_backend_available<T_Type, t_size>,
+                  "There is no x86 vector register for the combination of element type and size.");
+
+public:
+    //! @brief
+    //! Type of the data member. Either an x86 register or a `std::array`.
+    using StorageType = std::conditional_t<t_backend == Backend::X86,
+                                           decltype(internal::get_x86_register<T_Type, t_size>()),
+                                           std::array<T_Type, t_size>>;
+
+    //! @brief
+    //! Element type
+    using ValueType = T_Type;
+
+    //! @brief
+    //! Required alignment of the pointers passed to `load` and `store`
+    static constexpr UST alignment = alignof(StorageType);
+
+    //! @brief
+    //! Number of elements
+    static constexpr UST num_elements = t_size;
+
+    //! @brief
+    //! The backend of the vector
+    static constexpr Backend backend = t_backend;
+
+
+    //! @brief
+    //! Construct a new instance without initializing the elements.
+    Vec() noexcept = default;
+
+
+    //! @brief
+    //! Construct a new instance from the data of the backend.
+    //!
+    //! @param[in] data:
+    //! The register or array that should be stored
+    explicit Vec(StorageType data) noexcept;
+
+
+    //! @brief
+    //! Create a vector with all elements set to the same value.
+    //!
+    //! @param[in] value:
+    //! The value of all elements
+    //!
+    //! @return
+    //! New vector
+    [[nodiscard]] static auto broadcast(T_Type value) noexcept -> Vec;
+
+
+    //! @brief
+    //! Get the value of a single element.
+    //!
+    //! @param[in] index:
+    //! Index of the element
+    //!
+    //! @return
+    //! Value of the element
+    [[nodiscard]] auto get(UST index) const noexcept -> T_Type;
+
+
+    //! @brief
+    //! Get the data of the backend.
+    //!
+    //! @return
+    //! The stored register or array
+    [[nodiscard]] auto get_data() const noexcept -> StorageType;
+
+
+    //! @brief
+    //! Load a vector from memory.
+    //!
+    //! @param[in] ptr:
+    //! Pointer to `t_size` values. It must be aligned to `alignment`.
+    //!
+    //! @return
+    //! New vector with the loaded values
+    [[nodiscard]] static auto load(const T_Type* ptr) noexcept -> Vec;
+
+
+    //! @brief
+    //! Load a vector from memory that might not be aligned to `alignment`.
+    //!
+    //! @param[in] ptr:
+    //! Pointer to `t_size` values
+    //!
+    //! @return
+    //! New vector with the loaded values
+    [[nodiscard]] static auto load_unaligned(const T_Type* ptr) noexcept -> Vec;
+
+
+    //! @brief
+    //! Store the vector elements in memory.
+    //!
+    //! @param[out] ptr:
+    //! Pointer to the memory that receives `t_size` values. It must be aligned to `alignment`.
+    void store(T_Type* ptr) const noexcept;
+
+
+    //! @brief
+    //! Store the vector elements in memory that might not be aligned to `alignment`.
+    //!
+    //! @param[out] ptr:
+    //! Pointer to the memory that receives `t_size` values
+    void store_unaligned(T_Type* ptr) const noexcept;
+
+
+    //! @brief
+    //! Create a vector with all elements set to zero.
+    //!
+    //! @return
+    //! New vector
+    [[nodiscard]] static auto zero() noexcept -> Vec;
+
+
+    //! @brief
+    //! Add another vector element-wise to this one.
+    //!
+    //! @param[in] rhs:
+    //! The vector right of the operator
+    //!
+    //! @return
+    //! Reference to this vector
+    auto operator+=(Vec rhs) noexcept -> Vec&;
+
+
+    //! @brief
+    //! Subtract another vector element-wise from this one.
+    //!
+    //! @param[in] rhs:
+    //! The vector right of the operator
+    //!
+    //! @return
+    //! Reference to this vector
+    auto operator-=(Vec rhs) noexcept -> Vec&;
+
+
+    //! @brief
+    //! Multiply this vector element-wise with another one.
+    //!
+    //! @param[in] rhs:
+    //! The vector right of the operator
+    //!
+    //! @return
+    //! Reference to this vector
+    auto operator*=(Vec rhs) noexcept -> Vec&;
+
+
+private:
+    StorageType m_data;
+};
+
+
+//! @brief
+//! Return the sum of all vector elements.
+//!
+//! @details
+//! Both backends sum up the elements in the same order and give bitwise identical results.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+//! @tparam t_backend
+//! Backend of the vector
+//!
+//! @param[in] src:
+//! Source vector
+//!
+//! @return
+//! Sum of all elements
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto element_sum(Vec<T_Type, t_size, t_backend> src) noexcept -> T_Type;
+
+
+//! @brief
+//! Multiply `a` and `b` element-wise and add `c` to the result.
+//!
+//! @details
+//! The operation is performed with a single rounding.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+//! @tparam t_backend
+//! Backend of the vectors
+//!
+//! @param[in] a:
+//! First factor
+//! @param[in] b:
+//! Second factor
+//! @param[in] c:
+//! Summand
+//!
+//! @return
+//! Result of `a * b + c`
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto fmadd(Vec<T_Type, t_size, t_backend> a,
+                                Vec<T_Type, t_size, t_backend> b,
+                                Vec<T_Type, t_size, t_backend> c) noexcept -> Vec<T_Type, t_size, t_backend>;
+
+
+//! @brief
+//! Perform an element-wise addition of two vectors.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+//! @tparam t_backend
+//! Backend of the vectors
+//!
+//! @param[in] lhs:
+//! The vector left of the operator
+//! @param[in] rhs:
+//! The vector right of the operator
+//!
+//! @return
+//! Results of the element-wise addition
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto operator+(Vec<T_Type, t_size, t_backend> lhs, Vec<T_Type, t_size, t_backend> rhs) noexcept
+        -> Vec<T_Type, t_size, t_backend>;
+
+
+//! @brief
+//! Perform an element-wise subtraction of two vectors.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+//! @tparam t_backend
+//! Backend of the vectors
+//!
+//! @param[in] lhs:
+//! The vector left of the operator
+//! @param[in] rhs:
+//! The vector right of the operator
+//!
+//! @return
+//! Results of the element-wise subtraction
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto operator-(Vec<T_Type, t_size, t_backend> lhs, Vec<T_Type, t_size, t_backend> rhs) noexcept
+        -> Vec<T_Type, t_size, t_backend>;
+
+
+//! @brief
+//! Perform an element-wise multiplication of two vectors.
+//!
+//! @tparam T_Type
+//! Element type
+//! @tparam t_size
+//! Number of elements
+//! @tparam t_backend
+//! Backend of the vectors
+//!
+//! @param[in] lhs:
+//! The vector left of the operator
+//! @param[in] rhs:
+//! The vector right of the operator
+//!
+//! @return
+//! Results of the element-wise multiplication
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto operator*(Vec<T_Type, t_size, t_backend> lhs, Vec<T_Type, t_size, t_backend> rhs) noexcept
+        -> Vec<T_Type, t_size, t_backend>;
+
+
+//! @}
+} // namespace mjolnir::simd
+
+
+// === DEFINITIONS ====================================================================================================
+
+namespace mjolnir::simd
+{
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size>
+[[nodiscard]] consteval auto get_x86_register() noexcept
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    constexpr UST num_bytes = t_size * sizeof(T_Type);
+
+    if constexpr (num_bytes == sizeof(__m128))
+        return std::conditional_t<std::is_same_v<T_Type, F32>, __m128, __m128d>{};
+    else if constexpr (num_bytes == sizeof(__m256))
+        return std::conditional_t<std::is_same_v<T_Type, F32>, __m256, __m256d>{};
+#    ifdef MJOLNIR_CORE_ENABLE_AVX512
+    else if constexpr (num_bytes == sizeof(__m512))
+        return std::conditional_t<std::is_same_v<T_Type, F32>, __m512, __m512d>{};
+#    endif
+#endif
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+Vec<T_Type, t_size, t_backend>::Vec(StorageType data) noexcept
+    : m_data{data}
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] auto Vec<T_Type, t_size, t_backend>::broadcast(T_Type value) noexcept -> Vec
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return Vec{x86::mm_set1<StorageType>(value)};
+    else
+#endif
+    {
+        StorageType data;
+        data.fill(value);
+        return Vec{data};
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] auto Vec<T_Type, t_size, t_backend>::get(UST index) const noexcept -> T_Type
+{
+    assert(index < t_size && "Index exceeds the vector size."); // NOLINT
+
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return x86::get(m_data, index);
+    else
+#endif
+        return m_data[index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] auto Vec<T_Type, t_size, t_backend>::get_data() const noexcept -> StorageType
+{
+    return m_data;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] auto Vec<T_Type, t_size, t_backend>::load(const T_Type* ptr) noexcept -> Vec
+{
+    assert(is_aligned<alignment>(ptr) && "Pointer is not aligned to `alignment`."); // NOLINT
+
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return Vec{x86::mm_load<StorageType>(ptr)};
+    else
+#endif
+        return load_unaligned(ptr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] auto Vec<T_Type, t_size, t_backend>::load_unaligned(const T_Type* ptr) noexcept -> Vec
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return Vec{x86::mm_loadu<StorageType>(ptr)};
+    else
+#endif
+    {
+        StorageType data;
+        for (UST i = 0; i < t_size; ++i)
+            data[i] = ptr[i]; // NOLINT - pointer arithmetic and array index
+        return Vec{data};
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+void Vec<T_Type, t_size, t_backend>::store(T_Type* ptr) const noexcept
+{
+    assert(is_aligned<alignment>(ptr) && "Pointer is not aligned to `alignment`."); // NOLINT
+
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        x86::mm_store(ptr, m_data);
+    else
+#endif
+        store_unaligned(ptr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+void Vec<T_Type, t_size, t_backend>::store_unaligned(T_Type* ptr) const noexcept
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        x86::mm_storeu(ptr, m_data);
+    else
+#endif
+        for (UST i = 0; i < t_size; ++i)
+            ptr[i] = m_data[i]; // NOLINT - pointer arithmetic and array index
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] auto Vec<T_Type, t_size, t_backend>::zero() noexcept -> Vec
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return Vec{x86::mm_setzero<StorageType>()};
+    else
+#endif
+        return Vec{StorageType{}};
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+auto Vec<T_Type, t_size, t_backend>::operator+=(Vec rhs) noexcept -> Vec&
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        m_data = x86::mm_add(m_data, rhs.m_data);
+    else
+#endif
+        for (UST i = 0; i < t_size; ++i)
+            m_data[i] += rhs.m_data[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+auto Vec<T_Type, t_size, t_backend>::operator-=(Vec rhs) noexcept -> Vec&
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        m_data = x86::mm_sub(m_data, rhs.m_data);
+    else
+#endif
+        for (UST i = 0; i < t_size; ++i)
+            m_data[i] -= rhs.m_data[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+auto Vec<T_Type, t_size, t_backend>::operator*=(Vec rhs) noexcept -> Vec&
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        m_data = x86::mm_mul(m_data, rhs.m_data);
+    else
+#endif
+        for (UST i = 0; i < t_size; ++i)
+            m_data[i] *= rhs.m_data[i]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto element_sum(Vec<T_Type, t_size, t_backend> src) noexcept -> T_Type
+{
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return x86::element_sum(src.get_data());
+    else
+#endif
+    {
+        // The summation order mirrors the x86 backend, so that both give bitwise identical results. Data wider than
+        // 256 bits is halved by adding the upper to the lower half, like AVX-512 registers are reduced to AVX
+        // registers. The rest is summed pairwise with increasing distance, like the permutations of the register
+        // elements.
+        auto values = src.get_data();
+        UST  size   = t_size;
+
+        constexpr UST max_pairwise_bytes = 32;
+        while (size * sizeof(T_Type) > max_pairwise_bytes && size % 2 == 0)
+        {
+            size /= 2;
+            for (UST i = 0; i < size; ++i)
+                values[i] += values[i + size]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        for (UST distance = 1; distance < size; distance *= 2)
+            for (UST i = 0; i + distance < size; i += 2 * distance)
+                values[i] += values[i + distance]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        return values[0];
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto fmadd(Vec<T_Type, t_size, t_backend> a,
+                                Vec<T_Type, t_size, t_backend> b,
+                                Vec<T_Type, t_size, t_backend> c) noexcept -> Vec<T_Type, t_size, t_backend>
+{
+    using VecType = Vec<T_Type, t_size, t_backend>;
+
+#ifdef MJOLNIR_CORE_SIMD_X86_BACKEND_SUPPORTED
+    if constexpr (t_backend == Backend::X86)
+        return VecType{x86::mm_fmadd(a.get_data(), b.get_data(), c.get_data())};
+    else
+#endif
+    {
+        typename VecType::StorageType data_a = a.get_data();
+        typename VecType::StorageType data_b = b.get_data();
+        typename VecType::StorageType data_c = c.get_data();
+
+        for (UST i = 0; i < t_size; ++i)
+            data_c[i] = std::fma(data_a[i], data_b[i], data_c[i]); // NOLINT - array index
+        return VecType{data_c};
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto operator+(Vec<T_Type, t_size, t_backend> lhs, Vec<T_Type, t_size, t_backend> rhs) noexcept
+        -> Vec<T_Type, t_size, t_backend>
+{
+    return lhs += rhs;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto operator-(Vec<T_Type, t_size, t_backend> lhs, Vec<T_Type, t_size, t_backend> rhs) noexcept
+        -> Vec<T_Type, t_size, t_backend>
+{
+    return lhs -= rhs;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VecElement T_Type, UST t_size, Backend t_backend>
+[[nodiscard]] inline auto operator*(Vec<T_Type, t_size, t_backend> lhs, Vec<T_Type, t_size, t_backend> rhs) noexcept
+        -> Vec<T_Type, t_size, t_backend>
+{
+    return lhs *= rhs;
+}
+
+
+} // namespace mjolnir::simd
@@ -13,6 +13,7 @@
 
 #include "mjolnir/core/fundamental_types.h"
 
+#include <bit>
 #include <concepts>
 #include <limits>
 
@@ -32,6 +33,19 @@ template <typename T_Type>
 inline constexpr UST num_bits = sizeof(T_Type) * CHAR_BIT;
 
 
+//! @brief
+//! `true` if the compiler targets the BMI2 instruction set extension and `false` otherwise.
+//!
+//! @details
+//! If it is `true`, `deposit_bits` and `extract_bits` are compiled to the `pdep` and `pext` instructions. MSVC doesn't
+//! provide a dedicated symbol for BMI2, but every CPU with AVX2 support also supports BMI2.
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+inline constexpr bool is_bmi2_enabled = true;
+#else
+inline constexpr bool is_bmi2_enabled = false;
+#endif
+
+
 //! @brief
 //! Construct an unsigned integer by setting its individual bits.
 //!
@@ -127,6 +141,151 @@ template <UST t_num_bits, std::unsigned_integral T_Type>
 constexpr void clear_bits(T_Type& integer, UST index) noexcept;
 
 
+//! @brief
+//! Count the number of consecutive zero bits, starting at the highest bit.
+//!
+//! @details
+//! The function is usable in constant expressions. At runtime, it compiles to a single `lzcnt` instruction if the
+//! target supports LZCNT.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] integer:
+//! The source integer
+//!
+//! @return
+//! Number of leading zero bits. If `integer` is 0, the number of bits of `T_Type` is returned.
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto count_leading_zeros(T_Type integer) noexcept -> UST;
+
+
+//! @brief
+//! Count the number of set bits of an unsigned integer.
+//!
+//! @details
+//! The function is usable in constant expressions. At runtime, it compiles to a single `popcnt` instruction if the
+//! target supports POPCNT.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] integer:
+//! The source integer
+//!
+//! @return
+//! Number of set bits
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto count_set_bits(T_Type integer) noexcept -> UST;
+
+
+//! @brief
+//! Count the number of consecutive zero bits, starting at the lowest bit.
+//!
+//! @details
+//! The function is usable in constant expressions. At runtime, it compiles to a single `tzcnt` instruction if the
+//! target supports BMI.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] integer:
+//! The source integer
+//!
+//! @return
+//! Number of trailing zero bits. If `integer` is 0, the number of bits of `T_Type` is returned.
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto count_trailing_zeros(T_Type integer) noexcept -> UST;
+
+
+//! @brief
+//! Scatter the lowest bits of `source` to the positions of the set bits of `mask`.
+//!
+//! @details
+//! The lowest bit of `source` is written to the position of the lowest set bit of `mask`, the second lowest bit to the
+//! position of the second lowest set bit and so on. All other bits of the result are zero. At runtime, the function
+//! compiles to a single `pdep` instruction if `is_bmi2_enabled` is `true`. Otherwise, and in constant expressions, a
+//! software implementation with one iteration per set bit of `mask` is used.
+//!
+//! Note that `pdep` is implemented in microcode with a latency that depends on the number of set bits on AMD CPUs
+//! prior to Zen 3. Code that targets those CPUs should prefer fixed shift and mask sequences if they exist.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] source:
+//! The integer that provides the bit values
+//!
+//! @param[in] mask:
+//! The mask that selects the target positions
+//!
+//! @return
+//! Integer with the deposited bits
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto deposit_bits(T_Type source, T_Type mask) noexcept -> T_Type;
+
+
+//! @brief
+//! Gather the bits of `source` at the positions of the set bits of `mask` into the lowest bits of the result.
+//!
+//! @details
+//! This is the inverse operation of `deposit_bits`. At runtime, the function compiles to a single `pext` instruction
+//! if `is_bmi2_enabled` is `true`. Otherwise, and in constant expressions, a software implementation with one
+//! iteration per set bit of `mask` is used. The performance note of `deposit_bits` also applies to `pext`.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] source:
+//! The integer that provides the bit values
+//!
+//! @param[in] mask:
+//! The mask that selects the extracted bits
+//!
+//! @return
+//! Integer with the extracted bits in its lowest bits
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto extract_bits(T_Type source, T_Type mask) noexcept -> T_Type;
+
+
+//! @brief
+//! Find the lowest set bit of an unsigned integer.
+//!
+//! @details
+//! The returned position is one-based, like the one of the POSIX function `ffs`, so that 0 can indicate an integer
+//! without set bits.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] integer:
+//! The source integer
+//!
+//! @return
+//! Index of the lowest set bit plus one or 0 if no bit is set
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto find_first_set(T_Type integer) noexcept -> UST;
+
+
+//! @brief
+//! Find the highest set bit of an unsigned integer.
+//!
+//! @details
+//! The returned position is one-based, so that 0 can indicate an integer without set bits. For integers larger than
+//! 0, the result minus one is the rounded down binary logarithm.
+//!
+//! @tparam T_Type:
+//! An unsigned integer type
+//!
+//! @param[in] integer:
+//! The source integer
+//!
+//! @return
+//! Index of the highest set bit plus one or 0 if no bit is set
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto find_last_set(T_Type integer) noexcept -> UST;
+
+
 //! @brief
 //! Extract a bit from an integer and store it with an optional shift in a new integer.
 //!
@@ -421,6 +580,12 @@ constexpr void set_bits_with_int(T_Type& integer, UST index, UST value) noexcept
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <type_traits>
+
+// same condition as for `is_bmi2_enabled`, since only `pdep` and `pext` need the intrinsics
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#    include <immintrin.h>
+#endif
 
 namespace mjolnir
 {
@@ -448,6 +613,39 @@ template <std::integral T_Type>
 }
 
 
+//! Software implementation of `deposit_bits`. Each iteration moves one bit to the lowest remaining set bit of `mask`.
+//! The loop is branchless, because the source bits are usually unpredictable.
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto deposit_bits_software(T_Type source, T_Type mask) noexcept -> T_Type
+{
+    T_Type result = 0;
+    for (; mask != 0; source = static_cast<T_Type>(source >> 1U))
+    {
+        const auto lowest   = static_cast<T_Type>(mask & static_cast<T_Type>(~mask + 1U));
+        const auto bit_mask = static_cast<T_Type>(T_Type(0) - static_cast<T_Type>(source & 1U));
+        result |= static_cast<T_Type>(lowest & bit_mask);
+        mask &= static_cast<T_Type>(mask - 1U);
+    }
+    return result;
+}
+
+
+//! Software implementation of `extract_bits`. Each iteration reads the bit at the lowest remaining set bit of `mask`.
+//! The loop is branchless, because the source bits are usually unpredictable.
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto extract_bits_software(T_Type source, T_Type mask) noexcept -> T_Type
+{
+    T_Type result = 0;
+    for (UST index = 0; mask != 0; ++index)
+    {
+        const auto lowest = static_cast<T_Type>(mask & static_cast<T_Type>(~mask + 1U));
+        result |= static_cast<T_Type>(static_cast<T_Type>((source & lowest) != 0) << index);
+        mask &= static_cast<T_Type>(mask - 1U);
+    }
+    return result;
+}
+
+
 } // namespace internal
 //! \endcond
 
@@ -544,6 +742,87 @@ constexpr void clear_bits(T_Type& integer, UST index) noexcept
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto count_leading_zeros(T_Type integer) noexcept -> UST
+{
+    return static_cast<UST>(std::countl_zero(integer));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto count_set_bits(T_Type integer) noexcept -> UST
+{
+    return static_cast<UST>(std::popcount(integer));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto count_trailing_zeros(T_Type integer) noexcept -> UST
+{
+    return static_cast<UST>(std::countr_zero(integer));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto deposit_bits(T_Type source, T_Type mask) noexcept -> T_Type
+{
+    if constexpr (is_bmi2_enabled)
+        if (! std::is_constant_evaluated())
+        {
+            if constexpr (sizeof(T_Type) <= sizeof(U32))
+                return static_cast<T_Type>(_pdep_u32(source, mask));
+            else
+                return static_cast<T_Type>(_pdep_u64(source, mask));
+        }
+
+    return internal::deposit_bits_software(source, mask);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto extract_bits(T_Type source, T_Type mask) noexcept -> T_Type
+{
+    if constexpr (is_bmi2_enabled)
+        if (! std::is_constant_evaluated())
+        {
+            if constexpr (sizeof(T_Type) <= sizeof(U32))
+                return static_cast<T_Type>(_pext_u32(source, mask));
+            else
+                return static_cast<T_Type>(_pext_u64(source, mask));
+        }
+
+    return internal::extract_bits_software(source, mask);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto find_first_set(T_Type integer) noexcept -> UST
+{
+    return (integer == 0) ? 0 : count_trailing_zeros(integer) + 1;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+[[nodiscard]] constexpr auto find_last_set(T_Type integer) noexcept -> UST
+{
+    return static_cast<UST>(std::bit_width(integer));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <UST t_index, I32 t_shift, std::unsigned_integral T_Type, std::unsigned_integral T_ReturnType>
@@ -0,0 +1,801 @@
+//! @file
+//! utility/bitset.h
+//!
+//! @brief
+//! Contains bitsets with a fixed and a runtime size whose bulk operations process 256 bits per instruction.
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+
+#include <array>
+#include <vector>
+
+
+namespace mjolnir
+{
+//! \addtogroup core_utility
+//! @{
+
+
+// --- StaticBitset ---------------------------------------------------------------------------------------------------
+
+//! @brief
+//! A bitset with a size that is known at compile time.
+//!
+//! @details
+//! The bits are stored in 64 bit words. If AVX2 is enabled, combining two bitsets and the queries `any` and `none`
+//! process four words at once with AVX2 registers. Otherwise, they use plain word loops. `count` uses the hardware
+//! population count. `for_each_set_bit` and `find_next_set` skip zero words with a single bit scan per set bit, which
+//! makes them efficient for sparse bitsets.
+//!
+//! @tparam t_num_bits:
+//! Number of bits
+template <UST t_num_bits>
+class StaticBitset
+{
+public:
+    //! Number of 64 bit words that store the bits
+    static constexpr UST num_words = (t_num_bits + 63) / 64;
+
+
+    //! @brief
+    //! Construct a bitset with all bits cleared.
+    constexpr StaticBitset() noexcept = default;
+
+
+    //! @brief
+    //! Return `true` if at least one bit is set.
+    [[nodiscard]] auto any() const noexcept -> bool;
+
+
+    //! @brief
+    //! Clear all bits.
+    constexpr void clear() noexcept;
+
+
+    //! @brief
+    //! Return the number of set bits.
+    [[nodiscard]] auto count() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get a pointer to the words that store the bits.
+    [[nodiscard]] constexpr auto data() const noexcept -> const U64*;
+
+
+    //! @brief
+    //! Get the index of the first set bit that is not smaller than `index`.
+    //!
+    //! @param[in] index:
+    //! Index of the first bit that should be checked
+    //!
+    //! @return
+    //! Index of the found bit or `size()` if there is none
+    [[nodiscard]] auto find_next_set(UST index = 0) const noexcept -> UST;
+
+
+    //! @brief
+    //! Call a function with the index of each set bit in ascending order.
+    //!
+    //! @tparam T_Func:
+    //! Type of the function
+    //!
+    //! @param[in] func:
+    //! A function that accepts a `UST`
+    template <typename T_Func>
+    void for_each_set_bit(T_Func&& func) const;
+
+
+    //! @brief
+    //! Return `true` if no bit is set.
+    [[nodiscard]] auto none() const noexcept -> bool;
+
+
+    //! @brief
+    //! Clear a single bit.
+    //!
+    //! @param[in] index:
+    //! Index of the bit
+    constexpr void reset(UST index) noexcept;
+
+
+    //! @brief
+    //! Set a single bit.
+    //!
+    //! @param[in] index:
+    //! Index of the bit
+    constexpr void set(UST index) noexcept;
+
+
+    //! @brief
+    //! Get the number of bits.
+    [[nodiscard]] static constexpr auto size() noexcept -> UST;
+
+
+    //! @brief
+    //! Return `true` if a single bit is set.
+    //!
+    //! @param[in] index:
+    //! Index of the bit
+    [[nodiscard]] constexpr auto test(UST index) const noexcept -> bool;
+
+
+    //! @brief
+    //! Keep only the bits that are also set in `other`.
+    auto operator&=(const StaticBitset& other) noexcept -> StaticBitset&;
+
+
+    //! @brief
+    //! Set all bits that are set in `other`.
+    auto operator|=(const StaticBitset& other) noexcept -> StaticBitset&;
+
+
+    //! @brief
+    //! Flip all bits that are set in `other`.
+    auto operator^=(const StaticBitset& other) noexcept -> StaticBitset&;
+
+
+    //! @brief
+    //! Return `true` if both bitsets have the same bits set.
+    [[nodiscard]] constexpr auto operator==(const StaticBitset& other) const noexcept -> bool = default;
+
+
+private:
+    std::array<U64, num_words> m_words = {};
+};
+
+
+// --- DynamicBitset --------------------------------------------------------------------------------------------------
+
+//! @brief
+//! A bitset with a size that is set at runtime.
+//!
+//! @details
+//! See `StaticBitset` for the details of the implementation. Combining two bitsets requires them to have the same
+//! size.
+class DynamicBitset
+{
+public:
+    //! @brief
+    //! Construct a bitset with all bits cleared.
+    //!
+    //! @param[in] num_bits:
+    //! Number of bits
+    explicit DynamicBitset(UST num_bits = 0);
+
+
+    //! @brief
+    //! Return `true` if at least one bit is set.
+    [[nodiscard]] auto any() const noexcept -> bool;
+
+
+    //! @brief
+    //! Clear all bits.
+    void clear() noexcept;
+
+
+    //! @brief
+    //! Return the number of set bits.
+    [[nodiscard]] auto count() const noexcept -> UST;
+
+
+    //! @brief
+    //! Get a pointer to the words that store the bits.
+    [[nodiscard]] auto data() const noexcept -> const U64*;
+
+
+    //! @brief
+    //! Get the index of the first set bit that is not smaller than `index`.
+    //!
+    //! @param[in] index:
+    //! Index of the first bit that should be checked
+    //!
+    //! @return
+    //! Index of the found bit or `size()` if there is none
+    [[nodiscard]] auto find_next_set(UST index = 0) const noexcept -> UST;
+
+
+    //! @brief
+    //! Call a function with the index of each set bit in ascending order.
+    //!
+    //! @tparam T_Func:
+    //! Type of the function
+    //!
+    //! @param[in] func:
+    //! A function that accepts a `UST`
+    template <typename T_Func>
+    void for_each_set_bit(T_Func&& func) const;
+
+
+    //! @brief
+    //! Return `true` if no bit is set.
+    [[nodiscard]] auto none() const noexcept -> bool;
+
+
+    //! @brief
+    //! Clear a single bit.
+    //!
+    //! @param[in] index:
+    //! Index of the bit
+    void reset(UST index) noexcept;
+
+
+    //! @brief
+    //! Change the number of bits. Added bits are cleared.
+    //!
+    //! @param[in] num_bits:
+    //! New number of bits
+    void resize(UST num_bits);
+
+
+    //! @brief
+    //! Set a single bit.
+    //!
+    //! @param[in] index:
+    //! Index of the bit
+    void set(UST index) noexcept;
+
+
+    //! @brief
+    //! Get the number of bits.
+    [[nodiscard]] auto size() const noexcept -> UST;
+
+
+    //! @brief
+    //! Return `true` if a single bit is set.
+    //!
+    //! @param[in] index:
+    //! Index of the bit
+    [[nodiscard]] auto test(UST index) const noexcept -> bool;
+
+
+    //! @brief
+    //! Keep only the bits that are also set in `other`.
+    auto operator&=(const DynamicBitset& other) noexcept -> DynamicBitset&;
+
+
+    //! @brief
+    //! Set all bits that are set in `other`.
+    auto operator|=(const DynamicBitset& other) noexcept -> DynamicBitset&;
+
+
+    //! @brief
+    //! Flip all bits that are set in `other`.
+    auto operator^=(const DynamicBitset& other) noexcept -> DynamicBitset&;
+
+
+    //! @brief
+    //! Return `true` if both bitsets have the same size and the same bits set.
+    [[nodiscard]] auto operator==(const DynamicBitset& other) const noexcept -> bool = default;
+
+
+private:
+    UST              m_num_bits = {0};
+    std::vector<U64> m_words;
+};
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Return `true` if any of the words has a set bit.
+[[nodiscard]] inline auto bitset_any(const U64* words, UST num_words) noexcept -> bool;
+
+
+//! Return the number of set bits of the words.
+[[nodiscard]] inline auto bitset_count(const U64* words, UST num_words) noexcept -> UST;
+
+
+//! Return the index of the first set bit that is not smaller than `index` or `size` if there is none.
+[[nodiscard]] inline auto bitset_find_next_set(const U64* words, UST num_words, UST index, UST size) noexcept -> UST;
+
+
+//! Call `func` with the index of each set bit in ascending order. Blocks of words without set bits are skipped.
+template <typename T_Func>
+inline void bitset_for_each_set_bit(const U64* words, UST num_words, T_Func&& func);
+
+
+//! Return `true` if none of the `t_num_words` words starting at `words` has a set bit.
+template <UST t_num_words>
+[[nodiscard]] inline auto bitset_none_in_block(const U64* words) noexcept -> bool;
+
+
+//! Replace the words of `lhs` with the result of an element-wise operation on the words of `lhs` and `rhs`. The
+//! operation must be `std::bit_and<>`, `std::bit_or<>` or `std::bit_xor<>`.
+template <typename T_Operation>
+inline void bitset_transform(U64* lhs, const U64* rhs, UST num_words, T_Operation operation) noexcept;
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/utility/bit_operations.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// only the AVX2 paths need the intrinsics, all other targets use plain word loops
+#ifdef __AVX2__
+#    include "mjolnir/core/x86/intrinsics.h"
+#    include "mjolnir/core/x86/x86.h"
+#endif
+
+
+namespace mjolnir
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] auto StaticBitset<t_num_bits>::any() const noexcept -> bool
+{
+    return internal::bitset_any(m_words.data(), num_words);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+constexpr void StaticBitset<t_num_bits>::clear() noexcept
+{
+    m_words.fill(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] auto StaticBitset<t_num_bits>::count() const noexcept -> UST
+{
+    return internal::bitset_count(m_words.data(), num_words);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] constexpr auto StaticBitset<t_num_bits>::data() const noexcept -> const U64*
+{
+    return m_words.data();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] auto StaticBitset<t_num_bits>::find_next_set(UST index) const noexcept -> UST
+{
+    return internal::bitset_find_next_set(m_words.data(), num_words, index, t_num_bits);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+template <typename T_Func>
+void StaticBitset<t_num_bits>::for_each_set_bit(T_Func&& func) const
+{
+    internal::bitset_for_each_set_bit(m_words.data(), num_words, std::forward<T_Func>(func));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] auto StaticBitset<t_num_bits>::none() const noexcept -> bool
+{
+    return ! any();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+constexpr void StaticBitset<t_num_bits>::reset(UST index) noexcept
+{
+    assert(index < t_num_bits && "Index exceeds number of bits."); // NOLINT
+
+    clear_bit(m_words[index / 64], index % 64); // NOLINT(*-constant-array-index)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+constexpr void StaticBitset<t_num_bits>::set(UST index) noexcept
+{
+    assert(index < t_num_bits && "Index exceeds number of bits."); // NOLINT
+
+    set_bit(m_words[index / 64], index % 64); // NOLINT(*-constant-array-index)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] constexpr auto StaticBitset<t_num_bits>::size() noexcept -> UST
+{
+    return t_num_bits;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+[[nodiscard]] constexpr auto StaticBitset<t_num_bits>::test(UST index) const noexcept -> bool
+{
+    assert(index < t_num_bits && "Index exceeds number of bits."); // NOLINT
+
+    return ((m_words[index / 64] >> (index % 64)) & 1U) != 0; // NOLINT(*-constant-array-index)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+auto StaticBitset<t_num_bits>::operator&=(const StaticBitset& other) noexcept -> StaticBitset&
+{
+    internal::bitset_transform(m_words.data(), other.m_words.data(), num_words, std::bit_and<>{});
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+auto StaticBitset<t_num_bits>::operator|=(const StaticBitset& other) noexcept -> StaticBitset&
+{
+    internal::bitset_transform(m_words.data(), other.m_words.data(), num_words, std::bit_or<>{});
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_bits>
+auto StaticBitset<t_num_bits>::operator^=(const StaticBitset& other) noexcept -> StaticBitset&
+{
+    internal::bitset_transform(m_words.data(), other.m_words.data(), num_words, std::bit_xor<>{});
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline DynamicBitset::DynamicBitset(UST num_bits) : m_num_bits{num_bits}, m_words((num_bits + 63) / 64, 0)
+{
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::any() const noexcept -> bool
+{
+    return internal::bitset_any(m_words.data(), m_words.size());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline void DynamicBitset::clear() noexcept
+{
+    std::ranges::fill(m_words, 0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::count() const noexcept -> UST
+{
+    return internal::bitset_count(m_words.data(), m_words.size());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::data() const noexcept -> const U64*
+{
+    return m_words.data();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::find_next_set(UST index) const noexcept -> UST
+{
+    return internal::bitset_find_next_set(m_words.data(), m_words.size(), index, m_num_bits);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Func>
+void DynamicBitset::for_each_set_bit(T_Func&& func) const
+{
+    internal::bitset_for_each_set_bit(m_words.data(), m_words.size(), std::forward<T_Func>(func));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::none() const noexcept -> bool
+{
+    return ! any();
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline void DynamicBitset::reset(UST index) noexcept
+{
+    assert(index < m_num_bits && "Index exceeds number of bits."); // NOLINT
+
+    clear_bit(m_words[index / 64], index % 64);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline void DynamicBitset::resize(UST num_bits)
+{
+    m_words.resize((num_bits + 63) / 64, 0);
+    m_num_bits = num_bits;
+
+    // bits beyond the size must stay cleared, so that they don't affect `any` and `count` after growing again
+    if (num_bits % 64 != 0)
+        m_words.back() &= (U64(1) << (num_bits % 64)) - 1;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline void DynamicBitset::set(UST index) noexcept
+{
+    assert(index < m_num_bits && "Index exceeds number of bits."); // NOLINT
+
+    set_bit(m_words[index / 64], index % 64);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::size() const noexcept -> UST
+{
+    return m_num_bits;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto DynamicBitset::test(UST index) const noexcept -> bool
+{
+    assert(index < m_num_bits && "Index exceeds number of bits."); // NOLINT
+
+    return ((m_words[index / 64] >> (index % 64)) & 1U) != 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline auto DynamicBitset::operator&=(const DynamicBitset& other) noexcept -> DynamicBitset&
+{
+    assert(m_num_bits == other.m_num_bits && "Bitsets must have the same size."); // NOLINT
+
+    internal::bitset_transform(m_words.data(), other.m_words.data(), m_words.size(), std::bit_and<>{});
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline auto DynamicBitset::operator|=(const DynamicBitset& other) noexcept -> DynamicBitset&
+{
+    assert(m_num_bits == other.m_num_bits && "Bitsets must have the same size."); // NOLINT
+
+    internal::bitset_transform(m_words.data(), other.m_words.data(), m_words.size(), std::bit_or<>{});
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline auto DynamicBitset::operator^=(const DynamicBitset& other) noexcept -> DynamicBitset&
+{
+    assert(m_num_bits == other.m_num_bits && "Bitsets must have the same size."); // NOLINT
+
+    internal::bitset_transform(m_words.data(), other.m_words.data(), m_words.size(), std::bit_xor<>{});
+    return *this;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Number of words that are processed together. This is the number of words that fit into an AVX2 register.
+inline constexpr UST bitset_block_words = 4;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto bitset_any(const U64* words, UST num_words) noexcept -> bool
+{
+    // four blocks are combined, so that only a single branch is needed per 1024 bits
+    constexpr UST block_words = 4 * bitset_block_words;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const UST num_block_words = num_words - num_words % block_words;
+
+    UST offset = 0;
+    for (; offset < num_block_words; offset += block_words)
+        if (! bitset_none_in_block<block_words>(words + offset))
+            return true;
+
+    U64 remaining = 0;
+    for (; offset < num_words; ++offset)
+        remaining |= words[offset];
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return remaining != 0;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto bitset_count(const U64* words, UST num_words) noexcept -> UST
+{
+    // `count_set_bits` compiles to `popcnt` and the loop is vectorized with `vpopcntq` if AVX-512 VPOPCNTDQ is
+    // available. Independent accumulators hide the latency of the scalar instruction. A vectorized count with `vpshufb`
+    // lookups was slower than both variants.
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const UST num_block_words = num_words - num_words % bitset_block_words;
+
+    std::array<UST, bitset_block_words> counts = {};
+
+    UST offset = 0;
+    for (; offset < num_block_words; offset += bitset_block_words)
+        for (UST i = 0; i < bitset_block_words; ++i)
+            counts[i] += count_set_bits(words[offset + i]);
+
+    UST count = counts[0] + counts[1] + counts[2] + counts[3];
+    for (; offset < num_words; ++offset)
+        count += count_set_bits(words[offset]);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return count;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto bitset_find_next_set(const U64* words, UST num_words, UST index, UST size) noexcept -> UST
+{
+    if (index >= size)
+        return size;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    UST word_index = index / 64;
+    U64 word       = words[word_index] & (~U64(0) << (index % 64));
+
+    while (word == 0)
+    {
+        if (++word_index == num_words)
+            return size;
+        word = words[word_index];
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return word_index * 64 + count_trailing_zeros(word);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Func>
+inline void bitset_for_each_set_bit(const U64* words, UST num_words, T_Func&& func)
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto process_word = [words, &func](UST word_index)
+    {
+        U64 word = words[word_index];
+        while (word != 0)
+        {
+            func(word_index * 64 + count_trailing_zeros(word));
+            word &= word - 1; // clears the lowest set bit
+        }
+    };
+
+    const UST num_block_words = num_words - num_words % bitset_block_words;
+
+    UST offset = 0;
+    for (; offset < num_block_words; offset += bitset_block_words)
+    {
+        if (bitset_none_in_block<bitset_block_words>(words + offset))
+            continue;
+
+        for (UST i = 0; i < bitset_block_words; ++i)
+            process_word(offset + i);
+    }
+
+    for (; offset < num_words; ++offset)
+        process_word(offset);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_words>
+[[nodiscard]] inline auto bitset_none_in_block(const U64* words) noexcept -> bool
+{
+    static_assert(t_num_words % bitset_block_words == 0, "Invalid number of words.");
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#ifdef __AVX2__
+    auto reg = x86::mm_loadu<__m256i>(words);
+    for (UST i = bitset_block_words; i < t_num_words; i += bitset_block_words)
+        reg = x86::mm_or(reg, x86::mm_loadu<__m256i>(words + i));
+    return _mm256_testz_si256(reg, reg) != 0; // NOLINT(portability-simd-intrinsics)
+#else
+    U64 combined = 0;
+    for (UST i = 0; i < t_num_words; ++i)
+        combined |= words[i];
+    return combined == 0;
+#endif
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_Operation>
+inline void bitset_transform(U64* lhs, const U64* rhs, UST num_words, T_Operation operation) noexcept
+{
+    UST offset = 0;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#ifdef __AVX2__
+    const UST num_block_words = num_words - num_words % bitset_block_words;
+
+    for (; offset < num_block_words; offset += bitset_block_words)
+    {
+        const auto lhs_reg = x86::mm_loadu<__m256i>(lhs + offset);
+        const auto rhs_reg = x86::mm_loadu<__m256i>(rhs + offset);
+
+        if constexpr (std::is_same_v<T_Operation, std::bit_and<>>)
+            x86::mm_storeu(lhs + offset, x86::mm_and(lhs_reg, rhs_reg));
+        else if constexpr (std::is_same_v<T_Operation, std::bit_or<>>)
+            x86::mm_storeu(lhs + offset, x86::mm_or(lhs_reg, rhs_reg));
+        else
+        {
+            static_assert(std::is_same_v<T_Operation, std::bit_xor<>>, "Unsupported operation.");
+            x86::mm_storeu(lhs + offset, x86::mm_xor(lhs_reg, rhs_reg));
+        }
+    }
+#endif
+
+    for (; offset < num_words; ++offset)
+        lhs[offset] = operation(lhs[offset], rhs[offset]);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+} // namespace internal
+//! \endcond
+} // namespace mjolnir
@@ -23,6 +23,14 @@ namespace mjolnir
 template <typename T_Type>
 inline constexpr T_Type default_tolerance_abs = static_cast<T_Type>(1E-6);
 
+//! @brief
+//! The default relative tolerance
+//!
+//! @tparam T_Type
+//! Tolerance type
+template <typename T_Type>
+inline constexpr T_Type default_tolerance_rel = static_cast<T_Type>(1E-6);
+
 //! @brief
 //! Return ´true´ if the difference between `lhs` and `rhs` is inside an absolute tolerance and `false` otherwise.
 //!
@@ -47,6 +55,28 @@ requires Number<T_Type>
 is_close_abs(T_Type lhs, T_Type rhs, T_Type tolerance = default_tolerance_abs<T_Type>) noexcept -> bool;
 
 
+//! @brief
+//! Return ´true´ if the difference between `lhs` and `rhs` is inside a tolerance relative to the larger magnitude of
+//! both values and `false` otherwise.
+//!
+//! @tparam T_Type
+//! Type of the function parameters
+//!
+//! @param [in] lhs
+//! Left-hand side value
+//! @param [in] rhs
+//! Right-hand side value
+//! @param [in] tolerance
+//! The relative tolerance of the comparison
+//!
+//! @return
+//! ´true´ if `|lhs - rhs| <= tolerance * max(|lhs|, |rhs|)` and `false` otherwise.
+template <typename T_Type>
+requires Number<T_Type>
+[[nodiscard]] inline auto
+is_close_rel(T_Type lhs, T_Type rhs, T_Type tolerance = default_tolerance_rel<T_Type>) noexcept -> bool;
+
+
 //! @}
 } // namespace mjolnir
 
@@ -54,6 +84,7 @@ is_close_abs(T_Type lhs, T_Type rhs, T_Type tolerance = default_tolerance_abs<T_
 // ====================================================================================================================
 
 
+#include <algorithm>
 #include <cmath>
 
 namespace mjolnir
@@ -69,4 +100,15 @@ requires Number<T_Type>
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+template <typename T_Type>
+requires Number<T_Type>
+[[nodiscard]] inline auto is_close_rel(T_Type lhs, T_Type rhs, T_Type tolerance) noexcept -> bool
+{
+    return std::abs(lhs - rhs) <= tolerance * std::max(std::abs(lhs), std::abs(rhs));
+}
+
+
 } // namespace mjolnir
@@ -0,0 +1,269 @@
+//! @file
+//! utility/morton_code.h
+//!
+//! @brief
+//! Contains functions to convert between 2d and 3d integer coordinates and Morton codes (Z-order curve indices).
+//!
+//! @note
+//! sources:
+//! - https://www.forceflow.be/2013/10/07/morton-encodingdecoding-through-bit-interleaving-implementations/
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+
+#include <array>
+
+
+namespace mjolnir
+{
+//! \addtogroup core_utility
+//! @{
+
+
+//! @brief
+//! Number of bits per coordinate that are stored in a 3d Morton code
+inline constexpr UST morton_3d_coordinate_bits = 21;
+
+
+//! @brief
+//! Decode a 2d Morton code.
+//!
+//! @details
+//! This is the inverse operation of `morton_encode_2d`. See its documentation for the details of the implementation.
+//!
+//! @param[in] code:
+//! The Morton code
+//!
+//! @return
+//! Array with the x and y coordinate
+[[nodiscard]] constexpr auto morton_decode_2d(U64 code) noexcept -> std::array<U32, 2>;
+
+
+//! @brief
+//! Decode a 3d Morton code.
+//!
+//! @details
+//! This is the inverse operation of `morton_encode_3d`. See its documentation for the details of the implementation.
+//!
+//! @param[in] code:
+//! The Morton code
+//!
+//! @return
+//! Array with the x, y and z coordinate
+[[nodiscard]] constexpr auto morton_decode_3d(U64 code) noexcept -> std::array<U32, 3>;
+
+
+//! @brief
+//! Interleave the bits of two coordinates to a 2d Morton code.
+//!
+//! @details
+//! The bits of `x` are stored in the even and the bits of `y` in the odd bits of the code. At runtime, the function
+//! uses `deposit_bits` if `is_bmi2_enabled` is `true`. Otherwise, and in constant expressions, the bits are spread
+//! with a fixed sequence of shifts and masks.
+//!
+//! @param[in] x:
+//! The x coordinate
+//!
+//! @param[in] y:
+//! The y coordinate
+//!
+//! @return
+//! Morton code
+[[nodiscard]] constexpr auto morton_encode_2d(U32 x, U32 y) noexcept -> U64;
+
+
+//! @brief
+//! Interleave the bits of three coordinates to a 3d Morton code.
+//!
+//! @details
+//! Only the lowest `morton_3d_coordinate_bits` bits of each coordinate are encoded. Bit `i` of `x`, `y` and `z` is
+//! stored in bit `3i`, `3i + 1` and `3i + 2` of the code. The implementation is selected like the one of
+//! `morton_encode_2d`.
+//!
+//! @param[in] x:
+//! The x coordinate
+//!
+//! @param[in] y:
+//! The y coordinate
+//!
+//! @param[in] z:
+//! The z coordinate
+//!
+//! @return
+//! Morton code
+[[nodiscard]] constexpr auto morton_encode_3d(U32 x, U32 y, U32 z) noexcept -> U64;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Mask of the bits of a 2d Morton code that store the x coordinate
+inline constexpr U64 morton_2d_mask = 0x5555555555555555;
+
+//! Mask of the bits of a 3d Morton code that store the x coordinate
+inline constexpr U64 morton_3d_mask = 0x1249249249249249;
+
+
+//! Return the even bits of `value` moved to the lowest 32 bits of the result.
+[[nodiscard]] constexpr auto morton_compact_bits_2d(U64 value) noexcept -> U32;
+
+//! Return every third bit of `value`, starting with the lowest, moved to the lowest 21 bits of the result.
+[[nodiscard]] constexpr auto morton_compact_bits_3d(U64 value) noexcept -> U32;
+
+//! Return the lowest 32 bits of `value` moved to the even bits of the result.
+[[nodiscard]] constexpr auto morton_spread_bits_2d(U32 value) noexcept -> U64;
+
+//! Return the lowest 21 bits of `value` moved to every third bit of the result, starting with the lowest.
+[[nodiscard]] constexpr auto morton_spread_bits_3d(U32 value) noexcept -> U64;
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/utility/bit_operations.h"
+
+#include <type_traits>
+
+
+namespace mjolnir
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_decode_2d(U64 code) noexcept -> std::array<U32, 2>
+{
+    using namespace internal;
+
+    if constexpr (is_bmi2_enabled)
+        if (! std::is_constant_evaluated())
+            return {{static_cast<U32>(extract_bits(code, morton_2d_mask)),
+                     static_cast<U32>(extract_bits(code, morton_2d_mask << 1U))}};
+
+    return {{morton_compact_bits_2d(code), morton_compact_bits_2d(code >> 1U)}};
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_decode_3d(U64 code) noexcept -> std::array<U32, 3>
+{
+    using namespace internal;
+
+    if constexpr (is_bmi2_enabled)
+        if (! std::is_constant_evaluated())
+            return {{static_cast<U32>(extract_bits(code, morton_3d_mask)),
+                     static_cast<U32>(extract_bits(code, morton_3d_mask << 1U)),
+                     static_cast<U32>(extract_bits(code, morton_3d_mask << 2U))}};
+
+    return {{morton_compact_bits_3d(code), morton_compact_bits_3d(code >> 1U), morton_compact_bits_3d(code >> 2U)}};
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_encode_2d(U32 x, U32 y) noexcept -> U64
+{
+    using namespace internal;
+
+    if constexpr (is_bmi2_enabled)
+        if (! std::is_constant_evaluated())
+            return deposit_bits(U64{x}, morton_2d_mask) | deposit_bits(U64{y}, morton_2d_mask << 1U);
+
+    return morton_spread_bits_2d(x) | (morton_spread_bits_2d(y) << 1U);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_encode_3d(U32 x, U32 y, U32 z) noexcept -> U64
+{
+    using namespace internal;
+
+    if constexpr (is_bmi2_enabled)
+        if (! std::is_constant_evaluated())
+            return deposit_bits(U64{x}, morton_3d_mask) | deposit_bits(U64{y}, morton_3d_mask << 1U)
+                   | deposit_bits(U64{z}, morton_3d_mask << 2U);
+
+    return morton_spread_bits_3d(x) | (morton_spread_bits_3d(y) << 1U) | (morton_spread_bits_3d(z) << 2U);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// NOLINTBEGIN(*-magic-numbers)
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_compact_bits_2d(U64 value) noexcept -> U32
+{
+    value &= morton_2d_mask;
+    value = (value | (value >> 1U)) & 0x3333333333333333;
+    value = (value | (value >> 2U)) & 0x0F0F0F0F0F0F0F0F;
+    value = (value | (value >> 4U)) & 0x00FF00FF00FF00FF;
+    value = (value | (value >> 8U)) & 0x0000FFFF0000FFFF;
+    value = (value | (value >> 16U)) & 0x00000000FFFFFFFF;
+    return static_cast<U32>(value);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_compact_bits_3d(U64 value) noexcept -> U32
+{
+    value &= morton_3d_mask;
+    value = (value | (value >> 2U)) & 0x10C30C30C30C30C3;
+    value = (value | (value >> 4U)) & 0x100F00F00F00F00F;
+    value = (value | (value >> 8U)) & 0x001F0000FF0000FF;
+    value = (value | (value >> 16U)) & 0x001F00000000FFFF;
+    value = (value | (value >> 32U)) & 0x00000000001FFFFF;
+    return static_cast<U32>(value);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_spread_bits_2d(U32 value) noexcept -> U64
+{
+    U64 result = value;
+    result     = (result | (result << 16U)) & 0x0000FFFF0000FFFF;
+    result     = (result | (result << 8U)) & 0x00FF00FF00FF00FF;
+    result     = (result | (result << 4U)) & 0x0F0F0F0F0F0F0F0F;
+    result     = (result | (result << 2U)) & 0x3333333333333333;
+    result     = (result | (result << 1U)) & morton_2d_mask;
+    return result;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] constexpr auto morton_spread_bits_3d(U32 value) noexcept -> U64
+{
+    U64 result = value & 0x1FFFFFU;
+    result     = (result | (result << 32U)) & 0x001F00000000FFFF;
+    result     = (result | (result << 16U)) & 0x001F0000FF0000FF;
+    result     = (result | (result << 8U)) & 0x100F00F00F00F00F;
+    result     = (result | (result << 4U)) & 0x10C30C30C30C30C3;
+    result     = (result | (result << 2U)) & morton_3d_mask;
+    return result;
+}
+
+// NOLINTEND(*-magic-numbers)
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir
@@ -0,0 +1,522 @@
+//! @file
+//! array_reduction.h
+//!
+//! @brief
+//! Contains functions that reduce arrays of arbitrary size using vector registers.
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+#include <array>
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Selects how the values of an array summation are accumulated.
+enum class SummationMode : UST
+{
+    STANDARD    = 0, //!< Plain additions, which accumulate one rounding error per addition
+    COMPENSATED = 1  //!< Error-free transformations (TwoSum/TwoProduct) that accumulate the rounding errors separately
+};
+
+
+//! @brief
+//! Calculate the dot product of two arrays.
+//!
+//! @details
+//! The array is processed with `t_num_accumulators` independent registers to hide the latency of the additions. The
+//! elements before the first aligned address of `lhs` and the remaining elements after the last full register are
+//! processed with partial loads. `rhs` doesn't need to be aligned.
+//!
+//! With `SummationMode::COMPENSATED`, the products and sums are computed with error-free transformations and the
+//! accumulated rounding errors are added to the result at the end. The result is as accurate as if it was computed
+//! with twice the working precision and then rounded.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computation
+//! @tparam t_mode:
+//! The summation mode
+//! @tparam t_num_accumulators:
+//! Number of independent accumulation registers
+//!
+//! @param[in] lhs:
+//! Pointer to the first array
+//! @param[in] rhs:
+//! Pointer to the second array
+//! @param[in] size:
+//! Number of array elements
+//!
+//! @return
+//! Dot product of both arrays
+template <FloatVectorRegister T_RegisterType,
+          SummationMode       t_mode             = SummationMode::STANDARD,
+          UST                 t_num_accumulators = 4>
+[[nodiscard]] inline auto array_dot_product(const ElementType<T_RegisterType>* lhs,
+                                            const ElementType<T_RegisterType>* rhs,
+                                            UST                                size) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the maximum element of an array.
+//!
+//! @details
+//! The array is processed with `t_num_accumulators` independent registers. Since the maximum is idempotent, the
+//! unaligned first and the last elements are processed with overlapping unaligned loads.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computation
+//! @tparam t_num_accumulators:
+//! Number of independent accumulation registers
+//!
+//! @param[in] data:
+//! Pointer to the array
+//! @param[in] size:
+//! Number of array elements. Must be larger than 0.
+//!
+//! @return
+//! Maximum element of the array
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators = 4>
+[[nodiscard]] inline auto array_max(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the minimum element of an array.
+//!
+//! @details
+//! See `array_max`.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computation
+//! @tparam t_num_accumulators:
+//! Number of independent accumulation registers
+//!
+//! @param[in] data:
+//! Pointer to the array
+//! @param[in] size:
+//! Number of array elements. Must be larger than 0.
+//!
+//! @return
+//! Minimum element of the array
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators = 4>
+[[nodiscard]] inline auto array_min(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Calculate the sum of all elements of an array.
+//!
+//! @details
+//! See `array_dot_product` for details on the processing of the array and the summation modes.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computation
+//! @tparam t_mode:
+//! The summation mode
+//! @tparam t_num_accumulators:
+//! Number of independent accumulation registers
+//!
+//! @param[in] data:
+//! Pointer to the array
+//! @param[in] size:
+//! Number of array elements
+//!
+//! @return
+//! Sum of all array elements
+template <FloatVectorRegister T_RegisterType,
+          SummationMode       t_mode             = SummationMode::STANDARD,
+          UST                 t_num_accumulators = 4>
+[[nodiscard]] inline auto array_sum(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Calculate the sum of the squares of all elements of an array.
+//!
+//! @details
+//! See `array_dot_product` for details on the processing of the array and the summation modes.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computation
+//! @tparam t_mode:
+//! The summation mode
+//! @tparam t_num_accumulators:
+//! Number of independent accumulation registers
+//!
+//! @param[in] data:
+//! Pointer to the array
+//! @param[in] size:
+//! Number of array elements
+//!
+//! @return
+//! Sum of the squares of all array elements
+template <FloatVectorRegister T_RegisterType,
+          SummationMode       t_mode             = SummationMode::STANDARD,
+          UST                 t_num_accumulators = 4>
+[[nodiscard]] inline auto array_sum_of_squares(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+// ---internal declarations -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Shared implementation of `array_max` and `array_min`.
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators, typename T_ReduceFunc>
+[[nodiscard]] inline auto
+array_extremum(const ElementType<T_RegisterType>* data, UST size, T_ReduceFunc reduce_func) noexcept -> T_RegisterType;
+
+
+//! Add `value` to `sum`. In compensated mode, the rounding error of the addition is added to `error`.
+template <SummationMode t_mode, FloatVectorRegister T_RegisterType>
+inline void accumulate_sum(T_RegisterType& sum, T_RegisterType& error, T_RegisterType value) noexcept;
+
+
+//! Add the element-wise product of `lhs` and `rhs` to `sum`. In compensated mode, the rounding errors of the
+//! multiplication and the addition are added to `error`.
+template <SummationMode t_mode, FloatVectorRegister T_RegisterType>
+inline void
+accumulate_product(T_RegisterType& sum, T_RegisterType& error, T_RegisterType lhs, T_RegisterType rhs) noexcept;
+
+
+//! Combine the accumulation registers of a summation and return the sum of all of their elements.
+template <SummationMode t_mode, FloatVectorRegister T_RegisterType, UST t_num_accumulators>
+[[nodiscard]] inline auto combine_sums(std::array<T_RegisterType, t_num_accumulators>& sums,
+                                       std::array<T_RegisterType, t_num_accumulators>& errors) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+//! Call `register_func(accumulator_index, offset)` for all full registers of the array that start at an aligned
+//! address. The calls are unrolled for `t_num_accumulators` consecutive registers. The unaligned elements at the start
+//! and the remaining elements at the end are passed to `partial_func(offset, num_values)`.
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators, typename T_RegisterFunc, typename T_PartialFunc>
+inline void for_each_register(const ElementType<T_RegisterType>* data,
+                              UST                                size,
+                              T_RegisterFunc                     register_func,
+                              T_PartialFunc                      partial_func) noexcept;
+
+
+//! Return the number of elements from `data` to the next address that is aligned for `T_RegisterType`.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto num_elements_to_alignment(const ElementType<T_RegisterType>* data) noexcept -> UST;
+
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/core/x86/element_reduction.h"
+#include "mjolnir/core/x86/element_summation.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, SummationMode t_mode, UST t_num_accumulators>
+[[nodiscard]] inline auto array_dot_product(const ElementType<T_RegisterType>* lhs,
+                                            const ElementType<T_RegisterType>* rhs,
+                                            UST                                size) noexcept
+        -> ElementType<T_RegisterType>
+{
+    std::array<T_RegisterType, t_num_accumulators> sums   = {};
+    std::array<T_RegisterType, t_num_accumulators> errors = {};
+    std::ranges::fill(sums, mm_setzero<T_RegisterType>());
+    std::ranges::fill(errors, mm_setzero<T_RegisterType>());
+
+    auto register_func = [&](UST idx, UST offset)
+    {
+        auto a = mm_load<T_RegisterType>(lhs + offset);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto b = mm_loadu<T_RegisterType>(rhs + offset); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        internal::accumulate_product<t_mode>(sums.at(idx), errors.at(idx), a, b);
+    };
+
+    auto partial_func = [&](UST offset, UST num_values)
+    {
+        auto a = mm_load_partial<T_RegisterType>(lhs + offset, num_values); // NOLINT - pointer arithmetic
+        auto b = mm_load_partial<T_RegisterType>(rhs + offset, num_values); // NOLINT - pointer arithmetic
+        internal::accumulate_product<t_mode>(sums.at(0), errors.at(0), a, b);
+    };
+
+    internal::for_each_register<T_RegisterType, t_num_accumulators>(lhs, size, register_func, partial_func);
+
+    return internal::combine_sums<t_mode>(sums, errors);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators>
+[[nodiscard]] inline auto array_max(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>
+{
+    auto reduce_func = [](T_RegisterType lhs, T_RegisterType rhs) { return mm_max(lhs, rhs); };
+    return element_max(internal::array_extremum<T_RegisterType, t_num_accumulators>(data, size, reduce_func));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators>
+[[nodiscard]] inline auto array_min(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>
+{
+    auto reduce_func = [](T_RegisterType lhs, T_RegisterType rhs) { return mm_min(lhs, rhs); };
+    return element_min(internal::array_extremum<T_RegisterType, t_num_accumulators>(data, size, reduce_func));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, SummationMode t_mode, UST t_num_accumulators>
+[[nodiscard]] inline auto array_sum(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>
+{
+    std::array<T_RegisterType, t_num_accumulators> sums   = {};
+    std::array<T_RegisterType, t_num_accumulators> errors = {};
+    std::ranges::fill(sums, mm_setzero<T_RegisterType>());
+    std::ranges::fill(errors, mm_setzero<T_RegisterType>());
+
+    auto register_func = [&](UST idx, UST offset)
+    {
+        auto value = mm_load<T_RegisterType>(data + offset); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        internal::accumulate_sum<t_mode>(sums.at(idx), errors.at(idx), value);
+    };
+
+    auto partial_func = [&](UST offset, UST num_values)
+    {
+        auto value = mm_load_partial<T_RegisterType>(data + offset, num_values); // NOLINT - pointer arithmetic
+        internal::accumulate_sum<t_mode>(sums.at(0), errors.at(0), value);
+    };
+
+    internal::for_each_register<T_RegisterType, t_num_accumulators>(data, size, register_func, partial_func);
+
+    return internal::combine_sums<t_mode>(sums, errors);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, SummationMode t_mode, UST t_num_accumulators>
+[[nodiscard]] inline auto array_sum_of_squares(const ElementType<T_RegisterType>* data, UST size) noexcept
+        -> ElementType<T_RegisterType>
+{
+    std::array<T_RegisterType, t_num_accumulators> sums   = {};
+    std::array<T_RegisterType, t_num_accumulators> errors = {};
+    std::ranges::fill(sums, mm_setzero<T_RegisterType>());
+    std::ranges::fill(errors, mm_setzero<T_RegisterType>());
+
+    auto register_func = [&](UST idx, UST offset)
+    {
+        auto value = mm_load<T_RegisterType>(data + offset); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        internal::accumulate_product<t_mode>(sums.at(idx), errors.at(idx), value, value);
+    };
+
+    auto partial_func = [&](UST offset, UST num_values)
+    {
+        auto value = mm_load_partial<T_RegisterType>(data + offset, num_values); // NOLINT - pointer arithmetic
+        internal::accumulate_product<t_mode>(sums.at(0), errors.at(0), value, value);
+    };
+
+    internal::for_each_register<T_RegisterType, t_num_accumulators>(data, size, register_func, partial_func);
+
+    return internal::combine_sums<t_mode>(sums, errors);
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators, typename T_ReduceFunc>
+[[nodiscard]] inline auto
+array_extremum(const ElementType<T_RegisterType>* data, UST size, T_ReduceFunc reduce_func) noexcept -> T_RegisterType
+{
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    assert(size > 0 && "The array must contain at least one element."); // NOLINT
+
+    // Arrays that are smaller than a register are padded with their first element
+    if (size < n_e)
+    {
+        auto result = mm_set1<T_RegisterType>(data[0]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (UST i = 1; i < size; ++i)
+            result = reduce_func(result, mm_set1<T_RegisterType>(data[i])); // NOLINT - pointer arithmetic
+        return result;
+    }
+
+    std::array<T_RegisterType, t_num_accumulators> results = {};
+    std::ranges::fill(results, mm_loadu<T_RegisterType>(data));
+
+    auto register_func = [&](UST idx, UST offset)
+    {
+        auto value      = mm_load<T_RegisterType>(data + offset); // NOLINT - pointer arithmetic
+        results.at(idx) = reduce_func(results.at(idx), value);
+    };
+
+    // Partial registers are replaced by overlapping full registers, which is valid since the reduction is idempotent
+    auto partial_func = [&](UST offset, [[maybe_unused]] UST num_values)
+    {
+        auto value    = mm_loadu<T_RegisterType>(data + std::min(offset, size - n_e)); // NOLINT - pointer arithmetic
+        results.at(0) = reduce_func(results.at(0), value);
+    };
+
+    for_each_register<T_RegisterType, t_num_accumulators>(data, size, register_func, partial_func);
+
+    for (UST i = 1; i < t_num_accumulators; ++i)
+        results.at(0) = reduce_func(results.at(0), results.at(i));
+
+    return results.at(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <SummationMode t_mode, FloatVectorRegister T_RegisterType>
+inline void accumulate_sum(T_RegisterType& sum, T_RegisterType& error, T_RegisterType value) noexcept
+{
+    if constexpr (t_mode == SummationMode::STANDARD)
+        sum = mm_add(sum, value);
+    else
+    {
+        // TwoSum (Knuth): `rounding_error` is the exact difference between `new_sum` and the true sum
+        T_RegisterType new_sum        = mm_add(sum, value);
+        T_RegisterType value_part     = mm_sub(new_sum, sum);
+        T_RegisterType sum_error      = mm_sub(sum, mm_sub(new_sum, value_part));
+        T_RegisterType rounding_error = mm_add(sum_error, mm_sub(value, value_part));
+
+        error = mm_add(error, rounding_error);
+        sum   = new_sum;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <SummationMode t_mode, FloatVectorRegister T_RegisterType>
+inline void
+accumulate_product(T_RegisterType& sum, T_RegisterType& error, T_RegisterType lhs, T_RegisterType rhs) noexcept
+{
+    if constexpr (t_mode == SummationMode::STANDARD)
+        sum = mm_fmadd(lhs, rhs, sum);
+    else
+    {
+        // TwoProduct: the FMA calculates the exact rounding error of the multiplication
+        T_RegisterType product = mm_mul(lhs, rhs);
+        error                  = mm_add(error, mm_fmsub(lhs, rhs, product));
+        accumulate_sum<t_mode>(sum, error, product);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <SummationMode t_mode, FloatVectorRegister T_RegisterType, UST t_num_accumulators>
+[[nodiscard]] inline auto combine_sums(std::array<T_RegisterType, t_num_accumulators>& sums,
+                                       std::array<T_RegisterType, t_num_accumulators>& errors) noexcept
+        -> ElementType<T_RegisterType>
+{
+    using EType = ElementType<T_RegisterType>;
+
+    for (UST i = 1; i < t_num_accumulators; ++i)
+    {
+        accumulate_sum<t_mode>(sums.at(0), errors.at(0), sums.at(i));
+        errors.at(0) = mm_add(errors.at(0), errors.at(i));
+    }
+
+    if constexpr (t_mode == SummationMode::STANDARD)
+        return element_sum(sums.at(0));
+    else
+    {
+        // The horizontal summation is also compensated, since its rounding errors are of the same magnitude
+        alignas(alignment_bytes<T_RegisterType>) std::array<EType, num_elements<T_RegisterType>> sum_values   = {};
+        alignas(alignment_bytes<T_RegisterType>) std::array<EType, num_elements<T_RegisterType>> error_values = {};
+        mm_store(sum_values.data(), sums.at(0));
+        mm_store(error_values.data(), errors.at(0));
+
+        EType sum   = 0;
+        EType error = 0;
+        for (UST i = 0; i < sum_values.size(); ++i)
+        {
+            EType new_sum    = sum + sum_values.at(i);
+            EType value_part = new_sum - sum;
+            error += (sum - (new_sum - value_part)) + (sum_values.at(i) - value_part) + error_values.at(i);
+            sum = new_sum;
+        }
+        return sum + error;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_accumulators, typename T_RegisterFunc, typename T_PartialFunc>
+inline void for_each_register(const ElementType<T_RegisterType>* data,
+                              UST                                size,
+                              T_RegisterFunc                     register_func,
+                              T_PartialFunc                      partial_func) noexcept
+{
+    static_assert(t_num_accumulators > 0, "At least one accumulator is required.");
+
+    constexpr UST n_e        = num_elements<T_RegisterType>;
+    constexpr UST block_size = n_e * t_num_accumulators;
+
+    UST num_head = std::min(size, num_elements_to_alignment<T_RegisterType>(data));
+    if (num_head > 0)
+        partial_func(0, num_head);
+
+    UST offset = num_head;
+    for (; offset + block_size <= size; offset += block_size)
+        [&]<UST... t_idx>(std::index_sequence<t_idx...>)
+        {
+            (register_func(t_idx, offset + t_idx * n_e), ...);
+        }(std::make_index_sequence<t_num_accumulators>());
+
+    for (; offset + n_e <= size; offset += n_e)
+        register_func(0, offset);
+
+    if (offset < size)
+        partial_func(offset, size - offset);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto num_elements_to_alignment(const ElementType<T_RegisterType>* data) noexcept -> UST
+{
+    constexpr UST alignment = alignment_bytes<T_RegisterType>;
+
+    UST offset = misalignment<alignment>(data);
+    return ((alignment - offset) % alignment) / sizeof(ElementType<T_RegisterType>);
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
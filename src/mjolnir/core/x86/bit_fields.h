@@ -0,0 +1,521 @@
+//! @file
+//! bit_fields.h
+//!
+//! @brief
+//! Contains vectorized versions of the bit operations from `utility/bit_operations.h` that read and modify bit fields
+//! of all elements of integer registers and arrays.
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+#include <array>
+#include <concepts>
+#include <numeric>
+
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Pack the bit fields of multiple arrays into a single array.
+//!
+//! @details
+//! The N-th element of the packed array contains the lowest `t_num_bits[0]` bits of `fields[0][N]` in its lowest
+//! bits, followed by the lowest `t_num_bits[1]` bits of `fields[1][N]` and so on. Higher bits of the source values
+//! that don't fit into their field are discarded. All arrays are accessed with unaligned loads and stores. The
+//! remaining elements that don't fill a register are processed with scalar code.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computations
+//! @tparam T_ElementType:
+//! An unsigned integer type
+//! @tparam t_num_bits:
+//! The number of bits of each field. The sum must not exceed the number of bits of `T_ElementType`.
+//!
+//! @param[in] fields:
+//! Pointers to the arrays that contain the values of the individual fields
+//! @param[in] size:
+//! Number of array elements
+//! @param[out] packed:
+//! Pointer to the array that receives the packed values
+template <IntegerSSEAVXRegister T_RegisterType, std::unsigned_integral T_ElementType, UST... t_num_bits>
+inline void array_pack_bit_fields(const std::array<const T_ElementType*, sizeof...(t_num_bits)>& fields,
+                                  UST                                                            size,
+                                  T_ElementType*                                                 packed) noexcept;
+
+
+//! @brief
+//! Unpack the bit fields of an array into multiple arrays.
+//!
+//! @details
+//! This is the inverse operation of `array_pack_bit_fields`. The extracted fields are shifted to the lowest bits of
+//! the destination elements.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the computations
+//! @tparam T_ElementType:
+//! An unsigned integer type
+//! @tparam t_num_bits:
+//! The number of bits of each field. The sum must not exceed the number of bits of `T_ElementType`.
+//!
+//! @param[in] packed:
+//! Pointer to the array with the packed values
+//! @param[in] size:
+//! Number of array elements
+//! @param[out] fields:
+//! Pointers to the arrays that receive the values of the individual fields
+template <IntegerSSEAVXRegister T_RegisterType, std::unsigned_integral T_ElementType, UST... t_num_bits>
+inline void array_unpack_bit_fields(const T_ElementType*                                     packed,
+                                    UST                                                      size,
+                                    const std::array<T_ElementType*, sizeof...(t_num_bits)>& fields) noexcept;
+
+
+//! @brief
+//! Clear a bit pattern in all elements of an integer register.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_index:
+//! The index of the first bit that should be cleared
+//! @tparam t_num_bits:
+//! The number of bits that should be cleared
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! Source register
+//!
+//! @return
+//! Copy of `src` with cleared bits
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto clear_bits(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Extract a bit pattern from all elements of an integer register and shift it to the lowest bits.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_index:
+//! The index of the first bit of the bit pattern
+//! @tparam t_num_bits:
+//! The patterns number of bits
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! Source register
+//!
+//! @return
+//! Register containing the extracted bit patterns
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto get_bits(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Extract a bit pattern with an individual start index from each element of an integer register and shift it to the
+//! lowest bits.
+//!
+//! @details
+//! Only 32 and 64 bit elements are supported since variable shifts of smaller integers aren't available without
+//! AVX-512BW.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_num_bits:
+//! The patterns number of bits
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! Source register
+//! @param[in] indices:
+//! Register containing the index of the first bit of each elements bit pattern
+//!
+//! @return
+//! Register containing the extracted bit patterns
+template <IntegerRegisterElement T_ElementType, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto get_bits(T_RegisterType src, T_RegisterType indices) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Pack the bit fields of multiple registers into a single register.
+//!
+//! @details
+//! See `array_pack_bit_fields` for the layout of the packed elements.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_num_bits:
+//! The number of bits of each field. The sum must not exceed the number of bits of `T_ElementType`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] fields:
+//! Registers containing the values of the individual fields
+//!
+//! @return
+//! Register with the packed values
+template <IntegerRegisterElement T_ElementType, UST... t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto pack_bit_fields(const std::array<T_RegisterType, sizeof...(t_num_bits)>& fields) noexcept
+        -> T_RegisterType;
+
+
+//! @brief
+//! Set a bit pattern in all elements of an integer register to the lowest bits of the corresponding element of
+//! another register.
+//!
+//! @details
+//! In contrast to the scalar version, bits of `values` that don't fit into the bit pattern are discarded.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_index:
+//! The index of the first bit that should be modified
+//! @tparam t_num_bits:
+//! The number of bits that should be modified
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] dst:
+//! The register that should be modified
+//! @param[in] values:
+//! Register with the new values of the bit patterns
+//!
+//! @return
+//! Copy of `dst` with the modified bits
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto set_bits_with_int(T_RegisterType dst, T_RegisterType values) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Set a bit pattern with an individual start index in each element of an integer register to the lowest bits of the
+//! corresponding element of another register.
+//!
+//! @details
+//! Bits of `values` that don't fit into the bit pattern are discarded. Only 32 and 64 bit elements are supported
+//! since variable shifts of smaller integers aren't available without AVX-512BW.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_num_bits:
+//! The number of bits that should be modified
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] dst:
+//! The register that should be modified
+//! @param[in] indices:
+//! Register containing the index of the first modified bit of each element
+//! @param[in] values:
+//! Register with the new values of the bit patterns
+//!
+//! @return
+//! Copy of `dst` with the modified bits
+template <IntegerRegisterElement T_ElementType, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto
+set_bits_with_int(T_RegisterType dst, T_RegisterType indices, T_RegisterType values) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Unpack the bit fields of a register into multiple registers.
+//!
+//! @details
+//! This is the inverse operation of `pack_bit_fields`. The extracted fields are shifted to the lowest bits.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_num_bits:
+//! The number of bits of each field. The sum must not exceed the number of bits of `T_ElementType`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] packed:
+//! Register with the packed values
+//!
+//! @return
+//! Array of registers containing the values of the individual fields
+template <IntegerRegisterElement T_ElementType, UST... t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto unpack_bit_fields(T_RegisterType packed) noexcept
+        -> std::array<T_RegisterType, sizeof...(t_num_bits)>;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! The index of the first bit of the bit field `t_field` if fields with the given numbers of bits are packed
+//! consecutively, starting at the lowest bit.
+template <UST t_field, UST... t_num_bits>
+inline constexpr UST bit_field_index = []() -> UST
+{
+    constexpr std::array<UST, sizeof...(t_num_bits)> field_bits = {{t_num_bits...}};
+    return std::accumulate(field_bits.begin(), field_bits.begin() + t_field, UST(0));
+}();
+
+
+//! Return a register where the lowest `t_num_bits` bits of each element are set.
+template <IntegerRegisterElement T_ElementType, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto get_bit_mask() noexcept -> T_RegisterType;
+
+
+//! Discard all bits of each element of `src` except for the lowest `t_num_bits` ones and shift the remaining bits to
+//! the given index.
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto shift_to_bit_field(T_RegisterType src) noexcept -> T_RegisterType;
+
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/utility/bit_operations.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <type_traits>
+#include <utility>
+
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerSSEAVXRegister T_RegisterType, std::unsigned_integral T_ElementType, UST... t_num_bits>
+inline void array_pack_bit_fields(const std::array<const T_ElementType*, sizeof...(t_num_bits)>& fields,
+                                  UST                                                            size,
+                                  T_ElementType*                                                 packed) noexcept
+{
+    constexpr UST n_e = num_integer_elements<T_ElementType, T_RegisterType>;
+    // copying the pointers tells the compiler that the stores can't modify them
+    const auto field_ptr = fields;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    UST offset = 0;
+    for (; offset + n_e <= size; offset += n_e)
+    {
+        auto registers = [&field_ptr, offset]<UST... t_i>(std::index_sequence<t_i...>)
+        {
+            return std::array<T_RegisterType, sizeof...(t_num_bits)>{
+                    {mm_loadu<T_RegisterType>(std::get<t_i>(field_ptr) + offset)...}};
+        }(std::make_index_sequence<sizeof...(t_num_bits)>());
+
+        mm_storeu(packed + offset, pack_bit_fields<T_ElementType, t_num_bits...>(registers));
+    }
+
+    for (; offset < size; ++offset)
+    {
+        T_ElementType value = 0;
+        [&]<UST... t_i>(std::index_sequence<t_i...>)
+        {
+            ((value |= static_cast<T_ElementType>(
+                      (std::get<t_i>(field_ptr)[offset] & bit_construct_set_first_n_bits<T_ElementType, t_num_bits>())
+                      << internal::bit_field_index<t_i, t_num_bits...>)),
+             ...);
+        }(std::make_index_sequence<sizeof...(t_num_bits)>());
+        packed[offset] = value;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerSSEAVXRegister T_RegisterType, std::unsigned_integral T_ElementType, UST... t_num_bits>
+inline void array_unpack_bit_fields(const T_ElementType*                                     packed,
+                                    UST                                                      size,
+                                    const std::array<T_ElementType*, sizeof...(t_num_bits)>& fields) noexcept
+{
+    constexpr UST n_e = num_integer_elements<T_ElementType, T_RegisterType>;
+    // copying the pointers tells the compiler that the stores can't modify them
+    const auto field_ptr = fields;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    UST offset = 0;
+    for (; offset + n_e <= size; offset += n_e)
+    {
+        auto registers = unpack_bit_fields<T_ElementType, t_num_bits...>(mm_loadu<T_RegisterType>(packed + offset));
+
+        [&field_ptr, &registers, offset]<UST... t_i>(std::index_sequence<t_i...>)
+        {
+            (mm_storeu(std::get<t_i>(field_ptr) + offset, std::get<t_i>(registers)), ...);
+        }(std::make_index_sequence<sizeof...(t_num_bits)>());
+    }
+
+    for (; offset < size; ++offset)
+    {
+        [&]<UST... t_i>(std::index_sequence<t_i...>)
+        {
+            ((std::get<t_i>(field_ptr)[offset] =
+                      static_cast<T_ElementType>(packed[offset] >> internal::bit_field_index<t_i, t_num_bits...>)
+                      & bit_construct_set_first_n_bits<T_ElementType, t_num_bits>()),
+             ...);
+        }(std::make_index_sequence<sizeof...(t_num_bits)>());
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto clear_bits(T_RegisterType src) noexcept -> T_RegisterType
+{
+    static_assert(t_num_bits > 0, "Number of bits must be larger than 0.");
+    static_assert(t_index + t_num_bits <= num_bits<T_ElementType>, "Required bits exceed maximum number of bits.");
+
+    using UType = std::make_unsigned_t<T_ElementType>;
+
+    constexpr auto mask = static_cast<UType>(bit_construct_set_first_n_bits<UType, t_num_bits>() << t_index);
+    return mm_andnot(mm_set1<T_ElementType, T_RegisterType>(static_cast<T_ElementType>(mask)), src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto get_bits(T_RegisterType src) noexcept -> T_RegisterType
+{
+    static_assert(t_num_bits > 0, "Number of bits must be larger than 0.");
+    static_assert(t_index + t_num_bits <= num_bits<T_ElementType>, "Required bits exceed maximum number of bits.");
+
+    // the shift already clears the bits above the highest field
+    if constexpr (t_index + t_num_bits == num_bits<T_ElementType>)
+        return mm_srli<T_ElementType, t_index>(src);
+    else if constexpr (t_index == 0)
+        return mm_and(src, internal::get_bit_mask<T_ElementType, t_num_bits, T_RegisterType>());
+    else
+        return mm_and(mm_srli<T_ElementType, t_index>(src),
+                      internal::get_bit_mask<T_ElementType, t_num_bits, T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto get_bits(T_RegisterType src, T_RegisterType indices) noexcept -> T_RegisterType
+{
+    static_assert(t_num_bits > 0, "Number of bits must be larger than 0.");
+    static_assert(t_num_bits <= num_bits<T_ElementType>, "Required bits exceed maximum number of bits.");
+
+    return mm_and(mm_srlv<T_ElementType>(src, indices),
+                  internal::get_bit_mask<T_ElementType, t_num_bits, T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST... t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto pack_bit_fields(const std::array<T_RegisterType, sizeof...(t_num_bits)>& fields) noexcept
+        -> T_RegisterType
+{
+    static_assert(sizeof...(t_num_bits) > 0, "At least one bit field is required.");
+    static_assert((t_num_bits + ...) <= num_bits<T_ElementType>, "Bit fields exceed maximum number of bits.");
+
+    auto packed = mm_setzero<T_RegisterType>();
+    [&]<UST... t_i>(std::index_sequence<t_i...>)
+    {
+        ((packed = mm_or(packed,
+                         internal::shift_to_bit_field<T_ElementType,
+                                                      internal::bit_field_index<t_i, t_num_bits...>,
+                                                      t_num_bits>(std::get<t_i>(fields)))),
+         ...);
+    }(std::make_index_sequence<sizeof...(t_num_bits)>());
+
+    return packed;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto set_bits_with_int(T_RegisterType dst, T_RegisterType values) noexcept -> T_RegisterType
+{
+    static_assert(t_num_bits > 0, "Number of bits must be larger than 0.");
+    static_assert(t_index + t_num_bits <= num_bits<T_ElementType>, "Required bits exceed maximum number of bits.");
+
+    return mm_or(clear_bits<T_ElementType, t_index, t_num_bits>(dst),
+                 internal::shift_to_bit_field<T_ElementType, t_index, t_num_bits>(values));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto
+set_bits_with_int(T_RegisterType dst, T_RegisterType indices, T_RegisterType values) noexcept -> T_RegisterType
+{
+    static_assert(t_num_bits > 0, "Number of bits must be larger than 0.");
+    static_assert(t_num_bits <= num_bits<T_ElementType>, "Required bits exceed maximum number of bits.");
+
+    const auto mask = internal::get_bit_mask<T_ElementType, t_num_bits, T_RegisterType>();
+    const auto bits = mm_sllv<T_ElementType>(mm_and(values, mask), indices);
+    return mm_or(mm_andnot(mm_sllv<T_ElementType>(mask, indices), dst), bits);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST... t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto unpack_bit_fields(T_RegisterType packed) noexcept
+        -> std::array<T_RegisterType, sizeof...(t_num_bits)>
+{
+    static_assert(sizeof...(t_num_bits) > 0, "At least one bit field is required.");
+    static_assert((t_num_bits + ...) <= num_bits<T_ElementType>, "Bit fields exceed maximum number of bits.");
+
+    return [packed]<UST... t_i>(std::index_sequence<t_i...>) -> std::array<T_RegisterType, sizeof...(t_num_bits)>
+    {
+        return {{get_bits<T_ElementType, internal::bit_field_index<t_i, t_num_bits...>, t_num_bits>(packed)...}};
+    }(std::make_index_sequence<sizeof...(t_num_bits)>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto get_bit_mask() noexcept -> T_RegisterType
+{
+    using UType = std::make_unsigned_t<T_ElementType>;
+
+    constexpr UType mask = bit_construct_set_first_n_bits<UType, t_num_bits>();
+    return mm_set1<T_ElementType, T_RegisterType>(static_cast<T_ElementType>(mask));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_index, UST t_num_bits, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto shift_to_bit_field(T_RegisterType src) noexcept -> T_RegisterType
+{
+    // the shift already discards the bits that exceed the highest field
+    if constexpr (t_index + t_num_bits == num_bits<T_ElementType>)
+        return mm_slli<T_ElementType, t_index>(src);
+    else
+        return mm_slli<T_ElementType, t_index>(
+                mm_and(src, get_bit_mask<T_ElementType, t_num_bits, T_RegisterType>()));
+}
+
+
+} // namespace internal
+//! \endcond
+} // namespace mjolnir::x86
@@ -0,0 +1,157 @@
+//! @file
+//! broadcast_load.h
+//!
+//! @brief
+//! Contains functions that load values from memory and broadcast them to all elements or lanes of vector registers.
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+#include <array>
+
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Load a single value from memory and broadcast it to all elements of a register.
+//!
+//! @details
+//! The load and the broadcast are performed by a single instruction (`vbroadcastss`, `vbroadcastsd` or `movddup`),
+//! which executes on the load ports and doesn't need a shuffle port. Loading the value into a register and
+//! broadcasting it afterwards requires an additional shuffle.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] ptr:
+//! Pointer to the value. No alignment is required.
+//!
+//! @return
+//! Register with all elements set to the loaded value
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_load(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Load `t_num_registers` consecutive values from memory and broadcast each of them into its own register.
+//!
+//! @details
+//! The N-th returned register contains the value `ptr[N]` in all elements. This is the typical access pattern of the
+//! inner loop of matrix products, where each scalar of one matrix is multiplied with a whole register of the other
+//! matrix.
+//!
+//! @tparam t_num_registers:
+//! The number of values that should be loaded
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] ptr:
+//! Pointer to the first value. No alignment is required.
+//!
+//! @return
+//! Array of registers with the broadcasted values
+template <UST t_num_registers, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_load_consecutive(const ElementType<T_RegisterType>* ptr) noexcept
+        -> std::array<T_RegisterType, t_num_registers>;
+
+
+//! @brief
+//! Load the number of values that fit into a single lane from memory and broadcast them to all lanes of a register.
+//!
+//! @details
+//! For AVX and AVX-512 registers, a single `vbroadcastf128` or `vbroadcastf32x4` is used. For SSE registers, this
+//! function is an unaligned load.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] ptr:
+//! Pointer to the first value. No alignment is required.
+//!
+//! @return
+//! Register with identical lanes
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_lane_load(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType;
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <utility>
+
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_load(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_broadcast_ss(ptr);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_loaddup_pd(ptr);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_broadcast_ss(ptr);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_broadcast_sd(ptr);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_broadcastss_ps(internal::mm512_full_mask<__m512>, _mm_load_ss(ptr));
+    else
+        return _mm512_maskz_broadcastsd_pd(internal::mm512_full_mask<__m512d>, _mm_load_sd(ptr));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_registers, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_load_consecutive(const ElementType<T_RegisterType>* ptr) noexcept
+        -> std::array<T_RegisterType, t_num_registers>
+{
+    return [ptr]<UST... t_i>(std::index_sequence<t_i...>) -> std::array<T_RegisterType, t_num_registers>
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return {{broadcast_load<T_RegisterType>(ptr + t_i)...}};
+    }(std::make_index_sequence<t_num_registers>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_lane_load(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType
+{
+    if constexpr (FloatSSERegister<T_RegisterType>)
+        return mm_loadu<T_RegisterType>(ptr);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_broadcast_ps(reinterpret_cast<const __m128*>(ptr)); // NOLINT(*-reinterpret-cast)
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_broadcast_pd(reinterpret_cast<const __m128d*>(ptr)); // NOLINT(*-reinterpret-cast)
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_broadcast_f32x4(internal::mm512_full_mask<__m512>, _mm_loadu_ps(ptr));
+    else
+    {
+        // vbroadcastf64x2 requires AVX-512DQ, but the bit pattern of two doubles can be broadcasted as four floats
+        const __m128 lane = _mm_castpd_ps(_mm_loadu_pd(ptr));
+        return _mm512_castps_pd(_mm512_maskz_broadcast_f32x4(internal::mm512_full_mask<__m512>, lane));
+    }
+}
+
+
+} // namespace mjolnir::x86
@@ -0,0 +1,180 @@
+//! @file
+//! compaction.h
+//!
+//! @brief
+//! Contains functions that left-pack the selected elements of a vector register (stream compaction).
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+#include <array>
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Return a register that contains the elements of `src` that are selected by `mask` in consecutive order, starting
+//! with the first element.
+//!
+//! @details
+//! Bit `i` of `mask` selects element `i` of `src`. Suitable masks are returned by the `compare_mask_*` functions of
+//! `comparison.h`. SSE and AVX registers use a permutation with indices from a lookup table. AVX-512 registers use the
+//! native compress instructions.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//! @param[in] mask:
+//! Bitmask that selects the elements of `src`
+//!
+//! @return
+//! Register with the selected elements in its lower part. The values of the remaining elements are unspecified.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compress(T_RegisterType src, U32 mask) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Store the elements of `src` that are selected by `mask` consecutively to the memory location `ptr` and return the
+//! number of stored elements.
+//!
+//! @details
+//! See `compress`. Only the selected elements are written, so `ptr` only needs to provide space for them. It doesn't
+//! need to be aligned.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in, out] ptr:
+//! Pointer to the memory location
+//! @param[in] src:
+//! The source register
+//! @param[in] mask:
+//! Bitmask that selects the elements of `src`
+//!
+//! @return
+//! Number of stored elements
+template <FloatVectorRegister T_RegisterType>
+inline auto compress_store(ElementType<T_RegisterType>* ptr, T_RegisterType src, U32 mask) noexcept -> UST;
+
+
+// ---internal declarations -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Create a lookup table for the compression of SSE and AVX registers. Entry `m` contains the 32 bit element indices of
+//! a permutation that moves the elements selected by `m` to the front. One byte is used per index, starting with the
+//! lowest byte. Double-precision elements are treated as two consecutive 32 bit elements.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] consteval auto create_compress_lut() noexcept -> std::array<U64, (1U << num_elements<T_RegisterType>)>;
+
+
+//! Lookup table for the compression of registers of type `T_RegisterType`.
+template <FloatVectorRegister T_RegisterType>
+inline constexpr auto compress_lut = create_compress_lut<T_RegisterType>();
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <bit>
+#include <cassert>
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compress(T_RegisterType src, U32 mask) noexcept -> T_RegisterType
+{
+    assert(mask < (U32{1} << num_elements<T_RegisterType>) && "Mask selects non-existing elements."); // NOLINT
+
+    if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_compress_ps(static_cast<__mmask16>(mask), src);
+    else if constexpr (is_m512d<T_RegisterType>)
+        return _mm512_maskz_compress_pd(static_cast<__mmask8>(mask), src);
+    else
+    {
+        const U64 indices = internal::compress_lut<T_RegisterType>[mask]; // NOLINT(*-constant-array-index)
+
+        if constexpr (is_sse_register<T_RegisterType>)
+        {
+            const __m128i idx = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(static_cast<I32>(indices)));
+            return mm_cast_if<T_RegisterType>(
+                    _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(mm_cast_fi(src)), idx)));
+        }
+        else
+        {
+            const __m256i idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<I64>(indices)));
+            return mm_cast_if<T_RegisterType>(
+                    _mm256_castps_si256(_mm256_permutevar8x32_ps(_mm256_castsi256_ps(mm_cast_fi(src)), idx)));
+        }
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+inline auto compress_store(ElementType<T_RegisterType>* ptr, T_RegisterType src, U32 mask) noexcept -> UST
+{
+    auto num_selected = static_cast<UST>(std::popcount(mask));
+
+    if constexpr (is_m512<T_RegisterType>)
+        _mm512_mask_compressstoreu_ps(ptr, static_cast<__mmask16>(mask), src);
+    else if constexpr (is_m512d<T_RegisterType>)
+        _mm512_mask_compressstoreu_pd(ptr, static_cast<__mmask8>(mask), src);
+    else
+        mm_store_partial(ptr, compress(src, mask), num_selected);
+
+    return num_selected;
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] consteval auto create_compress_lut() noexcept -> std::array<U64, (1U << num_elements<T_RegisterType>)>
+{
+    constexpr UST n_e              = num_elements<T_RegisterType>;
+    constexpr UST num_sub_elements = sizeof(ElementType<T_RegisterType>) / sizeof(F32);
+
+    std::array<U64, (1U << n_e)> lut = {};
+    for (UST mask = 0; mask < lut.size(); ++mask)
+    {
+        U64 entry    = 0;
+        UST position = 0;
+        for (UST i = 0; i < n_e; ++i)
+            if ((mask >> i) & 1U)
+                for (UST j = 0; j < num_sub_elements; ++j)
+                    entry |= static_cast<U64>(i * num_sub_elements + j) << (8 * position++);
+        lut.at(mask) = entry;
+    }
+    return lut;
+}
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
@@ -263,6 +263,117 @@ template <UST                                            t_idx_first,
 compare_in_sequence_true(T_RegisterType lhs, T_RegisterType rhs, T_CompFunc comp_func) noexcept -> bool;
 
 
+//! @brief
+//! Return a bitmask where bit `i` is set if element `i` of `lhs` is equal to element `i` of `rhs`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Bitmask with one bit per register element
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_equal(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32;
+
+
+//! @brief
+//! Return a bitmask where bit `i` is set if element `i` of `lhs` is greater than element `i` of `rhs`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Bitmask with one bit per register element
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_greater(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32;
+
+
+//! @brief
+//! Return a bitmask where bit `i` is set if element `i` of `lhs` is greater than or equal to element `i` of `rhs`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Bitmask with one bit per register element
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_greater_equal(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32;
+
+
+//! @brief
+//! Return a bitmask where bit `i` is set if element `i` of `lhs` is less than element `i` of `rhs`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Bitmask with one bit per register element
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_less(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32;
+
+
+//! @brief
+//! Return a bitmask where bit `i` is set if element `i` of `lhs` is less than or equal to element `i` of `rhs`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Bitmask with one bit per register element
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_less_equal(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32;
+
+
+//! @brief
+//! Return a bitmask where bit `i` is set if the comparison of element `i` of `lhs` and `rhs` is `true`.
+//!
+//! @details
+//! The bitmask can be used to process the selected elements without branches, for example with `compress_store`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//! @tparam T_CompFunc:
+//! The Type of a callable object that performs the register element comparison.
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//! @param[in] comp_func:
+//! A comparison function or functor that provides the comparison of the register elements. Functors should be preferred
+//! to assure inlining. See  https://stackoverflow.com/a/12718449/6700329
+//!
+//! @return
+//! Bitmask with one bit per register element
+template <FloatVectorRegister T_RegisterType, std::invocable<T_RegisterType, T_RegisterType> T_CompFunc>
+[[nodiscard]] inline auto compare_mask_true(T_RegisterType lhs, T_RegisterType rhs, T_CompFunc comp_func) noexcept
+        -> U32;
+
+
 //! @brief
 //! Return `true` only if all selected register elements are equal.
 //!
@@ -619,13 +730,72 @@ compare_in_sequence_true(T_RegisterType lhs, T_RegisterType rhs, T_CompFunc comp
     constexpr auto b = get_boolean_array();
 
 
-    if constexpr (is_m128d<T_RegisterType>)
+    if constexpr (n_e == 2)
         return compare_selected_true<b[0], b[1]>(lhs, rhs, comp_func);
-    else if constexpr (is_m128<T_RegisterType> || is_m256d<T_RegisterType>)
+    else if constexpr (n_e == 4)
         return compare_selected_true<b[0], b[1], b[2], b[3]>(lhs, rhs, comp_func);
-    else
+    else if constexpr (n_e == 8) // NOLINT(readability-magic-numbers)
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
         return compare_selected_true<b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]>(lhs, rhs, comp_func);
+    else
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        return compare_selected_true<b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7], b[8], b[9], b[10], b[11], b[12],
+                                     b[13], b[14], b[15]>(lhs, rhs, comp_func);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_equal(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32
+{
+    return compare_mask_true(lhs, rhs, internal::CompareEqual<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_greater(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32
+{
+    return compare_mask_true(lhs, rhs, internal::CompareGreater<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_greater_equal(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32
+{
+    return compare_mask_true(lhs, rhs, internal::CompareGreaterEqual<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_less(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32
+{
+    return compare_mask_true(lhs, rhs, internal::CompareLess<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_mask_less_equal(T_RegisterType lhs, T_RegisterType rhs) noexcept -> U32
+{
+    return compare_mask_true(lhs, rhs, internal::CompareLessEqual<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, std::invocable<T_RegisterType, T_RegisterType> T_CompFunc>
+[[nodiscard]] inline auto compare_mask_true(T_RegisterType lhs, T_RegisterType rhs, T_CompFunc comp_func) noexcept
+        -> U32
+{
+    return mm_movemask(comp_func(lhs, rhs));
 }
 
 
@@ -688,13 +858,31 @@ template <bool... t_cmp, FloatVectorRegister T_RegisterType, std::invocable<T_Re
     static_assert(! pack_all_false<t_cmp...>(), "At least one template parameter must be `true`.");
 
 
-    auto           result = mm_movemask_epi8(mm_cast_fi(comp_func(lhs, rhs)));
-    constexpr auto ref    = bit_construct_from_ints<n_bits, decltype(result), (static_cast<UST>(t_cmp) * val)...>(true);
+    if constexpr (is_avx512_register<T_RegisterType>)
+    {
+        // Get a mask register with one bit per element instead of processing each byte of the comparison result
+        const __m512i cmp    = mm_cast_fi(comp_func(lhs, rhs));
+        constexpr U32 ref    = bit_construct<U32, t_cmp...>(true);
+        U32           result = 0;
+
+        if constexpr (is_m512<T_RegisterType>)
+            result = _mm512_test_epi32_mask(cmp, cmp);
+        else
+            result = _mm512_test_epi64_mask(cmp, cmp);
+
+        return (result & ref) == ref;
+    }
+    else
+    {
+        auto           result = mm_movemask_epi8(mm_cast_fi(comp_func(lhs, rhs)));
+        constexpr auto ref =
+                bit_construct_from_ints<n_bits, decltype(result), (static_cast<UST>(t_cmp) * val)...>(true);
 
-    if constexpr (! pack_all_true<t_cmp...>())
-        result &= ref; // Set bits of elements that shouldn't be compared to zero
+        if constexpr (! pack_all_true<t_cmp...>())
+            result &= ref; // Set bits of elements that shouldn't be compared to zero
 
-    return result == ref;
+        return result == ref;
+    }
 }
 
 
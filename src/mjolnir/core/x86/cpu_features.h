@@ -0,0 +1,174 @@
+//! @file
+//! x86/cpu_features.h
+//!
+//! @brief
+//! Contains functions to detect the instruction set extensions that are supported by the executing CPU
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/bit_operations.h"
+#include "mjolnir/core/x86/x86.h"
+
+#if ! defined(_MSC_VER)
+#    include <cpuid.h>
+#endif
+
+#include <array>
+
+
+// === DECLARATIONS ===================================================================================================
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Stores which of the instruction set extensions that are relevant for the library are supported by the CPU.
+//!
+//! @details
+//! An extension that uses extended register states (AVX, AVX-512) is only reported as supported if the operating
+//! system also saves and restores the corresponding registers.
+struct CPUFeatures
+{
+    bool sse4_2  = false; //!< SSE4.2 support
+    bool avx     = false; //!< AVX support
+    bool avx2    = false; //!< AVX2 support
+    bool fma     = false; //!< FMA3 support
+    bool avx512f = false; //!< AVX-512 foundation support
+};
+
+
+//! @brief
+//! Get the instruction set extensions supported by the executing CPU.
+//!
+//! @details
+//! The features are detected with the `cpuid` instruction during the first call. Subsequent calls return the cached
+//! result.
+//!
+//! @return
+//! Supported instruction set extensions
+[[nodiscard]] inline auto get_cpu_features() noexcept -> const CPUFeatures&;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Execute the `cpuid` instruction and return the values of the registers `eax`, `ebx`, `ecx` and `edx`.
+[[nodiscard]] inline auto cpuid(U32 leaf, U32 sub_leaf) noexcept -> std::array<U32, 4>;
+
+//! Detect the instruction set extensions supported by the executing CPU.
+[[nodiscard]] inline auto detect_cpu_features() noexcept -> CPUFeatures;
+
+//! Read the extended control register `XCR0`. Must only be called if the CPU supports `OSXSAVE`.
+[[nodiscard]] inline auto read_xcr0() noexcept -> U64;
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto get_cpu_features() noexcept -> const CPUFeatures&
+{
+    static const CPUFeatures features = internal::detect_cpu_features();
+    return features;
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto cpuid(U32 leaf, U32 sub_leaf) noexcept -> std::array<U32, 4>
+{
+    std::array<U32, 4> registers = {{0}};
+
+#ifdef _MSC_VER
+    std::array<int, 4> signed_registers = {{0}};
+    __cpuidex(signed_registers.data(), static_cast<int>(leaf), static_cast<int>(sub_leaf));
+    for (UST i = 0; i < registers.size(); ++i)
+        registers.at(i) = static_cast<U32>(signed_registers.at(i));
+#else
+    __cpuid_count(leaf, sub_leaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+
+    return registers;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto detect_cpu_features() noexcept -> CPUFeatures
+{
+    // Bit positions are taken from the Intel 64 and IA-32 Architectures Software Developer's Manual, Vol. 2A, CPUID
+    constexpr UST leaf_1_ecx_sse4_2  = 20;
+    constexpr UST leaf_1_ecx_fma     = 12;
+    constexpr UST leaf_1_ecx_osxsave = 27;
+    constexpr UST leaf_1_ecx_avx     = 28;
+    constexpr UST leaf_7_ebx_avx2    = 5;
+    constexpr UST leaf_7_ebx_avx512f = 16;
+
+    // XCR0 bits that indicate that the OS saves the SSE and AVX states (1, 2) and the AVX-512 states (5, 6, 7)
+    constexpr U64 xcr0_avx_states    = 0x6;
+    constexpr U64 xcr0_avx512_states = 0xE6;
+
+    CPUFeatures features = {};
+
+    U32 max_leaf = cpuid(0, 0)[0];
+    if (max_leaf < 1)
+        return features;
+
+    std::array<U32, 4> leaf_1 = cpuid(1, 0);
+    std::array<U32, 4> leaf_7 = (max_leaf >= 7) ? cpuid(7, 0) : std::array<U32, 4>{{0}};
+
+    U64  xcr0            = is_bit_set(leaf_1[2], leaf_1_ecx_osxsave) ? read_xcr0() : 0;
+    bool avx_state_os    = (xcr0 & xcr0_avx_states) == xcr0_avx_states;
+    bool avx512_state_os = (xcr0 & xcr0_avx512_states) == xcr0_avx512_states;
+
+    features.sse4_2  = is_bit_set(leaf_1[2], leaf_1_ecx_sse4_2);
+    features.avx     = avx_state_os && is_bit_set(leaf_1[2], leaf_1_ecx_avx);
+    features.fma     = features.avx && is_bit_set(leaf_1[2], leaf_1_ecx_fma);
+    features.avx2    = features.avx && is_bit_set(leaf_7[1], leaf_7_ebx_avx2);
+    features.avx512f = avx512_state_os && is_bit_set(leaf_7[1], leaf_7_ebx_avx512f);
+
+    return features;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto read_xcr0() noexcept -> U64
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    // The `_xgetbv` intrinsic requires the `xsave` target option, which can't be assumed here
+    U32 eax = 0;
+    U32 edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0)); // NOLINT(hicpp-no-assembler)
+    return (static_cast<U64>(edx) << 32U) | eax;                // NOLINT(readability-magic-numbers)
+#endif
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
@@ -13,6 +13,12 @@
 
 #include <array>
 
+
+#if defined(MJOLNIR_CORE_ENABLE_AVX512) && ! defined(__AVX512F__)
+#    error "AVX-512 support is enabled, but the compiler does not target AVX-512F (use -mavx512f or /arch:AVX512)."
+#endif
+
+
 // === DECLARATION ====================================================================================================
 
 namespace mjolnir::x86
@@ -21,13 +27,52 @@ namespace mjolnir::x86
 //! @{
 
 
+//! @brief
+//! `true` if the support for AVX-512 registers is enabled and `false` otherwise.
+//!
+//! @details
+//! The support is enabled with the CMake option `MJOLNIR_CORE_ENABLE_AVX512`, which defines the preprocessor symbol
+//! of the same name. If it is disabled, the 512 bit register types are not part of the register concepts and can't be
+//! used with any function of the x86 module.
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+inline constexpr bool is_avx512_enabled = true;
+#else
+inline constexpr bool is_avx512_enabled = false;
+#endif
+
+
+//! @brief
+//! Concept for a x86 AVX-512 vector register.
+//!
+//! @details
+//! This concept is only satisfied if the AVX-512 support is enabled.
+//!
+//! @tparam T_Type
+//! Type
+template <typename T_Type>
+concept AVX512Register = is_avx512_enabled && is_any_of<T_Type, __m512, __m512d, __m512i>();
+
+
+//! @brief
+//! Concept for a x86 AVX-512 vector register that has floating-point elements.
+//!
+//! @details
+//! This concept is only satisfied if the AVX-512 support is enabled.
+//!
+//! @tparam T_Type
+//! Type
+template <typename T_Type>
+concept FloatAVX512Register = is_avx512_enabled && is_any_of<T_Type, __m512, __m512d>();
+
+
 //! @brief
 //! Concept for a x86 vector register
 //!
 //! @tparam T_Type
 //! Type
 template <typename T_Type>
-concept VectorRegister = is_any_of<T_Type, __m128, __m128d, __m128i, __m256, __m256d, __m256i>();
+concept VectorRegister =
+        is_any_of<T_Type, __m128, __m128d, __m128i, __m256, __m256d, __m256i>() || AVX512Register<T_Type>;
 
 
 //! @brief
@@ -36,7 +81,7 @@ concept VectorRegister = is_any_of<T_Type, __m128, __m128d, __m128i, __m256, __m
 //! @tparam T_Type
 //! Type
 template <typename T_Type>
-concept FloatVectorRegister = is_any_of<T_Type, __m128, __m128d, __m256, __m256d>();
+concept FloatVectorRegister = is_any_of<T_Type, __m128, __m128d, __m256, __m256d>() || FloatAVX512Register<T_Type>;
 
 
 //! @brief
@@ -63,7 +108,8 @@ concept FloatAVXRegister = is_any_of<T_Type, __m256, __m256d>();
 //! @tparam T_Type
 //! Type
 template <typename T_Type>
-concept SinglePrecisionVectorRegister = is_any_of<T_Type, __m128, __m256>();
+concept SinglePrecisionVectorRegister =
+        is_any_of<T_Type, __m128, __m256>() || (is_avx512_enabled && std::is_same_v<T_Type, __m512>);
 
 
 //! @brief
@@ -72,7 +118,8 @@ concept SinglePrecisionVectorRegister = is_any_of<T_Type, __m128, __m256>();
 //! @tparam T_Type
 //! Type
 template <typename T_Type>
-concept DoublePrecisionVectorRegister = is_any_of<T_Type, __m128d, __m256d>();
+concept DoublePrecisionVectorRegister =
+        is_any_of<T_Type, __m128d, __m256d>() || (is_avx512_enabled && std::is_same_v<T_Type, __m512d>);
 
 
 //! @brief
@@ -81,7 +128,30 @@ concept DoublePrecisionVectorRegister = is_any_of<T_Type, __m128d, __m256d>();
 //! @tparam T_Type
 //! Type
 template <typename T_Type>
-concept IntegerVectorRegister = is_any_of<T_Type, __m128i, __m256i>();
+concept IntegerVectorRegister =
+        is_any_of<T_Type, __m128i, __m256i>() || (is_avx512_enabled && std::is_same_v<T_Type, __m512i>);
+
+
+//! @brief
+//! Concept for the 128 and 256 bit x86 vector registers that have integer elements.
+//!
+//! @details
+//! Most of the integer functions are limited to these registers, since the AVX-512 counterparts for 8 and 16 bit
+//! elements require the AVX-512BW extension.
+//!
+//! @tparam T_Type
+//! Type
+template <typename T_Type>
+concept IntegerSSEAVXRegister = is_any_of<T_Type, __m128i, __m256i>();
+
+
+//! @brief
+//! Concept for a type that can be used as element type of an integer vector register.
+//!
+//! @tparam T_Type
+//! Type
+template <typename T_Type>
+concept IntegerRegisterElement = is_any_of<T_Type, I8, U8, I16, U16, I32, U32, I64, U64>();
 
 
 //! @brief
@@ -138,13 +208,40 @@ template <typename T_Type>
 inline constexpr bool is_m256i = std::is_same_v<T_Type, __m256i>;
 
 
+//! @brief
+//! Type dependent constant that is only `true` for `__m512` and `false` for all other types.
+//!
+//! @tparam T_Type:
+//! Type
+template <typename T_Type>
+inline constexpr bool is_m512 = std::is_same_v<T_Type, __m512>;
+
+
+//! @brief
+//! Type dependent constant that is only `true` for `__m512d` and `false` for all other types.
+//!
+//! @tparam T_Type:
+//! Type
+template <typename T_Type>
+inline constexpr bool is_m512d = std::is_same_v<T_Type, __m512d>;
+
+
+//! @brief
+//! Type dependent constant that is only `true` for `__m512i` and `false` for all other types.
+//!
+//! @tparam T_Type:
+//! Type
+template <typename T_Type>
+inline constexpr bool is_m512i = std::is_same_v<T_Type, __m512i>;
+
+
 //! @brief
 //! Type dependent constant that is only `true` for supported x86 vector registers.
 //!
 //! @tparam T_Type:
 //! Type
 template <typename T_Type>
-inline constexpr bool is_vector_register = is_any_of<T_Type, __m128, __m128d, __m128i, __m256, __m256d, __m256i>();
+inline constexpr bool is_vector_register = VectorRegister<T_Type>;
 
 
 //! @brief
@@ -165,13 +262,22 @@ template <typename T_Type>
 inline constexpr bool is_avx_register = is_any_of<T_Type, __m256, __m256d, __m256i>();
 
 
+//! @brief
+//! Type dependent constant that is only `true` for AVX-512 vector registers.
+//!
+//! @tparam T_Type:
+//! Type
+template <typename T_Type>
+inline constexpr bool is_avx512_register = is_any_of<T_Type, __m512, __m512d, __m512i>();
+
+
 //! @brief
 //! Type dependent constant that is only `true` for x86 vector registers that have floating-point types as elements.
 //!
 //! @tparam T_Type:
 //! Type
 template <typename T_Type>
-inline constexpr bool is_float_register = is_any_of<T_Type, __m128, __m128d, __m256, __m256d>();
+inline constexpr bool is_float_register = FloatVectorRegister<T_Type>;
 
 
 //! @brief
@@ -180,7 +286,7 @@ inline constexpr bool is_float_register = is_any_of<T_Type, __m128, __m128d, __m
 //! @tparam T_Type:
 //! Type
 template <typename T_Type>
-inline constexpr bool is_integer_register = is_any_of<T_Type, __m128i, __m256i>();
+inline constexpr bool is_integer_register = IntegerVectorRegister<T_Type>;
 
 
 // ---internal declarations -------------------------------------------------------------------------------------------
@@ -209,7 +315,7 @@ template <VectorRegister T_Type>
 //! @tparam T_RegisterType:
 //! Register type
 template <FloatVectorRegister T_RegisterType>
-using ElementType = typename std::conditional_t<is_any_of<T_RegisterType, __m128d, __m256d>(), F64, F32>;
+using ElementType = typename std::conditional_t<is_any_of<T_RegisterType, __m128d, __m256d, __m512d>(), F64, F32>;
 
 
 //! @brief
@@ -266,6 +372,41 @@ template <FloatVectorRegister T_RegisterType>
 inline constexpr UST num_lane_elements = num_elements<T_RegisterType> / num_lanes<T_RegisterType>;
 
 
+//! @brief
+//! Number of elements of an integer register for a specific element type.
+//!
+//! @tparam T_ElementType:
+//! Element type
+//! @tparam T_RegisterType:
+//! Register type
+template <IntegerRegisterElement T_ElementType, IntegerVectorRegister T_RegisterType>
+inline constexpr UST num_integer_elements = sizeof(T_RegisterType) / sizeof(T_ElementType);
+
+
+//! @brief
+//! Number of elements per lane of an integer register for a specific element type.
+//!
+//! @tparam T_ElementType:
+//! Element type
+//! @tparam T_RegisterType:
+//! Register type
+template <IntegerRegisterElement T_ElementType, IntegerVectorRegister T_RegisterType>
+inline constexpr UST num_integer_lane_elements =
+        num_integer_elements<T_ElementType, T_RegisterType> / num_lanes<T_RegisterType>;
+
+
+//! @brief
+//! The integer register type that stores one 32 bit index per element of a floating-point register. It is used by
+//! the gather and scatter functions.
+//!
+//! @tparam T_RegisterType:
+//! Register type
+template <FloatVectorRegister T_RegisterType>
+using IndexRegisterType = std::conditional_t<num_elements<T_RegisterType> <= 4,
+                                             __m128i,
+                                             std::conditional_t<num_elements<T_RegisterType> == 8, __m256i, __m512i>>;
+
+
 //! @brief
 //! `true` if the register has multiple lanes and `false` otherwise.
 //!
@@ -301,13 +442,16 @@ namespace mjolnir::x86::internal
 template <VectorRegister T_Type>
 [[nodiscard]] consteval auto get_alignment_bytes() noexcept -> UST
 {
-    constexpr UST alignment_bytes_sse = 16;
-    constexpr UST alignment_bytes_avx = 32;
+    constexpr UST alignment_bytes_sse    = 16;
+    constexpr UST alignment_bytes_avx    = 32;
+    constexpr UST alignment_bytes_avx512 = 64;
 
     if constexpr (is_sse_register<T_Type>)
         return alignment_bytes_sse;
-    else
+    else if constexpr (is_avx_register<T_Type>)
         return alignment_bytes_avx;
+    else
+        return alignment_bytes_avx512;
 }
 
 
@@ -316,13 +460,16 @@ template <VectorRegister T_Type>
 template <VectorRegister T_Type>
 [[nodiscard]] consteval auto get_num_lanes() noexcept -> UST
 {
-    constexpr UST num_lanes_sse = 1;
-    constexpr UST num_lanes_avx = 2;
+    constexpr UST num_lanes_sse    = 1;
+    constexpr UST num_lanes_avx    = 2;
+    constexpr UST num_lanes_avx512 = 4;
 
     if constexpr (is_sse_register<T_Type>)
         return num_lanes_sse;
-    else
+    else if constexpr (is_avx_register<T_Type>)
         return num_lanes_avx;
+    else
+        return num_lanes_avx512;
 }
 
 
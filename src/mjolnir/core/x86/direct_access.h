@@ -50,6 +50,27 @@ template <UST t_index, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto get(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
 
 
+//! @brief
+//! Get the value of a specific element from a vector register without storing the register in memory.
+//!
+//! @details
+//! The element is moved to the first position with a variable permutation. This avoids the store-forwarding latency
+//! of `get(src, index)`, which stores the whole register on the stack and reloads a single element.
+//!
+//! @tparam T_RegisterType:
+//! Register type
+//!
+//! @param[in] src:
+//! The source register
+//! @param[in] index:
+//! Index of the element
+//!
+//! @return
+//! The value of the indexed element
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto get_permuted(T_RegisterType src, UST index) noexcept -> ElementType<T_RegisterType>;
+
+
 //! @brief
 //! Set the value of a specific vector register element.
 //!
@@ -66,6 +87,26 @@ template <FloatVectorRegister T_RegisterType>
 inline void set(T_RegisterType& dst, UST index, ElementType<T_RegisterType> value) noexcept;
 
 
+//! @brief
+//! Set the value of a specific vector register element without storing the register in memory.
+//!
+//! @details
+//! The value is broadcasted and blended into `dst` with a mask that is created by comparing the index with the
+//! element positions. This avoids the store and reload of the whole register that `set(dst, index, value)` performs.
+//!
+//! @tparam T_RegisterType:
+//! Register type
+//!
+//! @param[in, out] dst:
+//! The target register
+//! @param[in] index:
+//! The element index
+//! @param[in] value:
+//! The new value
+template <FloatVectorRegister T_RegisterType>
+inline void set_blended(T_RegisterType& dst, UST index, ElementType<T_RegisterType> value) noexcept;
+
+
 //! @brief
 //! Set the value of a specific vector register element.
 //!
@@ -90,6 +131,7 @@ inline void set(T_RegisterType& dst, ElementType<T_RegisterType> value) noexcept
 
 #include "mjolnir/core/x86/intrinsics.h"
 #include "mjolnir/core/x86/permutation.h"
+#include "mjolnir/core/x86/x86.h"
 
 #include <array>
 #include <cassert>
@@ -126,6 +168,38 @@ template <UST t_index, FloatVectorRegister T_RegisterType>
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto get_permuted(T_RegisterType src, UST index) noexcept -> ElementType<T_RegisterType>
+{
+    assert(index < num_elements<T_RegisterType>); // NOLINT
+
+    const auto idx = static_cast<I32>(index);
+
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_cvtss_f32(_mm_permutevar_ps(src, _mm_cvtsi32_si128(idx)));
+    else if constexpr (is_m128d<T_RegisterType>)
+        // The second bit of the control value selects the element
+        return _mm_cvtsd_f64(_mm_permutevar_pd(src, _mm_cvtsi32_si128(idx << 1)));
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_cvtss_f32(_mm256_permutevar8x32_ps(src, _mm256_set1_epi32(idx)));
+    else if constexpr (is_m256d<T_RegisterType>)
+    {
+        // There is no variable permutation of 64 bit elements across lanes, so the two halves of the element are
+        // moved as 32 bit values
+        const __m256i control = _mm256_set1_epi64x((static_cast<I64>(2 * idx + 1) << 32) | (2 * idx));
+        return _mm256_cvtsd_f64(_mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(src), control)));
+    }
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_cvtss_f32(
+                _mm512_maskz_permutexvar_ps(internal::mm512_full_mask<T_RegisterType>, _mm512_set1_epi32(idx), src));
+    else
+        return _mm512_cvtsd_f64(
+                _mm512_maskz_permutexvar_pd(internal::mm512_full_mask<T_RegisterType>, _mm512_set1_epi64(idx), src));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
@@ -141,6 +215,42 @@ inline void set(T_RegisterType& dst, UST index, ElementType<T_RegisterType> valu
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+inline void set_blended(T_RegisterType& dst, UST index, ElementType<T_RegisterType> value) noexcept
+{
+    assert(index < num_elements<T_RegisterType>); // NOLINT
+
+    const auto idx = static_cast<I32>(index);
+
+    if constexpr (is_m128<T_RegisterType>)
+    {
+        const __m128i mask = _mm_cmpeq_epi32(_mm_set1_epi32(idx), _mm_setr_epi32(0, 1, 2, 3));
+        dst                = _mm_blendv_ps(dst, _mm_set1_ps(value), _mm_castsi128_ps(mask));
+    }
+    else if constexpr (is_m128d<T_RegisterType>)
+    {
+        const __m128i mask = _mm_cmpeq_epi64(_mm_set1_epi64x(idx), _mm_set_epi64x(1, 0));
+        dst                = _mm_blendv_pd(dst, _mm_set1_pd(value), _mm_castsi128_pd(mask));
+    }
+    else if constexpr (is_m256<T_RegisterType>)
+    {
+        const __m256i mask = _mm256_cmpeq_epi32(_mm256_set1_epi32(idx), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        dst                = _mm256_blendv_ps(dst, _mm256_set1_ps(value), _mm256_castsi256_ps(mask));
+    }
+    else if constexpr (is_m256d<T_RegisterType>)
+    {
+        const __m256i mask = _mm256_cmpeq_epi64(_mm256_set1_epi64x(idx), _mm256_setr_epi64x(0, 1, 2, 3));
+        dst                = _mm256_blendv_pd(dst, _mm256_set1_pd(value), _mm256_castsi256_pd(mask));
+    }
+    else if constexpr (is_m512<T_RegisterType>)
+        dst = _mm512_mask_mov_ps(dst, static_cast<__mmask16>(U32{1} << index), _mm512_set1_ps(value));
+    else
+        dst = _mm512_mask_mov_pd(dst, static_cast<__mmask8>(U32{1} << index), _mm512_set1_pd(value));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <UST t_index, FloatVectorRegister T_RegisterType>
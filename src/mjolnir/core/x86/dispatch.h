@@ -0,0 +1,279 @@
+//! @file
+//! x86/dispatch.h
+//!
+//! @brief
+//! Contains the infrastructure to select function implementations at runtime depending on the CPU features
+
+
+#pragma once
+
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/cpu_features.h"
+
+#include <array>
+#include <atomic>
+#include <utility>
+
+
+// === DECLARATIONS ===================================================================================================
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Instruction set tiers that can be selected by the runtime dispatch.
+//!
+//! @details
+//! Each tier requires the instruction sets of all lower tiers. The `AVX2` tier additionally requires FMA support.
+//!
+//! The implementations of a tier have to be compiled in a separate translation unit that targets the instruction set
+//! of the tier (for example with `-mavx2 -mfma`). The remaining code only needs to target the baseline instruction
+//! set, which is SSE4.2. Hence, a single binary can use all tiers that are supported by the executing CPU.
+enum class InstructionSetTier : UST
+{
+    SCALAR = 0, //!< Scalar implementation without any explicit vectorization
+    SSE4_2 = 1, //!< Implementation based on the 128 bit registers
+    AVX2   = 2, //!< Implementation based on the 128 and 256 bit registers
+    AVX512 = 3  //!< Implementation based on the 512 bit registers
+};
+
+
+//! @brief
+//! Number of values of `InstructionSetTier`
+inline constexpr UST num_instruction_set_tiers = 4;
+
+
+//! @brief
+//! Get the highest instruction set tier that is supported by the executing CPU.
+//!
+//! @return
+//! Highest supported instruction set tier
+[[nodiscard]] inline auto get_supported_instruction_set_tier() noexcept -> InstructionSetTier;
+
+
+//! @brief
+//! Get the instruction set tier that is currently used by all `DispatchedFunction` instances.
+//!
+//! @details
+//! The tier is determined once during the first call and equals the return value of
+//! `get_supported_instruction_set_tier` unless it was changed with `force_instruction_set_tier`.
+//!
+//! @return
+//! Active instruction set tier
+[[nodiscard]] inline auto get_instruction_set_tier() noexcept -> InstructionSetTier;
+
+
+//! @brief
+//! Force all `DispatchedFunction` instances to use the implementations of a specific instruction set tier.
+//!
+//! @details
+//! This function is meant for testing and benchmarking the individual implementations. It should not be called while
+//! other threads are executing dispatched functions.
+//!
+//! @param[in] tier:
+//! The instruction set tier that should be used
+//!
+//! @exception ValueError
+//! The tier is not supported by the executing CPU
+inline void force_instruction_set_tier(InstructionSetTier tier);
+
+
+//! @brief
+//! Reset the active instruction set tier to the highest supported one.
+inline void reset_instruction_set_tier() noexcept;
+
+
+//! @brief
+//! Function wrapper that calls the implementation for the active instruction set tier.
+//!
+//! @tparam T_FunctionType
+//! Function type of the implementations
+template <typename T_FunctionType>
+class DispatchedFunction;
+
+
+//! @brief
+//! Function wrapper that calls the implementation for the active instruction set tier.
+//!
+//! @details
+//! The implementations are stored as function pointers, one per instruction set tier. If no implementation is
+//! provided for a tier, the one of the next lower tier is used instead. Calling the wrapper only adds a relaxed atomic
+//! load and an indirect call compared to calling the implementation directly.
+//!
+//! @tparam T_ReturnType
+//! Return type of the implementations
+//! @tparam T_Args
+//! Parameter types of the implementations
+template <typename T_ReturnType, typename... T_Args>
+class DispatchedFunction<T_ReturnType(T_Args...)>
+{
+public:
+    //! @brief
+    //! Function pointer type of the implementations
+    using FunctionPointer = T_ReturnType (*)(T_Args...);
+
+
+    //! @brief
+    //! Construct a new instance.
+    //!
+    //! @param[in] scalar:
+    //! Implementation of the `SCALAR` tier. It must not be the `nullptr`
+    //! @param[in] sse4_2:
+    //! Implementation of the `SSE4_2` tier or `nullptr`
+    //! @param[in] avx2:
+    //! Implementation of the `AVX2` tier or `nullptr`
+    //! @param[in] avx512:
+    //! Implementation of the `AVX512` tier or `nullptr`
+    constexpr explicit DispatchedFunction(FunctionPointer scalar,
+                                          FunctionPointer sse4_2 = nullptr,
+                                          FunctionPointer avx2   = nullptr,
+                                          FunctionPointer avx512 = nullptr) noexcept;
+
+
+    //! @brief
+    //! Call the implementation of the active instruction set tier.
+    //!
+    //! @param[in] args:
+    //! Function arguments
+    //!
+    //! @return
+    //! Return value of the called implementation
+    auto operator()(T_Args... args) const -> T_ReturnType;
+
+
+    //! @brief
+    //! Get the implementation that is used for a specific instruction set tier.
+    //!
+    //! @param[in] tier:
+    //! Instruction set tier
+    //!
+    //! @return
+    //! Function pointer to the implementation
+    [[nodiscard]] constexpr auto get_function(InstructionSetTier tier) const noexcept -> FunctionPointer;
+
+
+private:
+    std::array<FunctionPointer, num_instruction_set_tiers> m_functions;
+};
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Get the storage of the active instruction set tier
+[[nodiscard]] inline auto get_active_instruction_set_tier() noexcept -> std::atomic<InstructionSetTier>&;
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto get_supported_instruction_set_tier() noexcept -> InstructionSetTier
+{
+    const CPUFeatures& features = get_cpu_features();
+
+    if (! features.sse4_2)
+        return InstructionSetTier::SCALAR;
+    if (! features.avx2 || ! features.fma)
+        return InstructionSetTier::SSE4_2;
+    if (! features.avx512f)
+        return InstructionSetTier::AVX2;
+    return InstructionSetTier::AVX512;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto get_instruction_set_tier() noexcept -> InstructionSetTier
+{
+    return internal::get_active_instruction_set_tier().load(std::memory_order_relaxed);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline void force_instruction_set_tier(InstructionSetTier tier)
+{
+    THROW_EXCEPTION_IF(tier > get_supported_instruction_set_tier(),
+                       ValueError,
+                       "The instruction set tier is not supported by the CPU.");
+
+    internal::get_active_instruction_set_tier().store(tier, std::memory_order_relaxed);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+inline void reset_instruction_set_tier() noexcept
+{
+    internal::get_active_instruction_set_tier().store(get_supported_instruction_set_tier(), std::memory_order_relaxed);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_ReturnType, typename... T_Args>
+constexpr DispatchedFunction<T_ReturnType(T_Args...)>::DispatchedFunction(FunctionPointer scalar,
+                                                                          FunctionPointer sse4_2,
+                                                                          FunctionPointer avx2,
+                                                                          FunctionPointer avx512) noexcept
+    : m_functions{{scalar, sse4_2, avx2, avx512}}
+{
+    for (UST i = 1; i < num_instruction_set_tiers; ++i)
+        if (m_functions.at(i) == nullptr)
+            m_functions.at(i) = m_functions.at(i - 1);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_ReturnType, typename... T_Args>
+auto DispatchedFunction<T_ReturnType(T_Args...)>::operator()(T_Args... args) const -> T_ReturnType
+{
+    return get_function(get_instruction_set_tier())(std::forward<T_Args>(args)...);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename T_ReturnType, typename... T_Args>
+[[nodiscard]] constexpr auto
+DispatchedFunction<T_ReturnType(T_Args...)>::get_function(InstructionSetTier tier) const noexcept -> FunctionPointer
+{
+    return m_functions[static_cast<UST>(tier)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline auto get_active_instruction_set_tier() noexcept -> std::atomic<InstructionSetTier>&
+{
+    static std::atomic<InstructionSetTier> tier = get_supported_instruction_set_tier();
+    return tier;
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
@@ -0,0 +1,595 @@
+//! @file
+//! element_reduction.h
+//!
+//! @brief
+//! Contains functions that reduce all elements of a vector register to a single value with an arbitrary operation.
+
+
+#pragma once
+
+#include "mjolnir/core/x86/definitions.h"
+
+#include <concepts>
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Reduce all elements of `src` with the binary operation `reduce_func`, broadcast the result into a new register and
+//! return it.
+//!
+//! @details
+//! The reduction is performed with a butterfly pattern of in-lane permutations and lane swaps. Therefore,
+//! `reduce_func` should be associative and commutative. Otherwise, the result depends on the implementation.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//! @tparam T_ReduceFunc:
+//! Type of the callable that performs the element-wise reduction of two registers
+//!
+//! @param[in] src:
+//! The source register
+//! @param[in] reduce_func:
+//! Callable that returns the element-wise reduction of two registers, for example a wrapper around `mm_max`
+//!
+//! @return
+//! Register with all elements set to the reduction result
+template <FloatVectorRegister T_RegisterType, std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto broadcast_element_reduction(T_RegisterType src, T_ReduceFunc reduce_func) noexcept
+        -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the maximum of all elements of `src`, broadcast it into a new register and return the result.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Register with all elements set to the maximum element of `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_element_max(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the minimum of all elements of `src`, broadcast it into a new register and return the result.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Register with all elements set to the minimum element of `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_element_min(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the product of all elements of `src`, broadcast it into a new register and return the result.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Register with all elements set to the element product of `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_element_product(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Return the index of the maximum element of `src`.
+//!
+//! @details
+//! If multiple elements are equal to the maximum, the lowest index is returned. The result is unspecified if `src`
+//! contains NaN values.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Index of the maximum element of `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_argmax(T_RegisterType src) noexcept -> UST;
+
+
+//! @brief
+//! Return the index of the minimum element of `src`.
+//!
+//! @details
+//! If multiple elements are equal to the minimum, the lowest index is returned. The result is unspecified if `src`
+//! contains NaN values.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Index of the minimum element of `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_argmin(T_RegisterType src) noexcept -> UST;
+
+
+//! @brief
+//! Return the maximum of all elements from `src`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Maximum of all elements from `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_max(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the maximum of the first `t_num_elements` elements from `src`.
+//!
+//! @tparam t_num_elements:
+//! Number of elements that should be considered.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Maximum of the first `t_num_elements` elements from `src`
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_max_first_n(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the minimum of all elements from `src`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Minimum of all elements from `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_min(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the minimum of the first `t_num_elements` elements from `src`.
+//!
+//! @tparam t_num_elements:
+//! Number of elements that should be considered.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Minimum of the first `t_num_elements` elements from `src`
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_min_first_n(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the product of all elements from `src`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Product of all elements from `src`
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_product(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Return the product of the first `t_num_elements` elements from `src`.
+//!
+//! @tparam t_num_elements:
+//! Number of elements that should be multiplied.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Product of the first `t_num_elements` elements from `src`
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_product_first_n(T_RegisterType src) noexcept -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Reduce all elements of `src` with the binary operation `reduce_func` and return the result.
+//!
+//! @details
+//! See `broadcast_element_reduction` for the requirements on `reduce_func`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//! @tparam T_ReduceFunc:
+//! Type of the callable that performs the element-wise reduction of two registers
+//!
+//! @param[in] src:
+//! The source register
+//! @param[in] reduce_func:
+//! Callable that returns the element-wise reduction of two registers
+//!
+//! @return
+//! Reduction result of all elements from `src`
+template <FloatVectorRegister T_RegisterType, std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto element_reduction(T_RegisterType src, T_ReduceFunc reduce_func) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+//! @brief
+//! Reduce the first `t_num_elements` elements of `src` with the binary operation `reduce_func` and return the result.
+//!
+//! @details
+//! If `t_num_elements` isn't a power of 2, the remaining elements are replaced by `identity` before the reduction.
+//! See `broadcast_element_reduction` for the requirements on `reduce_func`.
+//!
+//! @tparam t_num_elements:
+//! Number of elements that should be reduced.
+//! @tparam T_RegisterType:
+//! The register type
+//! @tparam T_ReduceFunc:
+//! Type of the callable that performs the element-wise reduction of two registers
+//!
+//! @param[in] src:
+//! The source register
+//! @param[in] reduce_func:
+//! Callable that returns the element-wise reduction of two registers
+//! @param[in] identity:
+//! The identity element of the reduction operation, for example `0` for an addition or `1` for a multiplication
+//!
+//! @return
+//! Reduction result of the first `t_num_elements` elements from `src`
+template <UST                                            t_num_elements,
+          FloatVectorRegister                            T_RegisterType,
+          std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto
+element_reduction_first_n(T_RegisterType src, T_ReduceFunc reduce_func, ElementType<T_RegisterType> identity) noexcept
+        -> ElementType<T_RegisterType>;
+
+
+// ---internal declarations -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Return the index of the first element of `src` that is equal to the broadcasted element `value`.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto first_equal_index(T_RegisterType src, T_RegisterType value) noexcept -> UST;
+
+
+//! Permute the 128 bit lanes of an AVX-512 register.
+template <UST t_lane_0, UST t_lane_1, UST t_lane_2, UST t_lane_3, FloatAVX512Register T_RegisterType>
+[[nodiscard]] inline auto permute_avx512_lanes(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! Combine the first `t_num_elements` elements of `src` with a butterfly reduction. The result is stored in the first
+//! element. `t_num_elements` must be a power of 2. If it is equal to the number of register elements, the result is
+//! stored in all elements.
+template <UST                                            t_num_elements,
+          FloatVectorRegister                            T_RegisterType,
+          std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto reduce_elements(T_RegisterType src, T_ReduceFunc reduce_func) noexcept -> T_RegisterType;
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/permutation.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <bit>
+#include <limits>
+
+namespace mjolnir::x86
+{
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! The following structs are just wrappers around functions from `mjolnir/core/x86/intrinsics.h`. They are used as
+//! reduction operations of the generalized reduction functions. See `comparison.h` for the reasoning behind using
+//! wrapper structs instead of the functions themselves.
+
+template <FloatVectorRegister T_RegisterType>
+struct ReduceMax
+{
+    [[nodiscard]] inline auto operator()(T_RegisterType lhs, T_RegisterType rhs) const noexcept -> T_RegisterType
+    {
+        return mm_max(lhs, rhs);
+    }
+};
+
+
+// --------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+struct ReduceMin
+{
+    [[nodiscard]] inline auto operator()(T_RegisterType lhs, T_RegisterType rhs) const noexcept -> T_RegisterType
+    {
+        return mm_min(lhs, rhs);
+    }
+};
+
+
+// --------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+struct ReduceProduct
+{
+    [[nodiscard]] inline auto operator()(T_RegisterType lhs, T_RegisterType rhs) const noexcept -> T_RegisterType
+    {
+        return mm_mul(lhs, rhs);
+    }
+};
+
+
+} // namespace internal
+//! \endcond
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto broadcast_element_reduction(T_RegisterType src, T_ReduceFunc reduce_func) noexcept
+        -> T_RegisterType
+{
+    return internal::reduce_elements<num_elements<T_RegisterType>>(src, reduce_func);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_element_max(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return broadcast_element_reduction(src, internal::ReduceMax<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_element_min(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return broadcast_element_reduction(src, internal::ReduceMin<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto broadcast_element_product(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return broadcast_element_reduction(src, internal::ReduceProduct<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_argmax(T_RegisterType src) noexcept -> UST
+{
+    return internal::first_equal_index(src, broadcast_element_max(src));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_argmin(T_RegisterType src) noexcept -> UST
+{
+    return internal::first_equal_index(src, broadcast_element_min(src));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_max(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
+{
+    return element_reduction(src, internal::ReduceMax<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_max_first_n(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
+{
+    using EType = ElementType<T_RegisterType>;
+
+    return element_reduction_first_n<t_num_elements>(
+            src, internal::ReduceMax<T_RegisterType>(), -std::numeric_limits<EType>::infinity());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_min(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
+{
+    return element_reduction(src, internal::ReduceMin<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_min_first_n(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
+{
+    using EType = ElementType<T_RegisterType>;
+
+    return element_reduction_first_n<t_num_elements>(
+            src, internal::ReduceMin<T_RegisterType>(), std::numeric_limits<EType>::infinity());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_product(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
+{
+    return element_reduction(src, internal::ReduceProduct<T_RegisterType>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto element_product_first_n(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
+{
+    using EType = ElementType<T_RegisterType>;
+
+    return element_reduction_first_n<t_num_elements>(src, internal::ReduceProduct<T_RegisterType>(), EType(1));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto element_reduction(T_RegisterType src, T_ReduceFunc reduce_func) noexcept
+        -> ElementType<T_RegisterType>
+{
+    return mm_cvt_float(broadcast_element_reduction(src, reduce_func));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST                                            t_num_elements,
+          FloatVectorRegister                            T_RegisterType,
+          std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto
+element_reduction_first_n(T_RegisterType src, T_ReduceFunc reduce_func, ElementType<T_RegisterType> identity) noexcept
+        -> ElementType<T_RegisterType>
+{
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    static_assert(t_num_elements > 0, "`t_num_elements` must be larger than 0.");
+    static_assert(t_num_elements <= n_e, "`t_num_elements` must be less or equal to the number of register elements.");
+
+    if constexpr (t_num_elements == 1)
+        return mm_cvt_float(src);
+    else if constexpr (std::has_single_bit(t_num_elements))
+        return mm_cvt_float(internal::reduce_elements<t_num_elements>(src, reduce_func));
+    else
+    {
+        // The butterfly reduction only combines groups of 2^n elements, so the excess elements are set to the identity
+        constexpr UST num_reduced_elements = std::bit_ceil(t_num_elements);
+
+        T_RegisterType masked = blend_below<t_num_elements>(mm_set1<T_RegisterType>(identity), src);
+        return mm_cvt_float(internal::reduce_elements<num_reduced_elements>(masked, reduce_func));
+    }
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto first_equal_index(T_RegisterType src, T_RegisterType value) noexcept -> UST
+{
+    return static_cast<UST>(std::countr_zero(mm_movemask(mm_cmp_eq(src, value))));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_lane_0, UST t_lane_1, UST t_lane_2, UST t_lane_3, FloatAVX512Register T_RegisterType>
+[[nodiscard]] inline auto permute_avx512_lanes(T_RegisterType src) noexcept -> T_RegisterType
+{
+    static_assert(pack_all_less<t_lane_0, t_lane_1, t_lane_2, t_lane_3>(4),
+                  "All template values must be in the range [0, 3]");
+
+    constexpr U8 mask = bit_construct_from_ints<2, U8, t_lane_0, t_lane_1, t_lane_2, t_lane_3>(true);
+
+    if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_shuffle_f32x4(mm512_full_mask<T_RegisterType>, src, src, mask);
+    else
+        return _mm512_maskz_shuffle_f64x2(mm512_full_mask<T_RegisterType>, src, src, mask);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST                                            t_num_elements,
+          FloatVectorRegister                            T_RegisterType,
+          std::invocable<T_RegisterType, T_RegisterType> T_ReduceFunc>
+[[nodiscard]] inline auto reduce_elements(T_RegisterType src, T_ReduceFunc reduce_func) noexcept -> T_RegisterType
+{
+    constexpr UST n_le = num_lane_elements<T_RegisterType>;
+
+    static_assert(std::has_single_bit(t_num_elements), "`t_num_elements` must be a power of 2.");
+    static_assert(t_num_elements <= num_elements<T_RegisterType>,
+                  "`t_num_elements` must be less or equal to the number of register elements.");
+
+    T_RegisterType result = src;
+
+    if constexpr (is_single_precision<T_RegisterType>)
+    {
+        if constexpr (t_num_elements > 1)
+            result = reduce_func(result, permute<1, 0, 3, 2>(result));
+        if constexpr (t_num_elements > 2)
+            result = reduce_func(result, permute<2, 3, 0, 1>(result));
+    }
+    else if constexpr (t_num_elements > 1)
+        result = reduce_func(result, permute<1, 0>(result));
+
+    if constexpr (t_num_elements > n_le)
+    {
+        if constexpr (is_avx512_register<T_RegisterType>)
+        {
+            result = reduce_func(result, permute_avx512_lanes<1, 0, 3, 2>(result));
+            if constexpr (t_num_elements > 2 * n_le)
+                result = reduce_func(result, permute_avx512_lanes<2, 3, 0, 1>(result));
+        }
+        else
+            result = reduce_func(result, swap_lanes(result));
+    }
+
+    return result;
+}
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
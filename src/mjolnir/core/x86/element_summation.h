@@ -96,7 +96,9 @@ namespace mjolnir::x86
 template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto broadcast_element_sum(T_RegisterType src) noexcept -> T_RegisterType
 {
-    if constexpr (is_single_precision<T_RegisterType>)
+    if constexpr (is_avx512_register<T_RegisterType>)
+        return mm_set1<T_RegisterType>(element_sum(src));
+    else if constexpr (is_single_precision<T_RegisterType>)
     {
         T_RegisterType sum = mm_add(src, permute<1, 0, 3, 2>(src));
         sum                = mm_add(sum, permute<2, 3, 0, 1>(sum));
@@ -123,8 +125,25 @@ template <FloatVectorRegister T_RegisterType>
 template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto element_sum(T_RegisterType src) noexcept -> ElementType<T_RegisterType>
 {
-    T_RegisterType sum = broadcast_element_sum(src);
-    return mm_cvt_float(sum);
+    // AVX-512 registers are reduced to AVX registers by adding the upper to the lower 256 bits
+    if constexpr (is_m512d<T_RegisterType>)
+    {
+        __m256d lower = _mm512_maskz_extractf64x4_pd(internal::mm512_lane_mask, src, 0);
+        __m256d upper = _mm512_maskz_extractf64x4_pd(internal::mm512_lane_mask, src, 1);
+        return element_sum(mm_add(lower, upper));
+    }
+    else if constexpr (is_m512<T_RegisterType>)
+    {
+        __m512d src_pd = _mm512_castps_pd(src);
+        __m256  lower  = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(internal::mm512_lane_mask, src_pd, 0));
+        __m256  upper  = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(internal::mm512_lane_mask, src_pd, 1));
+        return element_sum(mm_add(lower, upper));
+    }
+    else
+    {
+        T_RegisterType sum = broadcast_element_sum(src);
+        return mm_cvt_float(sum);
+    }
 }
 
 
@@ -138,7 +157,15 @@ template <UST t_num_elements, FloatVectorRegister T_RegisterType>
     static_assert(t_num_elements > 0, "`t_num_elements` must be larger than 0.");
     static_assert(t_num_elements <= n_e, "`t_num_elements` must be less or equal to the number of register elements.");
 
-    return internal::element_sum_first_n<t_num_elements, T_RegisterType>(src);
+    if constexpr (is_avx512_register<T_RegisterType>)
+    {
+        if constexpr (t_num_elements == n_e)
+            return element_sum(src);
+        else
+            return element_sum(blend_below<t_num_elements>(mm_setzero<T_RegisterType>(), src));
+    }
+    else
+        return internal::element_sum_first_n<t_num_elements, T_RegisterType>(src);
 }
 
 
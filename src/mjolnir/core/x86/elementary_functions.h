@@ -0,0 +1,652 @@
+//! @file
+//! elementary_functions.h
+//!
+//! @brief
+//! Contains vectorized reciprocals, exponential, logarithm and trigonometric functions.
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+#include <array>
+
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Selects the trade-off between accuracy and speed of the approximated functions.
+enum class Accuracy : UST
+{
+    PRECISE = 0, //!< Errors of a few units in the last place
+    FAST    = 1  //!< Shorter approximations with a relative error below the square root of the machine epsilon
+};
+
+
+//! @brief
+//! Calculate the element-wise four-quadrant arc tangent of `y / x`.
+//!
+//! @details
+//! The behavior for zeros, infinities and NaNs matches `std::atan2`.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] y:
+//! The y-coordinates
+//! @param[in] x:
+//! The x-coordinates
+//!
+//! @return
+//! Register with the angles in the range [-pi, pi]
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto atan2(T_RegisterType y, T_RegisterType x) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise cosine of `src`.
+//!
+//! @details
+//! The argument is reduced with a three-part representation of pi/2. Arguments with a magnitude above 10^4 (single
+//! precision) or 10^9 (double precision) lose accuracy. Infinities and NaNs yield NaN.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The angles in radians
+//!
+//! @return
+//! Register with the cosines
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto cos(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise exponential function of `src`.
+//!
+//! @details
+//! Results that exceed the range of the element type become infinity. Subnormal results are supported.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The exponents
+//!
+//! @return
+//! Register with the results
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto exp(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise natural logarithm of `src`.
+//!
+//! @details
+//! Subnormal values are supported. Zeros yield negative infinity and negative values yield NaN.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Register with the logarithms
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto log(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise reciprocal of `src`.
+//!
+//! @details
+//! `Accuracy::PRECISE` uses a division. `Accuracy::FAST` refines the approximation instruction with one Newton-Raphson
+//! step. SSE and AVX have no approximation instruction for double-precision values, so that they always use a
+//! division.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Register with the reciprocals
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto rcp(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise reciprocal square root of `src`.
+//!
+//! @details
+//! `Accuracy::PRECISE` uses a square root and a division. `Accuracy::FAST` refines the approximation instruction with
+//! one Newton-Raphson step. SSE and AVX have no approximation instruction for double-precision values, so that they
+//! always use the precise version.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! Register with the reciprocal square roots
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto rsqrt(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise sine of `src`.
+//!
+//! @details
+//! See `cos` for the supported argument range.
+//!
+//! @tparam t_accuracy:
+//! The accuracy of the approximation
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The angles in radians
+//!
+//! @return
+//! Register with the sines
+template <Accuracy t_accuracy = Accuracy::PRECISE, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto sin(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Return the polynomial coefficients that match the requested accuracy. The three sets are approximations with a
+//! relative error below 2^-14, 2^-28 and 2^-56. The coefficients are ordered from the highest to the lowest degree.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy, UST t_n_low, UST t_n_mid, UST t_n_high>
+[[nodiscard]] consteval auto select_coefficients(const std::array<F64, t_n_low>&  low,
+                                                 const std::array<F64, t_n_mid>&  mid,
+                                                 const std::array<F64, t_n_high>& high) noexcept;
+
+
+//! Coefficients of `q(r)` with `exp(r) = 1 + r + r^2 q(r)` for `|r| <= ln(2) / 2`.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+inline constexpr auto exp_coefficients = select_coefficients<T_RegisterType, t_accuracy>(
+        std::array<F64, 3>{{0.041791986112873949, 0.16741898669505059, 0.5}},
+        std::array<F64, 6>{{0.00019890980869750327, 0.0013933641031986701, 0.008333310934448869, 0.04166646500604005,
+                            0.16666666681614256, 0.50000000134577272}},
+        std::array<F64, 11>{{2.0914679376583935e-09, 2.5105206373957011e-08, 2.7557273661348637e-07,
+                             2.7557255425746435e-06, 2.4801587325533363e-05, 0.00019841269874800493,
+                             0.0013888888888883752, 0.0083333333333261411, 0.041666666666666671, 0.16666666666666671,
+                             0.5}});
+
+
+//! Coefficients of `q(z)` with `ln((1 + s) / (1 - s)) = 2s + s z q(z)` and `z = s^2` for `|s| <= 3 - 2 sqrt(2)`.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+inline constexpr auto log_coefficients = select_coefficients<T_RegisterType, t_accuracy>(
+        std::array<F64, 2>{{0.4085826936143872, 0.66663499454944741}},
+        std::array<F64, 3>{{0.29579949391972787, 0.39988780566021981, 0.66666685039575857}},
+        std::array<F64, 7>{{0.14616449685043406, 0.15331721600556042, 0.18182889125261723, 0.22222211134795081,
+                            0.28571428625975487, 0.39999999999899505, 0.66666666666666696}});
+
+
+//! Coefficients of `q(z)` with `sin(r) = r + r z q(z)` and `z = r^2` for `|r| <= pi / 4`.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+inline constexpr auto sin_coefficients = select_coefficients<T_RegisterType, t_accuracy>(
+        std::array<F64, 2>{{0.0082118555073082185, -0.16665731001278386}},
+        std::array<F64, 4>{{2.7249925803059792e-06, -0.00019840086735384846, 0.0083333318747102082,
+                            -0.1666666666385529}},
+        std::array<F64, 6>{{1.5918129294866608e-10, -2.5051131845003624e-08, 2.7557316102552439e-06,
+                            -0.00019841269836758574, 0.008333333333330948, -0.16666666666666666}});
+
+
+//! Coefficients of `q(z)` with `cos(r) = 1 - z / 2 + z^2 q(z)` and `z = r^2` for `|r| <= pi / 4`.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+inline constexpr auto cos_coefficients = select_coefficients<T_RegisterType, t_accuracy>(
+        std::array<F64, 2>{{-0.0013736814061734361, 0.041665495080110332}},
+        std::array<F64, 3>{{2.4547942085071572e-05, -0.0013888303035894866, 0.041666664659502209}},
+        std::array<F64, 6>{{-1.1382632425521717e-11, 2.0876146268403199e-09, -2.7557317271729793e-07,
+                            2.4801587298765689e-05, -0.0013888888888887398, 0.041666666666666664}});
+
+
+//! Coefficients of `q(z)` with `atan(a) = a + a z q(z)` and `z = a^2` for `|a| <= tan(pi / 8)`.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+inline constexpr auto atan_coefficients = select_coefficients<T_RegisterType, t_accuracy>(
+        std::array<F64, 3>{{-0.11819444409574102, 0.19848097811084561, -0.33331896557788776}},
+        std::array<F64, 5>{{-0.064519282081217488, 0.10743731490791084, -0.1426395559798464, 0.19999540483648964,
+                            -0.33333331761168522}},
+        std::array<F64, 11>{{-0.01917688711906226, 0.039231658295587189, -0.050854497379402598, 0.0585814891280221,
+                             -0.066645114473819475, 0.076921831908260865, -0.090909045781239026,
+                             0.11111111015256361, -0.14285714284666542, 0.19999999999995521,
+                             -0.33333333333333331}});
+
+
+//! Evaluate the polynomial with the passed coefficients at `x` using Horner's method.
+template <FloatVectorRegister T_RegisterType, UST t_num_coefficients>
+[[nodiscard]] inline auto evaluate_polynomial(T_RegisterType                               x,
+                                              const std::array<F64, t_num_coefficients>& coefficients) noexcept
+        -> T_RegisterType;
+
+
+//! Return the number of explicitly stored mantissa bits of the register's element type.
+template <FloatVectorRegister T_RegisterType>
+inline constexpr UST num_mantissa_bits = is_single_precision<T_RegisterType> ? 23 : 52;
+
+
+//! Return a register with `value` converted to the element type in all elements.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto set1(F64 value) noexcept -> T_RegisterType;
+
+
+//! Shift the bit representation of each element left by `t_count` bits while shifting in zeros.
+template <UST t_count, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto shift_element_bits_left(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! Shift the bit representation of each element right by `t_count` bits while shifting in zeros.
+template <UST t_count, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto shift_element_bits_right(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! Calculate the sine or, if `t_cosine` is `true`, the cosine of `src`.
+template <Accuracy t_accuracy, bool t_cosine, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto sin_cos(T_RegisterType src) noexcept -> T_RegisterType;
+
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/sign_manipulation.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <limits>
+#include <numbers>
+
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto atan2(T_RegisterType y, T_RegisterType x) noexcept -> T_RegisterType
+{
+    using namespace internal;
+    using EType = ElementType<T_RegisterType>;
+
+    constexpr F64 tan_pi_8 = 0.41421356237309503; // sqrt(2) - 1
+    constexpr F64 pi       = std::numbers::pi;
+
+    const auto inf = mm_set1<T_RegisterType>(std::numeric_limits<EType>::infinity());
+
+    auto abs_x = abs(x);
+    auto abs_y = abs(y);
+    auto min   = mm_min(abs_x, abs_y);
+    auto max   = mm_max(abs_x, abs_y);
+
+    // Reduce the ratio min / max to [-tan(pi/8), tan(pi/8)] with atan(a) = pi/4 + atan((a - 1) / (a + 1))
+    auto large  = mm_cmp_gt(min, mm_mul(max, set1<T_RegisterType>(tan_pi_8)));
+    auto infs   = mm_cmp_eq(min, inf);
+    auto num    = mm_blendv(min, mm_sub(min, max), large);
+    auto den    = mm_blendv(max, mm_add(min, max), large);
+    auto ratio  = mm_div(num, den);
+    auto offset = mm_and(mm_or(large, infs), set1<T_RegisterType>(pi / 4));
+
+    // Two zeros or two infinities yield NaN. Their angles are fully determined by the offset and the quadrant.
+    ratio = mm_and(ratio, mm_cmp_eq(ratio, ratio));
+
+    auto z     = mm_mul(ratio, ratio);
+    auto poly  = evaluate_polynomial(z, atan_coefficients<T_RegisterType, t_accuracy>);
+    auto angle = mm_add(mm_fmadd(mm_mul(ratio, z), poly, ratio), offset);
+
+    // Map the angle to the correct octant and quadrant
+    angle = mm_blendv(angle, mm_sub(set1<T_RegisterType>(pi / 2), angle), mm_cmp_gt(abs_y, abs_x));
+    angle = mm_blendv(angle, mm_sub(set1<T_RegisterType>(pi), angle), x);
+    angle = mm_or(angle, mm_and(y, mm_set1<T_RegisterType>(static_cast<EType>(-0.0))));
+
+    auto ordered = mm_and(mm_cmp_eq(x, x), mm_cmp_eq(y, y));
+    return mm_blendv(mm_add(x, y), angle, ordered);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto cos(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return internal::sin_cos<t_accuracy, true>(src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto exp(T_RegisterType src) noexcept -> T_RegisterType
+{
+    using namespace internal;
+
+    constexpr bool is_sp   = is_single_precision<T_RegisterType>;
+    constexpr F64  bias    = is_sp ? 127 : 1023;
+    constexpr F64  min_arg = is_sp ? -104 : -746;
+    constexpr F64  max_arg = is_sp ? 89 : 710;
+    constexpr F64  ln2_hi  = is_sp ? 0.693147182 : 0.6931471805599453;
+    constexpr F64  ln2_lo  = is_sp ? -1.90465421e-09 : 2.3190468138462996e-17;
+
+    // Adding this number rounds values to integers that are stored in the lowest mantissa bits
+    constexpr F64 round_magic = 1.5 * static_cast<F64>(UST{1} << num_mantissa_bits<T_RegisterType>);
+
+    // Clamp the arguments to a range where the results overflow or underflow. The operand order propagates NaNs.
+    auto x = mm_max(set1<T_RegisterType>(min_arg), mm_min(set1<T_RegisterType>(max_arg), src));
+
+    // Reduce to exp(x) = 2^n exp(r) with |r| <= ln(2) / 2
+    auto n = mm_sub(mm_fmadd(x, set1<T_RegisterType>(std::numbers::log2e), set1<T_RegisterType>(round_magic)),
+                    set1<T_RegisterType>(round_magic));
+    auto r = mm_fmadd(n, set1<T_RegisterType>(-ln2_hi), x);
+    r      = mm_fmadd(n, set1<T_RegisterType>(-ln2_lo), r);
+
+    auto poly  = evaluate_polynomial(r, exp_coefficients<T_RegisterType, t_accuracy>);
+    auto exp_r = mm_add(mm_fmadd(mm_mul(r, r), poly, r), set1<T_RegisterType>(1));
+
+    // 2^n is applied as 2^n1 * 2^n2 so that both factors and subnormal results are representable. Shifting the biased
+    // exponents that are stored in the lowest mantissa bits of the magic sums yields the factors.
+    const auto scale_magic = set1<T_RegisterType>(round_magic + bias);
+
+    auto n1_magic = mm_fmadd(n, set1<T_RegisterType>(0.5), scale_magic);
+    auto n2_magic = mm_add(mm_sub(n, mm_sub(n1_magic, scale_magic)), scale_magic);
+    auto scale_1  = shift_element_bits_left<num_mantissa_bits<T_RegisterType>>(n1_magic);
+    auto scale_2  = shift_element_bits_left<num_mantissa_bits<T_RegisterType>>(n2_magic);
+
+    return mm_mul(mm_mul(exp_r, scale_1), scale_2);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto log(T_RegisterType src) noexcept -> T_RegisterType
+{
+    using namespace internal;
+    using EType = ElementType<T_RegisterType>;
+
+    constexpr UST n_m        = num_mantissa_bits<T_RegisterType>;
+    constexpr F64 bias       = is_single_precision<T_RegisterType> ? 127 : 1023;
+    constexpr F64 two_pow_nm = static_cast<F64>(UST{1} << n_m);
+    constexpr F64 ln2_hi     = is_single_precision<T_RegisterType> ? 0.693147182 : 0.6931471805599453;
+    constexpr F64 ln2_lo     = is_single_precision<T_RegisterType> ? -1.90465421e-09 : 2.3190468138462996e-17;
+
+    const auto zero = mm_setzero<T_RegisterType>();
+    const auto one  = set1<T_RegisterType>(1);
+    const auto inf  = mm_set1<T_RegisterType>(std::numeric_limits<EType>::infinity());
+
+    // Scale subnormal values into the normal range
+    auto is_subnormal = mm_cmp_lt(src, mm_set1<T_RegisterType>(std::numeric_limits<EType>::min()));
+    auto x            = mm_blendv(src, mm_mul(src, set1<T_RegisterType>(two_pow_nm)), is_subnormal);
+    auto e_offset =
+            mm_add(set1<T_RegisterType>(bias), mm_and(is_subnormal, set1<T_RegisterType>(static_cast<F64>(n_m))));
+
+    // Split x = 2^e m with m in [sqrt(2) / 2, sqrt(2)]. The exponent bits are converted to a floating-point value by
+    // inserting them into the mantissa of 2^n_m.
+    auto exp_bits = mm_or(shift_element_bits_right<n_m>(x), set1<T_RegisterType>(two_pow_nm));
+    auto e        = mm_sub(exp_bits, set1<T_RegisterType>(two_pow_nm));
+    auto m        = mm_or(mm_andnot(mm_set1<T_RegisterType>(-std::numeric_limits<EType>::infinity()), x), one);
+
+    auto m_large = mm_cmp_gt(m, set1<T_RegisterType>(std::numbers::sqrt2));
+    m            = mm_blendv(m, mm_mul(m, set1<T_RegisterType>(0.5)), m_large);
+    e            = mm_sub(mm_add(e, mm_and(m_large, one)), e_offset);
+
+    // ln(m) = ln((1 + s) / (1 - s)) with s = (m - 1) / (m + 1)
+    auto s     = mm_div(mm_sub(m, one), mm_add(m, one));
+    auto z     = mm_mul(s, s);
+    auto poly  = evaluate_polynomial(z, log_coefficients<T_RegisterType, t_accuracy>);
+    auto log_m = mm_fmadd(mm_mul(s, z), poly, mm_add(s, s));
+
+    auto result = mm_fmadd(e, set1<T_RegisterType>(ln2_hi), mm_fmadd(e, set1<T_RegisterType>(ln2_lo), log_m));
+
+    // Special values: +inf and NaN are returned unchanged, zeros yield -inf and negative values NaN
+    auto special = mm_blendv(src, mm_set1<T_RegisterType>(-std::numeric_limits<EType>::infinity()),
+                             mm_cmp_eq(src, zero));
+    special      = mm_blendv(special, mm_set1<T_RegisterType>(std::numeric_limits<EType>::quiet_NaN()),
+                             mm_cmp_lt(src, zero));
+    auto regular = mm_and(mm_cmp_gt(src, zero), mm_cmp_lt(src, inf));
+
+    return mm_blendv(special, result, regular);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto rcp(T_RegisterType src) noexcept -> T_RegisterType
+{
+    constexpr bool has_approximation = is_single_precision<T_RegisterType> || is_avx512_register<T_RegisterType>;
+
+    if constexpr (t_accuracy == Accuracy::PRECISE || ! has_approximation)
+        return mm_div(internal::set1<T_RegisterType>(1), src);
+    else
+    {
+        T_RegisterType approx;
+        if constexpr (is_m128<T_RegisterType>)
+            approx = _mm_rcp_ps(src);
+        else if constexpr (is_m256<T_RegisterType>)
+            approx = _mm256_rcp_ps(src);
+        else if constexpr (is_m512<T_RegisterType>)
+            approx = _mm512_maskz_rcp14_ps(internal::mm512_full_mask<__m512>, src);
+        else
+            approx = _mm512_maskz_rcp14_pd(internal::mm512_full_mask<__m512d>, src);
+
+        // y' = y + y (1 - x y). Zeros and infinities yield NaN and keep the approximated result.
+        auto error   = mm_fmadd(negate_all(src), approx, internal::set1<T_RegisterType>(1));
+        auto refined = mm_fmadd(approx, error, approx);
+        return mm_blendv(approx, refined, mm_cmp_eq(refined, refined));
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto rsqrt(T_RegisterType src) noexcept -> T_RegisterType
+{
+    constexpr bool has_approximation = is_single_precision<T_RegisterType> || is_avx512_register<T_RegisterType>;
+
+    if constexpr (t_accuracy == Accuracy::PRECISE || ! has_approximation)
+        return mm_div(internal::set1<T_RegisterType>(1), mm_sqrt(src));
+    else
+    {
+        T_RegisterType approx;
+        if constexpr (is_m128<T_RegisterType>)
+            approx = _mm_rsqrt_ps(src);
+        else if constexpr (is_m256<T_RegisterType>)
+            approx = _mm256_rsqrt_ps(src);
+        else if constexpr (is_m512<T_RegisterType>)
+            approx = _mm512_maskz_rsqrt14_ps(internal::mm512_full_mask<__m512>, src);
+        else
+            approx = _mm512_maskz_rsqrt14_pd(internal::mm512_full_mask<__m512d>, src);
+
+        // y' = y (1.5 - 0.5 x y^2). Zeros and infinities yield NaN and keep the approximated result.
+        auto half_x  = mm_mul(src, internal::set1<T_RegisterType>(-0.5));
+        auto factor  = mm_fmadd(mm_mul(half_x, approx), approx, internal::set1<T_RegisterType>(1.5));
+        auto refined = mm_mul(approx, factor);
+        return mm_blendv(approx, refined, mm_cmp_eq(refined, refined));
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto sin(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return internal::sin_cos<t_accuracy, false>(src);
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy, UST t_n_low, UST t_n_mid, UST t_n_high>
+[[nodiscard]] consteval auto select_coefficients(const std::array<F64, t_n_low>&  low,
+                                                 const std::array<F64, t_n_mid>&  mid,
+                                                 const std::array<F64, t_n_high>& high) noexcept
+{
+    constexpr bool is_sp = is_single_precision<T_RegisterType>;
+
+    if constexpr (is_sp && t_accuracy == Accuracy::FAST)
+        return low;
+    else if constexpr (is_sp || t_accuracy == Accuracy::FAST)
+        return mid;
+    else
+        return high;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_coefficients>
+[[nodiscard]] inline auto evaluate_polynomial(T_RegisterType                               x,
+                                              const std::array<F64, t_num_coefficients>& coefficients) noexcept
+        -> T_RegisterType
+{
+    auto result = set1<T_RegisterType>(std::get<0>(coefficients));
+    for (UST i = 1; i < t_num_coefficients; ++i)
+        result = mm_fmadd(result, x, set1<T_RegisterType>(coefficients.at(i)));
+    return result;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto set1(F64 value) noexcept -> T_RegisterType
+{
+    return mm_set1<T_RegisterType>(static_cast<ElementType<T_RegisterType>>(value));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_count, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto shift_element_bits_left(T_RegisterType src) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(src), t_count));
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(src), t_count));
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(src), t_count));
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(src), t_count));
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_castsi512_ps(
+                _mm512_maskz_slli_epi32(mm512_full_mask<__m512>, _mm512_castps_si512(src), t_count));
+    else
+        return _mm512_castsi512_pd(
+                _mm512_maskz_slli_epi64(mm512_full_mask<__m512d>, _mm512_castpd_si512(src), t_count));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <UST t_count, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto shift_element_bits_right(T_RegisterType src) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_castsi128_ps(_mm_srli_epi32(_mm_castps_si128(src), t_count));
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(src), t_count));
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_castsi256_ps(_mm256_srli_epi32(_mm256_castps_si256(src), t_count));
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(src), t_count));
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_castsi512_ps(
+                _mm512_maskz_srli_epi32(mm512_full_mask<__m512>, _mm512_castps_si512(src), t_count));
+    else
+        return _mm512_castsi512_pd(
+                _mm512_maskz_srli_epi64(mm512_full_mask<__m512d>, _mm512_castpd_si512(src), t_count));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Accuracy t_accuracy, bool t_cosine, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto sin_cos(T_RegisterType src) noexcept -> T_RegisterType
+{
+    using EType = ElementType<T_RegisterType>;
+
+    constexpr bool is_sp       = is_single_precision<T_RegisterType>;
+    constexpr UST  num_bits    = sizeof(EType) * 8;
+    constexpr F64  round_magic = 1.5 * static_cast<F64>(UST{1} << num_mantissa_bits<T_RegisterType>);
+
+    // Three-part representation of pi/2 in the element type
+    constexpr F64 pio2_1 = is_sp ? 1.57079637 : 1.5707963267948966;
+    constexpr F64 pio2_2 = is_sp ? -4.37113883e-08 : 6.123233995736766e-17;
+    constexpr F64 pio2_3 = is_sp ? -1.71512451e-15 : -1.4973849048591698e-33;
+
+    // Sine is odd and cosine even. Reducing |x| avoids losing the sign of negative zeros.
+    const auto sign_mask = set1<T_RegisterType>(-0.0);
+    auto       x         = mm_andnot(sign_mask, src);
+
+    // Reduce to x = k pi/2 + r with |r| <= pi/4. The lowest mantissa bits of `k_magic` contain k as integer.
+    auto k_magic = mm_fmadd(x, set1<T_RegisterType>(2 / std::numbers::pi), set1<T_RegisterType>(round_magic));
+    auto k       = mm_sub(k_magic, set1<T_RegisterType>(round_magic));
+    auto r       = mm_fmadd(k, set1<T_RegisterType>(-pio2_1), x);
+    r            = mm_fmadd(k, set1<T_RegisterType>(-pio2_2), r);
+    r            = mm_fmadd(k, set1<T_RegisterType>(-pio2_3), r);
+
+    auto z     = mm_mul(r, r);
+    auto sin_p = evaluate_polynomial(z, sin_coefficients<T_RegisterType, t_accuracy>);
+    auto cos_p = evaluate_polynomial(z, cos_coefficients<T_RegisterType, t_accuracy>);
+    auto sin_r = mm_fmadd(mm_mul(r, z), sin_p, r);
+    auto cos_r = mm_fmadd(mm_mul(z, z), cos_p, mm_fmadd(z, set1<T_RegisterType>(-0.5), set1<T_RegisterType>(1)));
+
+    // cos(x) = sin(x + pi/2)
+    if constexpr (t_cosine)
+        k_magic = mm_add(k_magic, set1<T_RegisterType>(1));
+
+    // The first bit of the quadrant selects the polynomial and the second one the sign. Both are moved to the sign bit.
+    auto use_cos = shift_element_bits_left<num_bits - 1>(k_magic);
+    auto sign    = mm_and(shift_element_bits_left<num_bits - 2>(k_magic), sign_mask);
+
+    if constexpr (! t_cosine)
+        sign = mm_xor(sign, mm_and(src, sign_mask));
+
+    return mm_xor(mm_blendv(sin_r, cos_r, use_cos), sign);
+}
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
@@ -10,9 +10,13 @@
 
 // === DECLARATIONS ===================================================================================================
 
+#include "mjolnir/core/utility/bit_operations.h"
 #include "mjolnir/core/x86/definitions.h"
 
+#include <array>
 #include <concepts>
+#include <limits>
+#include <type_traits>
 
 namespace mjolnir::x86
 {
@@ -37,6 +41,28 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_add(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Perform an element-wise addition of the integer elements in `lhs` and `rhs` and return the result.
+//!
+//! @details
+//! The addition wraps around on overflow.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Results of the element-wise addition.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_add(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Compute the bitwise AND of `a` and `b`.
 //!
@@ -50,7 +76,7 @@ template <FloatVectorRegister T_RegisterType>
 //!
 //! @return
 //! Result of the bitwise AND operation
-template <FloatVectorRegister T_RegisterType>
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_and(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
 
 
@@ -67,7 +93,7 @@ template <FloatVectorRegister T_RegisterType>
 //!
 //! @return
 //! Result of the bitwise operation `NOT a AND b` per register element
-template <FloatVectorRegister T_RegisterType>
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_andnot(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
 
 
@@ -76,7 +102,8 @@ template <FloatVectorRegister T_RegisterType>
 //!
 //! @tparam t_mask
 //! An integer value used as control mask. Consult the intel intrinsics guide for further information. Note that this
-//! library provides template functions in `permute.h` to apply the correct mask for each use-case.
+//! library provides template functions in `permute.h` to apply the correct mask for each use-case. For AVX-512
+//! registers, the value is used as mask register for a masked blend.
 //! @tparam T_RegisterType
 //! The register type
 //!
@@ -91,6 +118,90 @@ template <I32 t_mask, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_blend(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Blend the 16 bit elements from `a` and `b` using a control mask and return the resulting vector register.
+//!
+//! @details
+//! For 256 bit registers, the mask is applied to both lanes.
+//!
+//! @tparam t_mask
+//! An 8 bit integer value used as control mask. A set bit selects the element from `b`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] a:
+//! First register
+//! @param [in] b:
+//! Second register
+//!
+//! @return
+//! Register with the blended values
+template <I32 t_mask, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blend_epi16(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Blend the 32 bit elements from `a` and `b` using a control mask and return the resulting vector register.
+//!
+//! @tparam t_mask
+//! An integer value used as control mask. A set bit selects the element from `b`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] a:
+//! First register
+//! @param [in] b:
+//! Second register
+//!
+//! @return
+//! Register with the blended values
+template <I32 t_mask, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blend_epi32(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Blend the elements from `a` and `b` using a mask register and return the resulting vector register.
+//!
+//! @details
+//! Only the sign bits of the mask elements are evaluated. The results of the `mm_cmp_*` functions can be used directly
+//! as mask. AVX-512 has no corresponding instruction. It is emulated with a mask blend.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] a:
+//! First register
+//! @param [in] b:
+//! Second register
+//! @param [in] mask:
+//! Mask register. If the sign bit of an element is set, the element is taken from `b` and from `a` otherwise.
+//!
+//! @return
+//! Register with the blended values
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blendv(T_RegisterType a, T_RegisterType b, T_RegisterType mask) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Blend the bytes from `a` and `b` using a mask register and return the resulting vector register.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] a:
+//! First register
+//! @param [in] b:
+//! Second register
+//! @param [in] mask:
+//! Mask register. If the highest bit of a byte is set, the byte is taken from `b` and from `a` otherwise.
+//!
+//! @return
+//! Register with the blended values
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blendv_epi8(T_RegisterType a, T_RegisterType b, T_RegisterType mask) noexcept
+        -> T_RegisterType;
+
+
 //! @brief
 //! Broadcasts the lowest floating point element across lanes to all elements of the returned register.
 //!
@@ -168,6 +279,29 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_cmp_eq(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Compare the integer elements in `lhs` and `rhs` for equality and return the result.
+//!
+//! @details
+//! If a comparison is false, the corresponding element of the returned register is `0`. Otherwise, all bits of the
+//! element are set. Unsigned element types are compared as unsigned integers.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the comparison results. See detailed description.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_eq(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Compare element-wise if the register elements of `lhs` are greater equal than the ones in `rhs`.
 //!
@@ -189,6 +323,29 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_cmp_ge(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Compare element-wise if the integer elements of `lhs` are greater equal than the ones in `rhs`.
+//!
+//! @details
+//! If a comparison is false, the corresponding element of the returned register is `0`. Otherwise, all bits of the
+//! element are set. Unsigned element types are compared as unsigned integers.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the comparison results. See detailed description.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_ge(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Compare element-wise if the register elements of `lhs` are greater than the ones in `rhs`.
 //!
@@ -210,6 +367,29 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_cmp_gt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Compare element-wise if the integer elements of `lhs` are greater than the ones in `rhs`.
+//!
+//! @details
+//! If a comparison is false, the corresponding element of the returned register is `0`. Otherwise, all bits of the
+//! element are set. Unsigned element types are compared as unsigned integers.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the comparison results. See detailed description.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_gt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Compare element-wise if the register elements of `lhs` are less equal than the ones in `rhs`.
 //!
@@ -231,6 +411,29 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_cmp_le(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Compare element-wise if the integer elements of `lhs` are less equal than the ones in `rhs`.
+//!
+//! @details
+//! If a comparison is false, the corresponding element of the returned register is `0`. Otherwise, all bits of the
+//! element are set. Unsigned element types are compared as unsigned integers.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the comparison results. See detailed description.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_le(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Compare element-wise if the register elements of `lhs` are less than the ones in `rhs`.
 //!
@@ -252,6 +455,29 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_cmp_lt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Compare element-wise if the integer elements of `lhs` are less than the ones in `rhs`.
+//!
+//! @details
+//! If a comparison is false, the corresponding element of the returned register is `0`. Otherwise, all bits of the
+//! element are set. Unsigned element types are compared as unsigned integers.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the comparison results. See detailed description.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_lt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Return the first element of `src`.
 //!
@@ -267,6 +493,23 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_cvt_float(T_RegisterType src) -> ElementType<T_RegisterType>;
 
 
+//! @brief
+//! Perform an element-wise division of `lhs` by `rhs` and return the result.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Results of the element-wise division.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_div(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Perform an element-wise multiplication of `a` and `b`, add `c` and return the result.
 //!
@@ -306,132 +549,426 @@ template <FloatVectorRegister T_RegisterType>
 
 
 //! @brief
-//! Load data from an aligned memory location into a new register.
+//! Load the values at the positions `base[indices[i]]` into the elements of a new register.
 //!
 //! @tparam T_RegisterType:
 //! The register type
 //!
-//! @param [in] ptr:
-//! Correctly aligned pointer to the memory location
+//! @param [in] base:
+//! Pointer to the memory location that the indices refer to. It doesn't need to be aligned.
+//! @param [in] indices:
+//! Register with one signed 32 bit index per register element. The indices are given in units of elements and not
+//! in bytes. For `__m128d`, only the lower two indices are used.
 //!
 //! @return
-//! New register with loaded data
+//! New register with the gathered values
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_load(ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType;
+[[nodiscard]] inline auto mm_i32gather(const ElementType<T_RegisterType>* base,
+                                       IndexRegisterType<T_RegisterType> indices) noexcept -> T_RegisterType;
 
 
 //! @brief
-//! Create mask from the most significant bit of each 8-bit element in `src`, and return the result as unsigned integer.
+//! Store the elements of a register at the positions `base[indices[i]]`.
 //!
 //! @details
-//! For SSE registers a 16 bit integer is returned. For AVX registers a 32 bit integer is returned.
+//! Only AVX-512 provides a scatter instruction. For all other registers, the elements are stored one by one. If
+//! multiple indices are identical, the element with the highest index in the register is the one that remains in
+//! memory.
 //!
 //! @tparam T_RegisterType:
 //! The register type
 //!
+//! @param [in, out] base:
+//! Pointer to the memory location that the indices refer to. It doesn't need to be aligned.
+//! @param [in] indices:
+//! Register with one signed 32 bit index per register element. The indices are given in units of elements and not
+//! in bytes. For `__m128d`, only the lower two indices are used.
 //! @param [in] src:
-//! The source register
-//!
-//! @return
-//! The created mask
-template <IntegerVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_movemask_epi8(T_RegisterType src) noexcept;
+//! The register that should be stored
+template <FloatVectorRegister T_RegisterType>
+inline void mm_i32scatter(ElementType<T_RegisterType>*      base,
+                          IndexRegisterType<T_RegisterType> indices,
+                          T_RegisterType                    src) noexcept;
 
 
 //! @brief
-//! Perform an element-wise multiplication of `lhs` and `rhs` and return the result.
+//! Load data from an aligned memory location into a new register.
 //!
 //! @tparam T_RegisterType:
 //! The register type
 //!
-//! @param[in] lhs:
-//! The register left of the operator
-//! @param[in] rhs:
-//! The register right of the operator
+//! @param [in] ptr:
+//! Correctly aligned pointer to the memory location
 //!
 //! @return
-//! Results of the element-wise multiplication.
+//! New register with loaded data
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_mul(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+[[nodiscard]] inline auto mm_load(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType;
 
 
 //! @brief
-//! Compute the bitwise OR of `a` and `b`.
+//! Load the first `num_values` elements of a register from memory and set the remaining ones to zero.
+//!
+//! @details
+//! Memory beyond the first `num_values` elements isn't accessed. Therefore, this function can be used to process
+//! the remainder of an array whose length isn't a multiple of the number of register elements.
 //!
 //! @tparam T_RegisterType:
 //! The register type
 //!
-//! @param [in] a:
-//! First register
-//! @param [in] b:
-//! Second register
+//! @param [in] ptr:
+//! Pointer to the memory location. It doesn't need to be aligned.
+//! @param [in] num_values:
+//! Number of values that should be loaded. It must not exceed the number of register elements.
 //!
 //! @return
-//! Result of the bitwise OR operation
+//! New register with loaded data
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_or(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
+[[nodiscard]] inline auto mm_load_partial(const ElementType<T_RegisterType>* ptr, UST num_values) noexcept
+        -> T_RegisterType;
 
 
 //! @brief
-//! Shuffle the elements in `src` using the control mask `t_mask` and return the resulting vector register.
+//! Load data from a memory location that doesn't need to be aligned into a new register.
 //!
-//! @tparam t_mask
-//! An integer value used as control mask. Consult the intel intrinsics guide for further information. Note that
-//! this library provides template functions in `permute.h` to apply the correct mask for each use-case.
-//! @tparam T_RegisterType
+//! @tparam T_RegisterType:
 //! The register type
 //!
-//! @param [in] src:
-//! Source register
+//! @param [in] ptr:
+//! Pointer to the memory location
 //!
 //! @return
-//! Register with shuffled values
-template <I32 t_mask, FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_permute(T_RegisterType src) noexcept -> T_RegisterType;
+//! New register with loaded data
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_loadu(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType;
 
 
 //! @brief
-//! Shuffle 128-bits lanes selected by `t_mask` from `a` and `b`, and return the results in a new register.
+//! Load integers from a memory location that doesn't need to be aligned into a new register.
 //!
-//! @tparam t_mask
-//! An integer value used as control mask. Consult the intel intrinsics guide for further information. Note that this
-//! library provides template functions in `permute.h` to apply the correct mask for each use-case.
-//! @tparam T_RegisterType
+//! @tparam T_RegisterType:
 //! The register type
+//! @tparam T_ElementType:
+//! The integer type of the register elements
 //!
-//!
-//! @param [in] a:
-//! First register
-//! @param [in] b:
-//! Second register
+//! @param [in] ptr:
+//! Pointer to the memory location
 //!
 //! @return
-//! Register with permuted 128 bit lanes values
-template <I32 t_mask, FloatAVXRegister T_RegisterType>
-[[nodiscard]] inline auto mm_permute2f128(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
+//! New register with loaded data
+template <IntegerSSEAVXRegister T_RegisterType, IntegerRegisterElement T_ElementType>
+[[nodiscard]] inline auto mm_loadu(const T_ElementType* ptr) noexcept -> T_RegisterType;
 
 
 //! @brief
-//! Broadcast a single value a to all elements of the register
+//! Load all elements from memory whose corresponding element in `mask` has the most significant bit set. The other
+//! elements are set to zero.
+//!
+//! @details
+//! Masked out elements are not accessed and can't cause memory faults. The results of the comparison functions can
+//! be used directly as mask.
 //!
 //! @tparam T_RegisterType:
 //! The register type
 //!
-//! @param [in] value:
-//! The value that should be broadcasted
+//! @param [in] ptr:
+//! Pointer to the memory location. It doesn't need to be aligned.
+//! @param [in] mask:
+//! Register that selects the elements that should be loaded
 //!
 //! @return
-//! Register with broadcasted value
+//! New register with loaded data
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_set1(ElementType<T_RegisterType> value) noexcept -> T_RegisterType;
+[[nodiscard]] inline auto mm_maskload(const ElementType<T_RegisterType>* ptr, T_RegisterType mask) noexcept
+        -> T_RegisterType;
 
 
 //! @brief
-//! Set register elements with the supplied values in reverse order.
+//! Store all elements of `src` whose corresponding element in `mask` has the most significant bit set.
+//!
+//! @details
+//! The memory of masked out elements is not accessed and can't cause memory faults. The results of the comparison
+//! functions can be used directly as mask.
 //!
 //! @tparam T_RegisterType:
 //! The register type
-//! @tparam T_Args
+//!
+//! @param [in, out] ptr:
+//! Pointer to the memory location. It doesn't need to be aligned.
+//! @param [in] mask:
+//! Register that selects the elements that should be stored
+//! @param [in] src:
+//! The register that should be stored
+template <FloatVectorRegister T_RegisterType>
+inline void mm_maskstore(ElementType<T_RegisterType>* ptr, T_RegisterType mask, T_RegisterType src) noexcept;
+
+
+//! @brief
+//! Return a register that contains the element-wise maximum of `lhs` and `rhs`.
+//!
+//! @details
+//! Like the underlying intrinsics, the element of `rhs` is returned if one of the compared elements is NaN.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the element-wise maximum
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_max(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Return a register that contains the element-wise maximum of the integer elements in `lhs` and `rhs`.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the element-wise maximum
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_max(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Return a register that contains the element-wise minimum of `lhs` and `rhs`.
+//!
+//! @details
+//! Like the underlying intrinsics, the element of `rhs` is returned if one of the compared elements is NaN.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the element-wise minimum
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_min(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Return a register that contains the element-wise minimum of the integer elements in `lhs` and `rhs`.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the element-wise minimum
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_min(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Create mask from the most significant bit of each element in `src`, and return the result as unsigned integer.
+//!
+//! @details
+//! Bit `i` of the result corresponds to element `i` of `src`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! The source register
+//!
+//! @return
+//! The created mask
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_movemask(T_RegisterType src) noexcept -> U32;
+
+
+//! @brief
+//! Create mask from the most significant bit of each 8-bit element in `src`, and return the result as unsigned integer.
+//!
+//! @details
+//! For SSE registers a 16 bit integer is returned. For AVX registers a 32 bit integer is returned. For AVX-512
+//! registers a 64 bit integer is returned.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! The source register
+//!
+//! @return
+//! The created mask
+template <IntegerVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_movemask_epi8(T_RegisterType src) noexcept;
+
+
+//! @brief
+//! Perform an element-wise multiplication of `lhs` and `rhs` and return the result.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Results of the element-wise multiplication.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_mul(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Multiply the lower unsigned 32 bits of each 64 bit element in `lhs` and `rhs` and return the 64 bit results.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Register with the 64 bit products
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_mul_epu32(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Multiply the integer elements in `lhs` and `rhs` element-wise and return the lower halves of the results.
+//!
+//! @details
+//! The lower half of a product is identical for signed and unsigned integers. There are no native instructions for
+//! 8 and 64 bit elements. They are emulated with multiple instructions.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Lower halves of the element-wise products
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_mullo(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Compute the bitwise OR of `a` and `b`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] a:
+//! First register
+//! @param [in] b:
+//! Second register
+//!
+//! @return
+//! Result of the bitwise OR operation
+template <VectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_or(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shuffle the elements in `src` using the control mask `t_mask` and return the resulting vector register.
+//!
+//! @tparam t_mask
+//! An integer value used as control mask. Consult the intel intrinsics guide for further information. Note that
+//! this library provides template functions in `permute.h` to apply the correct mask for each use-case.
+//! @tparam T_RegisterType
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//!
+//! @return
+//! Register with shuffled values
+template <I32 t_mask, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_permute(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shuffle 128-bits lanes selected by `t_mask` from `a` and `b`, and return the results in a new register.
+//!
+//! @tparam t_mask
+//! An integer value used as control mask. Consult the intel intrinsics guide for further information. Note that this
+//! library provides template functions in `permute.h` to apply the correct mask for each use-case.
+//! @tparam T_RegisterType
+//! The register type
+//!
+//!
+//! @param [in] a:
+//! First register
+//! @param [in] b:
+//! Second register
+//!
+//! @return
+//! Register with permuted 128 bit lanes values
+template <I32 t_mask, FloatAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_permute2f128(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Broadcast a single value a to all elements of the register
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] value:
+//! The value that should be broadcasted
+//!
+//! @return
+//! Register with broadcasted value
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_set1(ElementType<T_RegisterType> value) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Broadcast a single integer value to all elements of the register
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] value:
+//! The value that should be broadcasted
+//!
+//! @return
+//! Register with broadcasted value
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_set1(T_ElementType value) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Set register elements with the supplied values in reverse order.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//! @tparam T_Args
 //! Parameter pack that holds the values
 //!
 //! @param args
@@ -443,6 +980,25 @@ template <FloatVectorRegister T_RegisterType, typename... T_Args>
 [[nodiscard]] inline auto mm_setr(T_Args... args) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Set the integer register elements with the supplied values in reverse order.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//! @tparam T_Args
+//! Parameter pack that holds the values
+//!
+//! @param args
+//! Values of the parameter pack. They are converted to `T_ElementType`
+//!
+//! @return
+//! Register that contains the provided values
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType, typename... T_Args>
+[[nodiscard]] inline auto mm_setr(T_Args... args) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Return a vector register with all elements set to zero.
 //!
@@ -451,7 +1007,7 @@ template <FloatVectorRegister T_RegisterType, typename... T_Args>
 //!
 //! @return
 //! Vector register with all elements set to zero
-template <FloatVectorRegister T_RegisterType>
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_setzero() noexcept -> T_RegisterType;
 
 
@@ -475,6 +1031,174 @@ template <UST t_mask, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_shuffle(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Shuffle the bytes of `src` within each 128 bit lane using the control bytes in `control`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//! @param [in] control:
+//! Register with the control bytes. The lower 4 bits of each byte select the source byte from the same lane. If the
+//! highest bit is set, the byte is set to zero instead.
+//!
+//! @return
+//! Register with the shuffled bytes
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_shuffle_epi8(T_RegisterType src, T_RegisterType control) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shuffle the 32 bit elements of `src` within each 128 bit lane using a control mask.
+//!
+//! @tparam t_mask
+//! An integer value used as control mask. Consult the intel intrinsics guide for further information. Note that this
+//! library provides template functions in `permute.h` to apply the correct mask for each use-case.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//!
+//! @return
+//! Register with the shuffled elements
+template <I32 t_mask, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_shuffle_epi32(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shift the integer elements of `src` left by `t_count` bits while shifting in zeros.
+//!
+//! @details
+//! There is no native instruction for 8 bit elements. It is emulated with a 16 bit shift and a mask.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_count:
+//! Number of bits that the elements are shifted. It must be smaller than the number of bits of `T_ElementType`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//!
+//! @return
+//! Register with the shifted elements
+template <IntegerRegisterElement T_ElementType, UST t_count, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_slli(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shift each integer element of `src` left by the number of bits in the corresponding element of `counts`.
+//!
+//! @details
+//! Only 32 and 64 bit elements are supported. Elements with a count that is larger than or equal to the number of
+//! element bits are set to zero.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//! @param [in] counts:
+//! Register with the shift counts of each element
+//!
+//! @return
+//! Register with the shifted elements
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_sllv(T_RegisterType src, T_RegisterType counts) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Calculate the element-wise square root of `src` and return the result.
+//!
+//! @details
+//! The results are correctly rounded.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//!
+//! @return
+//! Register with the square roots
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_sqrt(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shift the integer elements of `src` right by `t_count` bits while shifting in sign bits.
+//!
+//! @details
+//! The element type determines only the element size. The elements are always treated as signed integers. There are
+//! no native instructions for 8 and 64 bit elements. They are emulated with multiple instructions.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_count:
+//! Number of bits that the elements are shifted. It must be smaller than the number of bits of `T_ElementType`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//!
+//! @return
+//! Register with the shifted elements
+template <IntegerRegisterElement T_ElementType, UST t_count, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_srai(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shift the integer elements of `src` right by `t_count` bits while shifting in zeros.
+//!
+//! @details
+//! There is no native instruction for 8 bit elements. It is emulated with a 16 bit shift and a mask.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_count:
+//! Number of bits that the elements are shifted. It must be smaller than the number of bits of `T_ElementType`.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//!
+//! @return
+//! Register with the shifted elements
+template <IntegerRegisterElement T_ElementType, UST t_count, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_srli(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Shift each integer element of `src` right by the number of bits in the corresponding element of `counts` while
+//! shifting in zeros.
+//!
+//! @details
+//! Only 32 and 64 bit elements are supported. Elements with a count that is larger than or equal to the number of
+//! element bits are set to zero.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in] src:
+//! Source register
+//! @param [in] counts:
+//! Register with the shift counts of each element
+//!
+//! @return
+//! Register with the shifted elements
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_srlv(T_RegisterType src, T_RegisterType counts) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Store the content of a register to a memory address
 //!
@@ -489,6 +1213,73 @@ template <FloatVectorRegister T_RegisterType>
 inline void mm_store(ElementType<T_RegisterType>* ptr, T_RegisterType reg) noexcept;
 
 
+//! @brief
+//! Store the first `num_values` elements of a register in memory.
+//!
+//! @details
+//! Memory beyond the first `num_values` elements isn't accessed.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in, out] ptr:
+//! Pointer to the memory where the elements should be stored. It doesn't need to be aligned.
+//! @param [in] src:
+//! The register that should be stored
+//! @param [in] num_values:
+//! Number of values that should be stored. It must not exceed the number of register elements.
+template <FloatVectorRegister T_RegisterType>
+inline void mm_store_partial(ElementType<T_RegisterType>* ptr, T_RegisterType src, UST num_values) noexcept;
+
+
+//! @brief
+//! Store the content of a register to a memory address that doesn't need to be aligned.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in, out] ptr:
+//! Pointer to the memory where the content should be stored
+//! @param [in] reg:
+//! The register that should be stored
+template <FloatVectorRegister T_RegisterType>
+inline void mm_storeu(ElementType<T_RegisterType>* ptr, T_RegisterType reg) noexcept;
+
+
+//! @brief
+//! Store the content of an integer register to a memory address that doesn't need to be aligned.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in, out] ptr:
+//! Pointer to the memory where the content should be stored
+//! @param [in] reg:
+//! The register that should be stored
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+inline void mm_storeu(T_ElementType* ptr, T_RegisterType reg) noexcept;
+
+
+//! @brief
+//! Store the content of a register to a memory address using a non-temporal hint.
+//!
+//! @details
+//! The data bypasses the caches, which avoids evicting other data when large arrays are written that won't be read
+//! again soon. Non-temporal stores are weakly ordered. Call `_mm_sfence` before the data is read by another thread.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param [in, out] ptr:
+//! Correctly aligned pointer to the memory where the content should be stored
+//! @param [in] reg:
+//! The register that should be stored
+template <FloatVectorRegister T_RegisterType>
+inline void mm_stream(ElementType<T_RegisterType>* ptr, T_RegisterType reg) noexcept;
+
+
 //! @brief
 //! Subtract `rhs` element-wise from `rhs` and return the result.
 //!
@@ -506,6 +1297,28 @@ template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_sub(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Subtract the integer elements of `rhs` element-wise from the ones of `lhs` and return the result.
+//!
+//! @details
+//! The subtraction wraps around on overflow.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! The register left of the operator
+//! @param[in] rhs:
+//! The register right of the operator
+//!
+//! @return
+//! Results of the element-wise subtraction.
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_sub(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Compute the bitwise XOR of `a` and `b`.
 //!
@@ -519,10 +1332,52 @@ template <FloatVectorRegister T_RegisterType>
 //!
 //! @return
 //! Result of the bitwise XOR operation
-template <FloatVectorRegister T_RegisterType>
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_xor(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType;
 
 
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Compare two AVX-512 registers with the given predicate and expand the resulting mask register into a register
+//! that has all bits of an element set if the comparison is `true`.
+template <I32 t_predicate, FloatAVX512Register T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_avx512(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType;
+
+//! Mask register value that selects all elements of an AVX-512 register. Zero-masking intrinsics with this mask are
+//! used instead of the unmasked versions if the latter trigger false `-Wmaybe-uninitialized` warnings in GCC 12,
+//! which are caused by the use of `_mm512_undefined_*` inside the intrinsics.
+template <FloatAVX512Register T_RegisterType>
+inline constexpr auto mm512_full_mask =
+        static_cast<std::conditional_t<is_m512<T_RegisterType>, __mmask16, __mmask8>>(~0U);
+
+//! Return an AVX-512 mask register that has the bits set whose corresponding elements in `mask` have the most
+//! significant bit set.
+template <FloatAVX512Register T_RegisterType>
+[[nodiscard]] inline auto mm512_sign_bit_mask(T_RegisterType mask) noexcept;
+
+//! Return a mask register for `mm_maskload` and `mm_maskstore` that selects the first `num_values` elements.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_partial_mask(UST num_values) noexcept -> T_RegisterType;
+
+//! Mask register value that selects all elements of the extraction intrinsics. The unmasked extraction intrinsics and
+//! the casts to smaller registers are affected by the same GCC 12 warnings as mentioned above.
+inline constexpr __mmask8 mm512_lane_mask = 0xF;
+
+//! Create an AVX-512 register from an array of values in reverse order. For `__m512i`, the element type selects
+//! between 32 and 64 bit elements. This function is necessary since GCC implements the `_mm512_setr_*` intrinsics as
+//! macros that can't be used with parameter pack expansions.
+template <AVX512Register T_RegisterType, typename T_ElementType, UST t_num_elements>
+[[nodiscard]] inline auto mm512_setr(const std::array<T_ElementType, t_num_elements>& values) noexcept
+        -> T_RegisterType;
+
+
+} // namespace internal
+//! \endcond
+
+
 //! @}
 } // namespace mjolnir::x86
 
@@ -532,73 +1387,186 @@ template <FloatVectorRegister T_RegisterType>
 #include "mjolnir/core/utility/pointer_operations.h"
 #include "mjolnir/core/x86/x86.h"
 
+#include <bit>
 #include <cassert>
 #include <utility>
 
 
-namespace mjolnir::x86
-{
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_add(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_add_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_add_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_add_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_add_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_add_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else
+        return _mm512_add_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_add(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm_add_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_add_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_add_epi32(lhs, rhs);
+        else
+            return _mm_add_epi64(lhs, rhs);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm256_add_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_add_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_add_epi32(lhs, rhs);
+        else
+            return _mm256_add_epi64(lhs, rhs);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_and(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_and_ps(a, b);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_and_pd(a, b);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_and_ps(a, b);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_and_pd(a, b);
+    else if constexpr (is_m128i<T_RegisterType>)
+        return _mm_and_si128(a, b);
+    else if constexpr (is_m256i<T_RegisterType>)
+        return _mm256_and_si256(a, b);
+    else if constexpr (is_m512i<T_RegisterType>)
+        return _mm512_and_si512(a, b);
+    else
+        return mm_cast_if<T_RegisterType>(_mm512_and_si512(mm_cast_fi(a), mm_cast_fi(b)));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_andnot(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_andnot_ps(a, b);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_andnot_pd(a, b);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_andnot_ps(a, b);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_andnot_pd(a, b);
+    else if constexpr (is_m128i<T_RegisterType>)
+        return _mm_andnot_si128(a, b);
+    else if constexpr (is_m256i<T_RegisterType>)
+        return _mm256_andnot_si256(a, b);
+    else if constexpr (is_m512i<T_RegisterType>)
+        return _mm512_maskz_andnot_epi32(internal::mm512_full_mask<__m512>, a, b);
+    else
+        return mm_cast_if<T_RegisterType>(
+                _mm512_maskz_andnot_epi32(internal::mm512_full_mask<__m512>, mm_cast_fi(a), mm_cast_fi(b)));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <I32 t_mask, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blend(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_blend_ps(a, b, t_mask);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_blend_pd(a, b, t_mask);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_blend_ps(a, b, t_mask);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_blend_pd(a, b, t_mask);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_mask_blend_ps(static_cast<__mmask16>(t_mask), a, b);
+    else
+        return _mm512_mask_blend_pd(static_cast<__mmask8>(t_mask), a, b);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_add(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+template <I32 t_mask, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blend_epi16(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
 {
-    if constexpr (is_m128<T_RegisterType>)
-        return _mm_add_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
-    else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_add_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
-    else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_add_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_blend_epi16(a, b, t_mask);
     else
-        return _mm256_add_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+        return _mm256_blend_epi16(a, b, t_mask);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_and(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
+template <I32 t_mask, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blend_epi32(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
 {
-    if constexpr (is_m128<T_RegisterType>)
-        return _mm_and_ps(a, b);
-    else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_and_pd(a, b);
-    else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_and_ps(a, b);
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_blend_epi32(a, b, t_mask);
     else
-        return _mm256_and_pd(a, b);
+        return _mm256_blend_epi32(a, b, t_mask);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_andnot(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
+[[nodiscard]] inline auto mm_blendv(T_RegisterType a, T_RegisterType b, T_RegisterType mask) noexcept -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
-        return _mm_andnot_ps(a, b);
+        return _mm_blendv_ps(a, b, mask);
     else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_andnot_pd(a, b);
+        return _mm_blendv_pd(a, b, mask);
     else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_andnot_ps(a, b);
+        return _mm256_blendv_ps(a, b, mask);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_blendv_pd(a, b, mask);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_mask_blend_ps(internal::mm512_sign_bit_mask(mask), a, b);
     else
-        return _mm256_andnot_pd(a, b);
+        return _mm512_mask_blend_pd(internal::mm512_sign_bit_mask(mask), a, b);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <I32 t_mask, FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_blend(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_blendv_epi8(T_RegisterType a, T_RegisterType b, T_RegisterType mask) noexcept
+        -> T_RegisterType
 {
-    if constexpr (is_m128<T_RegisterType>)
-        return _mm_blend_ps(a, b, t_mask);
-    else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_blend_pd(a, b, t_mask);
-    else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_blend_ps(a, b, t_mask);
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_blendv_epi8(a, b, mask);
     else
-        return _mm256_blend_pd(a, b, t_mask);
+        return _mm256_blendv_epi8(a, b, mask);
 }
 
 
@@ -616,8 +1584,18 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_movedup_pd(src);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_broadcastss_ps(_mm256_castps256_ps128(src));
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_broadcastsd_pd(_mm256_castpd256_pd128(src));
+    else if constexpr (is_m512<T_RegisterType>)
+    {
+        const __m128 lower = _mm512_maskz_extractf32x4_ps(internal::mm512_lane_mask, src, 0);
+        return _mm512_maskz_broadcastss_ps(internal::mm512_full_mask<T_RegisterType>, lower);
+    }
+    else
+    {
+        const __m128 lower = _mm512_maskz_extractf32x4_ps(internal::mm512_lane_mask, _mm512_castpd_ps(src), 0);
+        return _mm512_maskz_broadcastsd_pd(internal::mm512_full_mask<T_RegisterType>, _mm_castps_pd(lower));
+    }
 }
 
 
@@ -632,8 +1610,12 @@ template <FloatVectorRegister T_RegisterTypeIn>
         return _mm_castpd_si128(src);
     else if constexpr (is_m256<T_RegisterTypeIn>)
         return _mm256_castps_si256(src);
-    else
+    else if constexpr (is_m256d<T_RegisterTypeIn>)
         return _mm256_castpd_si256(src);
+    else if constexpr (is_m512<T_RegisterTypeIn>)
+        return _mm512_castps_si512(src);
+    else
+        return _mm512_castpd_si512(src);
 }
 
 
@@ -648,8 +1630,12 @@ template <FloatVectorRegister T_RegisterTypeOut, IntegerVectorRegister T_Registe
         return _mm_castsi128_pd(src);
     else if constexpr (is_m256<T_RegisterTypeOut>)
         return _mm256_castsi256_ps(src);
-    else
+    else if constexpr (is_m256d<T_RegisterTypeOut>)
         return _mm256_castsi256_pd(src);
+    else if constexpr (is_m512<T_RegisterTypeOut>)
+        return _mm512_castsi512_ps(src);
+    else
+        return _mm512_castsi512_pd(src);
 }
 
 
@@ -664,8 +1650,40 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_cmpeq_pd(lhs, rhs);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OS);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OS);
+    else
+        return internal::mm_cmp_avx512<_CMP_EQ_OS>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_eq(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm_cmpeq_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_cmpeq_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_cmpeq_epi32(lhs, rhs);
+        else
+            return _mm_cmpeq_epi64(lhs, rhs);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        else
+            return _mm256_cmpeq_epi64(lhs, rhs);
+    }
 }
 
 
@@ -680,122 +1698,514 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_cmpge_pd(lhs, rhs);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OS);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OS);
+    else
+        return internal::mm_cmp_avx512<_CMP_GE_OS>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_ge(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    return mm_andnot(mm_cmp_gt<T_ElementType>(rhs, lhs), mm_set1<I8, T_RegisterType>(-1));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_gt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_cmpgt_ps(lhs, rhs);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_cmpgt_pd(lhs, rhs);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OS);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OS);
+    else
+        return internal::mm_cmp_avx512<_CMP_GT_OS>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_gt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (std::is_unsigned_v<T_ElementType>)
+    {
+        // Flipping the sign bits maps the unsigned order onto the signed one
+        using SignedType = std::make_signed_t<T_ElementType>;
+
+        const auto sign_bits = mm_set1<SignedType, T_RegisterType>(std::numeric_limits<SignedType>::min());
+        return mm_cmp_gt<SignedType>(mm_xor(lhs, sign_bits), mm_xor(rhs, sign_bits));
+    }
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm_cmpgt_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_cmpgt_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_cmpgt_epi32(lhs, rhs);
+        else
+            return _mm_cmpgt_epi64(lhs, rhs);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm256_cmpgt_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_cmpgt_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_cmpgt_epi32(lhs, rhs);
+        else
+            return _mm256_cmpgt_epi64(lhs, rhs);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_le(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_cmple_ps(lhs, rhs);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_cmple_pd(lhs, rhs);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OS);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OS);
+    else
+        return internal::mm_cmp_avx512<_CMP_LE_OS>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_le(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    return mm_andnot(mm_cmp_gt<T_ElementType>(lhs, rhs), mm_set1<I8, T_RegisterType>(-1));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_lt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_cmplt_ps(lhs, rhs);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_cmplt_pd(lhs, rhs);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OS);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OS);
+    else
+        return internal::mm_cmp_avx512<_CMP_LT_OS>(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_lt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    return mm_cmp_gt<T_ElementType>(rhs, lhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_cvt_float(T_RegisterType src) -> ElementType<T_RegisterType>
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_cvtss_f32(src);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_cvtsd_f64(src);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_cvtss_f32(src);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_cvtsd_f64(src);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_cvtss_f32(src);
+    else
+        return _mm512_cvtsd_f64(src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_div(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_div_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_div_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_div_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_div_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_div_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else
+        return _mm512_div_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_fmadd(T_RegisterType a, T_RegisterType b, T_RegisterType c) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_fmadd_ps(a, b, c);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_fmadd_pd(a, b, c);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_fmadd_ps(a, b, c);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_fmadd_pd(a, b, c);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_fmadd_ps(a, b, c);
+    else
+        return _mm512_fmadd_pd(a, b, c);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_fmsub(T_RegisterType a, T_RegisterType b, T_RegisterType c) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_fmsub_ps(a, b, c);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_fmsub_pd(a, b, c);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_fmsub_ps(a, b, c);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_fmsub_pd(a, b, c);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_fmsub_ps(a, b, c);
+    else
+        return _mm512_fmsub_pd(a, b, c);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_i32gather(const ElementType<T_RegisterType>* base,
+                                       IndexRegisterType<T_RegisterType> indices) noexcept -> T_RegisterType
+{
+    constexpr I32 scale = sizeof(ElementType<T_RegisterType>);
+
+    // The masked versions with a full mask are used since the unmasked ones trigger false `-Wuninitialized` warnings
+    // in GCC 12
+    const auto zero = mm_setzero<T_RegisterType>();
+    const auto mask = mm_cmp_eq(zero, zero);
+
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_mask_i32gather_ps(zero, base, indices, mask, scale);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_mask_i32gather_pd(zero, base, indices, mask, scale);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_mask_i32gather_ps(zero, base, indices, mask, scale);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_mask_i32gather_pd(zero, base, indices, mask, scale);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_mask_i32gather_ps(
+                _mm512_setzero_ps(), internal::mm512_full_mask<T_RegisterType>, indices, base, scale);
+    else
+        return _mm512_mask_i32gather_pd(
+                _mm512_setzero_pd(), internal::mm512_full_mask<T_RegisterType>, indices, base, scale);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+inline void mm_i32scatter(ElementType<T_RegisterType>*      base,
+                          IndexRegisterType<T_RegisterType> indices,
+                          T_RegisterType                    src) noexcept
+{
+    constexpr I32 scale = sizeof(ElementType<T_RegisterType>);
+
+    if constexpr (is_m512<T_RegisterType>)
+        _mm512_i32scatter_ps(base, indices, src, scale);
+    else if constexpr (is_m512d<T_RegisterType>)
+        _mm512_i32scatter_pd(base, indices, src, scale);
+    else
+    {
+        VectorDataArray<T_RegisterType> values = {};
+        mm_store(values.data(), src);
+
+        const auto idx = std::bit_cast<std::array<I32, sizeof(indices) / sizeof(I32)>>(indices);
+        for (UST i = 0; i < values.size(); ++i)
+            base[idx[i]] = values[i]; // NOLINT - pointer arithmetic and array index
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_load(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType
+{
+    assert(is_aligned<alignment_bytes<T_RegisterType>>(ptr)); // NOLINT
+
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_load_ps(ptr);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_load_pd(ptr);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_load_ps(ptr);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_load_pd(ptr);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_load_ps(ptr);
+    else
+        return _mm512_load_pd(ptr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_load_partial(const ElementType<T_RegisterType>* ptr, UST num_values) noexcept
+        -> T_RegisterType
+{
+    assert(num_values <= num_elements<T_RegisterType> && "Number of values exceeds the register size."); // NOLINT
+
+    if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_loadu_ps(static_cast<__mmask16>((U32{1} << num_values) - 1U), ptr);
+    else if constexpr (is_m512d<T_RegisterType>)
+        return _mm512_maskz_loadu_pd(static_cast<__mmask8>((U32{1} << num_values) - 1U), ptr);
+    else
+        return mm_maskload(ptr, internal::mm_partial_mask<T_RegisterType>(num_values));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_loadu(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_loadu_ps(ptr);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_loadu_pd(ptr);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_loadu_ps(ptr);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_loadu_pd(ptr);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_loadu_ps(internal::mm512_full_mask<T_RegisterType>, ptr);
+    else
+        return _mm512_maskz_loadu_pd(internal::mm512_full_mask<T_RegisterType>, ptr);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerSSEAVXRegister T_RegisterType, IntegerRegisterElement T_ElementType>
+[[nodiscard]] inline auto mm_loadu(const T_ElementType* ptr) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); // NOLINT(*-reinterpret-cast)
     else
-        return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OS);
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); // NOLINT(*-reinterpret-cast)
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_cmp_gt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+[[nodiscard]] inline auto mm_maskload(const ElementType<T_RegisterType>* ptr, T_RegisterType mask) noexcept
+        -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
-        return _mm_cmpgt_ps(lhs, rhs);
+        return _mm_maskload_ps(ptr, mm_cast_fi(mask));
     else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_cmpgt_pd(lhs, rhs);
+        return _mm_maskload_pd(ptr, mm_cast_fi(mask));
     else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OS);
+        return _mm256_maskload_ps(ptr, mm_cast_fi(mask));
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_maskload_pd(ptr, mm_cast_fi(mask));
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_loadu_ps(internal::mm512_sign_bit_mask(mask), ptr);
     else
-        return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OS);
+        return _mm512_maskz_loadu_pd(internal::mm512_sign_bit_mask(mask), ptr);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_cmp_le(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+inline void mm_maskstore(ElementType<T_RegisterType>* ptr, T_RegisterType mask, T_RegisterType src) noexcept
 {
     if constexpr (is_m128<T_RegisterType>)
-        return _mm_cmple_ps(lhs, rhs);
+        _mm_maskstore_ps(ptr, mm_cast_fi(mask), src);
     else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_cmple_pd(lhs, rhs);
+        _mm_maskstore_pd(ptr, mm_cast_fi(mask), src);
     else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OS);
+        _mm256_maskstore_ps(ptr, mm_cast_fi(mask), src);
+    else if constexpr (is_m256d<T_RegisterType>)
+        _mm256_maskstore_pd(ptr, mm_cast_fi(mask), src);
+    else if constexpr (is_m512<T_RegisterType>)
+        _mm512_mask_storeu_ps(ptr, internal::mm512_sign_bit_mask(mask), src);
     else
-        return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OS);
+        _mm512_mask_storeu_pd(ptr, internal::mm512_sign_bit_mask(mask), src);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_cmp_lt(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+[[nodiscard]] inline auto mm_max(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
-        return _mm_cmplt_ps(lhs, rhs);
+        return _mm_max_ps(lhs, rhs);
     else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_cmplt_pd(lhs, rhs);
+        return _mm_max_pd(lhs, rhs);
     else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OS);
+        return _mm256_max_ps(lhs, rhs);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_max_pd(lhs, rhs);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_max_ps(internal::mm512_full_mask<T_RegisterType>, lhs, rhs);
     else
-        return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OS);
+        return _mm512_maskz_max_pd(internal::mm512_full_mask<T_RegisterType>, lhs, rhs);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_cvt_float(T_RegisterType src) -> ElementType<T_RegisterType>
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_max(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
 {
-    if constexpr (is_m128<T_RegisterType>)
-        return _mm_cvtss_f32(src);
-    else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_cvtsd_f64(src);
-    else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_cvtss_f32(src);
+    if constexpr (sizeof(T_ElementType) == 8)
+        return mm_blendv_epi8(rhs, lhs, mm_cmp_gt<T_ElementType>(lhs, rhs));
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (std::is_same_v<T_ElementType, I8>)
+            return _mm_max_epi8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U8>)
+            return _mm_max_epu8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I16>)
+            return _mm_max_epi16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U16>)
+            return _mm_max_epu16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I32>)
+            return _mm_max_epi32(lhs, rhs);
+        else
+            return _mm_max_epu32(lhs, rhs);
+    }
     else
-        return _mm256_cvtsd_f64(src);
+    {
+        if constexpr (std::is_same_v<T_ElementType, I8>)
+            return _mm256_max_epi8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U8>)
+            return _mm256_max_epu8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I16>)
+            return _mm256_max_epi16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U16>)
+            return _mm256_max_epu16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I32>)
+            return _mm256_max_epi32(lhs, rhs);
+        else
+            return _mm256_max_epu32(lhs, rhs);
+    }
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_fmadd(T_RegisterType a, T_RegisterType b, T_RegisterType c) noexcept -> T_RegisterType
+[[nodiscard]] inline auto mm_min(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
-        return _mm_fmadd_ps(a, b, c);
+        return _mm_min_ps(lhs, rhs);
     else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_fmadd_pd(a, b, c);
+        return _mm_min_pd(lhs, rhs);
     else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_fmadd_ps(a, b, c);
+        return _mm256_min_ps(lhs, rhs);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_min_pd(lhs, rhs);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_min_ps(internal::mm512_full_mask<T_RegisterType>, lhs, rhs);
     else
-        return _mm256_fmadd_pd(a, b, c);
+        return _mm512_maskz_min_pd(internal::mm512_full_mask<T_RegisterType>, lhs, rhs);
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_fmsub(T_RegisterType a, T_RegisterType b, T_RegisterType c) noexcept -> T_RegisterType
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_min(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
 {
-    if constexpr (is_m128<T_RegisterType>)
-        return _mm_fmsub_ps(a, b, c);
-    else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_fmsub_pd(a, b, c);
-    else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_fmsub_ps(a, b, c);
+    if constexpr (sizeof(T_ElementType) == 8)
+        return mm_blendv_epi8(lhs, rhs, mm_cmp_gt<T_ElementType>(lhs, rhs));
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (std::is_same_v<T_ElementType, I8>)
+            return _mm_min_epi8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U8>)
+            return _mm_min_epu8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I16>)
+            return _mm_min_epi16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U16>)
+            return _mm_min_epu16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I32>)
+            return _mm_min_epi32(lhs, rhs);
+        else
+            return _mm_min_epu32(lhs, rhs);
+    }
     else
-        return _mm256_fmsub_pd(a, b, c);
+    {
+        if constexpr (std::is_same_v<T_ElementType, I8>)
+            return _mm256_min_epi8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U8>)
+            return _mm256_min_epu8(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I16>)
+            return _mm256_min_epi16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, U16>)
+            return _mm256_min_epu16(lhs, rhs);
+        else if constexpr (std::is_same_v<T_ElementType, I32>)
+            return _mm256_min_epi32(lhs, rhs);
+        else
+            return _mm256_min_epu32(lhs, rhs);
+    }
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 template <FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto mm_load(ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType
+[[nodiscard]] inline auto mm_movemask(T_RegisterType src) noexcept -> U32
 {
-    assert(is_aligned<alignment_bytes<T_RegisterType>>(ptr)); // NOLINT
-
     if constexpr (is_m128<T_RegisterType>)
-        return _mm_load_ps(ptr);
+        return static_cast<U32>(_mm_movemask_ps(src));
     else if constexpr (is_m128d<T_RegisterType>)
-        return _mm_load_pd(ptr);
+        return static_cast<U32>(_mm_movemask_pd(src));
     else if constexpr (is_m256<T_RegisterType>)
-        return _mm256_load_ps(ptr);
+        return static_cast<U32>(_mm256_movemask_ps(src));
+    else if constexpr (is_m256d<T_RegisterType>)
+        return static_cast<U32>(_mm256_movemask_pd(src));
     else
-        return _mm256_load_pd(ptr);
+        return static_cast<U32>(internal::mm512_sign_bit_mask(src));
 }
 
 
@@ -806,8 +2216,17 @@ template <IntegerVectorRegister T_RegisterType>
 {
     if constexpr (is_m128i<T_RegisterType>)
         return static_cast<U16>(_mm_movemask_epi8(src));
-    else
+    else if constexpr (is_m256i<T_RegisterType>)
         return static_cast<U32>(_mm256_movemask_epi8(src));
+    else
+    {
+        // `_mm512_movepi8_mask` requires AVX-512BW, so both 256 bit halves are processed separately
+        constexpr __mmask8 mask = internal::mm512_lane_mask;
+
+        auto low  = static_cast<U32>(_mm256_movemask_epi8(_mm512_maskz_extracti64x4_epi64(mask, src, 0)));
+        auto high = static_cast<U32>(_mm256_movemask_epi8(_mm512_maskz_extracti64x4_epi64(mask, src, 1)));
+        return static_cast<U64>(low) | (static_cast<U64>(high) << 32U); // NOLINT(readability-magic-numbers)
+    }
 }
 
 
@@ -822,14 +2241,71 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_mul_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_mul_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_mul_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_mul_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else
+        return _mm512_mul_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_mul_epu32(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_mul_epu32(lhs, rhs);
+    else
+        return _mm256_mul_epu32(lhs, rhs);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_mullo(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (sizeof(T_ElementType) == 1)
+    {
+        // The even and odd bytes are multiplied separately as 16 bit integers
+        constexpr UST byte_bits = num_bits<U8>;
+
+        const auto even_mask = mm_set1<U16, T_RegisterType>(std::numeric_limits<U8>::max());
+        const auto even      = mm_mullo<U16>(lhs, rhs);
+        const auto odd       = mm_mullo<U16>(mm_srli<U16, byte_bits>(lhs), mm_srli<U16, byte_bits>(rhs));
+        return mm_or(mm_and(even, even_mask), mm_slli<U16, byte_bits>(odd));
+    }
+    else if constexpr (sizeof(T_ElementType) == 8)
+    {
+        // (a_hi * 2^32 + a_lo) * (b_hi * 2^32 + b_lo) = a_lo * b_lo + (a_hi * b_lo + a_lo * b_hi) * 2^32 (mod 2^64)
+        constexpr UST half_bits = num_bits<U32>;
+
+        const auto cross = mm_add<U64>(mm_mul_epu32(mm_srli<U64, half_bits>(lhs), rhs),
+                                       mm_mul_epu32(lhs, mm_srli<U64, half_bits>(rhs)));
+        return mm_add<U64>(mm_mul_epu32(lhs, rhs), mm_slli<U64, half_bits>(cross));
+    }
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_mullo_epi16(lhs, rhs);
+        else
+            return _mm_mullo_epi32(lhs, rhs);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_mullo_epi16(lhs, rhs);
+        else
+            return _mm256_mullo_epi32(lhs, rhs);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_or(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
@@ -838,8 +2314,16 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_or_pd(a, b);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_or_ps(a, b);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_or_pd(a, b);
+    else if constexpr (is_m128i<T_RegisterType>)
+        return _mm_or_si128(a, b);
+    else if constexpr (is_m256i<T_RegisterType>)
+        return _mm256_or_si256(a, b);
+    else if constexpr (is_m512i<T_RegisterType>)
+        return _mm512_or_si512(a, b);
+    else
+        return mm_cast_if<T_RegisterType>(_mm512_or_si512(mm_cast_fi(a), mm_cast_fi(b)));
 }
 
 
@@ -854,8 +2338,12 @@ template <I32 t_mask, FloatVectorRegister T_RegisterType>
         return _mm_permute_pd(src, t_mask);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_permute_ps(src, t_mask);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_permute_pd(src, t_mask);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_permute_ps(internal::mm512_full_mask<T_RegisterType>, src, t_mask);
+    else
+        return _mm512_maskz_permute_pd(internal::mm512_full_mask<T_RegisterType>, src, t_mask);
 }
 
 
@@ -882,8 +2370,42 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_set1_pd(value);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_set1_ps(value);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_set1_pd(value);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_set1_ps(value);
+    else
+        return _mm512_set1_pd(value);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_set1(T_ElementType value) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_set1_epi16(static_cast<I16>(value));
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_set1_epi32(static_cast<I32>(value));
+        else
+            return _mm_set1_epi64x(static_cast<I64>(value));
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm256_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_set1_epi16(static_cast<I16>(value));
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_set1_epi32(static_cast<I32>(value));
+        else
+            return _mm256_set1_epi64x(static_cast<I64>(value));
+    }
 }
 
 
@@ -900,14 +2422,53 @@ template <FloatVectorRegister T_RegisterType, typename... T_Args>
         return _mm_setr_pd(static_cast<EType>(args)...);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_setr_ps(static_cast<EType>(args)...);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_setr_pd(static_cast<EType>(args)...);
+    else
+        return internal::mm512_setr<T_RegisterType>(std::array<EType, sizeof...(args)>{{static_cast<EType>(args)...}});
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType, typename... T_Args>
+[[nodiscard]] inline auto mm_setr(T_Args... args) noexcept -> T_RegisterType
+{
+    static_assert(sizeof...(args) == num_integer_elements<T_ElementType, T_RegisterType>,
+                  "Number of values doesn't match the number of register elements.");
+
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm_setr_epi8(static_cast<char>(static_cast<T_ElementType>(args))...);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_setr_epi16(static_cast<I16>(static_cast<T_ElementType>(args))...);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_setr_epi32(static_cast<I32>(static_cast<T_ElementType>(args))...);
+        else
+        {
+            // There is no `_mm_setr_epi64x`
+            const std::array<I64, 2> values = {{static_cast<I64>(static_cast<T_ElementType>(args))...}};
+            return _mm_set_epi64x(values[1], values[0]);
+        }
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm256_setr_epi8(static_cast<char>(static_cast<T_ElementType>(args))...);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_setr_epi16(static_cast<I16>(static_cast<T_ElementType>(args))...);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_setr_epi32(static_cast<I32>(static_cast<T_ElementType>(args))...);
+        else
+            return _mm256_setr_epi64x(static_cast<I64>(static_cast<T_ElementType>(args))...);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_setzero() noexcept -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
@@ -916,8 +2477,18 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_setzero_pd();
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_setzero_ps();
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_setzero_pd();
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_setzero_ps();
+    else if constexpr (is_m512d<T_RegisterType>)
+        return _mm512_setzero_pd();
+    else if constexpr (is_m128i<T_RegisterType>)
+        return _mm_setzero_si128();
+    else if constexpr (is_m256i<T_RegisterType>)
+        return _mm256_setzero_si256();
+    else
+        return _mm512_setzero_si512();
 }
 
 
@@ -932,8 +2503,227 @@ template <UST t_mask, FloatVectorRegister T_RegisterType>
         return _mm_shuffle_pd(a, b, t_mask);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_shuffle_ps(a, b, t_mask);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_shuffle_pd(a, b, t_mask);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_shuffle_ps(a, b, t_mask);
+    else
+        return _mm512_shuffle_pd(a, b, t_mask);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_shuffle_epi8(T_RegisterType src, T_RegisterType control) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_shuffle_epi8(src, control);
+    else
+        return _mm256_shuffle_epi8(src, control);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <I32 t_mask, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_shuffle_epi32(T_RegisterType src) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+        return _mm_shuffle_epi32(src, t_mask);
+    else
+        return _mm256_shuffle_epi32(src, t_mask);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_count, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_slli(T_RegisterType src) noexcept -> T_RegisterType
+{
+    static_assert(t_count < num_bits<T_ElementType>, "Shift count must be smaller than the number of element bits.");
+
+    constexpr auto count = static_cast<I32>(t_count);
+
+    if constexpr (sizeof(T_ElementType) == 1)
+    {
+        constexpr auto byte_mask = static_cast<U8>(std::numeric_limits<U8>::max() << t_count);
+        return mm_and(mm_slli<U16, t_count>(src), mm_set1<U8, T_RegisterType>(byte_mask));
+    }
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_slli_epi16(src, count);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_slli_epi32(src, count);
+        else
+            return _mm_slli_epi64(src, count);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_slli_epi16(src, count);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_slli_epi32(src, count);
+        else
+            return _mm256_slli_epi64(src, count);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_sllv(T_RegisterType src, T_RegisterType counts) noexcept -> T_RegisterType
+{
+    static_assert(sizeof(T_ElementType) == 4 || sizeof(T_ElementType) == 8, "Only 32 and 64 bit elements supported.");
+
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_sllv_epi32(src, counts);
+        else
+            return _mm_sllv_epi64(src, counts);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_sllv_epi32(src, counts);
+        else
+            return _mm256_sllv_epi64(src, counts);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_sqrt(T_RegisterType src) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_sqrt_ps(src);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_sqrt_pd(src);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_sqrt_ps(src);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_sqrt_pd(src);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_sqrt_ps(internal::mm512_full_mask<__m512>, src);
+    else
+        return _mm512_maskz_sqrt_pd(internal::mm512_full_mask<__m512d>, src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_count, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_srai(T_RegisterType src) noexcept -> T_RegisterType
+{
+    static_assert(t_count < num_bits<T_ElementType>, "Shift count must be smaller than the number of element bits.");
+
+    constexpr auto count = static_cast<I32>(t_count);
+
+    if constexpr (sizeof(T_ElementType) == 1)
+    {
+        // The even bytes are moved to the upper half of the 16 bit elements before they are shifted
+        constexpr UST byte_bits = num_bits<U8>;
+
+        constexpr auto odd_bytes = static_cast<U16>(std::numeric_limits<U8>::max() << byte_bits);
+
+        const auto odd_mask = mm_set1<U16, T_RegisterType>(odd_bytes);
+        const auto even     = mm_srli<U16, byte_bits>(mm_srai<I16, t_count>(mm_slli<U16, byte_bits>(src)));
+        const auto odd      = mm_and(mm_srai<I16, t_count>(src), odd_mask);
+        return mm_or(even, odd);
+    }
+    else if constexpr (sizeof(T_ElementType) == 8)
+    {
+        // The upper 32 bits of each element are taken from an arithmetic 32 bit shift and the lower ones from a logical
+        // 64 bit shift. Shifts by 32 bits or more only need the arithmetic shift of the upper 32 bits.
+        constexpr UST half_bits  = num_bits<U32>;
+        constexpr I32 upper_mask = is_m128i<T_RegisterType> ? 0b1010 : 0b10101010;
+
+        if constexpr (t_count == 0)
+            return src;
+        else if constexpr (t_count < half_bits)
+            return mm_blend_epi32<upper_mask>(mm_srli<U64, t_count>(src), mm_srai<I32, t_count>(src));
+        else
+            return mm_blend_epi32<upper_mask>(mm_srli<U64, half_bits>(mm_srai<I32, t_count - half_bits>(src)),
+                                              mm_srai<I32, half_bits - 1>(src));
+    }
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_srai_epi16(src, count);
+        else
+            return _mm_srai_epi32(src, count);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_srai_epi16(src, count);
+        else
+            return _mm256_srai_epi32(src, count);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST t_count, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_srli(T_RegisterType src) noexcept -> T_RegisterType
+{
+    static_assert(t_count < num_bits<T_ElementType>, "Shift count must be smaller than the number of element bits.");
+
+    constexpr auto count = static_cast<I32>(t_count);
+
+    if constexpr (sizeof(T_ElementType) == 1)
+    {
+        constexpr auto byte_mask = static_cast<U8>(std::numeric_limits<U8>::max() >> t_count);
+        return mm_and(mm_srli<U16, t_count>(src), mm_set1<U8, T_RegisterType>(byte_mask));
+    }
+    else if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_srli_epi16(src, count);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_srli_epi32(src, count);
+        else
+            return _mm_srli_epi64(src, count);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_srli_epi16(src, count);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_srli_epi32(src, count);
+        else
+            return _mm256_srli_epi64(src, count);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_srlv(T_RegisterType src, T_RegisterType counts) noexcept -> T_RegisterType
+{
+    static_assert(sizeof(T_ElementType) == 4 || sizeof(T_ElementType) == 8, "Only 32 and 64 bit elements supported.");
+
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_srlv_epi32(src, counts);
+        else
+            return _mm_srlv_epi64(src, counts);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_srlv_epi32(src, counts);
+        else
+            return _mm256_srlv_epi64(src, counts);
+    }
 }
 
 
@@ -950,8 +2740,82 @@ inline void mm_store(ElementType<T_RegisterType>* ptr, T_RegisterType reg) noexc
         _mm_store_pd(ptr, reg);
     else if constexpr (is_m256<T_RegisterType>)
         _mm256_store_ps(ptr, reg);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         _mm256_store_pd(ptr, reg);
+    else if constexpr (is_m512<T_RegisterType>)
+        _mm512_store_ps(ptr, reg);
+    else
+        _mm512_store_pd(ptr, reg);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+inline void mm_store_partial(ElementType<T_RegisterType>* ptr, T_RegisterType src, UST num_values) noexcept
+{
+    assert(num_values <= num_elements<T_RegisterType> && "Number of values exceeds the register size."); // NOLINT
+
+    if constexpr (is_m512<T_RegisterType>)
+        _mm512_mask_storeu_ps(ptr, static_cast<__mmask16>((U32{1} << num_values) - 1U), src);
+    else if constexpr (is_m512d<T_RegisterType>)
+        _mm512_mask_storeu_pd(ptr, static_cast<__mmask8>((U32{1} << num_values) - 1U), src);
+    else
+        mm_maskstore(ptr, internal::mm_partial_mask<T_RegisterType>(num_values), src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+inline void mm_storeu(ElementType<T_RegisterType>* ptr, T_RegisterType reg) noexcept
+{
+    if constexpr (is_m128<T_RegisterType>)
+        _mm_storeu_ps(ptr, reg);
+    else if constexpr (is_m128d<T_RegisterType>)
+        _mm_storeu_pd(ptr, reg);
+    else if constexpr (is_m256<T_RegisterType>)
+        _mm256_storeu_ps(ptr, reg);
+    else if constexpr (is_m256d<T_RegisterType>)
+        _mm256_storeu_pd(ptr, reg);
+    else if constexpr (is_m512<T_RegisterType>)
+        _mm512_storeu_ps(ptr, reg);
+    else
+        _mm512_storeu_pd(ptr, reg);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+inline void mm_storeu(T_ElementType* ptr, T_RegisterType reg) noexcept
+{
+    if constexpr (is_m128i<T_RegisterType>)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), reg); // NOLINT(*-reinterpret-cast)
+    else
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), reg); // NOLINT(*-reinterpret-cast)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+inline void mm_stream(ElementType<T_RegisterType>* ptr, T_RegisterType reg) noexcept
+{
+    assert(is_aligned<alignment_bytes<T_RegisterType>>(ptr)); // NOLINT
+
+    if constexpr (is_m128<T_RegisterType>)
+        _mm_stream_ps(ptr, reg);
+    else if constexpr (is_m128d<T_RegisterType>)
+        _mm_stream_pd(ptr, reg);
+    else if constexpr (is_m256<T_RegisterType>)
+        _mm256_stream_ps(ptr, reg);
+    else if constexpr (is_m256d<T_RegisterType>)
+        _mm256_stream_pd(ptr, reg);
+    else if constexpr (is_m512<T_RegisterType>)
+        _mm512_stream_ps(ptr, reg);
+    else
+        _mm512_stream_pd(ptr, reg);
 }
 
 
@@ -966,14 +2830,48 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_sub_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_sub_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_sub_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_sub_ps(lhs, rhs); // NOLINT(portability-simd-intrinsics)
+    else
+        return _mm512_sub_pd(lhs, rhs); // NOLINT(portability-simd-intrinsics)
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <FloatVectorRegister T_RegisterType>
+template <IntegerRegisterElement T_ElementType, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto mm_sub(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    if constexpr (is_m128i<T_RegisterType>)
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm_sub_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm_sub_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm_sub_epi32(lhs, rhs);
+        else
+            return _mm_sub_epi64(lhs, rhs);
+    }
+    else
+    {
+        if constexpr (sizeof(T_ElementType) == 1)
+            return _mm256_sub_epi8(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 2)
+            return _mm256_sub_epi16(lhs, rhs);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm256_sub_epi32(lhs, rhs);
+        else
+            return _mm256_sub_epi64(lhs, rhs);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <VectorRegister T_RegisterType>
 [[nodiscard]] inline auto mm_xor(T_RegisterType a, T_RegisterType b) noexcept -> T_RegisterType
 {
     if constexpr (is_m128<T_RegisterType>)
@@ -982,9 +2880,94 @@ template <FloatVectorRegister T_RegisterType>
         return _mm_xor_pd(a, b);
     else if constexpr (is_m256<T_RegisterType>)
         return _mm256_xor_ps(a, b);
-    else
+    else if constexpr (is_m256d<T_RegisterType>)
         return _mm256_xor_pd(a, b);
+    else if constexpr (is_m128i<T_RegisterType>)
+        return _mm_xor_si128(a, b);
+    else if constexpr (is_m256i<T_RegisterType>)
+        return _mm256_xor_si256(a, b);
+    else if constexpr (is_m512i<T_RegisterType>)
+        return _mm512_xor_si512(a, b);
+    else
+        return mm_cast_if<T_RegisterType>(_mm512_xor_si512(mm_cast_fi(a), mm_cast_fi(b)));
 }
 
 
 } // namespace mjolnir::x86
+
+
+//! \cond DO_NOT_DOCUMENT
+namespace mjolnir::x86::internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <I32 t_predicate, FloatAVX512Register T_RegisterType>
+[[nodiscard]] inline auto mm_cmp_avx512(T_RegisterType lhs, T_RegisterType rhs) noexcept -> T_RegisterType
+{
+    constexpr I32 all_bits_set = -1;
+
+    if constexpr (is_m512<T_RegisterType>)
+        return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(_mm512_cmp_ps_mask(lhs, rhs, t_predicate), all_bits_set));
+    else
+        return _mm512_castsi512_pd(_mm512_maskz_set1_epi64(_mm512_cmp_pd_mask(lhs, rhs, t_predicate), all_bits_set));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatAVX512Register T_RegisterType>
+[[nodiscard]] inline auto mm512_sign_bit_mask(T_RegisterType mask) noexcept
+{
+    if constexpr (is_m512<T_RegisterType>)
+        return _mm512_cmplt_epi32_mask(_mm512_castps_si512(mask), _mm512_setzero_si512());
+    else
+        return _mm512_cmplt_epi64_mask(_mm512_castpd_si512(mask), _mm512_setzero_si512());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <AVX512Register T_RegisterType, typename T_ElementType, UST t_num_elements>
+[[nodiscard]] inline auto mm512_setr(const std::array<T_ElementType, t_num_elements>& values) noexcept
+        -> T_RegisterType
+{
+    static_assert(t_num_elements * sizeof(T_ElementType) == sizeof(T_RegisterType), "Values don't fit the register.");
+
+    return [&values]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+    {
+        constexpr UST idx_last = t_num_elements - 1;
+
+        if constexpr (is_m512<T_RegisterType>)
+            return _mm512_set_ps(values[idx_last - t_i]...);
+        else if constexpr (is_m512d<T_RegisterType>)
+            return _mm512_set_pd(values[idx_last - t_i]...);
+        else if constexpr (sizeof(T_ElementType) == 4)
+            return _mm512_set_epi32(values[idx_last - t_i]...);
+        else
+            return _mm512_set_epi64(values[idx_last - t_i]...);
+    }(std::make_index_sequence<t_num_elements>());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto mm_partial_mask(UST num_values) noexcept -> T_RegisterType
+{
+    using IntegerType         = std::conditional_t<is_single_precision<T_RegisterType>, I32, I64>;
+    using IntegerRegisterType = std::conditional_t<is_sse_register<T_RegisterType>, __m128i, __m256i>;
+
+    const auto indices = []<UST... t_i>(std::index_sequence<t_i...>)
+    {
+        return mm_setr<IntegerType, IntegerRegisterType>(static_cast<IntegerType>(t_i)...);
+    }(std::make_index_sequence<num_elements<T_RegisterType>>());
+
+    const auto limit = mm_set1<IntegerType, IntegerRegisterType>(static_cast<IntegerType>(num_values));
+
+    return mm_cast_if<T_RegisterType>(mm_cmp_gt<IntegerType>(limit, indices));
+}
+
+
+} // namespace mjolnir::x86::internal
+//! \endcond
+
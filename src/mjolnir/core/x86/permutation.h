@@ -62,6 +62,30 @@ template <UST... t_args, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto blend(T_RegisterType src_0, T_RegisterType src_1) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Blend the integer elements from `src_0` and `src_1` into a new register.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_args:
+//! Parameters pack to select the source register for the individual elements. The number of parameters must be equal to
+//! the number of register elements. Each value must either be 0 or 1. Other values will cause a compile-time error. If
+//! a parameter is 0, the result value of the corresponding element is taken from `src_0`. Otherwise, the value of
+//! `src_1` is used.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src_0:
+//! First source register
+//! @param[in] src_1:
+//! Second source register
+//!
+//! @return
+//! New register with blended values
+template <IntegerRegisterElement T_ElementType, UST... t_args, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto blend(T_RegisterType src_0, T_RegisterType src_1) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Get a register where elements with a higher index than `t_index` are copied from `src_1`and the rest from `src_0`.
 //!
@@ -227,21 +251,25 @@ inline void exchange(T_RegisterType& reg_0, T_RegisterType& reg_1) noexcept;
 
 
 //! @brief
-//! Insert a single element from `src` into `dst` and return the result in a new `__m128` register.
+//! Insert a single element from `src` into `dst` and return the result in a new register.
 //!
 //! @details
 //! The source and the target elements are selected by template parameter indices. Optionally, elements can be set to
-//! zero by providing additional boolean template values.
+//! zero by providing additional boolean template values. The values never leave the registers. For `__m128`, a single
+//! `insertps` is used. All other register types move the source element with the cheapest permutation that
+//! `permute_across_lanes` can select for the given indices and blend it into `dst`.
 //!
 //! @tparam t_index_src:
 //! Index of the element in `src` that should be copied
 //! @tparam t_index_dst:
 //! Index of the element in `dst` that should receive the copied value
 //! @tparam t_set_zero:
-//! An optional parameter pack of boolean values. If the N-th provided value is `true`, the N-th element of the result
-//! register will be set to `0`. If it is `false`, no changes are applied to this element. Note that you can set
-//! multiple values to `0`. If the boolean value that corresponds to `t_index_dst` is `true`, the resulting value is
-//! `0`, which makes the insertion obsolete.
+//! An optional parameter pack of boolean values. If it is provided, its size must be equal to the number of register
+//! elements. If the N-th provided value is `true`, the N-th element of the result register will be set to `0`. If it is
+//! `false`, no changes are applied to this element. Note that you can set multiple values to `0`. If the boolean value
+//! that corresponds to `t_index_dst` is `true`, the resulting value is `0`, which makes the insertion obsolete.
+//! @tparam T_RegisterType:
+//! The register type
 //!
 //! @param[in] src:
 //! Source register
@@ -249,9 +277,9 @@ inline void exchange(T_RegisterType& reg_0, T_RegisterType& reg_1) noexcept;
 //! Target register
 //!
 //! @return
-//! A new `__m128` register with corresponding values
-template <UST t_index_src, UST t_index_dst, bool... t_set_zero>
-inline auto insert(__m128 src, __m128 dst) noexcept -> __m128;
+//! A new register with corresponding values
+template <UST t_index_src, UST t_index_dst, bool... t_set_zero, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto insert(T_RegisterType src, T_RegisterType dst) noexcept -> T_RegisterType;
 
 
 //! @brief
@@ -277,9 +305,41 @@ template <UST... t_indices, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto permute(T_RegisterType src) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Shuffle the integer elements of a vector register within lanes using indices and return the result in a new
+//! register.
+//!
+//! @details
+//! 32 and 64 bit elements with an identical pattern for all lanes use `mm_shuffle_epi32`. All other cases use a byte
+//! shuffle with a compile-time control register.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_indices
+//! A set of indices equal to the number of register elements or the number of lane elements. In the latter case the
+//! permutation pattern is identical for all lanes. The N-th index selects the value for the N-th element/lane element.
+//! Index values may not exceed the lane size of a register. Otherwise a compile-time error is triggered.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The source register
+//!
+//! @return
+//! New register with shuffled values
+template <IntegerRegisterElement T_ElementType, UST... t_indices, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto permute(T_RegisterType src) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Shuffle the elements of a vector register across lanes using indices and return the result in a new register.
 //!
+//! @details
+//! The instruction sequence is selected at compile-time by scoring all sequences that can realize the index pattern
+//! with a simple latency and constant-register cost model. Patterns that stay within lanes use the in-lane
+//! permutations, patterns that only move whole lanes use lane permutations and all other patterns use a single
+//! cross-lane permutation.
+//!
 //! @tparam t_indices
 //! A set of indices equal to the number of register elements. The N-th index selects the value for the N-th
 //! element/lane element. Index values may not exceed the number of register elements. Otherwise a compile-time error is
@@ -324,7 +384,8 @@ template <UST t_lane_0, UST t_lane_1, FloatAVXRegister T_RegisterType>
 //! Each integer of the parameter pack specifies the index of the value that should be taken from the corresponding
 //! source register. The first half of a lane is taken from the source `src_0` and the second from `src_1`. The number
 //! of integers must be equal to the number of lane values. Therefore, the pattern is identical for each lane. The sole
-//! exception is the `__m256d` register. Here the pattern might differ if you provide 4 instead of 2 indices.
+//! exceptions are the `__m256d` and `__m512d` registers. Here the pattern might differ if you provide one index per
+//! register element instead of 2 indices.
 //!
 //! @tparam t_indices:
 //! Parameter pack of indices that specify which elements are chosen from the source registers.
@@ -342,6 +403,33 @@ template <UST... t_indices, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto shuffle(T_RegisterType src_0, T_RegisterType src_1) noexcept -> T_RegisterType;
 
 
+//! @brief
+//! Return an integer register with the first half of the lane elements selected from `src_0` and the second half from
+//! `src_1`.
+//!
+//! @details
+//! The index semantics are identical to the floating-point version. 32 and 64 bit elements reuse the floating-point
+//! shuffles, which also allows one index per element for 64 bit elements of 256 bit registers. 8 and 16 bit elements
+//! are combined from two byte shuffles.
+//!
+//! @tparam T_ElementType:
+//! The integer type of the register elements
+//! @tparam t_indices:
+//! Parameter pack of indices that specify which elements are chosen from the source registers.
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src_0:
+//! First source register
+//! @param[in] src_1:
+//! Second source register
+//!
+//! @return
+//! New register with shuffled values
+template <IntegerRegisterElement T_ElementType, UST... t_indices, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto shuffle(T_RegisterType src_0, T_RegisterType src_1) noexcept -> T_RegisterType;
+
+
 //! @brief
 //! Create a new AVX register by combining arbitrary lanes from two source registers.
 //!
@@ -433,8 +521,258 @@ template <bool t_swap_lanes, FloatAVXRegister T_RegisterType>
 #include "mjolnir/core/utility/parameter_pack.h"
 #include "mjolnir/core/x86/intrinsics.h"
 
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
 namespace mjolnir::x86
 {
+// --- internal functions for AVX-512 ---------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Create an integer register from an index array that can be used with the variable permutation intrinsics of the
+//! AVX-512 register type `T_RegisterType`. Each register element gets its own index.
+template <FloatAVX512Register T_RegisterType, UST t_num_indices>
+[[nodiscard]] inline auto mm512_index_register(const std::array<UST, t_num_indices>& indices) noexcept -> __m512i
+{
+    static_assert(t_num_indices == num_elements<T_RegisterType>, "Number of indices must match the register size.");
+
+    using IndexType = std::conditional_t<is_m512<T_RegisterType>, I32, I64>;
+
+    return [&indices]<UST... t_i>(std::index_sequence<t_i...>) -> __m512i
+    {
+        return mm512_setr<__m512i>(std::array<IndexType, t_num_indices>{{static_cast<IndexType>(indices[t_i])...}});
+    }(std::make_index_sequence<t_num_indices>());
+}
+
+} // namespace internal
+//! \endcond
+
+
+// --- internal functions for integer registers -----------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Create an integer register from an array that contains the values of all bytes.
+template <IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto byte_register(const std::array<U8, sizeof(T_RegisterType)>& bytes) noexcept -> T_RegisterType
+{
+    return [&bytes]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+    {
+        return mm_setr<U8, T_RegisterType>(bytes[t_i]...);
+    }(std::make_index_sequence<sizeof(T_RegisterType)>());
+}
+
+
+//! Repeat a per lane index pattern until it covers all `t_num_elements` register elements. Patterns that already cover
+//! all elements are returned unchanged.
+template <UST t_num_elements, UST t_num_indices>
+[[nodiscard]] constexpr auto expand_lane_indices(const std::array<UST, t_num_indices>& indices) noexcept
+        -> std::array<UST, t_num_elements>
+{
+    std::array<UST, t_num_elements> expanded = {{0}};
+    for (UST i = 0; i < t_num_elements; ++i)
+        expanded.at(i) = indices.at(i % t_num_indices);
+    return expanded;
+}
+
+
+//! Create the control bytes of `mm_shuffle_epi8` for an in-lane permutation of elements with `t_element_size` bytes.
+//! Indices that are equal or larger than `t_num_lane_elements` set the element to zero.
+template <UST t_element_size, UST t_num_lane_elements, UST t_num_elements>
+[[nodiscard]] constexpr auto get_byte_shuffle_control(const std::array<UST, t_num_elements>& indices) noexcept
+        -> std::array<U8, t_num_elements * t_element_size>
+{
+    constexpr U8 zero_byte = 0x80;
+
+    std::array<U8, t_num_elements * t_element_size> control = {{0}};
+    for (UST i = 0; i < t_num_elements; ++i)
+        for (UST j = 0; j < t_element_size; ++j)
+            control.at(i * t_element_size + j) = (indices.at(i) < t_num_lane_elements)
+                                                         ? static_cast<U8>(indices.at(i) * t_element_size + j)
+                                                         : zero_byte;
+    return control;
+}
+
+
+//! Return `true` if all lanes of a register share the same permutation pattern.
+template <UST t_num_lane_elements, UST t_num_elements>
+[[nodiscard]] constexpr auto is_lane_pattern_uniform(const std::array<UST, t_num_elements>& indices) noexcept -> bool
+{
+    for (UST i = t_num_lane_elements; i < t_num_elements; ++i)
+        if (indices.at(i) != indices.at(i % t_num_lane_elements))
+            return false;
+    return true;
+}
+
+} // namespace internal
+//! \endcond
+
+
+// --- internal functions for permutation planning ---------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! The instruction sequences that `permute_across_lanes` can choose from. The order is used to break ties between
+//! sequences with the same cost.
+enum class PermutationStrategy : UST
+{
+    IDENTITY,             // no instruction
+    IN_LANE_IMMEDIATE,    // vpermilps/vpermilpd with an immediate
+    IN_LANE_VARIABLE,     // vpermilps with a constant control register
+    LANE_PERMUTATION,     // vperm2f128 or vshuff32x4/vshuff64x2
+    BROADCAST,            // vbroadcastss/vbroadcastsd
+    CROSS_LANE_IMMEDIATE, // vpermpd with an immediate
+    CROSS_LANE_VARIABLE   // vpermps/vpermpd with a constant index register
+};
+
+
+//! Estimated cost of a permutation strategy. The latencies are the ones of Skylake and later Intel architectures, where
+//! all permutations are executed on port 5. Each constant register adds one to the score since it requires a load and
+//! occupies a register.
+struct PermutationCost
+{
+    UST latency       = 0;
+    UST num_constants = 0;
+
+    [[nodiscard]] constexpr auto score() const noexcept -> UST
+    {
+        return latency + num_constants;
+    }
+};
+
+
+//! Return the cost of a permutation strategy.
+[[nodiscard]] consteval auto get_permutation_cost(PermutationStrategy strategy) noexcept -> PermutationCost
+{
+    using enum PermutationStrategy;
+
+    switch (strategy)
+    {
+    case IDENTITY:
+        return {0, 0};
+    case IN_LANE_IMMEDIATE:
+        return {1, 0};
+    case IN_LANE_VARIABLE:
+        return {1, 1};
+    case LANE_PERMUTATION:
+    case BROADCAST:
+    case CROSS_LANE_IMMEDIATE:
+        return {3, 0}; // NOLINT(readability-magic-numbers)
+    case CROSS_LANE_VARIABLE:
+        return {3, 1}; // NOLINT(readability-magic-numbers)
+    }
+    return {};
+}
+
+
+//! Return `true` if `strategy` can realize the permutation `indices` for the register type `T_RegisterType`.
+template <FloatVectorRegister T_RegisterType, UST t_num_elements>
+[[nodiscard]] consteval auto is_permutation_strategy_applicable(PermutationStrategy                  strategy,
+                                                                const std::array<UST, t_num_elements>& indices) noexcept
+        -> bool
+{
+    using enum PermutationStrategy;
+
+    constexpr UST n_le = num_lane_elements<T_RegisterType>;
+
+    std::array<UST, t_num_elements> lane_indices = {{0}};
+
+    bool is_identity = true;
+    bool is_in_lane  = true;
+    bool is_lane     = true;
+    bool is_zero     = true;
+    for (UST i = 0; i < t_num_elements; ++i)
+    {
+        lane_indices.at(i) = indices.at(i) % n_le;
+
+        // a lane permutation copies all elements of a lane from the same source lane without changing their order
+        UST source_lane = indices.at(i - i % n_le) / n_le;
+
+        is_identity = is_identity && indices.at(i) == i;
+        is_in_lane  = is_in_lane && indices.at(i) / n_le == i / n_le;
+        is_lane     = is_lane && indices.at(i) == source_lane * n_le + i % n_le;
+        is_zero     = is_zero && indices.at(i) == 0;
+    }
+
+    // vpermpd with an immediate permutes each 256 bit half of a __m512d with the same pattern
+    bool is_half_pattern_uniform = true;
+    if constexpr (is_m512d<T_RegisterType>)
+        for (UST i = 4; i < t_num_elements; ++i)
+            is_half_pattern_uniform = is_half_pattern_uniform && indices.at(i) == indices.at(i - 4) + 4;
+
+    switch (strategy)
+    {
+    case IDENTITY:
+        return is_identity;
+    case IN_LANE_IMMEDIATE:
+        return is_in_lane && (is_double_precision<T_RegisterType> || is_lane_pattern_uniform<n_le>(lane_indices));
+    case IN_LANE_VARIABLE:
+        return is_in_lane && is_single_precision<T_RegisterType>;
+    case LANE_PERMUTATION:
+        return num_lanes<T_RegisterType> > 1 && is_lane;
+    case BROADCAST:
+        return FloatAVXRegister<T_RegisterType> && is_zero;
+    case CROSS_LANE_IMMEDIATE:
+        return is_m256d<T_RegisterType> || (is_m512d<T_RegisterType> && is_half_pattern_uniform);
+    case CROSS_LANE_VARIABLE:
+        return num_lanes<T_RegisterType> > 1;
+    }
+    return false;
+}
+
+
+//! Return the cheapest strategy that realizes the permutation `indices` for the register type `T_RegisterType`.
+template <FloatVectorRegister T_RegisterType, UST t_num_elements>
+[[nodiscard]] consteval auto plan_permutation(const std::array<UST, t_num_elements>& indices) noexcept
+        -> PermutationStrategy
+{
+    using enum PermutationStrategy;
+
+    constexpr std::array<PermutationStrategy, 7> candidates = {{IDENTITY,
+                                                                 IN_LANE_IMMEDIATE,
+                                                                 IN_LANE_VARIABLE,
+                                                                 LANE_PERMUTATION,
+                                                                 BROADCAST,
+                                                                 CROSS_LANE_IMMEDIATE,
+                                                                 CROSS_LANE_VARIABLE}};
+
+    PermutationStrategy best       = CROSS_LANE_VARIABLE;
+    UST                 best_score = std::numeric_limits<UST>::max();
+    for (auto candidate : candidates)
+    {
+        if (is_permutation_strategy_applicable<T_RegisterType>(candidate, indices)
+            && get_permutation_cost(candidate).score() < best_score)
+        {
+            best       = candidate;
+            best_score = get_permutation_cost(candidate).score();
+        }
+    }
+    return best;
+}
+
+
+//! Return the immediate of the lane permutation instructions. Each lane is selected by `t_num_index_bits` bits.
+template <UST t_num_lane_elements, UST t_num_index_bits, UST t_num_elements>
+[[nodiscard]] consteval auto get_lane_permutation_mask(const std::array<UST, t_num_elements>& indices) noexcept -> I32
+{
+    constexpr UST n_lanes = t_num_elements / t_num_lane_elements;
+
+    I32 mask = 0;
+    for (UST i = 0; i < n_lanes; ++i)
+        mask |= static_cast<I32>((indices.at(i * t_num_lane_elements) / t_num_lane_elements) << (i * t_num_index_bits));
+    return mask;
+}
+
+} // namespace internal
+//! \endcond
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <UST t_shift, FloatVectorRegister T_RegisterType>
@@ -454,8 +792,34 @@ template <UST t_shift, FloatVectorRegister T_RegisterType>
 
         if constexpr (num_lanes<T_RegisterType> == 1)
             return mm_cast_if<T_RegisterType>(_mm_alignr_epi8(mm_cast_fi(lhs), mm_cast_fi(rhs), element_shift));
-        else
+        else if constexpr (num_lanes<T_RegisterType> == 2)
             return mm_cast_if<T_RegisterType>(_mm256_alignr_epi8(mm_cast_fi(lhs), mm_cast_fi(rhs), element_shift));
+        else
+        {
+            // `_mm512_alignr_epi8` requires AVX-512BW, so a two-source permutation is used instead. Indices equal or
+            // larger than the number of register elements select elements from the second source.
+            constexpr UST n_e  = num_elements<T_RegisterType>;
+            constexpr UST n_le = num_lane_elements<T_RegisterType>;
+
+            constexpr auto get_index_array = []() constexpr->std::array<UST, n_e>
+            {
+                std::array<UST, n_e> a = {{0}};
+                for (UST i = 0; i < n_e; ++i)
+                {
+                    UST lane_start = i - i % n_le;
+                    UST idx        = i % n_le + t_shift;
+                    a.at(i)        = (idx < n_le) ? lane_start + idx : n_e + lane_start + idx - n_le;
+                }
+                return a;
+            };
+
+            const __m512i indices = internal::mm512_index_register<T_RegisterType>(get_index_array());
+
+            if constexpr (is_m512<T_RegisterType>)
+                return _mm512_permutex2var_ps(rhs, indices, lhs);
+            else
+                return _mm512_permutex2var_pd(rhs, indices, lhs);
+        }
     }
 }
 
@@ -473,6 +837,56 @@ template <UST... t_args, FloatVectorRegister T_RegisterType>
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST... t_args, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto blend(T_RegisterType src_0, T_RegisterType src_1) noexcept -> T_RegisterType
+{
+    constexpr UST n_e          = num_integer_elements<T_ElementType, T_RegisterType>;
+    constexpr UST element_size = sizeof(T_ElementType);
+
+    static_assert(sizeof...(t_args) == n_e,
+                  "Number of template parameters must be equal to the number of register elements.");
+    static_assert(pack_all_less<t_args...>(2), "All template values must be in the range [0, 1]");
+
+    static constexpr std::array<UST, n_e> selection = {{t_args...}};
+
+    // Creates a blend mask with one bit per `t_block_size` bytes from the first `t_num_blocks` blocks
+    constexpr auto get_mask = []<UST t_block_size, UST t_num_blocks>() -> I32
+    {
+        I32 mask = 0;
+        for (UST i = 0; i < t_num_blocks; ++i)
+            if (selection.at(i * t_block_size / element_size) != 0)
+                mask |= 1 << i; // NOLINT(hicpp-signed-bitwise)
+        return mask;
+    };
+
+    constexpr UST dword_size = 4;
+    constexpr UST word_size  = 2;
+    constexpr UST n_words    = sizeof(__m128i) / word_size;
+
+    if constexpr (element_size >= dword_size)
+    {
+        constexpr UST n_dwords = sizeof(T_RegisterType) / dword_size;
+        return mm_blend_epi32<get_mask.template operator()<dword_size, n_dwords>()>(src_0, src_1);
+    }
+    else if constexpr (element_size == word_size && internal::is_lane_pattern_uniform<n_words>(selection))
+        return mm_blend_epi16<get_mask.template operator()<word_size, n_words>()>(src_0, src_1);
+    else
+    {
+        constexpr auto get_byte_mask = []() -> std::array<U8, sizeof(T_RegisterType)>
+        {
+            std::array<U8, sizeof(T_RegisterType)> bytes = {{0}};
+            for (UST i = 0; i < bytes.size(); ++i)
+                bytes.at(i) = (selection.at(i / element_size) != 0) ? std::numeric_limits<U8>::max() : 0;
+            return bytes;
+        };
+
+        return mm_blendv_epi8(src_0, src_1, internal::byte_register<T_RegisterType>(get_byte_mask()));
+    }
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <UST t_index, FloatVectorRegister T_RegisterType>
@@ -600,6 +1014,16 @@ template <UST t_index, FloatVectorRegister T_RegisterType>
         return mm_broadcast(src);
     else if constexpr (is_sse_register<T_RegisterType>)
         return broadcast<t_index>(src);
+    else if constexpr (is_m512<T_RegisterType>)
+    {
+        const __m512i mask = _mm512_set1_epi32(static_cast<I32>(t_index));
+        return _mm512_maskz_permutexvar_ps(internal::mm512_full_mask<T_RegisterType>, mask, src);
+    }
+    else if constexpr (is_m512d<T_RegisterType>)
+    {
+        const __m512i mask = _mm512_set1_epi64(static_cast<I64>(t_index));
+        return _mm512_maskz_permutexvar_pd(internal::mm512_full_mask<T_RegisterType>, mask, src);
+    }
     else
     {
         constexpr UST idx_value = t_index % num_lane_elements<T_RegisterType>;
@@ -610,55 +1034,61 @@ template <UST t_index, FloatVectorRegister T_RegisterType>
 }
 
 
-// --- internal functions of exchange ---------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------------------
 
-//! \cond DO_NOT_DOCUMENT
-namespace internal
-{
-//! Branch of the exchange function that covers cases where the exchanged elements are in the same register lane.
-template <UST t_idx_0, UST t_idx_1, FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto exchange_same_lane(T_RegisterType& reg_0, T_RegisterType& reg_1) noexcept
+template <UST t_index_0, UST t_index_1, FloatVectorRegister T_RegisterType>
+inline void exchange(T_RegisterType& reg_0, T_RegisterType& reg_1) noexcept
 {
-    constexpr UST n_le = num_lane_elements<T_RegisterType>;
+    constexpr UST n_e = num_elements<T_RegisterType>;
+    static_assert(t_index_0 < n_e && t_index_1 < n_e, "Indices exceed the register size.");
 
     T_RegisterType tmp_0 = reg_0;
-    T_RegisterType tmp_1 = reg_1;
-
-    if constexpr (t_idx_0 != t_idx_1)
-    {
-        tmp_0 = broadcast<t_idx_0 % n_le>(tmp_0);
-        tmp_1 = broadcast<t_idx_1 % n_le>(tmp_1);
-    }
 
-    reg_0 = blend_at<t_idx_0>(reg_0, tmp_1); // NOLINT(readability-misleading-indentation) - clang-tidy bug
-    reg_1 = blend_at<t_idx_1>(reg_1, tmp_0);
+    reg_0 = insert<t_index_1, t_index_0>(reg_1, reg_0);
+    reg_1 = insert<t_index_0, t_index_1>(tmp_0, reg_1);
 }
 
 
-// --------------------------------------------------------
-
+// --- internal functions of insert -----------------------------------------------------------------------------------
 
-//! Branch of the exchange function that covers cases where the exchanged elements are in different register lanes.
-template <UST t_idx_0, UST t_idx_1, FloatVectorRegister T_RegisterType>
-[[nodiscard]] inline auto exchange_different_lane(T_RegisterType& reg_0, T_RegisterType& reg_1) noexcept
+//! \cond DO_NOT_DOCUMENT
+namespace internal
 {
-    constexpr UST n_le       = num_lane_elements<T_RegisterType>;
-    constexpr UST lane_idx_0 = t_idx_0 / n_le;
-    constexpr UST lane_idx_1 = t_idx_1 / n_le;
-
-    constexpr UST select_reg_0  = (lane_idx_0 == 0) ? 1 : 0;
-    constexpr UST select_reg_1  = (lane_idx_1 == 0) ? 1 : 0;
-    constexpr U32 element_idx_0 = (lane_idx_0 == 0) ? t_idx_1 % n_le : t_idx_0 % n_le;
-    constexpr U32 element_idx_1 = (lane_idx_0 == 0) ? t_idx_0 % n_le : t_idx_1 % n_le;
-
+//! Return the permutation indices that move the element `t_index_src` to the position `t_index_dst`. All other elements
+//! are discarded by the subsequent blend. Therefore, the function tests several patterns that only agree at
+//! `t_index_dst` and returns the one with the cheapest permutation strategy.
+template <FloatVectorRegister T_RegisterType, UST t_index_src, UST t_index_dst>
+[[nodiscard]] consteval auto get_insert_indices() noexcept
+{
+    constexpr UST n_e  = num_elements<T_RegisterType>;
+    constexpr UST n_le = num_lane_elements<T_RegisterType>;
 
-    T_RegisterType tmp_0 = shuffle_lanes<select_reg_0, 1, select_reg_1, 0>(reg_0, reg_1);
+    // identity, broadcast of the source element, broadcast within each lane, copy of the source lane
+    std::array<std::array<UST, n_e>, 4> candidates = {};
+    for (UST i = 0; i < n_e; ++i)
+    {
+        candidates.at(0).at(i) = i;
+        candidates.at(1).at(i) = t_index_src;
+        candidates.at(2).at(i) = i - i % n_le + t_index_src % n_le;
+        candidates.at(3).at(i) = t_index_src - t_index_src % n_le + i % n_le;
+    }
+    candidates.at(0).at(t_index_dst) = t_index_src;
 
-    if constexpr (element_idx_0 != element_idx_1)
-        tmp_0 = broadcast<element_idx_0, element_idx_1>(tmp_0);
+    std::array<UST, n_e> best       = candidates.at(0);
+    UST                  best_score = get_permutation_cost(plan_permutation<T_RegisterType>(best)).score();
+    for (const auto& candidate : candidates)
+    {
+        if (candidate.at(t_index_dst) != t_index_src)
+            continue;
 
-    reg_0 = blend_at<t_idx_0>(reg_0, tmp_0);
-    reg_1 = blend_at<t_idx_1>(reg_1, tmp_0);
+        UST score = get_permutation_cost(plan_permutation<T_RegisterType>(candidate)).score();
+        if (score < best_score)
+        {
+            best       = candidate;
+            best_score = score;
+        }
+    }
+    return best;
 }
 
 } // namespace internal
@@ -667,37 +1097,38 @@ template <UST t_idx_0, UST t_idx_1, FloatVectorRegister T_RegisterType>
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <UST t_index_0, UST t_index_1, FloatVectorRegister T_RegisterType>
-inline void exchange(T_RegisterType& reg_0, T_RegisterType& reg_1) noexcept
+template <UST t_index_src, UST t_index_dst, bool... t_set_zero, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto insert(T_RegisterType src, T_RegisterType dst) noexcept -> T_RegisterType
 {
-    constexpr UST n_e        = num_elements<T_RegisterType>;
-    constexpr UST n_le       = num_lane_elements<T_RegisterType>;
-    constexpr UST lane_idx_0 = t_index_0 / n_le;
-    constexpr UST lane_idx_1 = t_index_1 / n_le;
-
-    static_assert(t_index_0 < n_e && t_index_1 < n_e, "Indices exceed the register size.");
+    constexpr UST n_e = num_elements<T_RegisterType>;
+    static_assert(t_index_src < n_e && t_index_dst < n_e, "Indices exceed the register size.");
+    static_assert(sizeof...(t_set_zero) == 0 || sizeof...(t_set_zero) == n_e,
+                  "Number of zero flags must be 0 or equal to the number of register elements.");
 
+    if constexpr (is_m128<T_RegisterType>)
+    {
+        constexpr UST set_zero_mask  = bit_construct<UST, t_set_zero...>(true);
+        constexpr UST selection_mask = bit_construct_from_ints<2, UST, t_index_src, t_index_dst>();
+        constexpr UST mask           = bit_construct_from_ints<4, UST, selection_mask, set_zero_mask>();
 
-    if constexpr (lane_idx_0 == lane_idx_1)
-        internal::exchange_same_lane<t_index_0, t_index_1>(reg_0, reg_1);
+        return _mm_insert_ps(dst, src, mask);
+    }
     else
-        internal::exchange_different_lane<t_index_0, t_index_1>(reg_0, reg_1);
-}
-
-
-// --------------------------------------------------------------------------------------------------------------------
+    {
+        static constexpr auto indices = internal::get_insert_indices<T_RegisterType, t_index_src, t_index_dst>();
 
-template <UST t_index_src, UST t_index_dst, bool... t_set_zero>
-inline auto insert(__m128 src, __m128 dst) noexcept -> __m128
-{
-    constexpr UST n_e = num_elements<__m128>;
-    static_assert(t_index_src < n_e && t_index_dst < n_e, "Indices exceed the register size.");
+        T_RegisterType moved = [src]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+        {
+            return permute_across_lanes<indices[t_i]...>(src);
+        }(std::make_index_sequence<n_e>());
 
-    constexpr UST set_zero_mask  = bit_construct<UST, t_set_zero...>(true);
-    constexpr UST selection_mask = bit_construct_from_ints<2, UST, t_index_src, t_index_dst>();
-    constexpr UST mask           = bit_construct_from_ints<4, UST, selection_mask, set_zero_mask>();
+        T_RegisterType result = blend_at<t_index_dst>(dst, moved);
 
-    return _mm_insert_ps(dst, src, mask);
+        if constexpr ((t_set_zero || ...))
+            return blend<static_cast<UST>(t_set_zero)...>(result, mm_setzero<T_RegisterType>());
+        else
+            return result;
+    }
 }
 
 
@@ -709,15 +1140,22 @@ template <UST... t_indices, FloatVectorRegister T_RegisterType>
     constexpr UST n_e  = num_elements<T_RegisterType>;
     constexpr UST n_le = num_lane_elements<T_RegisterType>;
 
-    static_assert(sizeof...(t_indices) == n_le || (is_avx_register<T_RegisterType> && sizeof...(t_indices) == n_e),
+    static_assert(sizeof...(t_indices) == n_le || (num_lanes<T_RegisterType> > 1 && sizeof...(t_indices) == n_e),
                   "Number of indices must be identical to the number of elements or the number of lane elements.");
     static_assert(pack_all_less<t_indices...>(n_le),
                   "All index values must be in the range [0, number of lane elements]");
 
     if constexpr (is_m256d<T_RegisterType> && sizeof...(t_indices) == n_le)
         return permute<t_indices..., t_indices...>(src);
+    else if constexpr (is_m512d<T_RegisterType> && sizeof...(t_indices) == n_le)
+        return permute<t_indices..., t_indices..., t_indices..., t_indices...>(src);
     else if constexpr (is_m256<T_RegisterType> && sizeof...(t_indices) == n_e)
         return _mm256_permutevar_ps(src, _mm256_setr_epi32(t_indices...));
+    else if constexpr (is_m512<T_RegisterType> && sizeof...(t_indices) == n_e)
+    {
+        const __m512i mask = internal::mm512_index_register<T_RegisterType>(std::array<UST, n_e>{{t_indices...}});
+        return _mm512_maskz_permutevar_ps(internal::mm512_full_mask<T_RegisterType>, src, mask);
+    }
     else
     {
         constexpr UST num_index_bits = num_lane_elements<T_RegisterType> / 2;
@@ -726,29 +1164,112 @@ template <UST... t_indices, FloatVectorRegister T_RegisterType>
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST... t_indices, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto permute(T_RegisterType src) noexcept -> T_RegisterType
+{
+    constexpr UST n_e          = num_integer_elements<T_ElementType, T_RegisterType>;
+    constexpr UST n_le         = num_integer_lane_elements<T_ElementType, T_RegisterType>;
+    constexpr UST element_size = sizeof(T_ElementType);
+
+    static_assert(sizeof...(t_indices) == n_le || (num_lanes<T_RegisterType> > 1 && sizeof...(t_indices) == n_e),
+                  "Number of indices must be identical to the number of elements or the number of lane elements.");
+    static_assert(pack_all_less<t_indices...>(n_le),
+                  "All index values must be in the range [0, number of lane elements]");
+
+    static constexpr auto indices =
+            internal::expand_lane_indices<n_e>(std::array<UST, sizeof...(t_indices)>{{t_indices...}});
+    constexpr UST dword_size = 4;
+
+    if constexpr (element_size >= dword_size && internal::is_lane_pattern_uniform<n_le>(indices))
+    {
+        constexpr auto get_mask = []() -> I32
+        {
+            constexpr UST n_dwords_per_element = element_size / dword_size;
+            constexpr UST n_index_bits         = 2;
+
+            I32 mask = 0;
+            for (UST i = 0; i < sizeof(__m128i) / dword_size; ++i)
+            {
+                UST element_index = indices.at(i / n_dwords_per_element);
+                UST dword_index   = element_index * n_dwords_per_element + i % n_dwords_per_element;
+                mask |= static_cast<I32>(dword_index << (i * n_index_bits));
+            }
+            return mask;
+        };
+
+        return mm_shuffle_epi32<get_mask()>(src);
+    }
+    else
+    {
+        constexpr auto control = internal::get_byte_shuffle_control<element_size, n_le>(indices);
+        return mm_shuffle_epi8(src, internal::byte_register<T_RegisterType>(control));
+    }
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <UST... t_indices, FloatVectorRegister T_RegisterType>
 [[nodiscard]] inline auto permute_across_lanes(T_RegisterType src) noexcept -> T_RegisterType
 {
-    constexpr UST n_e = num_elements<T_RegisterType>;
+    using enum internal::PermutationStrategy;
+
+    constexpr UST n_e  = num_elements<T_RegisterType>;
+    constexpr UST n_le = num_lane_elements<T_RegisterType>;
 
     static_assert(sizeof...(t_indices) == n_e, "Number of indices must be equal to the number of register elements.");
     static_assert(pack_all_less<t_indices...>(n_e),
                   "All template values must be in the range [0, number of register elements]");
 
-    if constexpr (num_lanes<T_RegisterType> == 1)
-        return permute<t_indices...>(src);
-    else if constexpr (is_m256d<T_RegisterType>)
+    static constexpr std::array<UST, n_e> indices  = {{t_indices...}};
+    constexpr auto                        strategy = internal::plan_permutation<T_RegisterType>(indices);
+
+    if constexpr (strategy == IDENTITY)
+        return src;
+    else if constexpr (strategy == IN_LANE_IMMEDIATE && is_single_precision<T_RegisterType>)
+        return [src]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+        {
+            return permute<indices[t_i]...>(src);
+        }(std::make_index_sequence<n_le>());
+    else if constexpr (strategy == IN_LANE_IMMEDIATE || strategy == IN_LANE_VARIABLE)
+        return permute<(t_indices % n_le)...>(src);
+    else if constexpr (strategy == LANE_PERMUTATION && FloatAVXRegister<T_RegisterType>)
+        return permute_lanes<indices[0] / n_le, indices[n_le] / n_le>(src);
+    else if constexpr (strategy == LANE_PERMUTATION)
     {
-        constexpr UST mask = bit_construct_from_ints<2, UST, t_indices...>(true);
-        return _mm256_permute4x64_pd(src, mask);
+        constexpr I32 mask = internal::get_lane_permutation_mask<n_le, 2>(indices);
+        if constexpr (is_m512<T_RegisterType>)
+            return _mm512_maskz_shuffle_f32x4(internal::mm512_full_mask<T_RegisterType>, src, src, mask);
+        else
+            return _mm512_maskz_shuffle_f64x2(internal::mm512_full_mask<T_RegisterType>, src, src, mask);
     }
-    else
+    else if constexpr (strategy == BROADCAST)
+        return mm_broadcast(src);
+    else if constexpr (strategy == CROSS_LANE_IMMEDIATE)
+    {
+        // only the indices of the first 256 bit half are needed
+        constexpr UST mask = bit_construct_from_ints<2, UST, (t_indices % 4)...>(true) & 0xFFU;
+        if constexpr (is_m256d<T_RegisterType>)
+            return _mm256_permute4x64_pd(src, mask);
+        else
+            return _mm512_maskz_permutex_pd(internal::mm512_full_mask<T_RegisterType>, src, mask);
+    }
+    else if constexpr (is_m256<T_RegisterType>)
     {
         const __m256i mask = _mm256_setr_epi32(t_indices...);
         return _mm256_permutevar8x32_ps(src, mask);
     }
+    else
+    {
+        const __m512i mask = internal::mm512_index_register<T_RegisterType>(indices);
+
+        if constexpr (is_m512<T_RegisterType>)
+            return _mm512_maskz_permutexvar_ps(internal::mm512_full_mask<T_RegisterType>, mask, src);
+        else
+            return _mm512_maskz_permutexvar_pd(internal::mm512_full_mask<T_RegisterType>, mask, src);
+    }
 }
 
 
@@ -769,8 +1290,11 @@ template <UST... t_indices, FloatVectorRegister T_RegisterType>
     constexpr UST n_e  = num_elements<T_RegisterType>;
     constexpr UST n_le = num_lane_elements<T_RegisterType>;
 
-    static_assert(sizeof...(t_indices) == n_le || (is_m256d<T_RegisterType> && sizeof...(t_indices) == n_e),
-                  "Number of indices must be identical to the number of lane elements (or elements for __m256d).");
+    static_assert(sizeof...(t_indices) == n_le
+                          || (is_double_precision<T_RegisterType> && num_lanes<T_RegisterType> > 1
+                              && sizeof...(t_indices) == n_e),
+                  "Number of indices must be identical to the number of lane elements (or elements for __m256d and "
+                  "__m512d).");
     static_assert(pack_all_less<t_indices...>(n_le),
                   "All index values must be in the range [0, number of lane elements]");
 
@@ -780,14 +1304,60 @@ template <UST... t_indices, FloatVectorRegister T_RegisterType>
             return bit_construct_from_ints<2, UST, t_indices...>(true);
         else if constexpr (sizeof...(t_indices) == num_elements<T_RegisterType>)
             return bit_construct<UST, t_indices...>(true);
-        else
+        else if constexpr (is_m256d<T_RegisterType>)
             return bit_construct<UST, t_indices..., t_indices...>(true);
+        else
+            return bit_construct<UST, t_indices..., t_indices..., t_indices..., t_indices...>(true);
     };
 
     return mm_shuffle<get_mask()>(src_0, src_1);
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <IntegerRegisterElement T_ElementType, UST... t_indices, IntegerSSEAVXRegister T_RegisterType>
+[[nodiscard]] inline auto shuffle(T_RegisterType src_0, T_RegisterType src_1) noexcept -> T_RegisterType
+{
+    if constexpr (sizeof(T_ElementType) == sizeof(F32))
+    {
+        using FloatRegister = std::conditional_t<is_m128i<T_RegisterType>, __m128, __m256>;
+        return mm_cast_fi(shuffle<t_indices...>(mm_cast_if<FloatRegister>(src_0), mm_cast_if<FloatRegister>(src_1)));
+    }
+    else if constexpr (sizeof(T_ElementType) == sizeof(F64))
+    {
+        using FloatRegister = std::conditional_t<is_m128i<T_RegisterType>, __m128d, __m256d>;
+        return mm_cast_fi(shuffle<t_indices...>(mm_cast_if<FloatRegister>(src_0), mm_cast_if<FloatRegister>(src_1)));
+    }
+    else
+    {
+        constexpr UST n_e  = num_integer_elements<T_ElementType, T_RegisterType>;
+        constexpr UST n_le = num_integer_lane_elements<T_ElementType, T_RegisterType>;
+
+        static_assert(sizeof...(t_indices) == n_le,
+                      "Number of indices must be identical to the number of lane elements.");
+        static_assert(pack_all_less<t_indices...>(n_le),
+                      "All index values must be in the range [0, number of lane elements]");
+
+        // Each source gets its own byte shuffle that zeros the elements taken from the other source
+        constexpr auto get_control = []<bool t_is_first_half>()
+        {
+            std::array<UST, n_e> indices = internal::expand_lane_indices<n_e>(std::array<UST, n_le>{{t_indices...}});
+            for (UST i = 0; i < n_e; ++i)
+                if ((i % n_le < n_le / 2) != t_is_first_half)
+                    indices.at(i) = n_le;
+            return internal::get_byte_shuffle_control<sizeof(T_ElementType), n_le>(indices);
+        };
+
+        constexpr auto control_0 = get_control.template operator()<true>();
+        constexpr auto control_1 = get_control.template operator()<false>();
+
+        return mm_or(mm_shuffle_epi8(src_0, internal::byte_register<T_RegisterType>(control_0)),
+                     mm_shuffle_epi8(src_1, internal::byte_register<T_RegisterType>(control_1)));
+    }
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <UST t_src_0, UST t_lane_0, UST t_src_1, UST t_lane_1, FloatAVXRegister T_RegisterType>
@@ -838,9 +1408,13 @@ template <UST t_idx_0, UST t_idx_1, FloatVectorRegister T_RegisterType>
         return permute<p[0], p[1]>(src);
     else if constexpr (n_e == 4)
         return permute<p[0], p[1], p[2], p[3]>(src);
-    else
+    else if constexpr (n_e == 8) // NOLINT(readability-magic-numbers)
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
         return permute<p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]>(src);
+    else
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        return permute<p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9], p[10], p[11], p[12], p[13], p[14],
+                       p[15]>(src);
 }
 
 
@@ -853,29 +1427,53 @@ template <UST t_idx_0, UST t_idx_1, FloatVectorRegister T_RegisterType>
     constexpr UST n_e  = num_elements<T_RegisterType>;
     constexpr UST n_le = num_lane_elements<T_RegisterType>;
 
-    constexpr U32 idx_lane_0 = (t_idx_0 < t_idx_1) ? t_idx_0 : t_idx_1;
-    constexpr U32 idx_lane_1 = ((t_idx_0 > t_idx_1) ? t_idx_0 : t_idx_1) % n_le;
+    if constexpr (is_avx512_register<T_RegisterType>)
+    {
+        constexpr auto get_permute_index_array = []() constexpr->std::array<UST, n_e>
+        {
+            std::array<UST, n_e> a = {{0}};
+            for (UST i = 0; i < n_e; ++i)
+                a.at(i) = i;
+            a.at(t_idx_0) = t_idx_1;
+            a.at(t_idx_1) = t_idx_0;
+            return a;
+        };
+        constexpr auto p = get_permute_index_array();
 
-    auto get_blend_index_array = []() constexpr->std::array<UST, n_e>
+        if constexpr (n_e == 8) // NOLINT(readability-magic-numbers)
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+            return permute_across_lanes<p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]>(src);
+        else
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+            return permute_across_lanes<p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9], p[10], p[11], p[12],
+                                        p[13], p[14], p[15]>(src);
+    }
+    else
     {
-        std::array<UST, n_e> a = {{0}};
-        for (UST i = 0; i < n_le; ++i)
+        constexpr U32 idx_lane_0 = (t_idx_0 < t_idx_1) ? t_idx_0 : t_idx_1;
+        constexpr U32 idx_lane_1 = ((t_idx_0 > t_idx_1) ? t_idx_0 : t_idx_1) % n_le;
+
+        auto get_blend_index_array = []() constexpr->std::array<UST, n_e>
         {
-            a[i]        = (idx_lane_0 == i) ? 1 : 0;
-            a[i + n_le] = (idx_lane_1 == i) ? 1 : 0;
-        }
-        return a;
-    };
-    constexpr auto b = get_blend_index_array();
+            std::array<UST, n_e> a = {{0}};
+            for (UST i = 0; i < n_le; ++i)
+            {
+                a[i]        = (idx_lane_0 == i) ? 1 : 0;
+                a[i + n_le] = (idx_lane_1 == i) ? 1 : 0;
+            }
+            return a;
+        };
+        constexpr auto b = get_blend_index_array();
 
 
-    T_RegisterType bc  = broadcast<idx_lane_0, idx_lane_1>(src);
-    T_RegisterType tmp = swap_lanes(bc);
-    if constexpr (n_e == 4)
-        return blend<b[0], b[1], b[2], b[3]>(src, tmp);
-    else
-        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-        return blend<b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]>(src, tmp);
+        T_RegisterType bc  = broadcast<idx_lane_0, idx_lane_1>(src);
+        T_RegisterType tmp = swap_lanes(bc);
+        if constexpr (n_e == 4)
+            return blend<b[0], b[1], b[2], b[3]>(src, tmp);
+        else
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+            return blend<b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]>(src, tmp);
+    }
 }
 
 } // namespace internal
@@ -0,0 +1,304 @@
+//! @file
+//! rounding.h
+//!
+//! @brief
+//! Contains element-wise rounding, clamping and float-integer conversion functions for vector registers.
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Selects the direction in which values are rounded to integers.
+//!
+//! @details
+//! The enumerator values match the rounding control bits of the x86 rounding instructions.
+enum class RoundingMode : UST
+{
+    NEAREST     = 0, //!< Round to the nearest integer. Ties are rounded to the even integer.
+    DOWN        = 1, //!< Round towards negative infinity
+    UP          = 2, //!< Round towards positive infinity
+    TOWARD_ZERO = 3  //!< Truncate the fractional part
+};
+
+
+//! @brief
+//! Round all elements up to the next integer.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The values that should be rounded
+//!
+//! @return
+//! Register with the rounded values
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto ceil(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Limit all elements of `src` to the range [`lower`, `upper`].
+//!
+//! @details
+//! The result is undefined if an element of `lower` is larger than the corresponding element of `upper`. If an element
+//! of `src` is NaN, the corresponding element of `lower` is returned.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The values that should be clamped
+//! @param[in] lower:
+//! The lower bounds
+//! @param[in] upper:
+//! The upper bounds
+//!
+//! @return
+//! Register with the clamped values
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto clamp(T_RegisterType src, T_RegisterType lower, T_RegisterType upper) noexcept
+        -> T_RegisterType;
+
+
+//! @brief
+//! Convert a register with 32 bit integer elements to a floating-point register.
+//!
+//! @details
+//! If `T_RegisterTypeOut` has double-precision elements, only the lower half of `src` is converted. The input for
+//! `__m128d` and `__m256d` is an `__m128i` and the input for `__m512d` is an `__m256i`. Otherwise, the input register
+//! has the same size as the output register.
+//!
+//! @tparam T_RegisterTypeOut:
+//! The floating-point register type that should be returned
+//! @tparam T_RegisterTypeIn:
+//! The integer register type
+//!
+//! @param[in] src:
+//! Register with 32 bit signed integer elements
+//!
+//! @return
+//! Register with the converted values
+template <FloatVectorRegister T_RegisterTypeOut, IntegerVectorRegister T_RegisterTypeIn>
+[[nodiscard]] inline auto convert_to_float(T_RegisterTypeIn src) noexcept -> T_RegisterTypeOut;
+
+
+//! @brief
+//! Round all elements with the selected rounding mode and convert them to 32 bit signed integers.
+//!
+//! @details
+//! Single-precision registers return an integer register of the same size. `__m128d` and `__m256d` return an
+//! `__m128i` and `__m512d` returns an `__m256i`. For `__m128d`, the upper two elements of the result are zero. Values
+//! that are NaN or outside of the range of `I32` yield the integer indefinite value `0x80000000`.
+//!
+//! @tparam t_mode:
+//! The rounding mode that is applied before the conversion
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The values that should be converted
+//!
+//! @return
+//! Integer register with the converted values
+template <RoundingMode t_mode = RoundingMode::NEAREST, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto convert_to_integer(T_RegisterType src) noexcept;
+
+
+//! @brief
+//! Round all elements down to the next integer.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The values that should be rounded
+//!
+//! @return
+//! Register with the rounded values
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto floor(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Round all elements to integers using the rounding mode selected at compile-time.
+//!
+//! @details
+//! The rounding is done by a single instruction and doesn't depend on the rounding mode of the MXCSR register.
+//! Floating-point exceptions are suppressed. Infinities, NaNs and signed zeros are preserved.
+//!
+//! @tparam t_mode:
+//! The rounding mode
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The values that should be rounded
+//!
+//! @return
+//! Register with the rounded values
+template <RoundingMode t_mode = RoundingMode::NEAREST, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto round(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @brief
+//! Round all elements towards zero.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The values that should be rounded
+//!
+//! @return
+//! Register with the rounded values
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto trunc(T_RegisterType src) noexcept -> T_RegisterType;
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/x86.h"
+
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto ceil(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return round<RoundingMode::UP>(src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto clamp(T_RegisterType src, T_RegisterType lower, T_RegisterType upper) noexcept
+        -> T_RegisterType
+{
+    return mm_min(mm_max(src, lower), upper);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterTypeOut, IntegerVectorRegister T_RegisterTypeIn>
+[[nodiscard]] inline auto convert_to_float(T_RegisterTypeIn src) noexcept -> T_RegisterTypeOut
+{
+    if constexpr (is_m128<T_RegisterTypeOut>)
+    {
+        static_assert(is_m128i<T_RegisterTypeIn>, "Input register must be of type `__m128i`.");
+        return _mm_cvtepi32_ps(src);
+    }
+    else if constexpr (is_m128d<T_RegisterTypeOut>)
+    {
+        static_assert(is_m128i<T_RegisterTypeIn>, "Input register must be of type `__m128i`.");
+        return _mm_cvtepi32_pd(src);
+    }
+    else if constexpr (is_m256<T_RegisterTypeOut>)
+    {
+        static_assert(is_m256i<T_RegisterTypeIn>, "Input register must be of type `__m256i`.");
+        return _mm256_cvtepi32_ps(src);
+    }
+    else if constexpr (is_m256d<T_RegisterTypeOut>)
+    {
+        static_assert(is_m128i<T_RegisterTypeIn>, "Input register must be of type `__m128i`.");
+        return _mm256_cvtepi32_pd(src);
+    }
+    else if constexpr (is_m512<T_RegisterTypeOut>)
+    {
+        static_assert(is_m512i<T_RegisterTypeIn>, "Input register must be of type `__m512i`.");
+        return _mm512_maskz_cvtepi32_ps(internal::mm512_full_mask<__m512>, src);
+    }
+    else
+    {
+        static_assert(is_m256i<T_RegisterTypeIn>, "Input register must be of type `__m256i`.");
+        return _mm512_maskz_cvtepi32_pd(internal::mm512_full_mask<__m512d>, src);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <RoundingMode t_mode, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto convert_to_integer(T_RegisterType src) noexcept
+{
+    // The truncating conversions are exact for integral values, so they don't depend on the MXCSR rounding mode
+    if constexpr (t_mode != RoundingMode::TOWARD_ZERO)
+        src = round<t_mode>(src);
+
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_cvttps_epi32(src);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_cvttpd_epi32(src);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_cvttps_epi32(src);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_cvttpd_epi32(src);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_cvttps_epi32(internal::mm512_full_mask<__m512>, src);
+    else
+        return _mm512_maskz_cvttpd_epi32(internal::mm512_full_mask<__m512d>, src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto floor(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return round<RoundingMode::DOWN>(src);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <RoundingMode t_mode, FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto round(T_RegisterType src) noexcept -> T_RegisterType
+{
+    constexpr auto imm = static_cast<I32>(t_mode) | _MM_FROUND_NO_EXC;
+
+    if constexpr (is_m128<T_RegisterType>)
+        return _mm_round_ps(src, imm);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return _mm_round_pd(src, imm);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_round_ps(src, imm);
+    else if constexpr (is_m256d<T_RegisterType>)
+        return _mm256_round_pd(src, imm);
+    else if constexpr (is_m512<T_RegisterType>)
+        return _mm512_maskz_roundscale_ps(internal::mm512_full_mask<__m512>, src, imm);
+    else
+        return _mm512_maskz_roundscale_pd(internal::mm512_full_mask<__m512d>, src, imm);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto trunc(T_RegisterType src) noexcept -> T_RegisterType
+{
+    return round<RoundingMode::TOWARD_ZERO>(src);
+}
+
+
+} // namespace mjolnir::x86
@@ -144,8 +144,10 @@ template <FloatVectorRegister T_RegisterType>
         return negate_selected<1, 1>(src);
     else if constexpr (n_e == 4)
         return negate_selected<1, 1, 1, 1>(src);
-    else
+    else if constexpr (n_e == 8) // NOLINT(readability-magic-numbers)
         return negate_selected<1, 1, 1, 1, 1, 1, 1, 1>(src);
+    else
+        return negate_selected<1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1>(src);
 }
 
 
@@ -0,0 +1,401 @@
+//! @file
+//! tolerance_comparison.h
+//!
+//! @brief
+//! Contains element-wise comparisons with tolerances for vector registers and arrays.
+
+
+#pragma once
+
+
+// === DECLARATIONS ===================================================================================================
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/is_close.h"
+#include "mjolnir/core/x86/definitions.h"
+
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Return `true` if all elements of two arrays differ by no more than an absolute tolerance.
+//!
+//! @details
+//! The arrays are compared with unaligned loads in blocks of `t_num_registers` registers. The function returns as soon
+//! as a block contains a pair of elements that is not close. The remaining elements that don't fill a register are
+//! compared with the scalar version of `is_close_abs`. NaN values are never close to any other value.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the comparison
+//! @tparam t_num_registers:
+//! Number of registers that are compared before the result is checked
+//!
+//! @param[in] lhs:
+//! Pointer to the first array
+//! @param[in] rhs:
+//! Pointer to the second array
+//! @param[in] size:
+//! Number of array elements
+//! @param[in] tolerance:
+//! The absolute tolerance
+//!
+//! @return
+//! `true` if all elements are close and `false` otherwise
+template <FloatVectorRegister T_RegisterType, UST t_num_registers = 4>
+[[nodiscard]] inline auto
+array_is_close_abs(const ElementType<T_RegisterType>* lhs,
+                   const ElementType<T_RegisterType>* rhs,
+                   UST                                size,
+                   ElementType<T_RegisterType> tolerance = default_tolerance_abs<ElementType<T_RegisterType>>) noexcept
+        -> bool;
+
+
+//! @brief
+//! Return `true` if all elements of two arrays differ by no more than a tolerance relative to the larger magnitude of
+//! each pair of elements.
+//!
+//! @details
+//! See `array_is_close_abs` for details.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the comparison
+//! @tparam t_num_registers:
+//! Number of registers that are compared before the result is checked
+//!
+//! @param[in] lhs:
+//! Pointer to the first array
+//! @param[in] rhs:
+//! Pointer to the second array
+//! @param[in] size:
+//! Number of array elements
+//! @param[in] tolerance:
+//! The relative tolerance
+//!
+//! @return
+//! `true` if all elements are close and `false` otherwise
+template <FloatVectorRegister T_RegisterType, UST t_num_registers = 4>
+[[nodiscard]] inline auto
+array_is_close_rel(const ElementType<T_RegisterType>* lhs,
+                   const ElementType<T_RegisterType>* rhs,
+                   UST                                size,
+                   ElementType<T_RegisterType> tolerance = default_tolerance_rel<ElementType<T_RegisterType>>) noexcept
+        -> bool;
+
+
+//! @brief
+//! Return `true` if all elements of `lhs` and `rhs` differ by no more than an absolute tolerance.
+//!
+//! @details
+//! An element is close if `|lhs - rhs| <= tolerance`. NaN values are never close to any other value.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! Left-hand side register
+//! @param[in] rhs:
+//! Right-hand side register
+//! @param[in] tolerance:
+//! The absolute tolerance
+//!
+//! @return
+//! `true` if all elements are close and `false` otherwise
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_abs(T_RegisterType              lhs,
+             T_RegisterType              rhs,
+             ElementType<T_RegisterType> tolerance = default_tolerance_abs<ElementType<T_RegisterType>>) noexcept
+        -> bool;
+
+
+//! @brief
+//! Compare the elements of `lhs` and `rhs` with an absolute tolerance and return the results as a bitmask.
+//!
+//! @details
+//! The N-th bit of the result is set if the N-th elements are close. See `is_close_abs` for details.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! Left-hand side register
+//! @param[in] rhs:
+//! Right-hand side register
+//! @param[in] tolerance:
+//! The absolute tolerance
+//!
+//! @return
+//! Bitmask with the comparison results
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_abs_mask(T_RegisterType              lhs,
+                  T_RegisterType              rhs,
+                  ElementType<T_RegisterType> tolerance = default_tolerance_abs<ElementType<T_RegisterType>>) noexcept
+        -> U32;
+
+
+//! @brief
+//! Return `true` if all elements of `lhs` and `rhs` differ by no more than a tolerance relative to the larger magnitude
+//! of each pair of elements.
+//!
+//! @details
+//! An element is close if `|lhs - rhs| <= tolerance * max(|lhs|, |rhs|)`. NaN values are never close to any other
+//! value.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! Left-hand side register
+//! @param[in] rhs:
+//! Right-hand side register
+//! @param[in] tolerance:
+//! The relative tolerance
+//!
+//! @return
+//! `true` if all elements are close and `false` otherwise
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_rel(T_RegisterType              lhs,
+             T_RegisterType              rhs,
+             ElementType<T_RegisterType> tolerance = default_tolerance_rel<ElementType<T_RegisterType>>) noexcept
+        -> bool;
+
+
+//! @brief
+//! Compare the elements of `lhs` and `rhs` with a relative tolerance and return the results as a bitmask.
+//!
+//! @details
+//! The N-th bit of the result is set if the N-th elements are close. See `is_close_rel` for details.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] lhs:
+//! Left-hand side register
+//! @param[in] rhs:
+//! Right-hand side register
+//! @param[in] tolerance:
+//! The relative tolerance
+//!
+//! @return
+//! Bitmask with the comparison results
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_rel_mask(T_RegisterType              lhs,
+                  T_RegisterType              rhs,
+                  ElementType<T_RegisterType> tolerance = default_tolerance_rel<ElementType<T_RegisterType>>) noexcept
+        -> U32;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Return `true` if `close_func` is true for all register pairs of both arrays and `scalar_func` for all remaining
+//! element pairs. The function returns early if a block of `t_num_registers` registers contains a pair that isn't
+//! close.
+template <FloatVectorRegister T_RegisterType, UST t_num_registers, typename T_CloseFunc, typename T_ScalarFunc>
+[[nodiscard]] inline auto array_is_close(const ElementType<T_RegisterType>* lhs,
+                                         const ElementType<T_RegisterType>* rhs,
+                                         UST                                size,
+                                         T_CloseFunc                        close_func,
+                                         T_ScalarFunc                       scalar_func) noexcept -> bool;
+
+
+//! Return a register where all bits of the elements that are within the absolute tolerance are set.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_close_abs(T_RegisterType lhs, T_RegisterType rhs, T_RegisterType tolerance) noexcept
+        -> T_RegisterType;
+
+
+//! Return a register where all bits of the elements that are within the relative tolerance are set.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_close_rel(T_RegisterType lhs, T_RegisterType rhs, T_RegisterType tolerance) noexcept
+        -> T_RegisterType;
+
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/sign_manipulation.h"
+#include "mjolnir/core/x86/x86.h"
+
+#include <utility>
+
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_registers>
+[[nodiscard]] inline auto array_is_close_abs(const ElementType<T_RegisterType>* lhs,
+                                             const ElementType<T_RegisterType>* rhs,
+                                             UST                                size,
+                                             ElementType<T_RegisterType>        tolerance) noexcept -> bool
+{
+    const auto tolerance_reg = mm_set1<T_RegisterType>(tolerance);
+
+    return internal::array_is_close<T_RegisterType, t_num_registers>(
+            lhs,
+            rhs,
+            size,
+            [tolerance_reg](T_RegisterType a, T_RegisterType b)
+            { return internal::compare_close_abs(a, b, tolerance_reg); },
+            [tolerance](auto a, auto b) { return mjolnir::is_close_abs(a, b, tolerance); });
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_registers>
+[[nodiscard]] inline auto array_is_close_rel(const ElementType<T_RegisterType>* lhs,
+                                             const ElementType<T_RegisterType>* rhs,
+                                             UST                                size,
+                                             ElementType<T_RegisterType>        tolerance) noexcept -> bool
+{
+    const auto tolerance_reg = mm_set1<T_RegisterType>(tolerance);
+
+    return internal::array_is_close<T_RegisterType, t_num_registers>(
+            lhs,
+            rhs,
+            size,
+            [tolerance_reg](T_RegisterType a, T_RegisterType b)
+            { return internal::compare_close_rel(a, b, tolerance_reg); },
+            [tolerance](auto a, auto b) { return mjolnir::is_close_rel(a, b, tolerance); });
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_abs(T_RegisterType lhs, T_RegisterType rhs, ElementType<T_RegisterType> tolerance) noexcept -> bool
+{
+    constexpr U32 all_set = (1U << num_elements<T_RegisterType>) - 1U;
+    return is_close_abs_mask(lhs, rhs, tolerance) == all_set;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_abs_mask(T_RegisterType lhs, T_RegisterType rhs, ElementType<T_RegisterType> tolerance) noexcept -> U32
+{
+    return mm_movemask(internal::compare_close_abs(lhs, rhs, mm_set1<T_RegisterType>(tolerance)));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_rel(T_RegisterType lhs, T_RegisterType rhs, ElementType<T_RegisterType> tolerance) noexcept -> bool
+{
+    constexpr U32 all_set = (1U << num_elements<T_RegisterType>) - 1U;
+    return is_close_rel_mask(lhs, rhs, tolerance) == all_set;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto
+is_close_rel_mask(T_RegisterType lhs, T_RegisterType rhs, ElementType<T_RegisterType> tolerance) noexcept -> U32
+{
+    return mm_movemask(internal::compare_close_rel(lhs, rhs, mm_set1<T_RegisterType>(tolerance)));
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_registers, typename T_CloseFunc, typename T_ScalarFunc>
+[[nodiscard]] inline auto array_is_close(const ElementType<T_RegisterType>* lhs,
+                                         const ElementType<T_RegisterType>* rhs,
+                                         UST                                size,
+                                         T_CloseFunc                        close_func,
+                                         T_ScalarFunc                       scalar_func) noexcept -> bool
+{
+    static_assert(t_num_registers > 0, "At least one register is required.");
+
+    constexpr UST n_e        = num_elements<T_RegisterType>;
+    constexpr UST block_size = n_e * t_num_registers;
+    constexpr U32 all_set    = (1U << n_e) - 1U;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto compare_register = [lhs, rhs, close_func](UST offset) -> T_RegisterType
+    {
+        return close_func(mm_loadu<T_RegisterType>(lhs + offset), mm_loadu<T_RegisterType>(rhs + offset));
+    };
+
+    // the results of a block are combined, so that only a single branch per block is needed
+    UST offset = 0;
+    for (; offset + block_size <= size; offset += block_size)
+    {
+        T_RegisterType result = compare_register(offset);
+        [&]<UST... t_idx>(std::index_sequence<t_idx...>)
+        {
+            ((result = mm_and(result, compare_register(offset + (t_idx + 1) * n_e))), ...);
+        }(std::make_index_sequence<t_num_registers - 1>());
+
+        if (mm_movemask(result) != all_set)
+            return false;
+    }
+
+    for (; offset + n_e <= size; offset += n_e)
+        if (mm_movemask(compare_register(offset)) != all_set)
+            return false;
+
+    for (; offset < size; ++offset)
+        if (! scalar_func(lhs[offset], rhs[offset]))
+            return false;
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return true;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_close_abs(T_RegisterType lhs, T_RegisterType rhs, T_RegisterType tolerance) noexcept
+        -> T_RegisterType
+{
+    return mm_cmp_le(abs(mm_sub(lhs, rhs)), tolerance);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto compare_close_rel(T_RegisterType lhs, T_RegisterType rhs, T_RegisterType tolerance) noexcept
+        -> T_RegisterType
+{
+    T_RegisterType max_magnitude = mm_max(abs(lhs), abs(rhs));
+    return mm_cmp_le(abs(mm_sub(lhs, rhs)), mm_mul(tolerance, max_magnitude));
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
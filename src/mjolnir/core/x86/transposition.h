@@ -0,0 +1,345 @@
+//! @file
+//! transposition.h
+//!
+//! @brief
+//! Contains functions to transpose blocks of vector registers and to convert between array-of-structures and
+//! structure-of-arrays data layouts.
+
+
+#pragma once
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+
+#include <array>
+
+namespace mjolnir::x86
+{
+//! \addtogroup core_x86
+//! @{
+
+
+//! @brief
+//! Convert an array of structures into a structure of arrays.
+//!
+//! @details
+//! Each structure consists of `t_num_components` consecutive values. The components are written to separate arrays.
+//! Blocks of `num_elements<T_RegisterType>` structures are loaded and transposed with `transpose_lanes`. The
+//! remaining structures are copied one by one.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the conversion. AVX-512 registers are not supported.
+//! @tparam t_num_components:
+//! Number of components per structure. It must not exceed the number of lane elements of the register.
+//!
+//! @param[in] aos:
+//! Pointer to the array of structures. It doesn't need to be aligned.
+//! @param[out] soa:
+//! One pointer per component to the arrays that receive the component values. They don't need to be aligned.
+//! @param[in] num_structs:
+//! Number of structures
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+inline void aos_to_soa(const ElementType<T_RegisterType>*                                aos,
+                       const std::array<ElementType<T_RegisterType>*, t_num_components>& soa,
+                       UST                                                               num_structs) noexcept;
+
+
+//! @brief
+//! Convert a structure of arrays into an array of structures.
+//!
+//! @details
+//! This is the inverse operation of `aos_to_soa`.
+//!
+//! @tparam T_RegisterType:
+//! The register type that is used for the conversion. AVX-512 registers are not supported.
+//! @tparam t_num_components:
+//! Number of components per structure. It must not exceed the number of lane elements of the register.
+//!
+//! @param[in] soa:
+//! One pointer per component to the arrays that contain the component values. They don't need to be aligned.
+//! @param[out] aos:
+//! Pointer to the array of structures. It doesn't need to be aligned.
+//! @param[in] num_structs:
+//! Number of structures
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+inline void soa_to_aos(const std::array<const ElementType<T_RegisterType>*, t_num_components>& soa,
+                       ElementType<T_RegisterType>*                                            aos,
+                       UST                                                                     num_structs) noexcept;
+
+
+//! @brief
+//! Transpose a square matrix that is stored as an array of registers where each register represents a row.
+//!
+//! @details
+//! The matrix has as many rows as the register has elements: 2x2 for `__m128d`, 4x4 for `__m128` and `__m256d` and
+//! 8x8 for `__m256`. AVX-512 registers are not supported.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The rows of the matrix
+//!
+//! @return
+//! The rows of the transposed matrix
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto transpose(const std::array<T_RegisterType, num_elements<T_RegisterType>>& src) noexcept
+        -> std::array<T_RegisterType, num_elements<T_RegisterType>>;
+
+
+//! @brief
+//! Transpose the square matrices that are formed by the lanes of an array of registers.
+//!
+//! @details
+//! Each lane of the registers contains one row of an independent matrix with as many rows as a lane has elements.
+//! Single precision registers contain 4x4 matrices and double precision registers 2x2 matrices. For 128 bit
+//! registers, this is identical to `transpose`.
+//!
+//! @tparam T_RegisterType:
+//! The register type
+//!
+//! @param[in] src:
+//! The rows of the matrices
+//!
+//! @return
+//! The rows of the transposed matrices
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto transpose_lanes(const std::array<T_RegisterType, num_lane_elements<T_RegisterType>>& src)
+        noexcept -> std::array<T_RegisterType, num_lane_elements<T_RegisterType>>;
+
+
+// --- internal declarations ------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+//! Load the structure at `ptr` into the first lane and the structure that is `num_lane_elements` structures behind it
+//! into the second lane of an AVX register. For SSE registers, only the first structure is loaded.
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+[[nodiscard]] inline auto load_aos_lanes(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType;
+
+//! Inverse operation of `load_aos_lanes`.
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+inline void store_aos_lanes(ElementType<T_RegisterType>* ptr, T_RegisterType src) noexcept;
+} // namespace internal
+//! \endcond
+
+
+//! @}
+} // namespace mjolnir::x86
+
+
+// === DEFINITIONS ====================================================================================================
+
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/permutation.h"
+#include "mjolnir/core/x86/x86.h"
+
+namespace mjolnir::x86
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+inline void aos_to_soa(const ElementType<T_RegisterType>*                                aos,
+                       const std::array<ElementType<T_RegisterType>*, t_num_components>& soa,
+                       UST                                                               num_structs) noexcept
+{
+    constexpr UST n_e  = num_elements<T_RegisterType>;
+    constexpr UST n_le = num_lane_elements<T_RegisterType>;
+
+    static_assert(! is_avx512_register<T_RegisterType>, "AVX-512 registers are not supported.");
+    static_assert(t_num_components > 0 && t_num_components <= n_le,
+                  "Number of components must be in the range [1, number of lane elements].");
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const UST num_block_structs = num_structs - num_structs % n_e;
+
+    for (UST idx = 0; idx < num_block_structs; idx += n_e)
+    {
+        std::array<T_RegisterType, n_le> rows = {};
+        for (UST i = 0; i < n_le; ++i)
+            rows.at(i) = internal::load_aos_lanes<T_RegisterType, t_num_components>(aos + (idx + i) * t_num_components);
+
+        std::array<T_RegisterType, n_le> columns = transpose_lanes(rows);
+        for (UST c = 0; c < t_num_components; ++c)
+            mm_storeu(soa.at(c) + idx, columns.at(c));
+    }
+
+    for (UST idx = num_block_structs; idx < num_structs; ++idx)
+        for (UST c = 0; c < t_num_components; ++c)
+            soa.at(c)[idx] = aos[idx * t_num_components + c];
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+inline void soa_to_aos(const std::array<const ElementType<T_RegisterType>*, t_num_components>& soa,
+                       ElementType<T_RegisterType>*                                            aos,
+                       UST                                                                     num_structs) noexcept
+{
+    constexpr UST n_e  = num_elements<T_RegisterType>;
+    constexpr UST n_le = num_lane_elements<T_RegisterType>;
+
+    static_assert(! is_avx512_register<T_RegisterType>, "AVX-512 registers are not supported.");
+    static_assert(t_num_components > 0 && t_num_components <= n_le,
+                  "Number of components must be in the range [1, number of lane elements].");
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const UST num_block_structs = num_structs - num_structs % n_e;
+
+    for (UST idx = 0; idx < num_block_structs; idx += n_e)
+    {
+        std::array<T_RegisterType, n_le> columns = {};
+        for (UST c = 0; c < t_num_components; ++c)
+            columns.at(c) = mm_loadu<T_RegisterType>(soa.at(c) + idx);
+        for (UST c = t_num_components; c < n_le; ++c)
+            columns.at(c) = mm_setzero<T_RegisterType>();
+
+        std::array<T_RegisterType, n_le> rows = transpose_lanes(columns);
+        for (UST i = 0; i < n_le; ++i)
+            internal::store_aos_lanes<T_RegisterType, t_num_components>(aos + (idx + i) * t_num_components,
+                                                                        rows.at(i));
+    }
+
+    for (UST idx = num_block_structs; idx < num_structs; ++idx)
+        for (UST c = 0; c < t_num_components; ++c)
+            aos[idx * t_num_components + c] = soa.at(c)[idx];
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto transpose(const std::array<T_RegisterType, num_elements<T_RegisterType>>& src) noexcept
+        -> std::array<T_RegisterType, num_elements<T_RegisterType>>
+{
+    static_assert(! is_avx512_register<T_RegisterType>, "AVX-512 registers are not supported.");
+
+    if constexpr (is_sse_register<T_RegisterType>)
+        return transpose_lanes(src);
+    else
+    {
+        constexpr UST n_le = num_lane_elements<T_RegisterType>;
+
+        std::array<T_RegisterType, n_le> upper = {};
+        std::array<T_RegisterType, n_le> lower = {};
+        for (UST i = 0; i < n_le; ++i)
+        {
+            upper.at(i) = src.at(i);
+            lower.at(i) = src.at(i + n_le);
+        }
+
+        // Transposing the lanes leaves the results for the columns of the first half in the lower lanes and those
+        // of the second half in the upper lanes. They only need to be recombined.
+        upper = transpose_lanes(upper);
+        lower = transpose_lanes(lower);
+
+        std::array<T_RegisterType, num_elements<T_RegisterType>> res = {};
+        for (UST i = 0; i < n_le; ++i)
+        {
+            res.at(i)        = shuffle_lanes<0, 0, 1, 0>(upper.at(i), lower.at(i));
+            res.at(i + n_le) = shuffle_lanes<0, 1, 1, 1>(upper.at(i), lower.at(i));
+        }
+        return res;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] inline auto transpose_lanes(const std::array<T_RegisterType, num_lane_elements<T_RegisterType>>& src)
+        noexcept -> std::array<T_RegisterType, num_lane_elements<T_RegisterType>>
+{
+    if constexpr (is_single_precision<T_RegisterType>)
+    {
+        T_RegisterType tmp_0 = shuffle<0, 1, 0, 1>(src[0], src[1]);
+        T_RegisterType tmp_1 = shuffle<2, 3, 2, 3>(src[0], src[1]);
+        T_RegisterType tmp_2 = shuffle<0, 1, 0, 1>(src[2], src[3]);
+        T_RegisterType tmp_3 = shuffle<2, 3, 2, 3>(src[2], src[3]);
+
+        return {{shuffle<0, 2, 0, 2>(tmp_0, tmp_2),
+                 shuffle<1, 3, 1, 3>(tmp_0, tmp_2),
+                 shuffle<0, 2, 0, 2>(tmp_1, tmp_3),
+                 shuffle<1, 3, 1, 3>(tmp_1, tmp_3)}};
+    }
+    else
+        return {{shuffle<0, 0>(src[0], src[1]), shuffle<1, 1>(src[0], src[1])}};
+}
+
+
+// --- internal definitions -------------------------------------------------------------------------------------------
+
+//! \cond DO_NOT_DOCUMENT
+namespace internal
+{
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+[[nodiscard]] inline auto load_aos_lanes(const ElementType<T_RegisterType>* ptr) noexcept -> T_RegisterType
+{
+    constexpr UST offset = num_lane_elements<T_RegisterType> * t_num_components;
+
+    auto load_lane = []<FloatSSERegister T_LaneType>(const ElementType<T_LaneType>* lane_ptr) -> T_LaneType
+    {
+        if constexpr (t_num_components == num_elements<T_LaneType>)
+            return mm_loadu<T_LaneType>(lane_ptr);
+        else
+            return mm_load_partial<T_LaneType>(lane_ptr, t_num_components);
+    };
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if constexpr (is_m128<T_RegisterType>)
+        return load_lane.template operator()<__m128>(ptr);
+    else if constexpr (is_m128d<T_RegisterType>)
+        return load_lane.template operator()<__m128d>(ptr);
+    else if constexpr (is_m256<T_RegisterType>)
+        return _mm256_set_m128(load_lane.template operator()<__m128>(ptr + offset),
+                               load_lane.template operator()<__m128>(ptr));
+    else
+        return _mm256_set_m128d(load_lane.template operator()<__m128d>(ptr + offset),
+                                load_lane.template operator()<__m128d>(ptr));
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+inline void store_aos_lanes(ElementType<T_RegisterType>* ptr, T_RegisterType src) noexcept
+{
+    constexpr UST offset = num_lane_elements<T_RegisterType> * t_num_components;
+
+    auto store_lane = []<FloatSSERegister T_LaneType>(ElementType<T_LaneType>* lane_ptr, T_LaneType lane)
+    {
+        if constexpr (t_num_components == num_elements<T_LaneType>)
+            mm_storeu(lane_ptr, lane);
+        else
+            mm_store_partial(lane_ptr, lane, t_num_components);
+    };
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if constexpr (is_sse_register<T_RegisterType>)
+        store_lane(ptr, src);
+    else if constexpr (is_m256<T_RegisterType>)
+    {
+        store_lane(ptr, _mm256_castps256_ps128(src));
+        store_lane(ptr + offset, _mm256_extractf128_ps(src, 1));
+    }
+    else
+    {
+        store_lane(ptr, _mm256_castpd256_pd128(src));
+        store_lane(ptr + offset, _mm256_extractf128_pd(src, 1));
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+} // namespace internal
+//! \endcond
+
+
+} // namespace mjolnir::x86
@@ -8,10 +8,15 @@
 #pragma once
 
 
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/math/math.h"
 #include "mjolnir/core/x86/definitions.h"
 #include "mjolnir/core/x86/x86.h"
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+
 
 //! \addtogroup testing
 //! @{
@@ -21,14 +26,71 @@
 //!
 //! @tparam T_RegisterType
 //! Template variable for the register type
+//!
+//! @details
+//! If the AVX-512 support is enabled, the suite also covers the AVX-512 registers. The build system only enables it for
+//! the tests if the building CPU supports AVX-512F.
 template <mjolnir::x86::FloatVectorRegister T_RegisterType>
 class FloatingPointVectorRegisterTestSuite : public ::testing::Test
 {
 };
 
 
+//! @brief
+//! Get the number of test cases for tests that iterate over all combinations of a boolean flag per register element.
+//!
+//! @details
+//! Testing all combinations of registers with 16 elements would result in an excessive number of template
+//! instantiations. Therefore, the number of test cases is limited to 256 for those registers. Use
+//! `get_element_flag_test_case_bits` to get the corresponding flags.
+//!
+//! @tparam T_RegisterType
+//! Register type
+//!
+//! @return
+//! Number of test cases
+template <mjolnir::x86::FloatVectorRegister T_RegisterType>
+[[nodiscard]] consteval auto get_num_element_flag_test_cases() noexcept -> mjolnir::UST
+{
+    constexpr mjolnir::UST max_num_elements = 8;
+    return mjolnir::power_of_2(std::min(mjolnir::x86::num_elements<T_RegisterType>, max_num_elements));
+}
+
+
+//! @brief
+//! Get an integer where each bit represents the boolean flag of the corresponding register element for a test case.
+//!
+//! @details
+//! For registers with up to 8 elements, the test case index is returned. For larger registers, the upper 8 bits are
+//! set to the inverted lower 8 bits, so that each element is tested with both flag values.
+//!
+//! @tparam T_RegisterType
+//! Register type
+//!
+//! @param[in] test_case_index:
+//! Index of the test case
+//!
+//! @return
+//! Integer with the flag bits
+template <mjolnir::x86::FloatVectorRegister T_RegisterType>
+[[nodiscard]] constexpr auto get_element_flag_test_case_bits(mjolnir::UST test_case_index) noexcept -> mjolnir::UST
+{
+    constexpr mjolnir::UST max_num_elements = 8;
+    constexpr mjolnir::UST byte_mask        = 0xFF;
+
+    if constexpr (mjolnir::x86::num_elements<T_RegisterType> <= max_num_elements)
+        return test_case_index;
+    else
+        return test_case_index | ((byte_mask - test_case_index) << max_num_elements);
+}
+
+
 //! \cond DO_NOT_DOCUMENT
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+using VectorRegisterTestTypes = ::testing::Types<__m128, __m128d, __m256, __m256d, __m512, __m512d>; // NOLINT
+#else
 using VectorRegisterTestTypes = ::testing::Types<__m128, __m128d, __m256, __m256d>; // NOLINT
+#endif
 
 
 //! The comma at the end of the typed test series call is necessary to suppress a warning. See the following link for
@@ -0,0 +1,163 @@
+//! @file
+//! integer_vector_register_test_suite.h
+//!
+//! @brief
+//! Contains the test suite for vector registers based on integer types
+
+
+#pragma once
+
+
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/x86.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <limits>
+
+
+//! \addtogroup testing
+//! @{
+
+//! @brief
+//! Combination of an integer element type and an integer register type that is used as parameter of the
+//! `IntegerVectorRegisterTestSuite`.
+//!
+//! @tparam T_ElementType
+//! Integer type of the register elements
+//! @tparam T_RegisterType
+//! Register type
+template <mjolnir::x86::IntegerRegisterElement T_ElementType, mjolnir::x86::IntegerSSEAVXRegister T_RegisterType>
+struct IntegerRegisterTestCase
+{
+    using ElementType  = T_ElementType;  //!< Integer type of the register elements
+    using RegisterType = T_RegisterType; //!< Register type
+
+    //! Number of register elements
+    static constexpr mjolnir::UST num_elements = mjolnir::x86::num_integer_elements<T_ElementType, T_RegisterType>;
+
+    //! Array type that stores all register elements
+    using ArrayType = std::array<T_ElementType, num_elements>;
+};
+
+
+//!@brief
+//! The test suite for all supported combinations of x86 integer registers and integer element types.
+//!
+//! @tparam T_TestCase
+//! An `IntegerRegisterTestCase`
+template <typename T_TestCase>
+class IntegerVectorRegisterTestSuite : public ::testing::Test
+{
+};
+
+
+//! @brief
+//! Store the elements of an integer register in an array.
+//!
+//! @tparam T_TestCase
+//! An `IntegerRegisterTestCase`
+//!
+//! @param[in] src:
+//! Source register
+//!
+//! @return
+//! Array with the register elements
+template <typename T_TestCase>
+[[nodiscard]] auto to_element_array(typename T_TestCase::RegisterType src) noexcept -> typename T_TestCase::ArrayType
+{
+    return std::bit_cast<typename T_TestCase::ArrayType>(src);
+}
+
+
+//! @brief
+//! Load the elements of an integer register from an array.
+//!
+//! @tparam T_TestCase
+//! An `IntegerRegisterTestCase`
+//!
+//! @param[in] values:
+//! Array with the register elements
+//!
+//! @return
+//! Register with the values of the array
+template <typename T_TestCase>
+[[nodiscard]] auto to_register(const typename T_TestCase::ArrayType& values) noexcept ->
+        typename T_TestCase::RegisterType
+{
+    return std::bit_cast<typename T_TestCase::RegisterType>(values);
+}
+
+
+//! @brief
+//! Get an array with test values for the elements of an integer register.
+//!
+//! @details
+//! The first two elements are set to the limits of the element type and the third one to `0` or `1`. The remaining
+//! elements are filled with a deterministic sequence of pseudo-random values that depends on `seed`.
+//!
+//! @tparam T_TestCase
+//! An `IntegerRegisterTestCase`
+//!
+//! @param[in] seed:
+//! Seed of the pseudo-random values
+//!
+//! @return
+//! Array with test values
+template <typename T_TestCase>
+[[nodiscard]] constexpr auto get_integer_test_values(mjolnir::U64 seed) noexcept -> typename T_TestCase::ArrayType
+{
+    using EType = typename T_TestCase::ElementType;
+
+    // Constants of the 64 bit linear congruential generator from Knuth's MMIX
+    constexpr mjolnir::U64 multiplier = 6364136223846793005U;
+    constexpr mjolnir::U64 increment  = 1442695040888963407U;
+    constexpr mjolnir::U64 shift      = 17;
+
+    typename T_TestCase::ArrayType values = {};
+    mjolnir::U64                   state  = seed;
+
+    for (mjolnir::UST i = 0; i < values.size(); ++i)
+    {
+        state        = state * multiplier + increment;
+        values.at(i) = static_cast<EType>(state >> shift);
+    }
+
+    values.at(0) = std::numeric_limits<EType>::min();
+    values.at(1) = std::numeric_limits<EType>::max();
+    if constexpr (T_TestCase::num_elements > 2)
+        values.at(2) = static_cast<EType>(seed % 2);
+
+    return values;
+}
+
+
+//! \cond DO_NOT_DOCUMENT
+using IntegerVectorRegisterTestTypes = ::testing::Types<IntegerRegisterTestCase<mjolnir::I8, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::U8, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::I16, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::U16, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::I32, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::U32, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::I64, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::U64, __m128i>,
+                                                        IntegerRegisterTestCase<mjolnir::I8, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::U8, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::I16, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::U16, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::I32, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::U32, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::I64, __m256i>,
+                                                        IntegerRegisterTestCase<mjolnir::U64, __m256i>>; // NOLINT
+
+
+//! The comma at the end of the typed test series call is necessary to suppress a warning. See the following link for
+//! more information: https://github.com/google/googletest/issues/2271
+// cppcheck-suppress syntaxError
+TYPED_TEST_SUITE(IntegerVectorRegisterTestSuite, IntegerVectorRegisterTestTypes, );
+//! \endcond
+
+
+//! @}
@@ -0,0 +1,192 @@
+#include "mjolnir/core/math/linear_algebra/determinant.h"
+#include "mjolnir/core/math/linear_algebra/dispatched.h"
+#include "mjolnir/core/math/linear_algebra/vector_operations.h"
+#include "mjolnir/core/x86/dispatch.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+
+
+// The test is compiled for the baseline instruction set, so that all vectorized tiers are provided by the kernel
+// library and not by the test itself
+#if defined(__AVX__)
+#    error "The test must be compiled for the baseline instruction set."
+#endif
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- test suite -----------------------------------------------------------------------------------------------------
+
+template <typename T_Type>
+class DispatchedTestSuite : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        reset_instruction_set_tier();
+    }
+};
+
+using DispatchedTestTypes = ::testing::Types<F32, F64>; // NOLINT
+
+// cppcheck-suppress syntaxError
+TYPED_TEST_SUITE(DispatchedTestSuite, DispatchedTestTypes, );
+
+
+// --- helper functions -----------------------------------------------------------------------------------------------
+
+template <Number T_Type, typename... T_Args>
+[[nodiscard]] constexpr auto create_array(T_Args... args) -> std::array<T_Type, sizeof...(T_Args)>
+{
+    return {{static_cast<T_Type>(args)...}};
+}
+
+
+template <Number T_Type, UST t_size>
+[[nodiscard]] auto create_sequence(T_Type start) -> std::array<T_Type, t_size>
+{
+    std::array<T_Type, t_size> data = {};
+    std::iota(data.begin(), data.end(), start);
+    return data;
+}
+
+
+//! Call the test function once for every instruction set tier that is supported by the executing CPU. The tier is
+//! forced before each call.
+template <typename T_Function>
+void for_each_supported_tier(T_Function test_function)
+{
+    InstructionSetTier supported = get_supported_instruction_set_tier();
+
+    for (UST i = 0; i < num_instruction_set_tiers; ++i)
+    {
+        auto tier = static_cast<InstructionSetTier>(i);
+        if (tier > supported)
+            break;
+
+        force_instruction_set_tier(tier);
+        SCOPED_TRACE("instruction set tier: " + std::to_string(i));
+        test_function();
+    }
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+
+// --- test cross_product ---------------------------------------------------------------------------------------------
+
+TYPED_TEST(DispatchedTestSuite, cross_product) // NOLINT
+{
+    auto a = create_array<TypeParam>(1., -2., 3.);
+    auto b = create_array<TypeParam>(4., 5., -6.); // NOLINT(readability-magic-numbers)
+
+    for_each_supported_tier(
+            [&]()
+            {
+                auto result = dispatched::cross_product(a, b);
+                auto exp    = mjolnir::cross_product(a, b);
+
+                for (UST i = 0; i < 3; ++i)
+                    EXPECT_DOUBLE_EQ(result.at(i), exp.at(i));
+            });
+}
+
+
+// --- test determinant_2x2 -------------------------------------------------------------------------------------------
+
+TYPED_TEST(DispatchedTestSuite, determinant_2x2) // NOLINT
+{
+    auto mat = create_array<TypeParam>(4., 2., -3., 5.); // NOLINT(readability-magic-numbers)
+
+    for_each_supported_tier([&]() { EXPECT_DOUBLE_EQ(dispatched::determinant_2x2(mat), 26.); });
+}
+
+
+// --- test determinant_3x3 -------------------------------------------------------------------------------------------
+
+TYPED_TEST(DispatchedTestSuite, determinant_3x3) // NOLINT
+{
+    auto mat = create_array<TypeParam>(2., 1., -1., 3., 4., 2., -1., 5., 3.); // NOLINT(readability-magic-numbers)
+
+    auto exp = mjolnir::determinant_3x3(mat);
+
+    for_each_supported_tier([&]() { EXPECT_DOUBLE_EQ(dispatched::determinant_3x3(mat), exp); });
+}
+
+
+// --- test determinant_4x4 -------------------------------------------------------------------------------------------
+
+TYPED_TEST(DispatchedTestSuite, determinant_4x4) // NOLINT
+{
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    auto mat = create_array<TypeParam>(2., 1., -1., 3., 4., 2., -1., 5., 3., 0., 1., -2., 6., 2., 1., 4.);
+
+    auto exp = mjolnir::determinant_4x4(mat);
+
+    for_each_supported_tier([&]() { EXPECT_DOUBLE_EQ(dispatched::determinant_4x4(mat), exp); });
+}
+
+
+// --- test dot_product -----------------------------------------------------------------------------------------------
+
+template <UST t_size, Number T_Type>
+void test_dot_product()
+{
+    SCOPED_TRACE("size: " + std::to_string(t_size));
+
+    auto lhs = create_sequence<T_Type, t_size>(1);
+    auto rhs = create_sequence<T_Type, t_size>(-3); // NOLINT(readability-magic-numbers)
+
+    auto exp = mjolnir::dot_product(lhs, rhs);
+
+    for_each_supported_tier([&]() { EXPECT_DOUBLE_EQ(dispatched::dot_product(lhs, rhs), exp); });
+}
+
+
+TYPED_TEST(DispatchedTestSuite, dot_product) // NOLINT
+{
+    test_dot_product<1, TypeParam>();
+    test_dot_product<3, TypeParam>();
+    test_dot_product<4, TypeParam>();
+    test_dot_product<5, TypeParam>();  // NOLINT(readability-magic-numbers)
+    test_dot_product<8, TypeParam>();  // NOLINT(readability-magic-numbers)
+    test_dot_product<13, TypeParam>(); // NOLINT(readability-magic-numbers)
+    test_dot_product<16, TypeParam>(); // NOLINT(readability-magic-numbers)
+    test_dot_product<37, TypeParam>(); // NOLINT(readability-magic-numbers)
+}
+
+
+// --- test element_sum -----------------------------------------------------------------------------------------------
+
+template <UST t_size, Number T_Type>
+void test_element_sum()
+{
+    SCOPED_TRACE("size: " + std::to_string(t_size));
+
+    auto data = create_sequence<T_Type, t_size>(-2);
+    auto exp  = std::accumulate(data.begin(), data.end(), T_Type(0));
+
+    for_each_supported_tier([&]() { EXPECT_DOUBLE_EQ(dispatched::element_sum(data), exp); });
+}
+
+
+TYPED_TEST(DispatchedTestSuite, element_sum) // NOLINT
+{
+    test_element_sum<1, TypeParam>();
+    test_element_sum<2, TypeParam>();
+    test_element_sum<4, TypeParam>();
+    test_element_sum<7, TypeParam>();  // NOLINT(readability-magic-numbers)
+    test_element_sum<8, TypeParam>();  // NOLINT(readability-magic-numbers)
+    test_element_sum<16, TypeParam>(); // NOLINT(readability-magic-numbers)
+    test_element_sum<33, TypeParam>(); // NOLINT(readability-magic-numbers)
+}
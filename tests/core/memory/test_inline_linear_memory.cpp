@@ -0,0 +1,194 @@
+#if defined(_MSC_VER)
+#    pragma warning(disable : 4324) // Some objects trigger this warning more or less on purpose during alignment tests
+#endif
+
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/memory/inline_linear_memory.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/testing/memory/memory_test_classes.h"
+#include "mjolnir/testing/new_delete_counter.h"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numbers>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+constexpr UST num_bytes = 1024;
+
+
+// === TESTS ==========================================================================================================
+
+// --- test construction ----------------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, construction) // NOLINT
+{
+    COUNT_NEW_AND_DELETE;
+
+    auto mem = InlineLinearMemory<num_bytes>();
+
+    static_assert(MemorySystem<InlineLinearMemory<num_bytes>>);
+    static_assert(InlineLinearMemory<num_bytes>::get_memory_size() == num_bytes);
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes);
+    ASSERT_NUM_NEW_AND_DELETE_EQ(0, 0);
+}
+
+
+// --- test allocation ------------------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, allocation) // NOLINT
+{
+    constexpr UST alloc_size_a = 24;
+    constexpr UST alloc_size_b = 16;
+
+    COUNT_NEW_AND_DELETE;
+
+    auto mem = InlineLinearMemory<num_bytes>();
+
+    const void* a = mem.allocate(alloc_size_a);
+    const void* b = mem.allocate(alloc_size_b);
+
+    EXPECT_EQ(pointer_to_integer(b), pointer_to_integer(a) + alloc_size_a);
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes - alloc_size_a - alloc_size_b);
+
+    const void* c = mem.allocate(mem.get_free_memory_size());
+
+    EXPECT_EQ(pointer_to_integer(c), pointer_to_integer(b) + alloc_size_b);
+    EXPECT_EQ(mem.get_free_memory_size(), 0);
+    ASSERT_NUM_NEW_AND_DELETE_EQ(0, 0);
+}
+
+
+// --- test aligned allocation ----------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, aligned_allocation) // NOLINT
+{
+    constexpr UST alloc_size = 8;
+
+    auto mem = InlineLinearMemory<num_bytes, 16>();
+
+    [[maybe_unused]] const void* a = mem.allocate(1);
+    const void*                  b = mem.allocate(alloc_size, 8);
+    EXPECT_TRUE(is_aligned<8>(b));
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes - 8 - alloc_size);
+
+    // alignment exceeds the alignment of the internal memory
+    const void* c = mem.allocate(alloc_size, 128);
+    EXPECT_TRUE(is_aligned<128>(c));
+    EXPECT_GT(pointer_to_integer(c), pointer_to_integer(b));
+    EXPECT_LE(mem.get_free_memory_size(), num_bytes - 2 * alloc_size - 8);
+}
+
+
+// --- test allocation exceptions -------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, allocation_exceptions) // NOLINT
+{
+    auto mem = InlineLinearMemory<num_bytes>();
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+    EXPECT_THROW([[maybe_unused]] auto m = mem.allocate(num_bytes + 1), AllocationError);
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes);
+
+    // cppcheck-suppress unreadVariable
+    [[maybe_unused]] const void* a = mem.allocate(num_bytes);
+    EXPECT_EQ(mem.get_free_memory_size(), 0);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+    EXPECT_THROW([[maybe_unused]] auto m = mem.allocate(1), AllocationError);
+    EXPECT_EQ(mem.get_free_memory_size(), 0);
+}
+
+
+// --- test constexpr -------------------------------------------------------------------------------------------------
+
+//! @brief
+//! Allocate and deallocate some memory and return the size of the free memory.
+constexpr auto get_free_memory_after_allocations() -> UST
+{
+    auto mem = InlineLinearMemory<num_bytes, 8>();
+
+    void* a = mem.allocate(3);
+    void* b = mem.allocate(4, 4);
+    void* c = mem.allocate(8, 8);
+    mem.deallocate(a, 3);
+    mem.deallocate(b, 4, 4);
+    mem.deallocate(c, 8, 8);
+
+    return mem.get_free_memory_size();
+}
+
+
+TEST(test_inline_linear_memory, constexpr_allocation) // NOLINT
+{
+    static_assert(get_free_memory_after_allocations() == num_bytes - 16);
+    EXPECT_EQ(get_free_memory_after_allocations(), num_bytes - 16);
+}
+
+
+// --- test create ----------------------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, create) // NOLINT
+{
+    COUNT_NEW_AND_DELETE;
+
+    auto mem = InlineLinearMemory<num_bytes>();
+
+    const auto* a = mem.allocate_construct<UST>(num_bytes);
+    const auto* b = mem.allocate_construct<F32>(std::numbers::pi_v<F32>);
+    const auto* c = mem.allocate_construct<AlignedStruct>();
+
+    EXPECT_EQ(*a, num_bytes);
+    EXPECT_EQ(*b, std::numbers::pi_v<F32>);
+    EXPECT_TRUE(is_aligned(c, struct_alignment));
+    EXPECT_LE(mem.get_free_memory_size(), num_bytes - sizeof(UST) - sizeof(F32) - sizeof(AlignedStruct));
+    ASSERT_NUM_NEW_AND_DELETE_EQ(0, 0);
+}
+
+
+// --- test destroy ---------------------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, destroy) // NOLINT
+{
+    UST num_destroyed = 0;
+
+    auto mem = InlineLinearMemory<num_bytes>();
+
+    auto* a = mem.allocate_construct<DestructionTester>(num_destroyed);
+    mem.destroy_deallocate(a);
+
+    EXPECT_EQ(num_destroyed, 1);
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes - sizeof(DestructionTester));
+
+    {
+        auto deleter = mem.get_deleter<DestructionTester>();
+        auto b       = std::unique_ptr<DestructionTester, decltype(deleter)>(
+                mem.allocate_construct<DestructionTester>(num_destroyed), deleter);
+    }
+    EXPECT_EQ(num_destroyed, 2);
+}
+
+
+// --- test reset -----------------------------------------------------------------------------------------------------
+
+TEST(test_inline_linear_memory, reset) // NOLINT
+{
+    constexpr UST alloc_size = 36;
+
+    auto mem = InlineLinearMemory<num_bytes>();
+
+    void* a = mem.allocate(alloc_size);
+    void* b = mem.allocate(alloc_size);
+    mem.deallocate(a, alloc_size);
+    mem.deallocate(b, alloc_size);
+
+    mem.reset();
+
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes);
+    EXPECT_EQ(mem.allocate(alloc_size), a);
+    mem.deallocate(a, alloc_size);
+}
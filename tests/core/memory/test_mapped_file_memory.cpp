@@ -0,0 +1,232 @@
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/memory/mapped_file_memory.h"
+#include "mjolnir/core/memory/offset_pointer.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/testing/memory/memory_test_classes.h"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+//! @brief
+//! Get a unique file path in the temporary directory and remove any existing file.
+//!
+//! @param[in] name:
+//! Name of the file
+//!
+//! @return
+//! File path
+auto get_file_path(const std::string& name) -> std::filesystem::path
+{
+    auto path = std::filesystem::temp_directory_path() / ("mjolnir_test_mapped_file_memory_" + name);
+    std::filesystem::remove(path);
+    return path;
+}
+
+
+//! @brief
+//! Linked list node that is stored inside the mapped memory
+struct Node
+{
+    OffsetPointer<Node> next  = {};
+    U64                 value = {0};
+};
+
+
+// === TESTS ==========================================================================================================
+
+// --- test construction ----------------------------------------------------------------------------------------------
+
+TEST(test_mapped_file_memory, construction) // NOLINT
+{
+    auto mem = MappedFileMemory();
+
+    EXPECT_EQ(mem.get_memory_size(), 0);
+    EXPECT_EQ(mem.get_free_memory_size(), 0);
+    EXPECT_FALSE(mem.is_initialized());
+    EXPECT_FALSE(mem.is_restored());
+}
+
+
+// --- test initialization --------------------------------------------------------------------------------------------
+
+TEST(test_mapped_file_memory, initialization) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    auto path = get_file_path("initialization");
+
+    auto mem = MappedFileMemory();
+    mem.initialize(path, num_bytes);
+
+    EXPECT_EQ(mem.get_memory_size(), num_bytes);
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes);
+    EXPECT_TRUE(mem.is_initialized());
+    EXPECT_FALSE(mem.is_restored());
+    EXPECT_GT(std::filesystem::file_size(path), num_bytes);
+
+    mem.deinitialize();
+    EXPECT_FALSE(mem.is_initialized());
+    EXPECT_TRUE(std::filesystem::exists(path));
+
+    std::filesystem::remove(path);
+}
+
+
+// --- test initialization exceptions ---------------------------------------------------------------------------------
+
+TEST(test_mapped_file_memory, initialization_exceptions) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    auto path = get_file_path("initialization_exceptions");
+
+    auto mem = MappedFileMemory();
+    EXPECT_THROW(mem.initialize(path, 0), ValueError);                                             // NOLINT
+    EXPECT_THROW(mem.initialize(path.parent_path() / "no_dir" / "file", num_bytes), RuntimeError); // NOLINT
+    EXPECT_THROW(mem.deinitialize(), RuntimeError);                                                // NOLINT
+    EXPECT_THROW(mem.sync(), RuntimeError);                                                        // NOLINT
+
+    mem.initialize(path, num_bytes);
+    EXPECT_THROW(mem.initialize(path, num_bytes), RuntimeError); // NOLINT
+    mem.deinitialize();
+
+    // size mismatch
+    EXPECT_THROW(mem.initialize(path, 2 * num_bytes), RuntimeError); // NOLINT
+    EXPECT_FALSE(mem.is_initialized());
+
+    // invalid content
+    std::filesystem::resize_file(path, 0);
+    std::filesystem::resize_file(path, num_bytes + 64);          // NOLINT(readability-magic-numbers)
+    EXPECT_THROW(mem.initialize(path, num_bytes), RuntimeError); // NOLINT
+    EXPECT_FALSE(mem.is_initialized());
+
+    std::filesystem::remove(path);
+}
+
+
+// --- test allocation ------------------------------------------------------------------------------------------------
+
+TEST(test_mapped_file_memory, allocation) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    auto path = get_file_path("allocation");
+
+    auto mem = MappedFileMemory();
+    mem.initialize(path, num_bytes);
+
+    auto* ptr_0 = mem.allocate(1);
+    auto* ptr_1 = mem.allocate_construct<AlignedStruct>();
+    auto* ptr_2 = mem.allocate(num_bytes / 2, 1);
+
+    EXPECT_EQ(pointer_to_integer(ptr_1) % struct_alignment, 0);
+    EXPECT_EQ(pointer_to_integer(ptr_2), pointer_to_integer(ptr_1) + sizeof(AlignedStruct));
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes - num_bytes / 2 - struct_alignment - sizeof(AlignedStruct));
+    EXPECT_THROW([[maybe_unused]] auto* ptr = mem.allocate(num_bytes / 2), AllocationError); // NOLINT
+
+    mem.deallocate(ptr_0, 1);
+    mem.destroy_deallocate(ptr_1);
+    mem.deallocate(ptr_2, num_bytes / 2);
+
+    mem.reset();
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes);
+
+    mem.deinitialize();
+    std::filesystem::remove(path);
+}
+
+
+// --- test restore ---------------------------------------------------------------------------------------------------
+
+TEST(test_mapped_file_memory, restore) // NOLINT
+{
+    constexpr UST num_bytes = 4096;
+    constexpr UST num_nodes = 10;
+
+    auto path             = get_file_path("restore");
+    UST  free_memory_size = 0;
+
+    {
+        auto mem = MappedFileMemory();
+        mem.initialize(path, num_bytes);
+
+        Node* root = mem.allocate_construct<Node>();
+        Node* node = root;
+        for (UST i = 1; i < num_nodes; ++i)
+        {
+            auto* next  = mem.allocate_construct<Node>();
+            next->value = i * i;
+            node->next  = next;
+            node        = next;
+        }
+        mem.set_root(root);
+        free_memory_size = mem.get_free_memory_size();
+
+        mem.deinitialize();
+    }
+
+    auto mem = MappedFileMemory();
+    mem.initialize(path, num_bytes);
+
+    EXPECT_TRUE(mem.is_restored());
+    EXPECT_EQ(mem.get_free_memory_size(), free_memory_size);
+
+    UST   count = 0;
+    auto* node  = mem.get_root<Node>();
+    ASSERT_NE(node, nullptr);
+    while (node != nullptr)
+    {
+        EXPECT_EQ(node->value, count * count);
+        node = node->next.get();
+        ++count;
+    }
+    EXPECT_EQ(count, num_nodes);
+
+    // new allocations must not overwrite restored data
+    auto* new_node = mem.allocate_construct<Node>();
+    EXPECT_GT(pointer_to_integer(new_node), pointer_to_integer(mem.get_root<Node>()));
+    mem.destroy_deallocate(new_node);
+
+    mem.reset();
+    EXPECT_EQ(mem.get_root<Node>(), nullptr);
+    EXPECT_EQ(mem.get_free_memory_size(), num_bytes);
+
+    mem.deinitialize();
+    std::filesystem::remove(path);
+}
+
+
+// --- test sync ------------------------------------------------------------------------------------------------------
+
+TEST(test_mapped_file_memory, sync) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    auto path = get_file_path("sync");
+
+    auto mem = MappedFileMemory();
+    mem.initialize(path, num_bytes);
+
+    auto* value = mem.allocate_construct<U64>(42); // NOLINT(readability-magic-numbers)
+    mem.set_root(value);
+    mem.sync();
+
+    // a second instance maps the same file and sees the synchronized state
+    auto mem_2 = MappedFileMemory();
+    mem_2.initialize(path, num_bytes);
+    EXPECT_TRUE(mem_2.is_restored());
+    auto* root = mem_2.get_root<U64>();
+    ASSERT_NE(root, nullptr);
+    EXPECT_EQ(*root, 42);
+
+    mem_2.deinitialize();
+    mem.deinitialize();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,110 @@
+#include "mjolnir/core/memory/linear_memory.h"
+#include "mjolnir/core/memory/utility.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/testing/memory/memory_test_classes.h"
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+//! @brief
+//! Struct whose constructor always throws
+struct ThrowingStruct
+{
+    ThrowingStruct()
+    {
+        throw std::runtime_error("Construction failed.");
+    }
+};
+
+
+// === TESTS ==========================================================================================================
+
+// --- test get_cache_isolated_size -----------------------------------------------------------------------------------
+
+TEST(test_memory_utility, get_cache_isolated_size) // NOLINT
+{
+    static_assert(is_power_of_2(cache_line_size));
+
+    EXPECT_EQ(get_cache_isolated_size(0), 0);
+    EXPECT_EQ(get_cache_isolated_size(1), cache_line_size);
+    EXPECT_EQ(get_cache_isolated_size(cache_line_size - 1), cache_line_size);
+    EXPECT_EQ(get_cache_isolated_size(cache_line_size), cache_line_size);
+    EXPECT_EQ(get_cache_isolated_size(cache_line_size + 1), 2 * cache_line_size);
+}
+
+
+// --- test allocate_cache_isolated -----------------------------------------------------------------------------------
+
+TEST(test_memory_utility, allocate_cache_isolated) // NOLINT
+{
+    constexpr UST memory_size = 16 * cache_line_size;
+
+    auto mem = LinearMemory();
+    mem.initialize(memory_size);
+
+    // unpadded allocation to misalign the current position of the memory system
+    [[maybe_unused]] void* ptr_misaligned = mem.allocate(1, 1);
+
+    void* ptr_a = allocate_cache_isolated(sizeof(I32), alignof(I32), mem);
+    void* ptr_b = allocate_cache_isolated(sizeof(I32), alignof(I32), mem);
+    void* ptr_c = allocate_cache_isolated(cache_line_size + 1, alignof(I32), mem);
+    void* ptr_d = allocate_cache_isolated(1, 1, mem);
+
+    EXPECT_TRUE(is_aligned(ptr_a, cache_line_size));
+    EXPECT_TRUE(is_aligned(ptr_b, cache_line_size));
+    EXPECT_TRUE(is_aligned(ptr_c, cache_line_size));
+    EXPECT_TRUE(is_aligned(ptr_d, cache_line_size));
+
+    EXPECT_EQ(pointer_to_integer(ptr_b) - pointer_to_integer(ptr_a), cache_line_size);
+    EXPECT_EQ(pointer_to_integer(ptr_c) - pointer_to_integer(ptr_b), cache_line_size);
+    EXPECT_EQ(pointer_to_integer(ptr_d) - pointer_to_integer(ptr_c), 2 * cache_line_size);
+
+    deallocate_cache_isolated(ptr_d, 1, 1, mem);
+    deallocate_cache_isolated(ptr_c, cache_line_size + 1, alignof(I32), mem);
+    deallocate_cache_isolated(ptr_b, sizeof(I32), alignof(I32), mem);
+    deallocate_cache_isolated(ptr_a, sizeof(I32), alignof(I32), mem);
+    mem.deallocate(ptr_misaligned, 1, 1);
+}
+
+
+// --- test allocate_construct_cache_isolated -------------------------------------------------------------------------
+
+TEST(test_memory_utility, allocate_construct_cache_isolated) // NOLINT
+{
+    constexpr UST memory_size = 16 * cache_line_size;
+
+    auto mem = LinearMemory();
+    mem.initialize(memory_size);
+
+    UST destruction_count = 0;
+
+    auto* ptr_a = allocate_construct_cache_isolated<DestructionTester>(mem, destruction_count);
+    auto* ptr_b = allocate_construct_cache_isolated<AlignedStruct>(mem);
+
+    EXPECT_TRUE(is_aligned(ptr_a, cache_line_size));
+    EXPECT_TRUE(is_aligned(ptr_b, cache_line_size));
+    EXPECT_EQ(pointer_to_integer(ptr_b) - pointer_to_integer(ptr_a), cache_line_size);
+    EXPECT_LE(mem.get_free_memory_size(), memory_size - 2 * cache_line_size);
+
+    destroy_deallocate_cache_isolated(ptr_b, mem);
+    destroy_deallocate_cache_isolated(ptr_a, mem);
+    EXPECT_EQ(destruction_count, 1);
+}
+
+
+TEST(test_memory_utility, allocate_construct_cache_isolated_throwing_constructor) // NOLINT
+{
+    auto mem = LinearMemory();
+    mem.initialize(16 * cache_line_size);
+
+    EXPECT_THROW(static_cast<void>(allocate_construct_cache_isolated<ThrowingStruct>(mem)), std::runtime_error); // NOLINT
+
+    // asserts in debug builds if the memory of the failed construction wasn't deallocated
+    mem.deinitialize();
+}
@@ -0,0 +1,110 @@
+#include "mjolnir/core/memory/offset_pointer.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+//! @brief
+//! Simple linked list node that can be relocated by copying its bytes.
+struct Node
+{
+    OffsetPointer<Node> next  = {};
+    I32                 value = {0};
+};
+
+
+// === TESTS ==========================================================================================================
+
+// --- test construction ----------------------------------------------------------------------------------------------
+
+TEST(test_offset_pointer, construction) // NOLINT
+{
+    I32 value = 4;
+
+    OffsetPointer<I32> ptr_default;
+    OffsetPointer<I32> ptr_null = nullptr;
+    OffsetPointer<I32> ptr      = &value;
+
+    EXPECT_FALSE(ptr_default);
+    EXPECT_FALSE(ptr_null);
+    EXPECT_TRUE(ptr);
+    EXPECT_EQ(ptr_default.get(), nullptr);
+    EXPECT_EQ(ptr_null.get(), nullptr);
+    EXPECT_EQ(ptr.get(), &value);
+    EXPECT_EQ(*ptr, 4);
+}
+
+
+// --- test copy ------------------------------------------------------------------------------------------------------
+
+TEST(test_offset_pointer, copy) // NOLINT
+{
+    I32 value = 4;
+
+    OffsetPointer<I32> ptr = &value;
+    OffsetPointer<I32> ptr_copy(ptr);
+    OffsetPointer<I32> ptr_assigned;
+    ptr_assigned = ptr;
+
+    EXPECT_EQ(ptr_copy.get(), &value);
+    EXPECT_EQ(ptr_assigned.get(), &value);
+    EXPECT_TRUE(ptr_copy == ptr);
+    EXPECT_TRUE(ptr_assigned == &value);
+    EXPECT_NE(ptr_copy.get_offset(), ptr.get_offset());
+
+    ptr_assigned.reset();
+    EXPECT_TRUE(ptr_assigned == nullptr);
+}
+
+
+// --- test relocation ------------------------------------------------------------------------------------------------
+
+TEST(test_offset_pointer, relocation) // NOLINT
+{
+    constexpr UST num_nodes = 4;
+
+    std::array<Node, num_nodes> nodes = {};
+    for (UST i = 0; i < num_nodes; ++i)
+    {
+        nodes.at(i).value = static_cast<I32>(i);
+        if (i + 1 < num_nodes)
+            nodes.at(i).next = &nodes.at(i + 1);
+    }
+
+    // copy all bytes to simulate a remapped file
+    std::array<Node, num_nodes> relocated = {};
+    std::memcpy(static_cast<void*>(relocated.data()), nodes.data(), sizeof(nodes));
+    nodes = {};
+
+    I32   count = 0;
+    Node* node  = relocated.data();
+    while (node != nullptr)
+    {
+        EXPECT_EQ(node->value, count);
+        EXPECT_TRUE(node->next == nullptr || node->next.get() == &relocated.at(static_cast<UST>(count) + 1));
+        node = node->next.get();
+        ++count;
+    }
+    EXPECT_EQ(count, num_nodes);
+}
+
+
+// --- test array access ----------------------------------------------------------------------------------------------
+
+TEST(test_offset_pointer, array_access) // NOLINT
+{
+    std::array<I32, 3> values = {{1, 2, 3}};
+
+    OffsetPointer<I32> ptr = values.data();
+
+    EXPECT_EQ(ptr[0], 1);
+    EXPECT_EQ(ptr[2], 3);
+    ptr[1] = 5;
+    EXPECT_EQ(values[1], 5);
+}
@@ -0,0 +1,273 @@
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/memory/ring_memory.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/testing/memory/memory_test_classes.h"
+#include "mjolnir/testing/new_delete_counter.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+// --- test suite -----------------------------------------------------------------------------------------------------
+
+template <class T_Type>
+class RingMemoryTestSuite : public ::testing::Test
+{
+};
+using RingMemoryTestTypes = ::testing::Types<RingMemory<false>, RingMemory<true>>;
+// cppcheck-suppress syntaxError
+TYPED_TEST_SUITE(RingMemoryTestSuite, RingMemoryTestTypes, ); // NOLINT
+
+
+// === TESTS ==========================================================================================================
+
+// --- test construction ----------------------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, construction) // NOLINT
+{
+    COUNT_NEW_AND_DELETE;
+
+    auto mem = TypeParam();
+
+    EXPECT_EQ(mem.get_memory_size(), 0);
+    EXPECT_FALSE(mem.is_initialized());
+    ASSERT_NUM_NEW_AND_DELETE_EQ(0, 0);
+}
+
+
+// --- test initialization --------------------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, initialization) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    COUNT_NEW_AND_DELETE;
+
+    auto mem = TypeParam();
+    mem.initialize(num_bytes);
+
+    EXPECT_EQ(mem.get_memory_size(), num_bytes);
+    EXPECT_EQ(mem.get_used_memory_size(), 0);
+    EXPECT_TRUE(mem.is_initialized());
+    EXPECT_TRUE(mem.is_empty());
+    EXPECT_NUM_NEW_AND_DELETE_EQ(1, 0);
+
+    mem.deinitialize();
+    EXPECT_FALSE(mem.is_initialized());
+    ASSERT_NUM_NEW_AND_DELETE_EQ(1, 1);
+}
+
+
+// --- test initialization exceptions ---------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, initialization_exceptions) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    auto mem = TypeParam();
+
+    EXPECT_THROW(mem.initialize(0), ValueError);             // NOLINT
+    EXPECT_THROW(mem.initialize(num_bytes + 1), ValueError); // NOLINT
+    EXPECT_THROW(mem.deinitialize(), RuntimeError);          // NOLINT
+
+    mem.initialize(num_bytes);
+    EXPECT_THROW(mem.initialize(num_bytes), RuntimeError); // NOLINT
+}
+
+
+// --- test fifo allocation -------------------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, fifo_allocation) // NOLINT
+{
+    constexpr UST num_bytes  = 256;
+    constexpr UST alloc_size = 40;
+    constexpr UST block_size = alloc_size + TypeParam::block_overhead;
+
+    auto mem = TypeParam();
+    mem.initialize(num_bytes);
+
+    std::array<void*, 3> ptr = {};
+    for (auto& p : ptr)
+        p = mem.allocate(alloc_size);
+
+    UPT start_addr = pointer_to_integer(ptr[0]) - TypeParam::block_overhead;
+    for (UST i = 1; i < ptr.size(); ++i)
+        EXPECT_EQ(pointer_to_integer(ptr.at(i)), pointer_to_integer(ptr.at(i - 1)) + block_size);
+    EXPECT_EQ(mem.get_used_memory_size(), ptr.size() * block_size);
+
+    // the last block would fill the whole buffer
+    EXPECT_THROW([[maybe_unused]] auto* p = mem.allocate(alloc_size), AllocationError); // NOLINT
+
+    // freeing a newer block does not free any memory
+    mem.deallocate(ptr[1], alloc_size);
+    EXPECT_EQ(mem.get_used_memory_size(), ptr.size() * block_size);
+
+    // freeing the oldest block releases both
+    mem.deallocate(ptr[0], alloc_size);
+    EXPECT_EQ(mem.get_used_memory_size(), block_size);
+
+    // the allocation does not fit into the remaining memory at the end and is not split
+    constexpr UST large_size = 80;
+    void*         ptr_large  = mem.allocate(large_size);
+    EXPECT_EQ(pointer_to_integer(ptr_large), start_addr + TypeParam::block_overhead);
+
+    // the tail skips the unused memory at the end
+    mem.deallocate(ptr[2], alloc_size);
+    EXPECT_EQ(mem.get_used_memory_size(), large_size + TypeParam::block_overhead);
+
+    mem.deallocate(ptr_large, large_size);
+    EXPECT_TRUE(mem.is_empty());
+}
+
+
+// --- test full buffer -----------------------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, full_buffer) // NOLINT
+{
+    constexpr UST num_bytes = 256;
+
+    auto mem = TypeParam();
+    mem.initialize(num_bytes);
+
+    // The head may never reach the tail, even if the block would fit exactly
+    EXPECT_THROW([[maybe_unused]] auto* p = mem.allocate(num_bytes - TypeParam::block_overhead), AllocationError);
+
+    void* ptr = mem.allocate(num_bytes - 2 * TypeParam::block_overhead);
+    EXPECT_THROW([[maybe_unused]] auto* p = mem.allocate(1), AllocationError); // NOLINT
+    mem.deallocate(ptr, num_bytes - 2 * TypeParam::block_overhead);
+
+    EXPECT_TRUE(mem.is_empty());
+}
+
+
+// --- test alignment -------------------------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, alignment) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+    constexpr UST num_loops = 20;
+
+    auto mem = TypeParam();
+    mem.initialize(num_bytes);
+
+    for (UST i = 0; i < num_loops; ++i)
+    {
+        auto* ptr_0 = mem.template allocate_construct<AlignedStruct>();
+        auto* ptr_1 = mem.allocate(3, 1);
+        auto* ptr_2 = mem.template allocate_construct<F64>(1.);
+
+        EXPECT_TRUE(is_aligned<struct_alignment>(ptr_0));
+        EXPECT_TRUE(is_aligned<alignof(F64)>(ptr_2));
+
+        mem.destroy_deallocate(ptr_0);
+        mem.deallocate(ptr_1, 3, 1);
+        mem.destroy_deallocate(ptr_2);
+    }
+
+    EXPECT_TRUE(mem.is_empty());
+}
+
+
+// --- test deleter ---------------------------------------------------------------------------------------------------
+
+TYPED_TEST(RingMemoryTestSuite, deleter) // NOLINT
+{
+    constexpr UST num_bytes = 1024;
+
+    UST destruction_count = 0;
+
+    auto mem = TypeParam();
+    mem.initialize(num_bytes);
+
+    {
+        auto deleter = mem.template get_deleter<DestructionTester>();
+        auto ptr     = std::unique_ptr<DestructionTester, decltype(deleter)>(
+                mem.template allocate_construct<DestructionTester>(destruction_count), deleter);
+        EXPECT_FALSE(mem.is_empty());
+    }
+
+    EXPECT_EQ(destruction_count, 1);
+    EXPECT_TRUE(mem.is_empty());
+}
+
+
+// --- test single producer single consumer ---------------------------------------------------------------------------
+
+TEST(test_ring_memory, single_producer_single_consumer) // NOLINT
+{
+    constexpr UST num_bytes    = 1024;
+    constexpr U64 num_messages = 100000;
+
+    auto mem = RingMemory<true>();
+    mem.initialize(num_bytes);
+
+    std::mutex        queue_mutex;
+    std::queue<U64*>  queue;
+    std::atomic<bool> error = false;
+
+    std::thread producer(
+            [&]()
+            {
+                for (U64 i = 0; i < num_messages; ++i)
+                {
+                    U64* message = nullptr;
+                    while (message == nullptr)
+                    {
+                        try
+                        {
+                            message = mem.allocate_construct<U64>(i);
+                        }
+                        catch (const AllocationError&)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+
+                    std::lock_guard lock(queue_mutex);
+                    queue.push(message);
+                }
+            });
+
+    std::thread consumer(
+            [&]()
+            {
+                U64 expected = 0;
+                while (expected < num_messages)
+                {
+                    U64* message = nullptr;
+                    {
+                        std::lock_guard lock(queue_mutex);
+                        if (! queue.empty())
+                        {
+                            message = queue.front();
+                            queue.pop();
+                        }
+                    }
+
+                    if (message == nullptr)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    if (*message != expected++)
+                        error = true;
+                    mem.destroy_deallocate(message);
+                }
+            });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_FALSE(error);
+    EXPECT_TRUE(mem.is_empty());
+}
@@ -0,0 +1,189 @@
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/memory/slab_memory.h"
+#include "mjolnir/core/utility/pointer_operations.h"
+#include "mjolnir/testing/memory/memory_test_classes.h"
+#include "mjolnir/testing/new_delete_counter.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+//! @brief
+//! Object with a pre-sized buffer that counts how often it was constructed.
+class BufferObject
+{
+public:
+    explicit BufferObject(UST& construction_count) : m_buffer(buffer_size)
+    {
+        ++construction_count;
+    }
+
+    static constexpr UST buffer_size = 128;
+
+    std::vector<F32> m_buffer; // NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+
+// === TESTS ==========================================================================================================
+
+// --- test construction ----------------------------------------------------------------------------------------------
+
+TEST(test_slab_memory, construction) // NOLINT
+{
+    COUNT_NEW_AND_DELETE;
+
+    auto mem = SlabMemory<F64, AlignedStruct>();
+
+    EXPECT_EQ(mem.get_num_cached_objects<F64>(), 0);
+    EXPECT_EQ(mem.get_num_used_objects<AlignedStruct>(), 0);
+    ASSERT_NUM_NEW_AND_DELETE_EQ(0, 0);
+}
+
+
+// --- test allocate_construct ----------------------------------------------------------------------------------------
+
+TEST(test_slab_memory, allocate_construct) // NOLINT
+{
+    constexpr UST num_objects_per_slab = 4;
+
+    auto mem = SlabMemory<F64, AlignedStruct>(num_objects_per_slab);
+
+    std::array<AlignedStruct*, 2 * num_objects_per_slab> pointers = {};
+    for (auto& pointer : pointers)
+    {
+        pointer = mem.allocate_construct<AlignedStruct>();
+        EXPECT_TRUE(is_aligned<struct_alignment>(pointer));
+    }
+
+    auto* value = mem.allocate_construct<F64>(2.);
+    EXPECT_EQ(*value, 2.);
+
+    EXPECT_EQ(mem.get_num_used_objects<AlignedStruct>(), pointers.size());
+    EXPECT_EQ(mem.get_num_used_objects<F64>(), 1);
+
+    for (auto& pointer : pointers)
+        mem.destroy_deallocate(pointer);
+    mem.destroy_deallocate(value);
+
+    EXPECT_EQ(mem.get_num_used_objects<AlignedStruct>(), 0);
+    EXPECT_EQ(mem.get_num_cached_objects<AlignedStruct>(), pointers.size());
+    EXPECT_EQ(mem.get_num_cached_objects<F64>(), 1);
+}
+
+
+// --- test object reuse ----------------------------------------------------------------------------------------------
+
+TEST(test_slab_memory, object_reuse) // NOLINT
+{
+    UST construction_count = 0;
+    UST destruction_count  = 0;
+
+    {
+        auto mem = SlabMemory<BufferObject, DestructionTester>();
+
+        auto* object            = mem.allocate_construct<BufferObject>(construction_count);
+        object->m_buffer.at(0)  = 3.F;
+        auto* buffer_address    = object->m_buffer.data();
+        auto* destruction_check = mem.allocate_construct<DestructionTester>(destruction_count);
+
+        mem.destroy_deallocate(object);
+        mem.destroy_deallocate(destruction_check);
+        EXPECT_EQ(destruction_count, 0);
+
+        COUNT_NEW_AND_DELETE;
+
+        auto* reused_object = mem.allocate_construct<BufferObject>(construction_count);
+
+        EXPECT_EQ(reused_object, object);
+        EXPECT_EQ(reused_object->m_buffer.data(), buffer_address);
+        EXPECT_EQ(reused_object->m_buffer.at(0), 3.F);
+        EXPECT_EQ(construction_count, 1);
+        EXPECT_NUM_NEW_AND_DELETE_EQ(0, 0);
+
+        mem.destroy_deallocate(reused_object);
+    }
+    EXPECT_EQ(destruction_count, 1);
+}
+
+
+// --- test reserve and clear -----------------------------------------------------------------------------------------
+
+TEST(test_slab_memory, reserve_and_clear) // NOLINT
+{
+    constexpr UST num_objects = 10;
+
+    UST construction_count = 0;
+    UST destruction_count  = 0;
+
+    auto mem = SlabMemory<BufferObject, DestructionTester>(4);
+
+    mem.reserve<BufferObject>(num_objects, construction_count);
+    mem.reserve<DestructionTester>(num_objects, destruction_count);
+    EXPECT_EQ(construction_count, num_objects);
+    EXPECT_EQ(mem.get_num_cached_objects<BufferObject>(), num_objects);
+
+    [[maybe_unused]] auto* object = mem.allocate_construct<BufferObject>(construction_count);
+    EXPECT_EQ(construction_count, num_objects);
+    EXPECT_EQ(mem.get_num_cached_objects<BufferObject>(), num_objects - 1);
+    mem.destroy_deallocate(object);
+
+    mem.clear();
+    EXPECT_EQ(destruction_count, num_objects);
+    EXPECT_EQ(mem.get_num_cached_objects<BufferObject>(), 0);
+    EXPECT_EQ(mem.get_num_cached_objects<DestructionTester>(), 0);
+}
+
+
+// --- test deleter ---------------------------------------------------------------------------------------------------
+
+TEST(test_slab_memory, deleter) // NOLINT
+{
+    UST destruction_count = 0;
+
+    auto mem = SlabMemory<DestructionTester>();
+
+    DestructionTester* address = nullptr;
+    {
+        auto deleter = mem.get_deleter<DestructionTester>();
+        auto ptr     = std::unique_ptr<DestructionTester, decltype(deleter)>(
+                mem.allocate_construct<DestructionTester>(destruction_count), deleter);
+        address = ptr.get();
+    }
+
+    EXPECT_EQ(destruction_count, 0);
+    EXPECT_EQ(mem.get_num_cached_objects<DestructionTester>(), 1);
+    EXPECT_EQ(mem.allocate_construct<DestructionTester>(destruction_count), address);
+    mem.destroy_deallocate(address);
+}
+
+
+// --- test raw allocation --------------------------------------------------------------------------------------------
+
+TEST(test_slab_memory, raw_allocation) // NOLINT
+{
+    auto mem = SlabMemory<F32, AlignedStruct>();
+
+    void* ptr_small   = mem.allocate(sizeof(F32), alignof(F32));
+    void* ptr_aligned = mem.allocate(sizeof(F32), struct_alignment);
+    void* ptr_large   = mem.allocate(sizeof(AlignedStruct));
+
+    EXPECT_EQ(mem.get_num_used_objects<F32>(), 1);
+    EXPECT_EQ(mem.get_num_used_objects<AlignedStruct>(), 2);
+    EXPECT_TRUE(is_aligned<struct_alignment>(ptr_aligned));
+    EXPECT_THROW([[maybe_unused]] auto* p = mem.allocate(2 * sizeof(AlignedStruct)), AllocationError); // NOLINT
+
+    mem.deallocate(ptr_small, sizeof(F32), alignof(F32));
+    mem.deallocate(ptr_aligned, sizeof(F32), struct_alignment);
+    mem.deallocate(ptr_large, sizeof(AlignedStruct));
+
+    EXPECT_EQ(mem.get_num_used_objects<F32>(), 0);
+    EXPECT_EQ(mem.get_num_used_objects<AlignedStruct>(), 0);
+    EXPECT_EQ(mem.get_num_cached_objects<AlignedStruct>(), 0);
+}
@@ -0,0 +1,207 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/simd/vec.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <type_traits>
+
+using namespace mjolnir;
+using namespace mjolnir::simd;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+template <typename T_VecType>
+class VecTestSuite : public ::testing::Test
+{
+};
+
+
+//! Return an array with test values for a vector of type `T_VecType`.
+template <typename T_VecType>
+[[nodiscard]] auto get_test_values(UST offset) noexcept
+{
+    using VType = typename T_VecType::ValueType;
+
+    std::array<VType, T_VecType::num_elements> values = {};
+    for (UST i = 0; i < values.size(); ++i)
+        values.at(i) = static_cast<VType>((3 * (i + offset)) % 11) - VType(4.5); // NOLINT(readability-magic-numbers)
+    return values;
+}
+
+
+// clang-format off
+using VecTestTypes = ::testing::Types<Vec<F32, 4, Backend::X86>,
+                                      Vec<F32, 8, Backend::X86>,
+                                      Vec<F64, 2, Backend::X86>,
+                                      Vec<F64, 4, Backend::X86>,
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+                                      Vec<F32, 16, Backend::X86>,
+                                      Vec<F64, 8, Backend::X86>,
+#endif
+                                      Vec<F32, 3, Backend::SCALAR>,
+                                      Vec<F32, 8, Backend::SCALAR>,
+                                      Vec<F64, 1, Backend::SCALAR>,
+                                      Vec<F64, 4, Backend::SCALAR>>; // NOLINT
+// clang-format on
+
+
+// cppcheck-suppress syntaxError
+TYPED_TEST_SUITE(VecTestSuite, VecTestTypes, );
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_default_backend -------------------------------------------------------------------------------------------
+
+TEST(TestVec, test_default_backend) // NOLINT
+{
+    EXPECT_EQ((Vec<F32, 4>::backend), Backend::X86);
+    EXPECT_EQ((Vec<F32, 8>::backend), Backend::X86);
+    EXPECT_EQ((Vec<F64, 2>::backend), Backend::X86);
+    EXPECT_EQ((Vec<F64, 4>::backend), Backend::X86);
+    EXPECT_EQ((Vec<F32, 3>::backend), Backend::SCALAR);
+    EXPECT_EQ((Vec<F64, 3>::backend), Backend::SCALAR);
+    EXPECT_EQ((Vec<F64, 32>::backend), Backend::SCALAR);
+
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+    EXPECT_EQ((Vec<F32, 16>::backend), Backend::X86);
+    EXPECT_EQ((Vec<F64, 8>::backend), Backend::X86);
+#else
+    EXPECT_EQ((Vec<F32, 16>::backend), Backend::SCALAR);
+    EXPECT_EQ((Vec<F64, 8>::backend), Backend::SCALAR);
+#endif
+}
+
+
+// --- test_arithmetic ------------------------------------------------------------------------------------------------
+
+TYPED_TEST(VecTestSuite, test_arithmetic) // NOLINT
+{
+    alignas(TypeParam::alignment) auto a = get_test_values<TypeParam>(1);
+    alignas(TypeParam::alignment) auto b = get_test_values<TypeParam>(5);
+    alignas(TypeParam::alignment) auto c = get_test_values<TypeParam>(7);
+
+    auto vec_a = TypeParam::load(a.data());
+    auto vec_b = TypeParam::load(b.data());
+    auto vec_c = TypeParam::load(c.data());
+
+    auto add   = vec_a + vec_b;
+    auto sub   = vec_a - vec_b;
+    auto mul   = vec_a * vec_b;
+    auto fma   = fmadd(vec_a, vec_b, vec_c);
+    auto accum = vec_c;
+    accum += vec_a;
+    accum *= vec_b;
+    accum -= vec_a;
+
+    for (UST i = 0; i < TypeParam::num_elements; ++i)
+    {
+        EXPECT_EQ(add.get(i), a.at(i) + b.at(i));
+        EXPECT_EQ(sub.get(i), a.at(i) - b.at(i));
+        EXPECT_EQ(mul.get(i), a.at(i) * b.at(i));
+        EXPECT_EQ(fma.get(i), std::fma(a.at(i), b.at(i), c.at(i)));
+        EXPECT_EQ(accum.get(i), (c.at(i) + a.at(i)) * b.at(i) - a.at(i));
+    }
+}
+
+
+// --- test_construction ----------------------------------------------------------------------------------------------
+
+TYPED_TEST(VecTestSuite, test_construction) // NOLINT
+{
+    using VType = typename TypeParam::ValueType;
+
+    constexpr VType value = 3.25;
+
+    auto vec_broadcast = TypeParam::broadcast(value);
+    auto vec_zero      = TypeParam::zero();
+    auto vec_copy      = TypeParam{vec_broadcast.get_data()};
+
+    for (UST i = 0; i < TypeParam::num_elements; ++i)
+    {
+        EXPECT_EQ(vec_broadcast.get(i), value);
+        EXPECT_EQ(vec_zero.get(i), VType(0));
+        EXPECT_EQ(vec_copy.get(i), value);
+    }
+}
+
+
+// --- test_element_sum -----------------------------------------------------------------------------------------------
+
+TYPED_TEST(VecTestSuite, test_element_sum) // NOLINT
+{
+    using VType = typename TypeParam::ValueType;
+
+    alignas(TypeParam::alignment) auto a = get_test_values<TypeParam>(2);
+
+    // All test values and partial sums are exactly representable, so the summation order doesn't matter
+    VType exp = 0;
+    for (VType value : a)
+        exp += value;
+
+    EXPECT_EQ(element_sum(TypeParam::load(a.data())), exp);
+}
+
+
+// --- test_element_sum_backend_equality -----------------------------------------------------------------------------
+
+TYPED_TEST(VecTestSuite, test_element_sum_backend_equality) // NOLINT
+{
+    using VType     = typename TypeParam::ValueType;
+    using BitsType  = std::conditional_t<sizeof(VType) == sizeof(U32), U32, U64>;
+    using ScalarVec = Vec<VType, TypeParam::num_elements, Backend::SCALAR>;
+
+    // The rounding errors of these values depend on the summation order
+    alignas(TypeParam::alignment) std::array<VType, TypeParam::num_elements> a = {};
+    for (UST i = 0; i < a.size(); ++i)
+        a.at(i) = VType(1) / static_cast<VType>(i + 3) * static_cast<VType>(1U << (i % 5)); // NOLINT
+
+    auto sum        = element_sum(TypeParam::load(a.data()));
+    auto sum_scalar = element_sum(ScalarVec::load(a.data()));
+
+    EXPECT_EQ(std::bit_cast<BitsType>(sum), std::bit_cast<BitsType>(sum_scalar));
+}
+
+
+// --- test_load_store ------------------------------------------------------------------------------------------------
+
+TYPED_TEST(VecTestSuite, test_load_store) // NOLINT
+{
+    alignas(TypeParam::alignment) auto a = get_test_values<TypeParam>(3);
+
+    alignas(TypeParam::alignment) std::array<typename TypeParam::ValueType, TypeParam::num_elements> b = {};
+    TypeParam::load(a.data()).store(b.data());
+
+    for (UST i = 0; i < TypeParam::num_elements; ++i)
+        EXPECT_EQ(b.at(i), a.at(i));
+}
+
+
+// --- test_load_store_unaligned --------------------------------------------------------------------------------------
+
+TYPED_TEST(VecTestSuite, test_load_store_unaligned) // NOLINT
+{
+    using VType = typename TypeParam::ValueType;
+
+    constexpr UST size = TypeParam::num_elements;
+
+    auto values = get_test_values<TypeParam>(4);
+
+    // Shift the data by one element, so that it isn't aligned to the register size
+    alignas(TypeParam::alignment) std::array<VType, size + 1> a = {};
+    alignas(TypeParam::alignment) std::array<VType, size + 1> b = {};
+    std::copy(values.begin(), values.end(), a.begin() + 1);
+
+    TypeParam::load_unaligned(a.data() + 1).store_unaligned(b.data() + 1); // NOLINT
+
+    for (UST i = 0; i < size; ++i)
+        EXPECT_EQ(b.at(i + 1), values.at(i));
+}
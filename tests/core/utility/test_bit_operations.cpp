@@ -113,6 +113,165 @@ TEST(test_bit_operations, clear_bits) // NOLINT
 }
 
 
+// --- test count_leading_zeros ---------------------------------------------------------------------------------------
+
+TEST(test_bit_operations, count_leading_zeros) // NOLINT
+{
+    static_assert(count_leading_zeros(U8(0b00010110)) == 3);
+
+    EXPECT_EQ(count_leading_zeros(U8(0)), 8);
+    EXPECT_EQ(count_leading_zeros(U8(0b00000001)), 7);
+    EXPECT_EQ(count_leading_zeros(U8(0b01101110)), 1);
+    EXPECT_EQ(count_leading_zeros(U8(0b10000000)), 0);
+
+    // Test other types
+    EXPECT_EQ(count_leading_zeros(U16(0)), 16);
+    EXPECT_EQ(count_leading_zeros(U32(0b111)), 29);
+    EXPECT_EQ(count_leading_zeros(U64(0)), 64);
+    EXPECT_EQ(count_leading_zeros(U64(1) << 40U), 23);
+}
+
+
+// --- test count_set_bits --------------------------------------------------------------------------------------------
+
+TEST(test_bit_operations, count_set_bits) // NOLINT
+{
+    static_assert(count_set_bits(U8(0b10110110)) == 5);
+
+    EXPECT_EQ(count_set_bits(U8(0)), 0);
+    EXPECT_EQ(count_set_bits(U8(0b00010000)), 1);
+    EXPECT_EQ(count_set_bits(U8(0b01101110)), 5);
+    EXPECT_EQ(count_set_bits(U8(0b11111111)), 8);
+
+    // Test other types
+    EXPECT_EQ(count_set_bits(U16(0xF0F0)), 8);
+    EXPECT_EQ(count_set_bits(U32(0xFFFFFFFF)), 32);
+    EXPECT_EQ(count_set_bits(U64(0x8000000000000001)), 2);
+}
+
+
+// --- test count_trailing_zeros --------------------------------------------------------------------------------------
+
+TEST(test_bit_operations, count_trailing_zeros) // NOLINT
+{
+    static_assert(count_trailing_zeros(U8(0b10110100)) == 2);
+
+    EXPECT_EQ(count_trailing_zeros(U8(0)), 8);
+    EXPECT_EQ(count_trailing_zeros(U8(0b00000001)), 0);
+    EXPECT_EQ(count_trailing_zeros(U8(0b01101000)), 3);
+    EXPECT_EQ(count_trailing_zeros(U8(0b10000000)), 7);
+
+    // Test other types
+    EXPECT_EQ(count_trailing_zeros(U16(0)), 16);
+    EXPECT_EQ(count_trailing_zeros(U32(0b1100000)), 5);
+    EXPECT_EQ(count_trailing_zeros(U64(0)), 64);
+    EXPECT_EQ(count_trailing_zeros(U64(1) << 40U), 40);
+}
+
+
+// --- test deposit_bits and extract_bits -----------------------------------------------------------------------------
+
+template <std::unsigned_integral T_Type>
+void test_deposit_extract_bits_test_case()
+{
+    // compare the runtime implementation, which uses BMI2 if available, with the software implementation
+    U64 state = 1;
+    for (UST i = 0; i < 1000; ++i)
+    {
+        state          = state * 6364136223846793005U + 1442695040888963407U; // NOLINT(*-magic-numbers)
+        auto source    = static_cast<T_Type>(state >> 7U);
+        auto mask      = static_cast<T_Type>(state >> (i % 32));
+        auto deposited = deposit_bits(source, mask);
+
+        EXPECT_EQ(deposited, internal::deposit_bits_software(source, mask));
+        EXPECT_EQ(extract_bits(source, mask), internal::extract_bits_software(source, mask));
+        EXPECT_EQ(deposited & static_cast<T_Type>(~mask), 0);
+
+        // extracting the deposited bits restores the lowest bits of the source
+        const UST  num_set     = count_set_bits(mask);
+        const auto lowest_mask = (num_set == num_bits<T_Type>) ? ~U64(0) : (U64(1) << num_set) - 1U;
+        const auto lowest_bits = static_cast<T_Type>(source & lowest_mask);
+        EXPECT_EQ(extract_bits(deposited, mask), lowest_bits);
+    }
+
+    constexpr T_Type max = std::numeric_limits<T_Type>::max();
+    EXPECT_EQ(deposit_bits(max, max), max);
+    EXPECT_EQ(extract_bits(max, max), max);
+    EXPECT_EQ(deposit_bits(max, T_Type(0)), 0);
+    EXPECT_EQ(extract_bits(max, T_Type(0)), 0);
+}
+
+
+TEST(test_bit_operations, deposit_bits) // NOLINT
+{
+    static_assert(deposit_bits(U8(0b00000101), U8(0b11010010)) == 0b01000010);
+    static_assert(deposit_bits(U64(0b11), U64(0x8000000000000001)) == 0x8000000000000001);
+
+    EXPECT_EQ(deposit_bits(U8(0b00000101), U8(0b11010010)), 0b01000010);
+    EXPECT_EQ(deposit_bits(U8(0b11111111), U8(0b00111000)), 0b00111000);
+    EXPECT_EQ(deposit_bits(U16(0b1), U16(0b1000000000000000)), 0b1000000000000000);
+    EXPECT_EQ(deposit_bits(U32(0xFFFF), U32(0x55555555)), 0x55555555);
+    EXPECT_EQ(deposit_bits(U64(0b10), U64(0x00F0000000000000)), 0x0020000000000000);
+}
+
+
+TEST(test_bit_operations, extract_bits) // NOLINT
+{
+    static_assert(extract_bits(U8(0b01000110), U8(0b11010010)) == 0b0101);
+    static_assert(extract_bits(U64(0x8000000000000001), U64(0x8000000000000001)) == 0b11);
+
+    EXPECT_EQ(extract_bits(U8(0b01000110), U8(0b11010010)), 0b0101);
+    EXPECT_EQ(extract_bits(U8(0b11111111), U8(0b00111000)), 0b111);
+    EXPECT_EQ(extract_bits(U16(0b1000000000000000), U16(0b1000000000000000)), 0b1);
+    EXPECT_EQ(extract_bits(U32(0x55555555), U32(0x55555555)), 0xFFFF);
+    EXPECT_EQ(extract_bits(U64(0x0020000000000000), U64(0x00F0000000000000)), 0b10);
+}
+
+
+TEST(test_bit_operations, deposit_extract_bits) // NOLINT
+{
+    test_deposit_extract_bits_test_case<U8>();
+    test_deposit_extract_bits_test_case<U16>();
+    test_deposit_extract_bits_test_case<U32>();
+    test_deposit_extract_bits_test_case<U64>();
+}
+
+
+// --- test find_first_set --------------------------------------------------------------------------------------------
+
+TEST(test_bit_operations, find_first_set) // NOLINT
+{
+    static_assert(find_first_set(U8(0b10110100)) == 3);
+
+    EXPECT_EQ(find_first_set(U8(0)), 0);
+    EXPECT_EQ(find_first_set(U8(0b00000001)), 1);
+    EXPECT_EQ(find_first_set(U8(0b01101000)), 4);
+    EXPECT_EQ(find_first_set(U8(0b10000000)), 8);
+
+    // Test other types
+    EXPECT_EQ(find_first_set(U32(0)), 0);
+    EXPECT_EQ(find_first_set(U64(1) << 63U), 64);
+}
+
+
+// --- test find_last_set ---------------------------------------------------------------------------------------------
+
+TEST(test_bit_operations, find_last_set) // NOLINT
+{
+    static_assert(find_last_set(U8(0b00110100)) == 6);
+
+    EXPECT_EQ(find_last_set(U8(0)), 0);
+    EXPECT_EQ(find_last_set(U8(0b00000001)), 1);
+    EXPECT_EQ(find_last_set(U8(0b01101000)), 7);
+    EXPECT_EQ(find_last_set(U8(0b10000000)), 8);
+
+    // Test other types
+    EXPECT_EQ(find_last_set(U32(0)), 0);
+    EXPECT_EQ(find_last_set(U32(1000)), 10);
+    EXPECT_EQ(find_last_set(U64(1) << 63U), 64);
+}
+
+
 // --- test get_bit (static) -----------------------------------------------------------------------------------------
 
 TEST(test_bit_operations, get_bit_static) // NOLINT
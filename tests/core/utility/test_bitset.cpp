@@ -0,0 +1,181 @@
+#include "mjolnir/core/utility/bitset.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+//! Set the bits of `bitset` and `reference` with a deterministic pattern that depends on `seed`. The pattern contains
+//! dense and sparse regions.
+template <typename T_Bitset>
+void fill_test_pattern(T_Bitset& bitset, std::vector<bool>& reference, UST seed)
+{
+    reference.assign(bitset.size(), false);
+    for (UST i = 0; i < bitset.size(); ++i)
+    {
+        const bool dense = (i / 256 + seed) % 3 == 0;
+        if ((dense && (i * 7 + seed) % 3 != 0) || (! dense && (i * 13 + seed) % 61 == 0))
+        {
+            bitset.set(i);
+            reference[i] = true;
+        }
+    }
+}
+
+
+//! Check that the bits of `bitset` are equal to the ones of `reference`.
+template <typename T_Bitset>
+void expect_equal_bits(const T_Bitset& bitset, const std::vector<bool>& reference)
+{
+    UST num_set = 0;
+    for (UST i = 0; i < bitset.size(); ++i)
+    {
+        EXPECT_EQ(bitset.test(i), reference[i]);
+        num_set += static_cast<UST>(reference[i]);
+    }
+    EXPECT_EQ(bitset.count(), num_set);
+    EXPECT_EQ(bitset.any(), num_set > 0);
+    EXPECT_EQ(bitset.none(), num_set == 0);
+}
+
+
+//! Test all operations with two bitsets of the same size that have all bits cleared.
+template <typename T_Bitset>
+void test_bitset_test_case(T_Bitset lhs, T_Bitset rhs)
+{
+    const UST size = lhs.size();
+
+    std::vector<bool> ref_lhs;
+    std::vector<bool> ref_rhs;
+
+    expect_equal_bits(lhs, std::vector<bool>(size, false));
+
+    fill_test_pattern(lhs, ref_lhs, 1);
+    fill_test_pattern(rhs, ref_rhs, 2);
+    expect_equal_bits(lhs, ref_lhs);
+    expect_equal_bits(rhs, ref_rhs);
+
+    // for_each_set_bit and find_next_set
+    std::vector<UST> indices;
+    std::vector<UST> ref_indices;
+    lhs.for_each_set_bit([&indices](UST index) { indices.push_back(index); });
+    for (UST i = 0; i < size; ++i)
+        if (ref_lhs[i])
+            ref_indices.push_back(i);
+    EXPECT_EQ(indices, ref_indices);
+
+    indices.clear();
+    for (UST i = lhs.find_next_set(); i < size; i = lhs.find_next_set(i + 1))
+        indices.push_back(i);
+    EXPECT_EQ(indices, ref_indices);
+    EXPECT_EQ(lhs.find_next_set(size), size);
+
+    // combinations
+    auto res_and = lhs;
+    auto res_or  = lhs;
+    auto res_xor = lhs;
+    res_and &= rhs;
+    res_or |= rhs;
+    res_xor ^= rhs;
+
+    std::vector<bool> ref_and(size);
+    std::vector<bool> ref_or(size);
+    std::vector<bool> ref_xor(size);
+    for (UST i = 0; i < size; ++i)
+    {
+        ref_and[i] = ref_lhs[i] && ref_rhs[i];
+        ref_or[i]  = ref_lhs[i] || ref_rhs[i];
+        ref_xor[i] = ref_lhs[i] != ref_rhs[i];
+    }
+    expect_equal_bits(res_and, ref_and);
+    expect_equal_bits(res_or, ref_or);
+    expect_equal_bits(res_xor, ref_xor);
+
+    // equality
+    EXPECT_TRUE(res_or == res_or);
+    EXPECT_EQ(res_or == res_xor, ref_or == ref_xor);
+
+    // reset and clear
+    for (UST i = 0; i < size; i += 3)
+    {
+        res_or.reset(i);
+        ref_or[i] = false;
+    }
+    expect_equal_bits(res_or, ref_or);
+
+    res_or.clear();
+    expect_equal_bits(res_or, std::vector<bool>(size, false));
+}
+
+
+// === TESTS ==========================================================================================================
+
+
+// --- test DynamicBitset ---------------------------------------------------------------------------------------------
+
+TEST(test_bitset, dynamic_bitset) // NOLINT
+{
+    for (UST size : {0U, 1U, 63U, 64U, 65U, 255U, 256U, 257U, 1000U, 1024U, 4099U})
+        test_bitset_test_case(DynamicBitset(size), DynamicBitset(size));
+}
+
+
+TEST(test_bitset, dynamic_bitset_resize) // NOLINT
+{
+    DynamicBitset bitset(200);
+    bitset.set(10);
+    bitset.set(100);
+    bitset.set(150);
+
+    // bits beyond the new size are discarded and don't reappear after growing
+    bitset.resize(120);
+    EXPECT_EQ(bitset.size(), 120);
+    EXPECT_EQ(bitset.count(), 2);
+
+    bitset.resize(300);
+    EXPECT_EQ(bitset.size(), 300);
+    EXPECT_EQ(bitset.count(), 2);
+    EXPECT_FALSE(bitset.test(150));
+    EXPECT_EQ(bitset.find_next_set(11), 100);
+    EXPECT_EQ(bitset.find_next_set(101), 300);
+
+    bitset.resize(0);
+    EXPECT_TRUE(bitset.none());
+}
+
+
+// --- test StaticBitset ----------------------------------------------------------------------------------------------
+
+TEST(test_bitset, static_bitset) // NOLINT
+{
+    test_bitset_test_case(StaticBitset<1>(), StaticBitset<1>());
+    test_bitset_test_case(StaticBitset<63>(), StaticBitset<63>());
+    test_bitset_test_case(StaticBitset<64>(), StaticBitset<64>());
+    test_bitset_test_case(StaticBitset<65>(), StaticBitset<65>());
+    test_bitset_test_case(StaticBitset<256>(), StaticBitset<256>());
+    test_bitset_test_case(StaticBitset<1000>(), StaticBitset<1000>());
+    test_bitset_test_case(StaticBitset<1024>(), StaticBitset<1024>());
+    test_bitset_test_case(StaticBitset<4099>(), StaticBitset<4099>());
+}
+
+
+TEST(test_bitset, static_bitset_constexpr) // NOLINT
+{
+    constexpr auto bitset = []()
+    {
+        StaticBitset<100> result;
+        result.set(3);
+        result.set(70);
+        result.set(99);
+        result.reset(70);
+        return result;
+    }();
+
+    static_assert(bitset.size() == 100);
+    static_assert(bitset.test(3) && ! bitset.test(70) && bitset.test(99));
+    EXPECT_EQ(bitset.count(), 2);
+}
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <type_traits>
 
 
 using namespace mjolnir;
@@ -59,3 +60,29 @@ TYPED_TEST(IsCloseTemplateTester, is_close_abs) // NOLINT
         EXPECT_FALSE(is_close_abs<TypeParam>(a, c, tolerance));
     }
 }
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IsCloseTemplateTester, is_close_rel) // NOLINT
+{
+    if constexpr (std::is_integral_v<TypeParam>)
+    {
+        // integer tolerances are either 0 or at least 100 %
+        EXPECT_TRUE(is_close_rel<TypeParam>(7, 7, 0));
+        EXPECT_FALSE(is_close_rel<TypeParam>(7, 8, 0));
+    }
+    else
+    {
+        const auto a         = static_cast<TypeParam>(200);
+        const auto tolerance = static_cast<TypeParam>(0.1);
+
+        // the tolerance is relative to the larger magnitude
+        EXPECT_TRUE(is_close_rel<TypeParam>(a, a, tolerance));
+        EXPECT_TRUE(is_close_rel<TypeParam>(a, static_cast<TypeParam>(180), tolerance));
+        EXPECT_TRUE(is_close_rel<TypeParam>(static_cast<TypeParam>(180), a, tolerance));
+        EXPECT_TRUE(is_close_rel<TypeParam>(-a, static_cast<TypeParam>(-180), tolerance));
+        EXPECT_FALSE(is_close_rel<TypeParam>(a, static_cast<TypeParam>(179), tolerance));
+        EXPECT_FALSE(is_close_rel<TypeParam>(a, -a, tolerance));
+    }
+}
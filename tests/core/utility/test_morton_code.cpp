@@ -0,0 +1,111 @@
+#include "mjolnir/core/utility/morton_code.h"
+#include <gtest/gtest.h>
+
+#include <array>
+
+
+// === SETUP ==========================================================================================================
+
+using namespace mjolnir;
+
+
+//! Interleave the bits of `coordinates` one bit at a time.
+template <UST t_num_dimensions>
+[[nodiscard]] auto reference_morton_encode(std::array<U32, t_num_dimensions> coordinates, UST num_coordinate_bits)
+        -> U64
+{
+    U64 code = 0;
+    for (UST bit = 0; bit < num_coordinate_bits; ++bit)
+        for (UST d = 0; d < t_num_dimensions; ++d)
+            code |= U64{(coordinates.at(d) >> bit) & 1U} << (bit * t_num_dimensions + d);
+    return code;
+}
+
+
+//! Return a sequence of pseudo random coordinates.
+[[nodiscard]] auto get_test_coordinates() -> std::array<U32, 1000>
+{
+    std::array<U32, 1000> coordinates = {};
+
+    U64 state = 1;
+    for (auto& coordinate : coordinates)
+    {
+        state      = state * 6364136223846793005U + 1442695040888963407U; // NOLINT(*-magic-numbers)
+        coordinate = static_cast<U32>(state >> 32U);
+    }
+    return coordinates;
+}
+
+
+// === TESTS ==========================================================================================================
+
+
+// --- test morton 2d -------------------------------------------------------------------------------------------------
+
+TEST(test_morton_code, morton_2d) // NOLINT
+{
+    static_assert(morton_encode_2d(3, 5) == 0b100111);
+    static_assert(morton_decode_2d(0b100111) == std::array<U32, 2>{{3, 5}});
+
+    EXPECT_EQ(morton_encode_2d(0, 0), 0);
+    EXPECT_EQ(morton_encode_2d(1, 0), 1);
+    EXPECT_EQ(morton_encode_2d(0, 1), 2);
+    EXPECT_EQ(morton_encode_2d(3, 5), 0b100111);
+    EXPECT_EQ(morton_encode_2d(0xFFFFFFFF, 0xFFFFFFFF), 0xFFFFFFFFFFFFFFFF);
+
+    const auto coordinates = get_test_coordinates();
+    for (UST i = 0; i + 1 < coordinates.size(); i += 2)
+    {
+        const std::array<U32, 2> xy = {{coordinates.at(i), coordinates.at(i + 1)}};
+
+        const U64 code = reference_morton_encode(xy, 32);
+        EXPECT_EQ(morton_encode_2d(xy[0], xy[1]), code);
+        EXPECT_EQ(internal::morton_spread_bits_2d(xy[0]) | (internal::morton_spread_bits_2d(xy[1]) << 1U), code);
+
+        EXPECT_EQ(morton_decode_2d(code), xy);
+        EXPECT_EQ(internal::morton_compact_bits_2d(code), xy[0]);
+        EXPECT_EQ(internal::morton_compact_bits_2d(code >> 1U), xy[1]);
+    }
+}
+
+
+// --- test morton 3d -------------------------------------------------------------------------------------------------
+
+TEST(test_morton_code, morton_3d) // NOLINT
+{
+    constexpr U32 max_coordinate = (U32(1) << morton_3d_coordinate_bits) - 1;
+
+    static_assert(morton_encode_3d(1, 2, 4) == 273);
+    static_assert(morton_decode_3d(273) == std::array<U32, 3>{{1, 2, 4}});
+
+    EXPECT_EQ(morton_encode_3d(0, 0, 0), 0);
+    EXPECT_EQ(morton_encode_3d(1, 0, 0), 1);
+    EXPECT_EQ(morton_encode_3d(0, 1, 0), 2);
+    EXPECT_EQ(morton_encode_3d(0, 0, 1), 4);
+    EXPECT_EQ(morton_encode_3d(1, 2, 4), 273);
+    EXPECT_EQ(morton_encode_3d(max_coordinate, max_coordinate, max_coordinate), 0x7FFFFFFFFFFFFFFF);
+
+    // bits beyond the encoded range are ignored
+    EXPECT_EQ(morton_encode_3d(0xFFFFFFFF, 0, 0), morton_encode_3d(max_coordinate, 0, 0));
+
+    const auto coordinates = get_test_coordinates();
+    for (UST i = 0; i + 2 < coordinates.size(); i += 3)
+    {
+        const std::array<U32, 3> xyz = {
+                {coordinates.at(i) & max_coordinate,
+                 coordinates.at(i + 1) & max_coordinate,
+                 coordinates.at(i + 2) & max_coordinate}
+        };
+
+        const U64 code = reference_morton_encode(xyz, morton_3d_coordinate_bits);
+        EXPECT_EQ(morton_encode_3d(xyz[0], xyz[1], xyz[2]), code);
+        EXPECT_EQ(internal::morton_spread_bits_3d(xyz[0]) | (internal::morton_spread_bits_3d(xyz[1]) << 1U)
+                          | (internal::morton_spread_bits_3d(xyz[2]) << 2U),
+                  code);
+
+        EXPECT_EQ(morton_decode_3d(code), xyz);
+        EXPECT_EQ(internal::morton_compact_bits_3d(code), xyz[0]);
+        EXPECT_EQ(internal::morton_compact_bits_3d(code >> 1U), xyz[1]);
+        EXPECT_EQ(internal::morton_compact_bits_3d(code >> 2U), xyz[2]);
+    }
+}
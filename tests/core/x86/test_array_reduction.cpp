@@ -0,0 +1,192 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/array_reduction.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Maximal number of elements of a test array.
+constexpr UST max_array_size = 300;
+
+
+//! Aligned array that contains the test values.
+template <FloatVectorRegister T_RegisterType>
+struct TestArray
+{
+    alignas(alignment_bytes<T_RegisterType>) std::array<ElementType<T_RegisterType>, max_array_size> values = {};
+};
+
+
+//! Return an aligned array with small integer values. All sums and dot products of these values are exactly
+//! representable, so that the summation order doesn't affect the results.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_test_array(UST factor) noexcept -> TestArray<T_RegisterType>
+{
+    using EType = ElementType<T_RegisterType>;
+
+    TestArray<T_RegisterType> array = {};
+    for (UST i = 0; i < max_array_size; ++i)
+        array.values.at(i) = static_cast<EType>((factor * i) % 13) - EType(6); // NOLINT(readability-magic-numbers)
+    return array;
+}
+
+
+//! Return the array sizes that are tested. They cover arrays smaller than a register, arrays without a full block of
+//! accumulation registers and arrays with multiple blocks and a remainder.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_test_sizes() noexcept -> std::array<UST, 7>
+{
+    constexpr UST n_e = num_elements<T_RegisterType>;
+    return {{0, 1, n_e - 1, n_e, 3 * n_e + 1, 8 * n_e + 3, max_array_size - n_e}};
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_array_dot_product -----------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_array_dot_product) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto a = get_test_array<TypeParam>(5); // NOLINT(readability-magic-numbers)
+    auto b = get_test_array<TypeParam>(7); // NOLINT(readability-magic-numbers)
+
+    for (UST size : get_test_sizes<TypeParam>())
+        for (UST offset = 0; offset < n_e; ++offset)
+        {
+            const EType* lhs = &a.values.at(offset);
+            const EType* rhs = &b.values.at(n_e - offset - 1);
+
+            EType exp = 0;
+            for (UST i = 0; i < size; ++i)
+                exp += lhs[i] * rhs[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            EXPECT_EQ(array_dot_product<TypeParam>(lhs, rhs, size), exp);
+            EXPECT_EQ((array_dot_product<TypeParam, SummationMode::COMPENSATED>(lhs, rhs, size)), exp);
+            EXPECT_EQ((array_dot_product<TypeParam, SummationMode::STANDARD, 1>(lhs, rhs, size)), exp);
+        }
+}
+
+
+// --- test_array_max_min ---------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_array_max_min) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto a = get_test_array<TypeParam>(5); // NOLINT(readability-magic-numbers)
+
+    for (UST size : get_test_sizes<TypeParam>())
+        for (UST offset = 0; offset < n_e; ++offset)
+        {
+            if (size == 0)
+                continue;
+
+            // Modify an element near the end to make sure that the extremes aren't always found in the first register
+            auto  b    = a;
+            auto* data = &b.values.at(offset);
+            auto* last = &b.values.at(offset + size - 1);
+
+            *last = EType(100.); // NOLINT(readability-magic-numbers)
+            EXPECT_EQ(array_max<TypeParam>(data, size), *std::max_element(data, last + 1));
+            EXPECT_EQ((array_max<TypeParam, 1>(data, size)), *std::max_element(data, last + 1));
+
+            *last = EType(-100.); // NOLINT(readability-magic-numbers)
+            EXPECT_EQ(array_min<TypeParam>(data, size), *std::min_element(data, last + 1));
+            EXPECT_EQ((array_min<TypeParam, 1>(data, size)), *std::min_element(data, last + 1));
+        }
+}
+
+
+// --- test_array_sum -------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_array_sum) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto a = get_test_array<TypeParam>(5); // NOLINT(readability-magic-numbers)
+
+    for (UST size : get_test_sizes<TypeParam>())
+        for (UST offset = 0; offset < n_e; ++offset)
+        {
+            const EType* data = &a.values.at(offset);
+
+            EType exp = 0;
+            for (UST i = 0; i < size; ++i)
+                exp += data[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            EXPECT_EQ(array_sum<TypeParam>(data, size), exp);
+            EXPECT_EQ((array_sum<TypeParam, SummationMode::COMPENSATED>(data, size)), exp);
+            EXPECT_EQ((array_sum<TypeParam, SummationMode::STANDARD, 1>(data, size)), exp);
+        }
+}
+
+
+// --- test_array_sum_compensated -------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_array_sum_compensated) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    // The ones are smaller than half the spacing of floating-point numbers around `large`. Without compensation, they
+    // are lost if they are added to the same register element as `large`.
+    constexpr EType large    = EType(1U << 2U) / std::numeric_limits<EType>::epsilon();
+    constexpr UST   num_ones = max_array_size - 2;
+
+    TestArray<TypeParam> a = {};
+    std::ranges::fill(a.values, EType(1));
+    a.values.front() = large;
+    a.values.back()  = -large;
+
+    EXPECT_EQ((array_sum<TypeParam, SummationMode::COMPENSATED>(a.values.data(), max_array_size)), EType(num_ones));
+    EXPECT_NE((array_sum<TypeParam, SummationMode::STANDARD>(a.values.data(), max_array_size)), EType(num_ones));
+
+    // The products are subject to the same cancellation
+    TestArray<TypeParam> b = {};
+    std::ranges::fill(b.values, EType(1));
+
+    const EType* lhs = a.values.data();
+    const EType* rhs = b.values.data();
+    EXPECT_EQ((array_dot_product<TypeParam, SummationMode::COMPENSATED>(lhs, rhs, max_array_size)), EType(num_ones));
+}
+
+
+// --- test_array_sum_of_squares --------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_array_sum_of_squares) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto a = get_test_array<TypeParam>(7); // NOLINT(readability-magic-numbers)
+
+    for (UST size : get_test_sizes<TypeParam>())
+        for (UST offset = 0; offset < n_e; ++offset)
+        {
+            const EType* data = &a.values.at(offset);
+
+            EType exp = 0;
+            for (UST i = 0; i < size; ++i)
+                exp += data[i] * data[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            EXPECT_EQ(array_sum_of_squares<TypeParam>(data, size), exp);
+            EXPECT_EQ((array_sum_of_squares<TypeParam, SummationMode::COMPENSATED>(data, size)), exp);
+        }
+}
@@ -0,0 +1,248 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/bit_operations.h"
+#include "mjolnir/core/x86/bit_fields.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/testing/x86/integer_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return the bits [`index`, `index` + `n_bits`) of `value` shifted to the lowest bits.
+template <typename T_Type>
+[[nodiscard]] auto reference_get_bits(T_Type value, UST index, UST n_bits) noexcept -> T_Type
+{
+    using UType = std::make_unsigned_t<T_Type>;
+
+    const auto bits = static_cast<UType>(static_cast<UType>(value) >> index);
+    if (n_bits >= num_bits<T_Type>)
+        return static_cast<T_Type>(bits);
+    return static_cast<T_Type>(bits & static_cast<UType>((UType(1) << n_bits) - 1U));
+}
+
+
+//! Return `dst` with the bits [`index`, `index` + `n_bits`) replaced by the lowest bits of `value`.
+template <typename T_Type>
+[[nodiscard]] auto reference_set_bits(T_Type dst, T_Type value, UST index, UST n_bits) noexcept -> T_Type
+{
+    using UType = std::make_unsigned_t<T_Type>;
+
+    const auto mask = (n_bits >= num_bits<T_Type>) ? static_cast<UType>(~UType(0))
+                                                   : static_cast<UType>((UType(1) << n_bits) - 1U);
+    const auto bits = static_cast<UType>(static_cast<UType>(value) & mask);
+    const auto res  = (static_cast<UType>(dst) & static_cast<UType>(~static_cast<UType>(mask << index)))
+                     | static_cast<UType>(bits << index);
+    return static_cast<T_Type>(res);
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_array_pack_unpack_bit_fields ------------------------------------------------------------------------------
+
+template <IntegerSSEAVXRegister T_RegisterType, typename T_Type, UST... t_num_bits>
+void test_array_pack_unpack_bit_fields_test_case()
+{
+    constexpr UST n_fields = sizeof...(t_num_bits);
+    constexpr UST n_e      = num_integer_elements<T_Type, T_RegisterType>;
+
+    for (UST size : {UST(0), UST(1), n_e - 1, n_e, 3 * n_e + 1, 8 * n_e + n_e / 2})
+    {
+        std::array<std::vector<T_Type>, n_fields> fields;
+        for (UST f = 0; f < n_fields; ++f)
+            for (UST i = 0; i < size; ++i)
+                fields.at(f).push_back(static_cast<T_Type>(i * 7919U + f * 104729U + i / 3));
+
+        std::array<const T_Type*, n_fields> field_ptr = {};
+        for (UST f = 0; f < n_fields; ++f)
+            field_ptr.at(f) = fields.at(f).data();
+
+        std::vector<T_Type> packed(size);
+        array_pack_bit_fields<T_RegisterType, T_Type, t_num_bits...>(field_ptr, size, packed.data());
+
+        std::array<std::vector<T_Type>, n_fields> unpacked;
+        std::array<T_Type*, n_fields>             unpacked_ptr = {};
+        for (UST f = 0; f < n_fields; ++f)
+        {
+            unpacked.at(f).resize(size);
+            unpacked_ptr.at(f) = unpacked.at(f).data();
+        }
+        array_unpack_bit_fields<T_RegisterType, T_Type, t_num_bits...>(packed.data(), size, unpacked_ptr);
+
+        constexpr std::array<UST, n_fields> field_bits = {{t_num_bits...}};
+        for (UST i = 0; i < size; ++i)
+        {
+            UST    index    = 0;
+            T_Type expected = 0;
+            for (UST f = 0; f < n_fields; ++f)
+            {
+                const auto n_bits = field_bits.at(f);
+                EXPECT_EQ(unpacked.at(f).at(i), reference_get_bits(fields.at(f).at(i), 0, n_bits));
+                expected = reference_set_bits(expected, fields.at(f).at(i), index, n_bits);
+                index += n_bits;
+            }
+            EXPECT_EQ(packed.at(i), expected);
+        }
+    }
+}
+
+
+TEST(test_bit_fields, test_array_pack_unpack_bit_fields) // NOLINT
+{
+    test_array_pack_unpack_bit_fields_test_case<__m128i, U8, 1, 1, 3, 3>();
+    test_array_pack_unpack_bit_fields_test_case<__m256i, U8, 4, 4>();
+    test_array_pack_unpack_bit_fields_test_case<__m128i, U16, 5, 6, 5>();
+    test_array_pack_unpack_bit_fields_test_case<__m256i, U16, 1, 7, 2>();
+    test_array_pack_unpack_bit_fields_test_case<__m128i, U32, 10, 10, 10, 2>();
+    test_array_pack_unpack_bit_fields_test_case<__m256i, U32, 11, 11, 10>();
+    test_array_pack_unpack_bit_fields_test_case<__m256i, U32, 1, 2, 3>();
+    test_array_pack_unpack_bit_fields_test_case<__m128i, U64, 21, 21, 21>();
+    test_array_pack_unpack_bit_fields_test_case<__m256i, U64, 16, 16, 32>();
+}
+
+
+// --- test_clear_get_set_bits ----------------------------------------------------------------------------------------
+
+template <typename T_TestCase, UST t_index, UST t_num_bits>
+void test_clear_get_set_bits_test_case()
+{
+    using EType = typename T_TestCase::ElementType;
+
+    auto a = get_integer_test_values<T_TestCase>(1);
+    auto b = get_integer_test_values<T_TestCase>(2);
+
+    auto src    = to_register<T_TestCase>(a);
+    auto values = to_register<T_TestCase>(b);
+
+    auto c_clear = to_element_array<T_TestCase>(clear_bits<EType, t_index, t_num_bits>(src));
+    auto c_get   = to_element_array<T_TestCase>(get_bits<EType, t_index, t_num_bits>(src));
+    auto c_set   = to_element_array<T_TestCase>(set_bits_with_int<EType, t_index, t_num_bits>(src, values));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(c_clear.at(i), reference_set_bits(a.at(i), EType(0), t_index, t_num_bits));
+        EXPECT_EQ(c_get.at(i), reference_get_bits(a.at(i), t_index, t_num_bits));
+        EXPECT_EQ(c_set.at(i), reference_set_bits(a.at(i), b.at(i), t_index, t_num_bits));
+    }
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_clear_get_set_bits) // NOLINT
+{
+    constexpr UST n_bits = num_bits<typename TypeParam::ElementType>;
+
+    test_clear_get_set_bits_test_case<TypeParam, 0, 1>();
+    test_clear_get_set_bits_test_case<TypeParam, 0, 3>();
+    test_clear_get_set_bits_test_case<TypeParam, 2, 3>();
+    test_clear_get_set_bits_test_case<TypeParam, 1, n_bits / 2>();
+    test_clear_get_set_bits_test_case<TypeParam, n_bits / 2, n_bits / 2>();
+    test_clear_get_set_bits_test_case<TypeParam, n_bits - 1, 1>();
+    test_clear_get_set_bits_test_case<TypeParam, 0, n_bits>();
+}
+
+
+// --- test_get_set_bits_variable -------------------------------------------------------------------------------------
+
+template <typename T_TestCase, UST t_num_bits>
+void test_get_set_bits_variable_test_case()
+{
+    using EType          = typename T_TestCase::ElementType;
+    constexpr UST n_bits = num_bits<EType>;
+
+    auto a = get_integer_test_values<T_TestCase>(3);
+    auto b = get_integer_test_values<T_TestCase>(4);
+
+    typename T_TestCase::ArrayType indices = {};
+    for (UST i = 0; i < indices.size(); ++i)
+        indices.at(i) = static_cast<EType>((i * 7 + 1) % (n_bits - t_num_bits + 1));
+
+    auto src    = to_register<T_TestCase>(a);
+    auto values = to_register<T_TestCase>(b);
+    auto idx    = to_register<T_TestCase>(indices);
+
+    auto c_get = to_element_array<T_TestCase>(get_bits<EType, t_num_bits>(src, idx));
+    auto c_set = to_element_array<T_TestCase>(set_bits_with_int<EType, t_num_bits>(src, idx, values));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        const auto index = static_cast<UST>(indices.at(i));
+        EXPECT_EQ(c_get.at(i), reference_get_bits(a.at(i), index, t_num_bits));
+        EXPECT_EQ(c_set.at(i), reference_set_bits(a.at(i), b.at(i), index, t_num_bits));
+    }
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_get_set_bits_variable) // NOLINT
+{
+    constexpr UST n_bits = num_bits<typename TypeParam::ElementType>;
+
+    if constexpr (n_bits >= 32)
+    {
+        test_get_set_bits_variable_test_case<TypeParam, 1>();
+        test_get_set_bits_variable_test_case<TypeParam, 5>();
+        test_get_set_bits_variable_test_case<TypeParam, n_bits / 2>();
+        test_get_set_bits_variable_test_case<TypeParam, n_bits>();
+    }
+}
+
+
+// --- test_pack_unpack_bit_fields ------------------------------------------------------------------------------------
+
+template <typename T_TestCase, UST... t_num_bits>
+void test_pack_unpack_bit_fields_test_case()
+{
+    using EType            = typename T_TestCase::ElementType;
+    using RType            = typename T_TestCase::RegisterType;
+    constexpr UST n_fields = sizeof...(t_num_bits);
+
+    constexpr std::array<UST, n_fields> field_bits = {{t_num_bits...}};
+
+    std::array<typename T_TestCase::ArrayType, n_fields> values = {};
+    std::array<RType, n_fields>                          fields = {};
+    for (UST f = 0; f < n_fields; ++f)
+    {
+        values.at(f) = get_integer_test_values<T_TestCase>(f + 5);
+        fields.at(f) = to_register<T_TestCase>(values.at(f));
+    }
+
+    auto packed   = pack_bit_fields<EType, t_num_bits...>(fields);
+    auto unpacked = unpack_bit_fields<EType, t_num_bits...>(packed);
+    auto c_packed = to_element_array<T_TestCase>(packed);
+
+    for (UST i = 0; i < T_TestCase::num_elements; ++i)
+    {
+        UST   index    = 0;
+        EType expected = 0;
+        for (UST f = 0; f < n_fields; ++f)
+        {
+            const auto n_bits   = field_bits.at(f);
+            const auto c_fields = to_element_array<T_TestCase>(unpacked.at(f));
+            EXPECT_EQ(c_fields.at(i), reference_get_bits(values.at(f).at(i), 0, n_bits));
+            expected = reference_set_bits(expected, values.at(f).at(i), index, n_bits);
+            index += n_bits;
+        }
+        EXPECT_EQ(c_packed.at(i), expected);
+    }
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_pack_unpack_bit_fields) // NOLINT
+{
+    constexpr UST n_bits = num_bits<typename TypeParam::ElementType>;
+
+    test_pack_unpack_bit_fields_test_case<TypeParam, n_bits>();
+    test_pack_unpack_bit_fields_test_case<TypeParam, 1, 2, 3>();
+    test_pack_unpack_bit_fields_test_case<TypeParam, n_bits / 2, n_bits / 2>();
+    test_pack_unpack_bit_fields_test_case<TypeParam, 1, n_bits / 2, n_bits / 4, n_bits / 4 - 1>();
+}
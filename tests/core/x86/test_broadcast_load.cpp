@@ -0,0 +1,84 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/broadcast_load.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <array>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return an aligned array with the values 0, 1, 2, ... . The tests load from every offset, so that aligned and
+//! unaligned addresses are covered.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_test_values() noexcept
+{
+    alignas(alignment_bytes<T_RegisterType>) std::array<ElementType<T_RegisterType>, 20> values = {}; // NOLINT
+    for (UST i = 0; i < values.size(); ++i)
+        values.at(i) = static_cast<ElementType<T_RegisterType>>(i);
+    return values;
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_broadcast_load --------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_broadcast_load) // NOLINT
+{
+    auto values = get_test_values<TypeParam>();
+
+    for (UST i = 0; i < values.size(); ++i)
+    {
+        auto res = broadcast_load<TypeParam>(&values.at(i));
+
+        for (UST j = 0; j < num_elements<TypeParam>; ++j)
+            EXPECT_EQ(get(res, j), values.at(i));
+    }
+}
+
+
+// --- test_broadcast_load_consecutive --------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_broadcast_load_consecutive) // NOLINT
+{
+    constexpr UST n_regs = 5;
+
+    auto values = get_test_values<TypeParam>();
+
+    for (UST i = 0; i + n_regs <= values.size(); i += 3)
+    {
+        auto res = broadcast_load_consecutive<n_regs, TypeParam>(&values.at(i));
+
+        for (UST r = 0; r < n_regs; ++r)
+            for (UST j = 0; j < num_elements<TypeParam>; ++j)
+                EXPECT_EQ(get(res.at(r), j), values.at(i + r));
+    }
+}
+
+
+// --- test_broadcast_lane_load ---------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_broadcast_lane_load) // NOLINT
+{
+    constexpr UST n_le = num_lane_elements<TypeParam>;
+
+    auto values = get_test_values<TypeParam>();
+
+    for (UST i = 0; i + n_le <= values.size(); ++i)
+    {
+        auto res = broadcast_lane_load<TypeParam>(&values.at(i));
+
+        for (UST j = 0; j < num_elements<TypeParam>; ++j)
+            EXPECT_EQ(get(res, j), values.at(i + j % n_le));
+    }
+}
@@ -0,0 +1,95 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/compaction.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <array>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return a register where each element is its index plus one.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_test_register() noexcept -> T_RegisterType
+{
+    using EType = ElementType<T_RegisterType>;
+
+    auto src = mm_setzero<T_RegisterType>();
+    for (UST i = 0; i < num_elements<T_RegisterType>; ++i)
+        set(src, i, static_cast<EType>(i + 1));
+    return src;
+}
+
+
+//! Return an array with the elements of `src` that are selected by `mask` in consecutive order. The remaining
+//! elements are set to `fill_value`.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_expected_values(T_RegisterType src, U32 mask, ElementType<T_RegisterType> fill_value) noexcept
+        -> std::array<ElementType<T_RegisterType>, num_elements<T_RegisterType>>
+{
+    std::array<ElementType<T_RegisterType>, num_elements<T_RegisterType>> exp = {};
+    exp.fill(fill_value);
+
+    UST n = 0;
+    for (UST i = 0; i < num_elements<T_RegisterType>; ++i)
+        if (is_bit_set(mask, i))
+            exp.at(n++) = get(src, i);
+    return exp;
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_compress --------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compress) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    auto src = get_test_register<TypeParam>();
+
+    for (UST mask = 0; mask < (UST{1} << num_elements<TypeParam>); ++mask)
+    {
+        auto res = compress(src, static_cast<U32>(mask));
+        auto exp = get_expected_values(src, static_cast<U32>(mask), EType(0));
+
+        for (UST i = 0; i < static_cast<UST>(std::popcount(mask)); ++i)
+            EXPECT_EQ(get(res, i), exp.at(i));
+    }
+}
+
+
+// --- test_compress_store --------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compress_store) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto src = get_test_register<TypeParam>();
+
+    for (UST mask = 0; mask < (UST{1} << n_e); ++mask)
+    {
+        // The element after the register size must not be overwritten
+        std::array<EType, n_e + 1> dst = {};
+        dst.fill(EType(-1));
+
+        UST num_stored = compress_store(dst.data(), src, static_cast<U32>(mask));
+        auto exp        = get_expected_values(src, static_cast<U32>(mask), EType(-1));
+
+        EXPECT_EQ(num_stored, static_cast<UST>(std::popcount(mask)));
+        for (UST i = 0; i < n_e; ++i)
+            EXPECT_EQ(dst.at(i), exp.at(i));
+        EXPECT_EQ(dst.back(), EType(-1));
+    }
+}
@@ -71,6 +71,42 @@ template <>
 }
 
 
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+template <>
+[[nodiscard]] auto get_test_register_array<__m512d>()
+{
+    return std::array<__m512d, 10>{{mm_setr<__m512d>(1, 2, 3, 4, 5, 6, 7, 8),   // NOLINT - magic number
+                                    mm_setr<__m512d>(1, 2, 3, 4, 5, 7, 7, 8),   // NOLINT - magic number
+                                    mm_setr<__m512d>(2, 3, 4, 5, 6, 7, 8, 9),   // NOLINT - magic number
+                                    mm_setr<__m512d>(1, 2, 3, 4, 5, 6, 6, 8),   // NOLINT - magic number
+                                    mm_setr<__m512d>(0, 0, 1, 3, 2, 5, 2, 1),   // NOLINT - magic number
+                                    mm_setr<__m512d>(4, 3, 5, 6, 6, 7, 9, 9),   // NOLINT - magic number
+                                    mm_setr<__m512d>(0, 0, 1, 1, 7, 9, 9, 9),   // NOLINT - magic number
+                                    mm_setr<__m512d>(9, 3, 3, 1, 2, 7, 3, 9),   // NOLINT - magic number
+                                    mm_setr<__m512d>(6, 3, 8, 4, 1, 5, 7, 5),   // NOLINT - magic number
+                                    mm_setr<__m512d>(4, 2, 3, 1, 4, 6, 2, 6)}}; // NOLINT - magic number
+}
+
+
+template <>
+[[nodiscard]] auto get_test_register_array<__m512>()
+{
+    // NOLINTBEGIN - magic numbers
+    return std::array<__m512, 10>{{mm_setr<__m512>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16),
+                                   mm_setr<__m512>(1, 2, 3, 4, 5, 7, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16),
+                                   mm_setr<__m512>(2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17),
+                                   mm_setr<__m512>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 14, 16),
+                                   mm_setr<__m512>(0, 0, 1, 3, 2, 5, 2, 1, 8, 9, 10, 11, 12, 13, 14, 15),
+                                   mm_setr<__m512>(4, 3, 5, 6, 6, 7, 9, 9, 9, 10, 11, 12, 13, 14, 15, 16),
+                                   mm_setr<__m512>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 9, 13, 17, 15, 16),
+                                   mm_setr<__m512>(9, 3, 3, 1, 2, 7, 3, 9, 9, 10, 11, 12, 13, 14, 15, 16),
+                                   mm_setr<__m512>(6, 3, 8, 4, 1, 5, 7, 5, 8, 9, 13, 11, 12, 15, 14, 17),
+                                   mm_setr<__m512>(4, 2, 3, 1, 4, 6, 2, 6, 5, 8, 9, 10, 14, 12, 13, 11)}};
+    // NOLINTEND
+}
+#endif
+
+
 //! ###################################################################################################################
 //! INFO:
 //! Most of the test case functions are created by macros since the general approach is equal for the different
@@ -111,6 +147,36 @@ template <>
     }
 
 
+// test case macro for bitmask comparison -----------------------------------------------------------------------------
+
+// NOLINTNEXTLINE
+#define MASK_COMPARISON_TESTCASE(test_case_func_name, cmp_func_name, cmp_operator)                                     \
+    template <typename T_RegisterType>                                                                                 \
+    void test_case_func_name()                                                                                         \
+    {                                                                                                                  \
+        auto test_func = [](T_RegisterType a, T_RegisterType b)                                                        \
+        {                                                                                                              \
+            constexpr UST n_e = num_elements<T_RegisterType>;                                                          \
+                                                                                                                       \
+            U32 exp_result = 0;                                                                                        \
+            for (UST i = 0; i < n_e; ++i)                                                                              \
+                if (get(a, i) cmp_operator get(b, i))                                                                  \
+                    exp_result |= U32{1} << i;                                                                         \
+                                                                                                                       \
+            EXPECT_EQ(cmp_func_name(a, b), exp_result);                                                                \
+        };                                                                                                             \
+                                                                                                                       \
+                                                                                                                       \
+        auto t = get_test_register_array<T_RegisterType>();                                                            \
+                                                                                                                       \
+        for (auto& v : t)                                                                                              \
+        {                                                                                                              \
+            test_func(t.at(0), v);                                                                                     \
+            test_func(v, t.at(0));                                                                                     \
+        }                                                                                                              \
+    }
+
+
 // test case macro for selective comparison ---------------------------------------------------------------------------
 
 template <typename T_RegisterType, UST t_test_case_index>
@@ -120,7 +186,7 @@ template <typename T_RegisterType, UST t_test_case_index>
 
     std::array<bool, n_e> a = {{0}};
     for (UST i = 0; i < n_e; ++i)
-        a.at(i) = ! is_bit_set(t_test_case_index, i);
+        a.at(i) = ! is_bit_set(get_element_flag_test_case_bits<T_RegisterType>(t_test_case_index), i);
     return a;
 }
 
@@ -131,6 +197,10 @@ template <typename T_RegisterType, UST t_test_case_index>
 #define CALL_CMP_FUNC_4(cmp_func_name) cmp_func_name<c[0], c[1], c[2], c[3]>(a, b)
 // NOLINTNEXTLINE
 #define CALL_CMP_FUNC_8(cmp_func_name) cmp_func_name<c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]>(a, b)
+// NOLINTNEXTLINE
+#define CALL_CMP_FUNC_16(cmp_func_name)                                                                                \
+    cmp_func_name<c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], c[10], c[11], c[12], c[13], c[14],       \
+                  c[15]>(a, b)
 
 // NOLINTNEXTLINE
 #define SELECTIVE_COMPARISON_TESTCASE(test_case_func_name, cmp_func_name, cmp_operator)                                \
@@ -149,8 +219,10 @@ template <typename T_RegisterType, UST t_test_case_index>
                 res = CALL_CMP_FUNC_2(cmp_func_name);                                                                  \
             else if constexpr (num_elements<T_RegisterType> == 4)                                                      \
                 res = CALL_CMP_FUNC_4(cmp_func_name);                                                                  \
-            else                                                                                                       \
+            else if constexpr (num_elements<T_RegisterType> == 8)                                                      \
                 res = CALL_CMP_FUNC_8(cmp_func_name);                                                                  \
+            else                                                                                                       \
+                res = CALL_CMP_FUNC_16(cmp_func_name);                                                                 \
                                                                                                                        \
             for (UST i = 0; i < n_e; ++i)                                                                              \
                 if (c.at(i))                                                                                           \
@@ -344,6 +416,61 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_in_sequence_less_e
 }
 
 
+// test compare_mask_equal --------------------------------------------------------------------------------------------
+
+MASK_COMPARISON_TESTCASE(test_compare_mask_equal, compare_mask_equal, ==)
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_mask_equal) // NOLINT
+{
+    test_compare_mask_equal<TypeParam>();
+}
+
+
+// test compare_mask_greater ------------------------------------------------------------------------------------------
+
+MASK_COMPARISON_TESTCASE(test_compare_mask_greater, compare_mask_greater, >)
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_mask_greater) // NOLINT
+{
+    test_compare_mask_greater<TypeParam>();
+}
+
+
+// test compare_mask_greater_equal ------------------------------------------------------------------------------------
+
+MASK_COMPARISON_TESTCASE(test_compare_mask_greater_equal, compare_mask_greater_equal, >=)
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_mask_greater_equal) // NOLINT
+{
+    test_compare_mask_greater_equal<TypeParam>();
+}
+
+
+// test compare_mask_less ---------------------------------------------------------------------------------------------
+
+MASK_COMPARISON_TESTCASE(test_compare_mask_less, compare_mask_less, <)
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_mask_less) // NOLINT
+{
+    test_compare_mask_less<TypeParam>();
+}
+
+
+// test compare_mask_less_equal ---------------------------------------------------------------------------------------
+
+MASK_COMPARISON_TESTCASE(test_compare_mask_less_equal, compare_mask_less_equal, <=)
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_mask_less_equal) // NOLINT
+{
+    test_compare_mask_less_equal<TypeParam>();
+}
+
+
 // test compare_selected_equal ----------------------------------------------------------------------------------------
 
 SELECTIVE_COMPARISON_TESTCASE(test_compare_selected_equal, compare_selected_equal, ==)
@@ -351,8 +478,7 @@ SELECTIVE_COMPARISON_TESTCASE(test_compare_selected_equal, compare_selected_equa
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_selected_equal) // NOLINT
 {
-    constexpr UST                  n_e         = num_elements<TypeParam>;
-    [[maybe_unused]] constexpr UST n_testcases = power_of_2(n_e) - 1;
+    [[maybe_unused]] constexpr UST n_testcases = get_num_element_flag_test_cases<TypeParam>() - 1;
 
     TYPED_TEST_SERIES(test_compare_selected_equal, n_testcases);
 }
@@ -365,8 +491,7 @@ SELECTIVE_COMPARISON_TESTCASE(test_compare_selected_greater, compare_selected_gr
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_selected_greater) // NOLINT
 {
-    constexpr UST                  n_e         = num_elements<TypeParam>;
-    [[maybe_unused]] constexpr UST n_testcases = power_of_2(n_e) - 1;
+    [[maybe_unused]] constexpr UST n_testcases = get_num_element_flag_test_cases<TypeParam>() - 1;
 
     TYPED_TEST_SERIES(test_compare_selected_greater, n_testcases);
 }
@@ -379,8 +504,7 @@ SELECTIVE_COMPARISON_TESTCASE(test_compare_selected_greater_equal, compare_selec
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_selected_greater_equal) // NOLINT
 {
-    constexpr UST                  n_e         = num_elements<TypeParam>;
-    [[maybe_unused]] constexpr UST n_testcases = power_of_2(n_e) - 1;
+    [[maybe_unused]] constexpr UST n_testcases = get_num_element_flag_test_cases<TypeParam>() - 1;
 
     TYPED_TEST_SERIES(test_compare_selected_greater_equal, n_testcases);
 }
@@ -393,8 +517,7 @@ SELECTIVE_COMPARISON_TESTCASE(test_compare_selected_less, compare_selected_less,
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_selected_less) // NOLINT
 {
-    constexpr UST                  n_e         = num_elements<TypeParam>;
-    [[maybe_unused]] constexpr UST n_testcases = power_of_2(n_e) - 1;
+    [[maybe_unused]] constexpr UST n_testcases = get_num_element_flag_test_cases<TypeParam>() - 1;
 
     TYPED_TEST_SERIES(test_compare_selected_less, n_testcases);
 }
@@ -407,8 +530,7 @@ SELECTIVE_COMPARISON_TESTCASE(test_compare_selected_less_equal, compare_selected
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_compare_selected_less_equal) // NOLINT
 {
-    constexpr UST                  n_e         = num_elements<TypeParam>;
-    [[maybe_unused]] constexpr UST n_testcases = power_of_2(n_e) - 1;
+    [[maybe_unused]] constexpr UST n_testcases = get_num_element_flag_test_cases<TypeParam>() - 1;
 
     TYPED_TEST_SERIES(test_compare_selected_less_equal, n_testcases);
 }
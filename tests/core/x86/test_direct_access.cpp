@@ -36,6 +36,21 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_get_dynamic_version) // NO
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_get_permuted) // NOLINT
+{
+    VectorDataArray<TypeParam> data = {{{0}}};
+
+    for (UST i = 0; i < data.size(); ++i)
+        data.at(i) = static_cast<ElementType<TypeParam>>(i + 1);
+    auto a = mm_load<TypeParam>(data.data());
+
+    for (UST i = 0; i < num_elements<TypeParam>; ++i)
+        EXPECT_DOUBLE_EQ(get_permuted(a, i), static_cast<F64>(i + 1));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_get_static_version) // NOLINT
@@ -53,17 +68,46 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_get_static_version) // NOL
     {
         EXPECT_DOUBLE_EQ(get<2>(a), 2.);
         EXPECT_DOUBLE_EQ(get<3>(a), 3.);
-        if constexpr (is_m256<TypeParam>)
+        if constexpr (num_elements<TypeParam> >= 8) // NOLINT(readability-magic-numbers)
         {
             EXPECT_DOUBLE_EQ(get<4>(a), 4.);
             EXPECT_DOUBLE_EQ(get<5>(a), 5.);
             EXPECT_DOUBLE_EQ(get<6>(a), 6.);
             EXPECT_DOUBLE_EQ(get<7>(a), 7.);
+            if constexpr (num_elements<TypeParam> == 16) // NOLINT(readability-magic-numbers)
+            {
+                EXPECT_DOUBLE_EQ(get<8>(a), 8.);   // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<9>(a), 9.);   // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<10>(a), 10.); // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<11>(a), 11.); // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<12>(a), 12.); // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<13>(a), 13.); // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<14>(a), 14.); // NOLINT(readability-magic-numbers)
+                EXPECT_DOUBLE_EQ(get<15>(a), 15.); // NOLINT(readability-magic-numbers)
+            }
         }
     }
 }
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_set_blended) // NOLINT
+{
+    for (UST i = 0; i < num_elements<TypeParam>; ++i)
+    {
+        auto a = mm_set1<TypeParam>(-1.);
+        set_blended(a, i, static_cast<ElementType<TypeParam>>(i));
+
+        VectorDataArray<TypeParam> data = {{{0}}};
+        mm_store(data.data(), a);
+
+        for (UST j = 0; j < data.size(); ++j)
+            EXPECT_DOUBLE_EQ(data.at(j), (j == i) ? static_cast<F64>(i) : -1.);
+    }
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_set_dynamic_version) // NOLINT
@@ -94,12 +138,23 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_set_static_version) // NOL
     {
         set<2>(a, 2.); // NOLINT
         set<3>(a, 3.); // NOLINT
-        if constexpr (is_m256<TypeParam>)
+        if constexpr (num_elements<TypeParam> >= 8) // NOLINT(readability-magic-numbers)
         {
             set<4>(a, 4.); // NOLINT
             set<5>(a, 5.); // NOLINT
             set<6>(a, 6.); // NOLINT
             set<7>(a, 7.); // NOLINT
+            if constexpr (num_elements<TypeParam> == 16) // NOLINT(readability-magic-numbers)
+            {
+                set<8>(a, 8.);   // NOLINT
+                set<9>(a, 9.);   // NOLINT
+                set<10>(a, 10.); // NOLINT
+                set<11>(a, 11.); // NOLINT
+                set<12>(a, 12.); // NOLINT
+                set<13>(a, 13.); // NOLINT
+                set<14>(a, 14.); // NOLINT
+                set<15>(a, 15.); // NOLINT
+            }
         }
     }
 
@@ -0,0 +1,141 @@
+#include "mjolnir/core/exception.h"
+#include "mjolnir/core/x86/cpu_features.h"
+#include "mjolnir/core/x86/dispatch.h"
+#include <gtest/gtest.h>
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// --- helper functions -----------------------------------------------------------------------------------------------
+
+[[nodiscard]] auto get_tier_scalar(I32 value) noexcept -> I32
+{
+    return value;
+}
+
+
+[[nodiscard]] auto get_tier_sse4_2(I32 value) noexcept -> I32
+{
+    return value + 1;
+}
+
+
+[[nodiscard]] auto get_tier_avx2(I32 value) noexcept -> I32
+{
+    return value + 2;
+}
+
+
+[[nodiscard]] auto get_tier_avx512(I32 value) noexcept -> I32
+{
+    return value + 3;
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test get_cpu_features ------------------------------------------------------------------------------------------
+
+TEST(TestDispatch, get_cpu_features) // NOLINT
+{
+    const CPUFeatures& features = get_cpu_features();
+
+    // The compiler targets the instruction sets of the test system
+#ifdef __SSE4_2__
+    EXPECT_TRUE(features.sse4_2);
+#endif
+#ifdef __AVX__
+    EXPECT_TRUE(features.avx);
+#endif
+#ifdef __AVX2__
+    EXPECT_TRUE(features.avx2);
+#endif
+#ifdef __FMA__
+    EXPECT_TRUE(features.fma);
+#endif
+#ifdef __AVX512F__
+    EXPECT_TRUE(features.avx512f);
+#endif
+
+    if (features.avx2 || features.fma)
+    {
+        EXPECT_TRUE(features.avx);
+    }
+
+    EXPECT_EQ(&features, &get_cpu_features());
+}
+
+
+// --- test DispatchedFunction ----------------------------------------------------------------------------------------
+
+TEST(TestDispatch, dispatched_function) // NOLINT
+{
+    constexpr DispatchedFunction<I32(I32)> f_scalar{&get_tier_scalar};
+    constexpr DispatchedFunction<I32(I32)> f_sse4_2{&get_tier_scalar, &get_tier_sse4_2};
+    constexpr DispatchedFunction<I32(I32)> f_all{
+            &get_tier_scalar, &get_tier_sse4_2, &get_tier_avx2, &get_tier_avx512};
+    constexpr DispatchedFunction<I32(I32)> f_gap{&get_tier_scalar, nullptr, &get_tier_avx2};
+
+    EXPECT_EQ(f_scalar.get_function(InstructionSetTier::SCALAR), &get_tier_scalar);
+    EXPECT_EQ(f_scalar.get_function(InstructionSetTier::SSE4_2), &get_tier_scalar);
+    EXPECT_EQ(f_scalar.get_function(InstructionSetTier::AVX2), &get_tier_scalar);
+    EXPECT_EQ(f_scalar.get_function(InstructionSetTier::AVX512), &get_tier_scalar);
+
+    EXPECT_EQ(f_sse4_2.get_function(InstructionSetTier::SCALAR), &get_tier_scalar);
+    EXPECT_EQ(f_sse4_2.get_function(InstructionSetTier::SSE4_2), &get_tier_sse4_2);
+    EXPECT_EQ(f_sse4_2.get_function(InstructionSetTier::AVX2), &get_tier_sse4_2);
+    EXPECT_EQ(f_sse4_2.get_function(InstructionSetTier::AVX512), &get_tier_sse4_2);
+
+    EXPECT_EQ(f_all.get_function(InstructionSetTier::SCALAR), &get_tier_scalar);
+    EXPECT_EQ(f_all.get_function(InstructionSetTier::SSE4_2), &get_tier_sse4_2);
+    EXPECT_EQ(f_all.get_function(InstructionSetTier::AVX2), &get_tier_avx2);
+    EXPECT_EQ(f_all.get_function(InstructionSetTier::AVX512), &get_tier_avx512);
+
+    EXPECT_EQ(f_gap.get_function(InstructionSetTier::SSE4_2), &get_tier_scalar);
+    EXPECT_EQ(f_gap.get_function(InstructionSetTier::AVX2), &get_tier_avx2);
+    EXPECT_EQ(f_gap.get_function(InstructionSetTier::AVX512), &get_tier_avx2);
+
+    EXPECT_EQ(f_all(1), f_all.get_function(get_instruction_set_tier())(1));
+}
+
+
+// --- test force_instruction_set_tier --------------------------------------------------------------------------------
+
+TEST(TestDispatch, force_instruction_set_tier) // NOLINT
+{
+    constexpr DispatchedFunction<I32(I32)> f{&get_tier_scalar, &get_tier_sse4_2, &get_tier_avx2, &get_tier_avx512};
+
+    // The supported tier only depends on the CPU and not on the instruction set the test is compiled for
+    const CPUFeatures& features = get_cpu_features();
+
+    InstructionSetTier supported = get_supported_instruction_set_tier();
+    EXPECT_EQ(supported >= InstructionSetTier::SSE4_2, features.sse4_2);
+    EXPECT_EQ(supported >= InstructionSetTier::AVX2, features.sse4_2 && features.avx2 && features.fma);
+    EXPECT_EQ(supported >= InstructionSetTier::AVX512,
+              features.sse4_2 && features.avx2 && features.fma && features.avx512f);
+    EXPECT_EQ(get_instruction_set_tier(), supported);
+
+    for (UST i = 0; i < num_instruction_set_tiers; ++i)
+    {
+        auto tier = static_cast<InstructionSetTier>(i);
+        if (tier > supported)
+        {
+            EXPECT_THROW(force_instruction_set_tier(tier), ValueError); // NOLINT
+            continue;
+        }
+
+        force_instruction_set_tier(tier);
+        EXPECT_EQ(get_instruction_set_tier(), tier);
+        EXPECT_EQ(f(1), static_cast<I32>(i) + 1);
+    }
+
+    reset_instruction_set_tier();
+    EXPECT_EQ(get_instruction_set_tier(), supported);
+}
@@ -0,0 +1,197 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/element_reduction.h"
+#include "mjolnir/core/x86/element_summation.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return a register with test values. The values are powers of 2, so that all products are exactly representable.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_test_register(UST offset) noexcept -> T_RegisterType
+{
+    using EType = ElementType<T_RegisterType>;
+
+    constexpr std::array<EType, 5> values = {{0.5, 4., 1., 0.25, 2.}};
+
+    auto src = mm_setzero<T_RegisterType>();
+    for (UST i = 0; i < num_elements<T_RegisterType>; ++i)
+        set(src, i, values.at((3 * i + offset) % values.size()));
+    return src;
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_broadcast_element_reduction -------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_broadcast_element_reduction) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    for (UST offset = 0; offset < 5; ++offset) // NOLINT(readability-magic-numbers)
+    {
+        auto src = get_test_register<TypeParam>(offset);
+
+        EType exp_max = get(src, 0);
+        EType exp_min = get(src, 0);
+        EType exp_mul = 1;
+        for (UST i = 0; i < n_e; ++i)
+        {
+            exp_max = std::max(exp_max, get(src, i));
+            exp_min = std::min(exp_min, get(src, i));
+            exp_mul *= get(src, i);
+        }
+
+        auto res_max = broadcast_element_max(src);
+        auto res_min = broadcast_element_min(src);
+        auto res_mul = broadcast_element_product(src);
+
+        for (UST i = 0; i < n_e; ++i)
+        {
+            EXPECT_EQ(get(res_max, i), exp_max);
+            EXPECT_EQ(get(res_min, i), exp_min);
+            EXPECT_EQ(get(res_mul, i), exp_mul);
+        }
+    }
+}
+
+
+// --- test_element_argmax_argmin -------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_element_argmax_argmin) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    for (UST idx = 0; idx < n_e; ++idx)
+    {
+        auto src = get_test_register<TypeParam>(idx);
+
+        set(src, idx, EType(10.));
+        EXPECT_EQ(element_argmax(src), idx);
+
+        set(src, idx, EType(-10.));
+        EXPECT_EQ(element_argmin(src), idx);
+
+        // If multiple elements share the extreme value, the lowest index is returned
+        set(src, n_e - 1, EType(-10.));
+        EXPECT_EQ(element_argmin(src), idx);
+    }
+}
+
+
+// --- test_element_max_min_product -----------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_element_max_min_product) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    for (UST offset = 0; offset < 5; ++offset) // NOLINT(readability-magic-numbers)
+    {
+        auto src = get_test_register<TypeParam>(offset);
+
+        EType exp_max = get(src, 0);
+        EType exp_min = get(src, 0);
+        EType exp_mul = 1;
+        for (UST i = 0; i < n_e; ++i)
+        {
+            exp_max = std::max(exp_max, get(src, i));
+            exp_min = std::min(exp_min, get(src, i));
+            exp_mul *= get(src, i);
+        }
+
+        EXPECT_EQ(element_max(src), exp_max);
+        EXPECT_EQ(element_min(src), exp_min);
+        EXPECT_EQ(element_product(src), exp_mul);
+    }
+}
+
+
+// --- test_element_max_min_product_first_n ---------------------------------------------------------------------------
+
+template <UST t_num_elements, FloatVectorRegister T_RegisterType>
+void element_max_min_product_first_n_testcase()
+{
+    using EType = ElementType<T_RegisterType>;
+
+    auto src = get_test_register<T_RegisterType>(t_num_elements);
+
+    EType exp_max = get(src, 0);
+    EType exp_min = get(src, 0);
+    EType exp_mul = 1;
+    for (UST i = 0; i < t_num_elements; ++i)
+    {
+        exp_max = std::max(exp_max, get(src, i));
+        exp_min = std::min(exp_min, get(src, i));
+        exp_mul *= get(src, i);
+    }
+
+    EXPECT_EQ(element_max_first_n<t_num_elements>(src), exp_max);
+    EXPECT_EQ(element_min_first_n<t_num_elements>(src), exp_min);
+    EXPECT_EQ(element_product_first_n<t_num_elements>(src), exp_mul);
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_element_max_min_product_first_n) // NOLINT
+{
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    element_max_min_product_first_n_testcase<1, TypeParam>();
+    element_max_min_product_first_n_testcase<2, TypeParam>();
+    if constexpr (n_e > 2)
+    {
+        element_max_min_product_first_n_testcase<3, TypeParam>();
+        element_max_min_product_first_n_testcase<4, TypeParam>();
+    }
+    if constexpr (n_e > 4) // NOLINT(readability-misleading-indentation)
+    {
+        element_max_min_product_first_n_testcase<5, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_max_min_product_first_n_testcase<6, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_max_min_product_first_n_testcase<7, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_max_min_product_first_n_testcase<8, TypeParam>(); // NOLINT(readability-magic-numbers)
+    }
+    if constexpr (n_e > 8) // NOLINT(readability-misleading-indentation, readability-magic-numbers)
+    {
+        element_max_min_product_first_n_testcase<9, TypeParam>();  // NOLINT(readability-magic-numbers)
+        element_max_min_product_first_n_testcase<12, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_max_min_product_first_n_testcase<15, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_max_min_product_first_n_testcase<16, TypeParam>(); // NOLINT(readability-magic-numbers)
+    }
+}
+
+
+// --- test_element_reduction -----------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_element_reduction) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto add = [](TypeParam lhs, TypeParam rhs) { return mm_add(lhs, rhs); };
+    auto src = get_test_register<TypeParam>(1);
+
+    // All test values and partial sums are exactly representable, so the summation order doesn't matter
+    EXPECT_EQ(element_reduction(src, add), element_sum(src));
+    EXPECT_EQ(element_reduction_first_n<n_e - 1>(src, add, EType(0)), element_sum_first_n<n_e - 1>(src));
+
+    auto res = broadcast_element_reduction(src, add);
+    for (UST i = 0; i < n_e; ++i)
+        EXPECT_EQ(get(res, i), element_sum(src));
+}
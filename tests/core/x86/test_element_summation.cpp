@@ -116,4 +116,11 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_element_sum_first_n) // NO
         element_sum_first_n_testcase<7, TypeParam>(); // NOLINT(readability-magic-numbers)
         element_sum_first_n_testcase<8, TypeParam>(); // NOLINT(readability-magic-numbers)
     }
+    if constexpr (n_e > 8) // NOLINT(readability-misleading-indentation, readability-magic-numbers)
+    {
+        element_sum_first_n_testcase<9, TypeParam>();  // NOLINT(readability-magic-numbers)
+        element_sum_first_n_testcase<12, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_sum_first_n_testcase<15, TypeParam>(); // NOLINT(readability-magic-numbers)
+        element_sum_first_n_testcase<16, TypeParam>(); // NOLINT(readability-magic-numbers)
+    }
 }
@@ -0,0 +1,328 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/elementary_functions.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Maximal error in units in the last place of the precise functions
+constexpr F64 max_ulp_error = 3.;
+
+//! Number of tested values per range
+constexpr UST num_test_values = 1000;
+
+
+//! Return the error of `result` in units in the last place of the exact value.
+template <typename T_Type>
+[[nodiscard]] auto get_ulp_error(T_Type result, long double exact) noexcept -> F64
+{
+    auto exact_rounded = static_cast<T_Type>(exact);
+    if ((std::isnan(result) && std::isnan(exact)) || (std::isinf(exact_rounded) && result == exact_rounded))
+        return 0.;
+
+    T_Type magnitude = std::abs(exact_rounded);
+    T_Type ulp       = std::nextafter(magnitude, std::numeric_limits<T_Type>::infinity()) - magnitude;
+    return static_cast<F64>(std::abs(static_cast<long double>(result) - exact) / ulp);
+}
+
+
+//! Apply the register function `func` to all values and return the results.
+template <FloatVectorRegister T_RegisterType, typename T_Func>
+[[nodiscard]] auto evaluate(T_Func func, std::vector<ElementType<T_RegisterType>> values)
+        -> std::vector<ElementType<T_RegisterType>>
+{
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    UST num_values = values.size();
+    values.resize((num_values + n_e - 1) / n_e * n_e, ElementType<T_RegisterType>(1));
+
+    std::vector<ElementType<T_RegisterType>> results(values.size());
+    for (UST i = 0; i < values.size(); i += n_e)
+        mm_storeu(&results[i], func(mm_loadu<T_RegisterType>(&values[i])));
+
+    results.resize(num_values);
+    return results;
+}
+
+
+//! Return `num_test_values` equally spaced values in [`lower`, `upper`]. If `t_logarithmic` is `true`, the logarithms
+//! of the values are equally spaced.
+template <typename T_Type, bool t_logarithmic = false>
+[[nodiscard]] auto get_test_values(long double lower, long double upper) -> std::vector<T_Type>
+{
+    std::vector<T_Type> values(num_test_values);
+    for (UST i = 0; i < num_test_values; ++i)
+    {
+        long double t = static_cast<long double>(i) / static_cast<long double>(num_test_values - 1);
+        if constexpr (t_logarithmic)
+            values[i] = static_cast<T_Type>(std::exp(std::log(lower) + t * (std::log(upper) - std::log(lower))));
+        else
+            values[i] = static_cast<T_Type>(lower + t * (upper - lower));
+    }
+    return values;
+}
+
+
+//! Check the errors of the register function `func` for all passed values against the reference function `ref`.
+//! Precise functions are checked in units in the last place. The relative error of fast functions must be below the
+//! square root of the machine epsilon for all results in the normal range.
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy, typename T_Func, typename T_Reference>
+void check_accuracy(T_Func func, T_Reference ref, const std::vector<ElementType<T_RegisterType>>& values)
+{
+    using EType = ElementType<T_RegisterType>;
+
+    const auto max_relative_error = std::sqrt(std::numeric_limits<EType>::epsilon());
+
+    auto results = evaluate<T_RegisterType>(func, values);
+    for (UST i = 0; i < values.size(); ++i)
+    {
+        long double exact = ref(static_cast<long double>(values[i]));
+
+        if constexpr (t_accuracy == Accuracy::PRECISE)
+        {
+            EXPECT_LE(get_ulp_error(results[i], exact), max_ulp_error) << "value: " << values[i];
+        }
+        else if (std::isnormal(static_cast<EType>(exact)))
+        {
+            EXPECT_LE(std::abs((results[i] - exact) / exact), max_relative_error) << "value: " << values[i];
+        }
+    }
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_atan2 -----------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+void test_atan2_accuracy()
+{
+    using EType = ElementType<T_RegisterType>;
+
+    auto y_values = get_test_values<EType>(-20., 20.); // NOLINT(readability-magic-numbers)
+
+    for (EType x : {EType(1.), EType(-1.), EType(0.3), EType(-7.)}) // NOLINT(readability-magic-numbers)
+    {
+        auto func = [x](T_RegisterType y) { return atan2<t_accuracy>(y, mm_set1<T_RegisterType>(x)); };
+        auto ref  = [x](long double y) { return std::atan2(y, static_cast<long double>(x)); };
+        check_accuracy<T_RegisterType, t_accuracy>(func, ref, y_values);
+    }
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_atan2) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    test_atan2_accuracy<TypeParam, Accuracy::PRECISE>();
+    test_atan2_accuracy<TypeParam, Accuracy::FAST>();
+
+    // zeros, infinities and NaNs
+    constexpr EType inf = std::numeric_limits<EType>::infinity();
+    constexpr EType nan = std::numeric_limits<EType>::quiet_NaN();
+
+    std::vector<EType> values = {0., -0., 1., -1., inf, -inf, nan};
+    for (EType x : values)
+    {
+        auto func    = [x](TypeParam y) { return atan2(y, mm_set1<TypeParam>(x)); };
+        auto results = evaluate<TypeParam>(func, values);
+
+        for (UST i = 0; i < values.size(); ++i)
+        {
+            EType exp = std::atan2(values[i], x);
+            if (std::isnan(exp))
+                EXPECT_TRUE(std::isnan(results[i]));
+            else
+            {
+                EXPECT_NEAR(results[i], exp, std::numeric_limits<EType>::epsilon() * 4) << values[i] << ", " << x;
+                EXPECT_EQ(std::signbit(results[i]), std::signbit(exp)) << values[i] << ", " << x;
+            }
+        }
+    }
+}
+
+
+// --- test_exp -------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+void test_exp_accuracy()
+{
+    using EType = ElementType<T_RegisterType>;
+
+    constexpr bool is_sp = is_single_precision<T_RegisterType>;
+
+    auto func = [](T_RegisterType x) { return exp<t_accuracy>(x); };
+    auto ref  = [](long double x) { return std::exp(x); };
+
+    // The full range includes overflowing and subnormal results
+    auto lower = is_sp ? -104.L : -746.L; // NOLINT(readability-magic-numbers)
+    auto upper = is_sp ? 89.L : 710.L;    // NOLINT(readability-magic-numbers)
+    check_accuracy<T_RegisterType, t_accuracy>(func, ref, get_test_values<EType>(lower, upper));
+    check_accuracy<T_RegisterType, t_accuracy>(func, ref, get_test_values<EType>(-1., 1.));
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_exp) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    test_exp_accuracy<TypeParam, Accuracy::PRECISE>();
+    test_exp_accuracy<TypeParam, Accuracy::FAST>();
+
+    // special values
+    constexpr EType inf = std::numeric_limits<EType>::infinity();
+    constexpr EType nan = std::numeric_limits<EType>::quiet_NaN();
+
+    auto results = evaluate<TypeParam>([](TypeParam x) { return exp(x); }, {0., inf, -inf, nan, 1000., -1000.});
+    EXPECT_EQ(results[0], EType(1.));
+    EXPECT_EQ(results[1], inf);
+    EXPECT_EQ(results[2], EType(0.));
+    EXPECT_TRUE(std::isnan(results[3]));
+    EXPECT_EQ(results[4], inf);
+    EXPECT_EQ(results[5], EType(0.));
+}
+
+
+// --- test_log -------------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+void test_log_accuracy()
+{
+    using EType = ElementType<T_RegisterType>;
+
+    auto func = [](T_RegisterType x) { return log<t_accuracy>(x); };
+    auto ref  = [](long double x) { return std::log(x); };
+
+    // The full range includes subnormal values
+    auto lower = static_cast<long double>(std::numeric_limits<EType>::denorm_min());
+    auto upper = static_cast<long double>(std::numeric_limits<EType>::max());
+    check_accuracy<T_RegisterType, t_accuracy>(func, ref, get_test_values<EType, true>(lower, upper));
+    check_accuracy<T_RegisterType, t_accuracy>(func, ref, get_test_values<EType>(0.5, 2.)); // NOLINT
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_log) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    test_log_accuracy<TypeParam, Accuracy::PRECISE>();
+    test_log_accuracy<TypeParam, Accuracy::FAST>();
+
+    // special values
+    constexpr EType inf = std::numeric_limits<EType>::infinity();
+    constexpr EType nan = std::numeric_limits<EType>::quiet_NaN();
+
+    auto results = evaluate<TypeParam>([](TypeParam x) { return log(x); }, {1., 0., -0., -1., inf, -inf, nan});
+    EXPECT_EQ(results[0], EType(0.));
+    EXPECT_EQ(results[1], -inf);
+    EXPECT_EQ(results[2], -inf);
+    EXPECT_TRUE(std::isnan(results[3]));
+    EXPECT_EQ(results[4], inf);
+    EXPECT_TRUE(std::isnan(results[5]));
+    EXPECT_TRUE(std::isnan(results[6]));
+}
+
+
+// --- test_rcp -------------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_rcp) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    auto ref    = [](long double x) { return 1 / x; };
+    auto values = get_test_values<EType, true>(1E-3, 1E3); // NOLINT(readability-magic-numbers)
+
+    check_accuracy<TypeParam, Accuracy::PRECISE>([](TypeParam x) { return rcp(x); }, ref, values);
+    check_accuracy<TypeParam, Accuracy::FAST>([](TypeParam x) { return rcp<Accuracy::FAST>(x); }, ref, values);
+
+    // special values
+    constexpr EType inf = std::numeric_limits<EType>::infinity();
+
+    auto results = evaluate<TypeParam>([](TypeParam x) { return rcp<Accuracy::FAST>(x); }, {0., inf, -0., -inf});
+    EXPECT_EQ(results[0], inf);
+    EXPECT_EQ(results[1], EType(0.));
+    EXPECT_EQ(results[2], -inf);
+    EXPECT_EQ(results[3], EType(0.));
+}
+
+
+// --- test_rsqrt -----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_rsqrt) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    auto ref    = [](long double x) { return 1 / std::sqrt(x); };
+    auto values = get_test_values<EType, true>(1E-3, 1E3); // NOLINT(readability-magic-numbers)
+
+    check_accuracy<TypeParam, Accuracy::PRECISE>([](TypeParam x) { return rsqrt(x); }, ref, values);
+    check_accuracy<TypeParam, Accuracy::FAST>([](TypeParam x) { return rsqrt<Accuracy::FAST>(x); }, ref, values);
+
+    // special values
+    constexpr EType inf = std::numeric_limits<EType>::infinity();
+
+    auto results = evaluate<TypeParam>([](TypeParam x) { return rsqrt<Accuracy::FAST>(x); }, {0., inf, -1.});
+    EXPECT_EQ(results[0], inf);
+    EXPECT_EQ(results[1], EType(0.));
+    EXPECT_TRUE(std::isnan(results[2]));
+}
+
+
+// --- test_sin_cos ---------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, Accuracy t_accuracy>
+void test_sin_cos_accuracy()
+{
+    using EType = ElementType<T_RegisterType>;
+
+    auto sin_func = [](T_RegisterType x) { return sin<t_accuracy>(x); };
+    auto cos_func = [](T_RegisterType x) { return cos<t_accuracy>(x); };
+    auto sin_ref  = [](long double x) { return std::sin(x); };
+    auto cos_ref  = [](long double x) { return std::cos(x); };
+
+    for (long double range : {10.L, 1E4L}) // NOLINT(readability-magic-numbers)
+    {
+        auto values = get_test_values<EType>(-range, range);
+        check_accuracy<T_RegisterType, t_accuracy>(sin_func, sin_ref, values);
+        check_accuracy<T_RegisterType, t_accuracy>(cos_func, cos_ref, values);
+    }
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_sin_cos) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    test_sin_cos_accuracy<TypeParam, Accuracy::PRECISE>();
+    test_sin_cos_accuracy<TypeParam, Accuracy::FAST>();
+
+    // special values
+    constexpr EType inf = std::numeric_limits<EType>::infinity();
+    constexpr EType nan = std::numeric_limits<EType>::quiet_NaN();
+
+    auto sin_results = evaluate<TypeParam>([](TypeParam x) { return sin(x); }, {0., -0., inf, nan});
+    auto cos_results = evaluate<TypeParam>([](TypeParam x) { return cos(x); }, {0., -0., inf, nan});
+
+    EXPECT_EQ(sin_results[0], EType(0.));
+    EXPECT_TRUE(std::signbit(sin_results[1]));
+    EXPECT_TRUE(std::isnan(sin_results[2]));
+    EXPECT_TRUE(std::isnan(sin_results[3]));
+    EXPECT_EQ(cos_results[0], EType(1.));
+    EXPECT_EQ(cos_results[1], EType(1.));
+    EXPECT_TRUE(std::isnan(cos_results[2]));
+    EXPECT_TRUE(std::isnan(cos_results[3]));
+}
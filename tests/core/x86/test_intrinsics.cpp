@@ -0,0 +1,510 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/utility/bit_operations.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include "mjolnir/testing/x86/integer_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return an array with test values where every third element is equal to the corresponding one in `values`.
+template <typename T_TestCase>
+[[nodiscard]] auto get_partially_equal_test_values(const typename T_TestCase::ArrayType& values) noexcept ->
+        typename T_TestCase::ArrayType
+{
+    auto b = get_integer_test_values<T_TestCase>(2);
+    for (UST i = 0; i < b.size(); i += 3)
+        b.at(i) = values.at(i);
+    return b;
+}
+
+
+//! Return an array with `t_size` distinct test values for floating-point registers.
+template <typename T_Type, UST t_size>
+[[nodiscard]] constexpr auto get_float_test_values() noexcept -> std::array<T_Type, t_size>
+{
+    std::array<T_Type, t_size> values = {};
+    for (UST i = 0; i < t_size; ++i)
+        values.at(i) = static_cast<T_Type>(i) * T_Type(1.5) + T_Type(1); // NOLINT(readability-magic-numbers)
+    return values;
+}
+
+
+//! Return a register with one 32 bit index per element of a floating-point register. Index `i` is stored in the
+//! element at position `i`.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_index_register(const std::array<I32, num_elements<T_RegisterType>>& indices) noexcept
+        -> IndexRegisterType<T_RegisterType>
+{
+    std::array<I32, sizeof(IndexRegisterType<T_RegisterType>) / sizeof(I32)> values = {};
+    std::copy(indices.begin(), indices.end(), values.begin());
+    return std::bit_cast<IndexRegisterType<T_RegisterType>>(values);
+}
+
+
+//! Return a mask register for a test case of the masked load and store functions. Element `i` is selected if bit
+//! `i` of `mask_bits` is set. Selected elements are set to `-1` and the others to `1`, so that only the sign bit
+//! decides.
+template <FloatVectorRegister T_RegisterType>
+[[nodiscard]] auto get_mask_register(UST mask_bits) noexcept -> T_RegisterType
+{
+    using EType = ElementType<T_RegisterType>;
+
+    std::array<EType, num_elements<T_RegisterType>> mask = {};
+    for (UST i = 0; i < mask.size(); ++i)
+        mask.at(i) = is_bit_set(mask_bits, i) ? EType(-1) : EType(1);
+    return mm_loadu<T_RegisterType>(mask.data());
+}
+
+
+//! Convert a boolean into the expected element value of a comparison.
+template <typename T_ElementType>
+[[nodiscard]] constexpr auto to_mask_element(bool value) noexcept -> T_ElementType
+{
+    return value ? static_cast<T_ElementType>(~U64{0}) : T_ElementType{0};
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_mm_add ----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_add) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+
+    auto a = get_integer_test_values<TypeParam>(1);
+    auto b = get_integer_test_values<TypeParam>(2);
+
+    auto c = to_element_array<TypeParam>(mm_add<EType>(to_register<TypeParam>(a), to_register<TypeParam>(b)));
+
+    for (UST i = 0; i < a.size(); ++i)
+        EXPECT_EQ(c.at(i), static_cast<EType>(static_cast<U64>(a.at(i)) + static_cast<U64>(b.at(i))));
+}
+
+
+// --- test_mm_bitwise_operations -------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_bitwise_operations) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+
+    auto a = get_integer_test_values<TypeParam>(1);
+    auto b = get_integer_test_values<TypeParam>(2);
+
+    auto reg_a = to_register<TypeParam>(a);
+    auto reg_b = to_register<TypeParam>(b);
+
+    auto c_and    = to_element_array<TypeParam>(mm_and(reg_a, reg_b));
+    auto c_andnot = to_element_array<TypeParam>(mm_andnot(reg_a, reg_b));
+    auto c_or     = to_element_array<TypeParam>(mm_or(reg_a, reg_b));
+    auto c_xor    = to_element_array<TypeParam>(mm_xor(reg_a, reg_b));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(c_and.at(i), static_cast<EType>(a.at(i) & b.at(i)));
+        EXPECT_EQ(c_andnot.at(i), static_cast<EType>(~a.at(i) & b.at(i)));
+        EXPECT_EQ(c_or.at(i), static_cast<EType>(a.at(i) | b.at(i)));
+        EXPECT_EQ(c_xor.at(i), static_cast<EType>(a.at(i) ^ b.at(i)));
+    }
+}
+
+
+// --- test_mm_cmp ----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_cmp) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+
+    auto a = get_integer_test_values<TypeParam>(1);
+    auto b = get_partially_equal_test_values<TypeParam>(a);
+
+    auto reg_a = to_register<TypeParam>(a);
+    auto reg_b = to_register<TypeParam>(b);
+
+    auto c_eq = to_element_array<TypeParam>(mm_cmp_eq<EType>(reg_a, reg_b));
+    auto c_ge = to_element_array<TypeParam>(mm_cmp_ge<EType>(reg_a, reg_b));
+    auto c_gt = to_element_array<TypeParam>(mm_cmp_gt<EType>(reg_a, reg_b));
+    auto c_le = to_element_array<TypeParam>(mm_cmp_le<EType>(reg_a, reg_b));
+    auto c_lt = to_element_array<TypeParam>(mm_cmp_lt<EType>(reg_a, reg_b));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(c_eq.at(i), to_mask_element<EType>(a.at(i) == b.at(i)));
+        EXPECT_EQ(c_ge.at(i), to_mask_element<EType>(a.at(i) >= b.at(i)));
+        EXPECT_EQ(c_gt.at(i), to_mask_element<EType>(a.at(i) > b.at(i)));
+        EXPECT_EQ(c_le.at(i), to_mask_element<EType>(a.at(i) <= b.at(i)));
+        EXPECT_EQ(c_lt.at(i), to_mask_element<EType>(a.at(i) < b.at(i)));
+    }
+}
+
+
+// --- test_mm_i32gather ----------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_i32gather) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto values = get_float_test_values<EType, 4 * n_e>();
+
+    std::array<I32, n_e> indices = {};
+    for (UST i = 0; i < n_e; ++i)
+        indices.at(i) = static_cast<I32>((7 * i + 3) % values.size()); // NOLINT(readability-magic-numbers)
+
+    auto res = mm_i32gather<TypeParam>(values.data(), get_index_register<TypeParam>(indices));
+
+    for (UST i = 0; i < n_e; ++i)
+        EXPECT_EQ(get(res, i), values.at(static_cast<UST>(indices.at(i))));
+}
+
+
+// --- test_mm_i32scatter ---------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_i32scatter) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto values = get_float_test_values<EType, n_e>();
+
+    std::array<I32, n_e> indices = {};
+    for (UST i = 0; i < n_e; ++i)
+        indices.at(i) = static_cast<I32>(2 * (n_e - 1 - i));
+
+    std::array<EType, 2 * n_e> dst = {};
+    std::ranges::fill(dst, EType(-1));
+
+    mm_i32scatter(dst.data(), get_index_register<TypeParam>(indices), mm_loadu<TypeParam>(values.data()));
+
+    for (UST i = 0; i < dst.size(); ++i)
+    {
+        if (i % 2 == 0)
+            EXPECT_EQ(dst.at(i), values.at(n_e - 1 - i / 2));
+        else
+            EXPECT_EQ(dst.at(i), EType(-1));
+    }
+}
+
+
+// --- test_mm_load_partial -------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_load_partial) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto values = get_float_test_values<EType, n_e + 1>();
+
+    for (UST n = 0; n <= n_e; ++n)
+    {
+        // The offset of one element prevents the pointer from being aligned
+        auto res = mm_load_partial<TypeParam>(&values.at(1), n);
+
+        for (UST i = 0; i < n_e; ++i)
+            EXPECT_EQ(get(res, i), (i < n) ? values.at(i + 1) : EType(0));
+    }
+}
+
+
+// --- test_mm_loadu_storeu -------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_loadu_storeu) // NOLINT
+{
+    using EType       = typename TypeParam::ElementType;
+    constexpr UST n_e = TypeParam::num_elements;
+
+    auto values = get_integer_test_values<TypeParam>(4);
+
+    std::array<EType, n_e + 1> src = {};
+    std::array<EType, n_e + 1> dst = {};
+    std::ranges::copy(values, src.begin() + 1);
+    mm_storeu(&dst.at(1), mm_loadu<typename TypeParam::RegisterType>(&src.at(1)));
+
+    EXPECT_EQ(dst.at(0), EType(0));
+    for (UST i = 0; i < n_e; ++i)
+        EXPECT_EQ(dst.at(i + 1), values.at(i));
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_loadu_storeu) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto values = get_float_test_values<EType, n_e + 1>();
+
+    std::array<EType, n_e + 1> dst = {};
+    mm_storeu(&dst.at(1), mm_loadu<TypeParam>(&values.at(1)));
+
+    EXPECT_EQ(dst.at(0), EType(0));
+    for (UST i = 1; i < dst.size(); ++i)
+        EXPECT_EQ(dst.at(i), values.at(i));
+}
+
+
+// --- test_mm_maskload_maskstore -------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_maskload_maskstore) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto values = get_float_test_values<EType, n_e>();
+
+    for (UST test_case = 0; test_case < get_num_element_flag_test_cases<TypeParam>(); ++test_case)
+    {
+        UST  mask_bits = get_element_flag_test_case_bits<TypeParam>(test_case);
+        auto mask      = get_mask_register<TypeParam>(mask_bits);
+
+        auto res = mm_maskload(values.data(), mask);
+
+        std::array<EType, n_e> dst = {};
+        std::ranges::fill(dst, EType(-1));
+        mm_maskstore(dst.data(), mask, mm_loadu<TypeParam>(values.data()));
+
+        for (UST i = 0; i < n_e; ++i)
+        {
+            EXPECT_EQ(get(res, i), is_bit_set(mask_bits, i) ? values.at(i) : EType(0));
+            EXPECT_EQ(dst.at(i), is_bit_set(mask_bits, i) ? values.at(i) : EType(-1));
+        }
+    }
+}
+
+
+// --- test_mm_max_min ------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_max_min) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+
+    auto a = get_integer_test_values<TypeParam>(1);
+    auto b = get_partially_equal_test_values<TypeParam>(a);
+
+    auto c_max = to_element_array<TypeParam>(mm_max<EType>(to_register<TypeParam>(a), to_register<TypeParam>(b)));
+    auto c_min = to_element_array<TypeParam>(mm_min<EType>(to_register<TypeParam>(a), to_register<TypeParam>(b)));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(c_max.at(i), std::max(a.at(i), b.at(i)));
+        EXPECT_EQ(c_min.at(i), std::min(a.at(i), b.at(i)));
+    }
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_max_min) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto a = get_float_test_values<EType, n_e>();
+
+    // Reversing the order mixes larger and smaller values
+    std::array<EType, n_e> b = {};
+    std::reverse_copy(a.begin(), a.end(), b.begin());
+
+    auto c_max = mm_max(mm_loadu<TypeParam>(a.data()), mm_loadu<TypeParam>(b.data()));
+    auto c_min = mm_min(mm_loadu<TypeParam>(a.data()), mm_loadu<TypeParam>(b.data()));
+
+    for (UST i = 0; i < n_e; ++i)
+    {
+        EXPECT_EQ(get(c_max, i), std::max(a.at(i), b.at(i)));
+        EXPECT_EQ(get(c_min, i), std::min(a.at(i), b.at(i)));
+    }
+}
+
+
+// --- test_mm_movemask -----------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_movemask) // NOLINT
+{
+    for (UST test_case = 0; test_case < get_num_element_flag_test_cases<TypeParam>(); ++test_case)
+    {
+        UST mask_bits = get_element_flag_test_case_bits<TypeParam>(test_case);
+        EXPECT_EQ(mm_movemask(get_mask_register<TypeParam>(mask_bits)), mask_bits);
+    }
+}
+
+
+// --- test_mm_mullo --------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_mullo) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+
+    auto a = get_integer_test_values<TypeParam>(1);
+    auto b = get_integer_test_values<TypeParam>(2);
+
+    auto c = to_element_array<TypeParam>(mm_mullo<EType>(to_register<TypeParam>(a), to_register<TypeParam>(b)));
+
+    for (UST i = 0; i < a.size(); ++i)
+        EXPECT_EQ(c.at(i), static_cast<EType>(static_cast<U64>(a.at(i)) * static_cast<U64>(b.at(i))));
+}
+
+
+// --- test_mm_set ----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_set) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+    using RType = typename TypeParam::RegisterType;
+
+    constexpr EType value = std::numeric_limits<EType>::max() - 3;
+
+    auto c_set1    = to_element_array<TypeParam>(mm_set1<EType, RType>(value));
+    auto c_setzero = to_element_array<TypeParam>(mm_setzero<RType>());
+    auto c_setr    = to_element_array<TypeParam>(
+            []<UST... t_i>(std::index_sequence<t_i...>) {
+                return mm_setr<EType, RType>(static_cast<EType>(t_i + 1)...);
+            }(std::make_index_sequence<TypeParam::num_elements>()));
+
+    for (UST i = 0; i < TypeParam::num_elements; ++i)
+    {
+        EXPECT_EQ(c_set1.at(i), value);
+        EXPECT_EQ(c_setzero.at(i), EType{0});
+        EXPECT_EQ(c_setr.at(i), static_cast<EType>(i + 1));
+    }
+}
+
+
+// --- test_mm_shift --------------------------------------------------------------------------------------------------
+
+template <typename T_TestCase, UST t_count>
+void test_mm_shift_test_case()
+{
+    using EType = typename T_TestCase::ElementType;
+    using UType = std::make_unsigned_t<EType>;
+    using SType = std::make_signed_t<EType>;
+
+    auto a   = get_integer_test_values<T_TestCase>(3);
+    auto src = to_register<T_TestCase>(a);
+
+    auto c_slli = to_element_array<T_TestCase>(mm_slli<EType, t_count>(src));
+    auto c_srai = to_element_array<T_TestCase>(mm_srai<EType, t_count>(src));
+    auto c_srli = to_element_array<T_TestCase>(mm_srli<EType, t_count>(src));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        EXPECT_EQ(c_slli.at(i), static_cast<EType>(static_cast<UType>(a.at(i)) << t_count));
+        EXPECT_EQ(c_srai.at(i), static_cast<EType>(static_cast<SType>(a.at(i)) >> t_count));
+        EXPECT_EQ(c_srli.at(i), static_cast<EType>(static_cast<UType>(a.at(i)) >> t_count));
+    }
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_shift) // NOLINT
+{
+    constexpr UST n_bits = num_bits<typename TypeParam::ElementType>;
+
+    test_mm_shift_test_case<TypeParam, 0>();
+    test_mm_shift_test_case<TypeParam, 1>();
+    test_mm_shift_test_case<TypeParam, n_bits / 2 - 1>();
+    test_mm_shift_test_case<TypeParam, n_bits / 2>();
+    test_mm_shift_test_case<TypeParam, n_bits / 2 + 1>();
+    test_mm_shift_test_case<TypeParam, n_bits - 1>();
+}
+
+
+// --- test_mm_shift_variable -----------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_shift_variable) // NOLINT
+{
+    using EType          = typename TypeParam::ElementType;
+    using UType          = std::make_unsigned_t<EType>;
+    constexpr UST n_bits = num_bits<EType>;
+
+    if constexpr (n_bits >= 32)
+    {
+        auto a = get_integer_test_values<TypeParam>(5);
+
+        // includes counts that exceed the number of element bits
+        typename TypeParam::ArrayType counts = {};
+        for (UST i = 0; i < counts.size(); ++i)
+            counts.at(i) = static_cast<EType>((i * 13 + 3) % (n_bits + 8));
+
+        auto src     = to_register<TypeParam>(a);
+        auto c_count = to_register<TypeParam>(counts);
+        auto c_sllv  = to_element_array<TypeParam>(mm_sllv<EType>(src, c_count));
+        auto c_srlv  = to_element_array<TypeParam>(mm_srlv<EType>(src, c_count));
+
+        for (UST i = 0; i < a.size(); ++i)
+        {
+            const auto count = static_cast<UST>(counts.at(i));
+            const auto value = static_cast<UType>(a.at(i));
+            EXPECT_EQ(c_sllv.at(i), static_cast<EType>(count < n_bits ? static_cast<UType>(value << count) : 0));
+            EXPECT_EQ(c_srlv.at(i), static_cast<EType>(count < n_bits ? static_cast<UType>(value >> count) : 0));
+        }
+    }
+}
+
+
+// --- test_mm_store_partial ------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_store_partial) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    constexpr auto values = get_float_test_values<EType, n_e>();
+    auto           src    = mm_loadu<TypeParam>(values.data());
+
+    for (UST n = 0; n <= n_e; ++n)
+    {
+        std::array<EType, n_e + 1> dst = {};
+        std::ranges::fill(dst, EType(-1));
+
+        mm_store_partial(&dst.at(1), src, n);
+
+        EXPECT_EQ(dst.at(0), EType(-1));
+        for (UST i = 0; i < n_e; ++i)
+            EXPECT_EQ(dst.at(i + 1), (i < n) ? values.at(i) : EType(-1));
+    }
+}
+
+
+// --- test_mm_stream -------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_mm_stream) // NOLINT
+{
+    constexpr auto values = get_float_test_values<ElementType<TypeParam>, num_elements<TypeParam>>();
+
+    VectorDataArray<TypeParam> dst = {};
+    mm_stream(dst.data(), mm_loadu<TypeParam>(values.data()));
+    _mm_sfence();
+
+    for (UST i = 0; i < values.size(); ++i)
+        EXPECT_EQ(dst.at(i), values.at(i));
+}
+
+
+// --- test_mm_sub ----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_mm_sub) // NOLINT
+{
+    using EType = typename TypeParam::ElementType;
+
+    auto a = get_integer_test_values<TypeParam>(1);
+    auto b = get_integer_test_values<TypeParam>(2);
+
+    auto c = to_element_array<TypeParam>(mm_sub<EType>(to_register<TypeParam>(a), to_register<TypeParam>(b)));
+
+    for (UST i = 0; i < a.size(); ++i)
+        EXPECT_EQ(c.at(i), static_cast<EType>(static_cast<U64>(a.at(i)) - static_cast<U64>(b.at(i))));
+}
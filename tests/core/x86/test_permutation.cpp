@@ -7,6 +7,7 @@
 #include "mjolnir/core/x86/permutation.h"
 #include "mjolnir/testing/typed_test_series.h"
 #include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include "mjolnir/testing/x86/integer_vector_register_test_suite.h"
 #include <gtest/gtest.h>
 #include <initializer_list>
 
@@ -77,7 +78,7 @@ template <typename T_RegisterType>
 {
     std::array<U32, num_elements<T_RegisterType>> a = {{0}};
     for (UST i = 0; i < a.size(); ++i)
-        a.at(i) = is_bit_set(test_case_index, i) ? 1 : 0;
+        a.at(i) = is_bit_set(get_element_flag_test_case_bits<T_RegisterType>(test_case_index), i) ? 1 : 0;
     return a;
 }
 
@@ -93,19 +94,22 @@ void test_blend_test_case(T_RegisterType a, T_RegisterType b)
         c = blend<v[0], v[1]>(a, b);
     else if constexpr (num_elements<T_RegisterType> == 4)
         c = blend<v[0], v[1], v[2], v[3]>(a, b);
-    else
+    else if constexpr (num_elements<T_RegisterType> == 8) // NOLINT - magic number
         c = blend<v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]>(a, b); // NOLINT
+    else
+        c = blend<v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], // NOLINT
+                  v[8], v[9], v[10], v[11], v[12], v[13], v[14], v[15]>(a, b);
 
 
     // check results
     for (UST i = 0; i < num_elements<T_RegisterType>; ++i)
-        EXPECT_DOUBLE_EQ(get(c, i), (is_bit_set(t_test_case_index, i) ? get(b, i) : get(a, i)));
+        EXPECT_DOUBLE_EQ(get(c, i), (v.at(i) == 1 ? get(b, i) : get(a, i)));
 }
 
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_blend) // NOLINT
 {
-    TYPED_TEST_SERIES(test_blend_test_case, power_of_2(num_elements<TypeParam>));
+    TYPED_TEST_SERIES(test_blend_test_case, get_num_element_flag_test_cases<TypeParam>());
 }
 
 
@@ -224,19 +228,15 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_blend_from_to) // NOLINT
 template <typename T_RegisterType, UST t_test_case_index>
 void test_broadcast(T_RegisterType a, [[maybe_unused]] T_RegisterType b) // NOLINT - complexity
 {
+    constexpr UST n_l  = num_lanes<T_RegisterType>;
     constexpr UST n_le = num_lane_elements<T_RegisterType>;
 
     T_RegisterType c = broadcast<t_test_case_index>(a);
 
 
     for (UST i = 0; i < n_le; ++i)
-    {
-        EXPECT_DOUBLE_EQ(get(c, i), get(a, t_test_case_index));
-        if constexpr (is_avx_register<T_RegisterType>)
-        {
-            EXPECT_DOUBLE_EQ(get(c, i + n_le), get(a, t_test_case_index + n_le));
-        }
-    }
+        for (UST j = 0; j < n_l; ++j)
+            EXPECT_DOUBLE_EQ(get(c, i + j * n_le), get(a, t_test_case_index + j * n_le));
 
     if constexpr (is_avx_register<T_RegisterType>)
     {
@@ -344,6 +344,38 @@ TEST(TestM128, test_insert) // NOLINT
 }
 
 
+template <typename T_RegisterType, UST t_test_case_index>
+void test_insert_test_case(T_RegisterType a, T_RegisterType b)
+{
+    constexpr UST n_e     = num_elements<T_RegisterType>;
+    constexpr UST idx_src = t_test_case_index % n_e;
+    constexpr UST idx_dst = t_test_case_index / n_e;
+
+    T_RegisterType c = insert<idx_src, idx_dst>(a, b);
+
+    // set every second element to zero
+    T_RegisterType d = [a, b]<UST... t_i>(std::index_sequence<t_i...>) -> T_RegisterType
+    {
+        return insert<idx_src, idx_dst, (t_i % 2 == 1)...>(a, b);
+    }(std::make_index_sequence<n_e>());
+
+    for (UST i = 0; i < n_e; ++i)
+    {
+        auto exp_c = (i == idx_dst) ? get(a, idx_src) : get(b, i);
+        auto exp_d = (i % 2 == 1) ? 0 : exp_c;
+
+        EXPECT_DOUBLE_EQ(get(c, i), exp_c);
+        EXPECT_DOUBLE_EQ(get(d, i), exp_d);
+    }
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_insert) // NOLINT
+{
+    TYPED_TEST_SERIES(test_insert_test_case, power(num_elements<TypeParam>, 2));
+}
+
+
 // --- test permute ---------------------------------------------------------------------------------------------------
 
 template <typename T_RegisterType>
@@ -363,6 +395,7 @@ template <typename T_RegisterType>
 template <typename T_RegisterType, UST t_index>
 void test_permute_test_case(T_RegisterType a, [[maybe_unused]] T_RegisterType b) // NOLINT - complexity
 {
+    constexpr UST  n_l  = num_lanes<T_RegisterType>;
     constexpr UST  n_le = num_lane_elements<T_RegisterType>;
     constexpr auto v    = get_permute_index_array<T_RegisterType>(t_index);
     auto           c    = mm_setzero<T_RegisterType>();
@@ -375,27 +408,26 @@ void test_permute_test_case(T_RegisterType a, [[maybe_unused]] T_RegisterType b)
 
 
     for (UST i = 0; i < n_le; ++i)
-    {
-        EXPECT_DOUBLE_EQ(get(c, i), get(a, v.at(i)));
-        if constexpr (is_multi_lane<T_RegisterType>)
-        {
-            EXPECT_DOUBLE_EQ(get(c, i + n_le), get(a, v.at(i) + n_le));
-        }
-    }
+        for (UST j = 0; j < n_l; ++j)
+            EXPECT_DOUBLE_EQ(get(c, i + j * n_le), get(a, v.at(i) + j * n_le));
 
 
-    if constexpr (is_avx_register<T_RegisterType>)
+    if constexpr (is_multi_lane<T_RegisterType>)
     {
+        // The pattern of the N-th lane is rotated by N elements
         if constexpr (is_m256d<T_RegisterType>)
             c = permute<v[0], v[1], v[1], v[0]>(a);
-        else
+        else if constexpr (is_m256<T_RegisterType>)
             c = permute<v[0], v[1], v[2], v[3], v[1], v[2], v[3], v[0]>(a);
+        else if constexpr (is_double_precision<T_RegisterType>)
+            c = permute<v[0], v[1], v[1], v[0], v[0], v[1], v[1], v[0]>(a);
+        else
+            c = permute<v[0], v[1], v[2], v[3], v[1], v[2], v[3], v[0], // NOLINT - magic number
+                        v[2], v[3], v[0], v[1], v[3], v[0], v[1], v[2]>(a);
 
         for (UST i = 0; i < n_le; ++i)
-        {
-            EXPECT_DOUBLE_EQ(get(c, i), get(a, v.at(i)));
-            EXPECT_DOUBLE_EQ(get(c, i + n_le), get(a, v.at((i + 1) % n_le) + n_le));
-        }
+            for (UST j = 0; j < n_l; ++j)
+                EXPECT_DOUBLE_EQ(get(c, i + j * n_le), get(a, v.at((i + j) % n_le) + j * n_le));
     }
 }
 
@@ -421,7 +453,9 @@ template <typename T_RegisterType>
         case 2: return IndexArray{{1, 2, 3, 2}};
         case 3: return IndexArray{{3, 0, 1, 2}};
         case 4: return IndexArray{{2, 3, 0, 1}};
-        default: return IndexArray{{3, 1, 0, 0}};
+        case 5: return IndexArray{{3, 1, 0, 0}};
+        case 6: return IndexArray{{1, 0, 3, 2}};
+        default: return IndexArray{{2, 3, 2, 3}};
     }
 }
 
@@ -451,9 +485,53 @@ template <>
         case 2: return IndexArray{{1, 2, 3, 0, 1, 2, 3, 0}};  // NOLINT - magic number
         case 3: return IndexArray{{5, 6, 7, 4, 5, 6, 7, 4}};  // NOLINT - magic number
         case 4: return IndexArray{{1, 6, 4, 3, 2, 0, 7, 5}};  // NOLINT - magic number
-        default: return IndexArray{{5, 7, 6, 4, 1, 0, 3, 2}}; // NOLINT - magic number
+        case 5: return IndexArray{{5, 7, 6, 4, 1, 0, 3, 2}};  // NOLINT - magic number
+        case 6: return IndexArray{{1, 0, 3, 2, 6, 7, 5, 4}};  // NOLINT - magic number
+        default: return IndexArray{{4, 5, 6, 7, 0, 1, 2, 3}}; // NOLINT - magic number
+    }
+}
+
+
+#ifdef MJOLNIR_CORE_ENABLE_AVX512
+template <>
+[[nodiscard]] constexpr auto get_permute_across_lanes_specific_indices<__m512d>(UST index) noexcept
+{
+    constexpr UST n_e = num_elements<__m512d>;
+    using IndexArray  = std::array<U32, n_e>;
+
+    switch (index)
+    {
+        case 0: return IndexArray{{0, 1, 2, 3, 4, 5, 6, 7}};  // NOLINT - magic number
+        case 1: return IndexArray{{7, 6, 5, 4, 3, 2, 1, 0}};  // NOLINT - magic number
+        case 2: return IndexArray{{1, 2, 3, 0, 1, 2, 3, 0}};  // NOLINT - magic number
+        case 3: return IndexArray{{5, 6, 7, 4, 5, 6, 7, 4}};  // NOLINT - magic number
+        case 4: return IndexArray{{1, 6, 4, 3, 2, 0, 7, 5}};  // NOLINT - magic number
+        case 5: return IndexArray{{5, 7, 6, 4, 1, 0, 3, 2}};  // NOLINT - magic number
+        case 6: return IndexArray{{1, 2, 3, 0, 5, 6, 7, 4}};  // NOLINT - magic number
+        default: return IndexArray{{2, 3, 0, 1, 6, 7, 4, 5}}; // NOLINT - magic number
+    }
+}
+
+
+template <>
+[[nodiscard]] constexpr auto get_permute_across_lanes_specific_indices<__m512>(UST index) noexcept
+{
+    constexpr UST n_e = num_elements<__m512>;
+    using IndexArray  = std::array<U32, n_e>;
+
+    switch (index)
+    {
+        case 0: return IndexArray{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};  // NOLINT - magic number
+        case 1: return IndexArray{{15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};  // NOLINT - magic number
+        case 2: return IndexArray{{1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12}};  // NOLINT - magic number
+        case 3: return IndexArray{{12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3}};  // NOLINT - magic number
+        case 4: return IndexArray{{1, 14, 4, 3, 12, 0, 7, 5, 9, 2, 11, 15, 6, 10, 8, 13}};  // NOLINT - magic number
+        case 5: return IndexArray{{5, 7, 6, 4, 1, 0, 3, 2, 5, 15, 15, 9, 0, 12, 3, 3}};     // NOLINT - magic number
+        case 6: return IndexArray{{1, 0, 3, 2, 6, 7, 5, 4, 8, 9, 10, 11, 15, 14, 13, 12}};  // NOLINT - magic number
+        default: return IndexArray{{4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15}};   // NOLINT - magic number
     }
 }
+#endif
 
 
 template <typename T_RegisterType>
@@ -480,12 +558,15 @@ void test_permute_across_lanes_test_case(T_RegisterType a, [[maybe_unused]] T_Re
 
 
     auto c = mm_setzero<T_RegisterType>();
-    if constexpr (is_m128d<T_RegisterType>)
+    if constexpr (n_e == 2)
         c = permute_across_lanes<p[0], p[1]>(a);
-    else if constexpr (! is_m256<T_RegisterType>)
+    else if constexpr (n_e == 4)
         c = permute_across_lanes<p[0], p[1], p[2], p[3]>(a);
-    else
+    else if constexpr (n_e == 8)                                                      // NOLINT - magic number
         c = permute_across_lanes<p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]>(a); // NOLINT - magic number
+    else
+        c = permute_across_lanes<p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], // NOLINT - magic number
+                                 p[8], p[9], p[10], p[11], p[12], p[13], p[14], p[15]>(a);
 
 
     for (UST i = 0; i < n_e; ++i)
@@ -495,7 +576,7 @@ void test_permute_across_lanes_test_case(T_RegisterType a, [[maybe_unused]] T_Re
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_permute_across_lanes) // NOLINT
 {
     [[maybe_unused]] constexpr UST n_e     = num_elements<TypeParam>;
-    [[maybe_unused]] constexpr UST n_extra = is_m128d<TypeParam> ? 2 : 6;
+    [[maybe_unused]] constexpr UST n_extra = is_m128d<TypeParam> ? 2 : 8;
 
     TYPED_TEST_SERIES(test_permute_across_lanes_test_case, n_e + n_extra);
 }
@@ -748,3 +829,136 @@ TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_swap_lanes_if) // NOLINT
         TYPED_TEST_SERIES(test_swap_lanes_if_test_case, 2);
     }
 }
+
+
+// --- test_integer_blend ---------------------------------------------------------------------------------------------
+
+template <typename T_TestCase, auto t_selection>
+void test_integer_blend_test_case()
+{
+    using EType = typename T_TestCase::ElementType;
+
+    auto a = get_integer_test_values<T_TestCase>(1);
+    auto b = get_integer_test_values<T_TestCase>(2);
+
+    auto c = to_element_array<T_TestCase>(
+            [&a, &b]<UST... t_i>(std::index_sequence<t_i...>) {
+                return blend<EType, t_selection[t_i]...>(to_register<T_TestCase>(a), to_register<T_TestCase>(b));
+            }(std::make_index_sequence<T_TestCase::num_elements>()));
+
+    for (UST i = 0; i < a.size(); ++i)
+        EXPECT_EQ(c.at(i), (t_selection.at(i) == 1) ? b.at(i) : a.at(i));
+}
+
+
+template <typename T_TestCase, UST t_divisor>
+[[nodiscard]] consteval auto get_integer_blend_selection() noexcept
+{
+    std::array<UST, T_TestCase::num_elements> selection = {{0}};
+    for (UST i = 0; i < selection.size(); ++i)
+        selection.at(i) = (i % t_divisor == 0) ? 1 : 0;
+    return selection;
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_blend) // NOLINT
+{
+    test_integer_blend_test_case<TypeParam, get_integer_blend_selection<TypeParam, 1>()>();
+    test_integer_blend_test_case<TypeParam, get_integer_blend_selection<TypeParam, 2>()>();
+    test_integer_blend_test_case<TypeParam, get_integer_blend_selection<TypeParam, 3>()>();
+}
+
+
+// --- test_integer_permute -------------------------------------------------------------------------------------------
+
+template <typename T_TestCase, auto t_indices>
+void test_integer_permute_test_case()
+{
+    using EType = typename T_TestCase::ElementType;
+
+    constexpr UST n_le = num_integer_lane_elements<EType, typename T_TestCase::RegisterType>;
+
+    auto a = get_integer_test_values<T_TestCase>(1);
+
+    auto c = to_element_array<T_TestCase>([&a]<UST... t_i>(std::index_sequence<t_i...>) {
+        return permute<EType, t_indices[t_i]...>(to_register<T_TestCase>(a));
+    }(std::make_index_sequence<t_indices.size()>()));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        UST lane_start = i - i % n_le;
+        EXPECT_EQ(c.at(i), a.at(lane_start + t_indices.at(i % t_indices.size())));
+    }
+}
+
+
+template <typename T_TestCase, UST t_num_indices, UST t_factor, UST t_offset>
+[[nodiscard]] consteval auto get_integer_permute_indices() noexcept
+{
+    constexpr UST n_le = num_integer_lane_elements<typename T_TestCase::ElementType, typename T_TestCase::RegisterType>;
+
+    std::array<UST, t_num_indices> indices = {{0}};
+    for (UST i = 0; i < indices.size(); ++i)
+        indices.at(i) = (i * t_factor + t_offset + i / n_le) % n_le;
+    return indices;
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_permute) // NOLINT
+{
+    using RType = typename TypeParam::RegisterType;
+
+    constexpr UST n_e  = TypeParam::num_elements;
+    constexpr UST n_le = num_integer_lane_elements<typename TypeParam::ElementType, RType>;
+
+    test_integer_permute_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_le, 1, 1>()>();
+    test_integer_permute_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_le, n_le - 1, 0>()>();
+    test_integer_permute_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_le, 3, 2>()>();
+
+    if constexpr (num_lanes<RType> > 1)
+    {
+        test_integer_permute_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_e, 1, 1>()>();
+        test_integer_permute_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_e, 3, 0>()>();
+    }
+}
+
+
+// --- test_integer_shuffle -------------------------------------------------------------------------------------------
+
+template <typename T_TestCase, auto t_indices>
+void test_integer_shuffle_test_case()
+{
+    using EType = typename T_TestCase::ElementType;
+
+    constexpr UST n_le = num_integer_lane_elements<EType, typename T_TestCase::RegisterType>;
+
+    auto a = get_integer_test_values<T_TestCase>(1);
+    auto b = get_integer_test_values<T_TestCase>(2);
+
+    auto c = to_element_array<T_TestCase>([&a, &b]<UST... t_i>(std::index_sequence<t_i...>) {
+        return shuffle<EType, t_indices[t_i]...>(to_register<T_TestCase>(a), to_register<T_TestCase>(b));
+    }(std::make_index_sequence<t_indices.size()>()));
+
+    for (UST i = 0; i < a.size(); ++i)
+    {
+        UST lane_start = i - i % n_le;
+        UST idx        = lane_start + t_indices.at(i % t_indices.size());
+        EXPECT_EQ(c.at(i), (i % n_le < n_le / 2) ? a.at(idx) : b.at(idx));
+    }
+}
+
+
+TYPED_TEST(IntegerVectorRegisterTestSuite, test_shuffle) // NOLINT
+{
+    using RType = typename TypeParam::RegisterType;
+
+    constexpr UST n_e  = TypeParam::num_elements;
+    constexpr UST n_le = num_integer_lane_elements<typename TypeParam::ElementType, RType>;
+
+    test_integer_shuffle_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_le, 1, 1>()>();
+    test_integer_shuffle_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_le, n_le - 1, 0>()>();
+    test_integer_shuffle_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_le, 3, 2>()>();
+
+    if constexpr (sizeof(typename TypeParam::ElementType) == 8 && num_lanes<RType> > 1)
+        test_integer_shuffle_test_case<TypeParam, get_integer_permute_indices<TypeParam, n_e, 1, 1>()>();
+}
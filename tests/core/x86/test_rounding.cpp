@@ -0,0 +1,187 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/rounding.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return exactly representable test values that contain ties, negative values, signed zeros and values close to
+//! integers.
+template <typename T_Type>
+[[nodiscard]] constexpr auto get_test_values() noexcept -> std::array<T_Type, 16> // NOLINT - magic number
+{
+    return {{-2.5, -1.5, -0.5, -0., 0., 0.5, 1.5, 2.5, -3.75, 3.75, -0.25, 0.25, 7.9375, -7.9375, 1000.5, -1000.25}};
+}
+
+
+//! Call `function` with registers that are filled with consecutive chunks of the test values and compare each result
+//! element to the result of `reference` for the corresponding value.
+template <FloatVectorRegister T_RegisterType, typename T_Function, typename T_Reference>
+void check_element_wise(T_Function function, T_Reference reference)
+{
+    using EType       = ElementType<T_RegisterType>;
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    constexpr auto values = get_test_values<EType>();
+
+    for (UST i = 0; i < values.size(); i += n_e)
+    {
+        auto src = mm_loadu<T_RegisterType>(&values.at(i));
+        auto res = function(src);
+
+        for (UST j = 0; j < n_e; ++j)
+        {
+            EType exp = reference(values.at(i + j));
+            EXPECT_EQ(get(res, j), exp);
+            EXPECT_EQ(std::signbit(get(res, j)), std::signbit(exp));
+        }
+    }
+}
+
+
+//! Return the 32 bit integer elements of an integer register.
+template <IntegerVectorRegister T_RegisterType>
+[[nodiscard]] auto get_i32_elements(T_RegisterType src) noexcept
+{
+    return std::bit_cast<std::array<I32, sizeof(T_RegisterType) / sizeof(I32)>>(src);
+}
+
+
+//! Check that `convert_to_integer` with the rounding mode `t_mode` yields the same values as `reference`.
+template <RoundingMode t_mode, FloatVectorRegister T_RegisterType, typename T_Reference>
+void check_convert_to_integer(T_Reference reference)
+{
+    using EType       = ElementType<T_RegisterType>;
+    constexpr UST n_e = num_elements<T_RegisterType>;
+
+    constexpr auto values = get_test_values<EType>();
+
+    for (UST i = 0; i < values.size(); i += n_e)
+    {
+        auto res = get_i32_elements(convert_to_integer<t_mode>(mm_loadu<T_RegisterType>(&values.at(i))));
+
+        for (UST j = 0; j < n_e; ++j)
+            EXPECT_EQ(res.at(j), static_cast<I32>(reference(values.at(i + j))));
+
+        // unused upper elements of the integer register must be zero
+        for (UST j = n_e; j < res.size(); ++j)
+            EXPECT_EQ(res.at(j), 0);
+    }
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_round -----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_round) // NOLINT
+{
+    // std::nearbyint uses the default rounding mode, which rounds ties to even
+    check_element_wise<TypeParam>([](auto a) { return round(a); }, [](auto v) { return std::nearbyint(v); });
+    check_element_wise<TypeParam>([](auto a) { return round<RoundingMode::NEAREST>(a); },
+                                  [](auto v) { return std::nearbyint(v); });
+    check_element_wise<TypeParam>([](auto a) { return round<RoundingMode::DOWN>(a); },
+                                  [](auto v) { return std::floor(v); });
+    check_element_wise<TypeParam>([](auto a) { return round<RoundingMode::UP>(a); },
+                                  [](auto v) { return std::ceil(v); });
+    check_element_wise<TypeParam>([](auto a) { return round<RoundingMode::TOWARD_ZERO>(a); },
+                                  [](auto v) { return std::trunc(v); });
+}
+
+
+// --- test_floor_ceil_trunc ------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_floor_ceil_trunc) // NOLINT
+{
+    check_element_wise<TypeParam>([](auto a) { return floor(a); }, [](auto v) { return std::floor(v); });
+    check_element_wise<TypeParam>([](auto a) { return ceil(a); }, [](auto v) { return std::ceil(v); });
+    check_element_wise<TypeParam>([](auto a) { return trunc(a); }, [](auto v) { return std::trunc(v); });
+}
+
+
+// --- test_round_special_values --------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_round_special_values) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+    using Limit = std::numeric_limits<EType>;
+
+    EXPECT_EQ(get(floor(mm_set1<TypeParam>(Limit::infinity())), 0), Limit::infinity());
+    EXPECT_EQ(get(ceil(mm_set1<TypeParam>(-Limit::infinity())), 0), -Limit::infinity());
+    EXPECT_TRUE(std::isnan(get(round(mm_set1<TypeParam>(Limit::quiet_NaN())), 0)));
+    EXPECT_EQ(get(round(mm_set1<TypeParam>(Limit::max())), 0), Limit::max());
+}
+
+
+// --- test_clamp -----------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_clamp) // NOLINT
+{
+    using EType = ElementType<TypeParam>;
+
+    auto lower = mm_set1<TypeParam>(-1);
+    auto upper = mm_set1<TypeParam>(2.5); // NOLINT(readability-magic-numbers)
+
+    check_element_wise<TypeParam>([&](auto a) { return clamp(a, lower, upper); },
+                                  [](auto v) { return std::clamp(v, EType(-1), EType(2.5)); }); // NOLINT
+
+    auto nan = mm_set1<TypeParam>(std::numeric_limits<EType>::quiet_NaN());
+    EXPECT_EQ(get(clamp(nan, lower, upper), 0), EType(-1));
+}
+
+
+// --- test_convert_to_integer ----------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_convert_to_integer) // NOLINT
+{
+    check_convert_to_integer<RoundingMode::NEAREST, TypeParam>([](auto v) { return std::nearbyint(v); });
+    check_convert_to_integer<RoundingMode::DOWN, TypeParam>([](auto v) { return std::floor(v); });
+    check_convert_to_integer<RoundingMode::UP, TypeParam>([](auto v) { return std::ceil(v); });
+    check_convert_to_integer<RoundingMode::TOWARD_ZERO, TypeParam>([](auto v) { return std::trunc(v); });
+
+    using EType = ElementType<TypeParam>;
+    auto res    = get_i32_elements(convert_to_integer(mm_set1<TypeParam>(std::numeric_limits<EType>::quiet_NaN())));
+    EXPECT_EQ(res.at(0), std::numeric_limits<I32>::min());
+}
+
+
+// --- test_convert_to_float ------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_convert_to_float) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    auto src = convert_to_integer(mm_setzero<TypeParam>());
+
+    std::array<I32, sizeof(src) / sizeof(I32)> values = {};
+    for (UST i = 0; i < values.size(); ++i)
+        values.at(i) = (static_cast<I32>(i) - 3) * 1000003; // NOLINT(readability-magic-numbers)
+
+    src      = std::bit_cast<decltype(src)>(values);
+    auto res = convert_to_float<TypeParam>(src);
+
+    for (UST i = 0; i < n_e; ++i)
+        EXPECT_EQ(get(res, i), static_cast<EType>(values.at(i)));
+
+    // round trip
+    auto round_trip = get_i32_elements(convert_to_integer(res));
+    for (UST i = 0; i < n_e; ++i)
+        EXPECT_EQ(round_trip.at(i), static_cast<I32>(static_cast<EType>(values.at(i))));
+}
@@ -27,14 +27,15 @@ using namespace mjolnir::x86;
 
 template <FloatVectorRegister T_RegisterType>
 [[nodiscard]] constexpr auto get_default_test_values() noexcept
-        -> std::array<std::array<ElementType<T_RegisterType>, 8>, 4> // NOLINT - magic number
+        -> std::array<std::array<ElementType<T_RegisterType>, 16>, 4> // NOLINT - magic number
 {
     using EType = ElementType<T_RegisterType>;
 
-    constexpr std::array<std::array<EType, 8>, 4> test_values = {{{{-1, 2, -3, -4, 5, 6, 7, 8}},
-                                                                  {{3, -0, 6, 2, -1, 9, -3, -5}},
-                                                                  {{-3, -1, -3, -5, -6, -2, -0, -1}},
-                                                                  {{6, 2, 5, 5, 1, 0, 6, 3}}}};
+    constexpr std::array<std::array<EType, 16>, 4> test_values = {
+            {{{-1, 2, -3, -4, 5, 6, 7, 8, -9, 4, 1, -2, 0, 3, -7, 5}},
+             {{3, -0, 6, 2, -1, 9, -3, -5, 2, -8, -0, 4, 7, -1, 6, -3}},
+             {{-3, -1, -3, -5, -6, -2, -0, -1, -4, -7, -2, -9, -1, -3, -8, -5}},
+             {{6, 2, 5, 5, 1, 0, 6, 3, 8, 4, 2, 9, 0, 7, 1, 3}}}};
     return test_values;
 }
 
@@ -141,7 +142,7 @@ template <typename T_RegisterType>
 {
     std::array<bool, num_elements<T_RegisterType>> a = {{0}};
     for (UST i = 0; i < a.size(); ++i)
-        a.at(i) = ! is_bit_set(test_case_index, i);
+        a.at(i) = ! is_bit_set(get_element_flag_test_case_bits<T_RegisterType>(test_case_index), i);
     return a;
 }
 
@@ -170,8 +171,11 @@ inline void test_negate_selected_test_case()
             res = negate_selected<b[0], b[1]>(a);
         else if constexpr (n_e == 4)
             res = negate_selected<b[0], b[1], b[2], b[3]>(a);
-        else
+        else if constexpr (n_e == 8)                                                     // NOLINT - magic number
             res = negate_selected<b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]>(a); // NOLINT - magic number
+        else
+            res = negate_selected<b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7], // NOLINT - magic number
+                                  b[8], b[9], b[10], b[11], b[12], b[13], b[14], b[15]>(a);
 
         for (UST j = 0; j < n_e; j++)
         {
@@ -185,7 +189,7 @@ inline void test_negate_selected_test_case()
 
 TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_negate_selected) // NOLINT
 {
-    [[maybe_unused]] constexpr UST n_test_cases = power_of_2(num_elements<TypeParam>);
+    [[maybe_unused]] constexpr UST n_test_cases = get_num_element_flag_test_cases<TypeParam>();
 
     TYPED_TEST_SERIES(test_negate_selected_test_case, n_test_cases);
 }
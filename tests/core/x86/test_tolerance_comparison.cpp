@@ -0,0 +1,122 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/tolerance_comparison.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_is_close_abs ----------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_is_close_abs) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    const EType tolerance = 0.5;
+    const auto  base      = mm_set1<TypeParam>(10);
+
+    EXPECT_TRUE(is_close_abs(base, base));
+    EXPECT_EQ(is_close_abs_mask(base, base), (1U << n_e) - 1U);
+
+    // move one element at a time outside of the tolerance
+    for (UST i = 0; i < n_e; ++i)
+    {
+        auto other = base;
+        set(other, i, EType(10.5));
+        EXPECT_TRUE(is_close_abs(base, other, tolerance));
+
+        set(other, i, EType(9.25));
+        EXPECT_FALSE(is_close_abs(base, other, tolerance));
+        EXPECT_EQ(is_close_abs_mask(base, other, tolerance), ((1U << n_e) - 1U) & ~(1U << i));
+    }
+
+    auto nan = mm_set1<TypeParam>(std::numeric_limits<EType>::quiet_NaN());
+    EXPECT_FALSE(is_close_abs(nan, nan, tolerance));
+    EXPECT_EQ(is_close_abs_mask(base, nan, tolerance), 0U);
+}
+
+
+// --- test_is_close_rel ----------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_is_close_rel) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    const EType tolerance = 0.125;
+    const auto  base      = mm_set1<TypeParam>(-64);
+
+    EXPECT_TRUE(is_close_rel(base, base));
+
+    for (UST i = 0; i < n_e; ++i)
+    {
+        auto other = base;
+
+        // the tolerance is relative to the larger magnitude
+        set(other, i, EType(-56));
+        EXPECT_TRUE(is_close_rel(base, other, tolerance));
+        EXPECT_TRUE(is_close_rel(other, base, tolerance));
+
+        set(other, i, EType(-55));
+        EXPECT_FALSE(is_close_rel(base, other, tolerance));
+        EXPECT_EQ(is_close_rel_mask(base, other, tolerance), ((1U << n_e) - 1U) & ~(1U << i));
+
+        set(other, i, EType(64));
+        EXPECT_FALSE(is_close_rel(base, other, tolerance));
+    }
+
+    auto nan = mm_set1<TypeParam>(std::numeric_limits<EType>::quiet_NaN());
+    EXPECT_EQ(is_close_rel_mask(base, nan, tolerance), 0U);
+}
+
+
+// --- test_array_is_close --------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_array_is_close) // NOLINT
+{
+    using EType       = ElementType<TypeParam>;
+    constexpr UST n_e = num_elements<TypeParam>;
+
+    const EType tolerance = 0.25;
+
+    // sizes that cover full blocks, single registers and scalar remainders
+    for (UST size : {UST(0), UST(1), n_e - 1, n_e, 4 * n_e, 5 * n_e + 3, 13 * n_e + 1})
+    {
+        std::vector<EType> lhs(size);
+        for (UST i = 0; i < size; ++i)
+            lhs[i] = static_cast<EType>(i);
+
+        auto rhs = lhs;
+        for (auto& value : rhs)
+            value += EType(0.125);
+
+        EXPECT_TRUE(array_is_close_abs<TypeParam>(lhs.data(), rhs.data(), size, tolerance));
+
+        // the first element is skipped, because 0 and 0.125 are not relatively close
+        if (size > 1)
+        {
+            EXPECT_TRUE(array_is_close_rel<TypeParam>(&lhs[1], &rhs[1], size - 1, EType(0.5)));
+        }
+
+        // every single element outside of the tolerance must be detected
+        for (UST i = 0; i < size; ++i)
+        {
+            auto modified = rhs;
+            modified[i]   = -modified[i] - EType(1);
+            EXPECT_FALSE(array_is_close_abs<TypeParam>(lhs.data(), modified.data(), size, tolerance));
+            EXPECT_FALSE(array_is_close_rel<TypeParam>(lhs.data(), modified.data(), size, tolerance));
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include "mjolnir/core/fundamental_types.h"
+#include "mjolnir/core/x86/definitions.h"
+#include "mjolnir/core/x86/direct_access.h"
+#include "mjolnir/core/x86/intrinsics.h"
+#include "mjolnir/core/x86/transposition.h"
+#include "mjolnir/testing/x86/floating_point_vector_register_test_suite.h"
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace mjolnir;
+using namespace mjolnir::x86;
+
+
+// ====================================================================================================================
+// Setup
+// ====================================================================================================================
+
+//! Return an array of registers where the element `j` of register `i` has the value `100 * i + j`.
+template <FloatVectorRegister T_RegisterType, UST t_num_registers>
+[[nodiscard]] auto get_test_rows() noexcept -> std::array<T_RegisterType, t_num_registers>
+{
+    using EType = ElementType<T_RegisterType>;
+
+    std::array<T_RegisterType, t_num_registers> rows = {};
+    for (UST i = 0; i < t_num_registers; ++i)
+    {
+        rows.at(i) = mm_setzero<T_RegisterType>();
+        for (UST j = 0; j < num_elements<T_RegisterType>; ++j)
+            set(rows.at(i), j, static_cast<EType>(100 * i + j)); // NOLINT(readability-magic-numbers)
+    }
+    return rows;
+}
+
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+// --- test_aos_to_soa ------------------------------------------------------------------------------------------------
+
+template <FloatVectorRegister T_RegisterType, UST t_num_components>
+void test_aos_soa_conversion_test_case()
+{
+    using EType = ElementType<T_RegisterType>;
+
+    // One full block, one additional lane and a few remaining structures
+    constexpr UST num_structs = 2 * num_elements<T_RegisterType> + num_lane_elements<T_RegisterType> + 3;
+
+    std::vector<EType> aos(num_structs * t_num_components);
+    for (UST i = 0; i < aos.size(); ++i)
+        aos.at(i) = static_cast<EType>(i);
+
+    std::array<std::vector<EType>, t_num_components> soa_data = {};
+    std::array<EType*, t_num_components>             soa      = {};
+    std::array<const EType*, t_num_components>       soa_in   = {};
+    for (UST c = 0; c < t_num_components; ++c)
+    {
+        soa_data.at(c).resize(num_structs, EType(-1));
+        soa.at(c)    = soa_data.at(c).data();
+        soa_in.at(c) = soa_data.at(c).data();
+    }
+
+    aos_to_soa<T_RegisterType, t_num_components>(aos.data(), soa, num_structs);
+
+    for (UST i = 0; i < num_structs; ++i)
+        for (UST c = 0; c < t_num_components; ++c)
+            EXPECT_EQ(soa_data.at(c).at(i), aos.at(i * t_num_components + c));
+
+    std::vector<EType> aos_out(num_structs * t_num_components, EType(-1));
+    soa_to_aos<T_RegisterType, t_num_components>(soa_in, aos_out.data(), num_structs);
+
+    for (UST i = 0; i < aos.size(); ++i)
+        EXPECT_EQ(aos_out.at(i), aos.at(i));
+}
+
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_aos_soa_conversion) // NOLINT
+{
+    if constexpr (! is_avx512_register<TypeParam>)
+    {
+        test_aos_soa_conversion_test_case<TypeParam, 1>();
+        test_aos_soa_conversion_test_case<TypeParam, 2>();
+        if constexpr (is_single_precision<TypeParam>)
+        {
+            test_aos_soa_conversion_test_case<TypeParam, 3>();
+            test_aos_soa_conversion_test_case<TypeParam, 4>();
+        }
+    }
+}
+
+
+// --- test_transpose -------------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_transpose) // NOLINT
+{
+    if constexpr (! is_avx512_register<TypeParam>)
+    {
+        constexpr UST n_e = num_elements<TypeParam>;
+
+        auto rows = get_test_rows<TypeParam, n_e>();
+        auto res  = transpose(rows);
+
+        for (UST i = 0; i < n_e; ++i)
+            for (UST j = 0; j < n_e; ++j)
+                EXPECT_EQ(get(res.at(i), j), get(rows.at(j), i));
+    }
+}
+
+
+// --- test_transpose_lanes -------------------------------------------------------------------------------------------
+
+TYPED_TEST(FloatingPointVectorRegisterTestSuite, test_transpose_lanes) // NOLINT
+{
+    constexpr UST n_e  = num_elements<TypeParam>;
+    constexpr UST n_le = num_lane_elements<TypeParam>;
+
+    auto rows = get_test_rows<TypeParam, n_le>();
+    auto res  = transpose_lanes(rows);
+
+    for (UST i = 0; i < n_le; ++i)
+        for (UST j = 0; j < n_e; ++j)
+        {
+            UST lane_offset = (j / n_le) * n_le;
+            EXPECT_EQ(get(res.at(i), j), get(rows.at(j % n_le), lane_offset + i));
+        }
+}